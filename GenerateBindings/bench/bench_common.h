@@ -0,0 +1,136 @@
+/*
+Helpers shared by the benchmarks in this directory: a monotonic clock and WAV fixtures. Include it after miniaudio, or
+after the source file a benchmark includes, so the ma_ types are defined. Everything is static since each benchmark is
+one translation unit.
+*/
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#define BENCH_WAV_HEADER_SIZE   44
+
+/* Seconds since an arbitrary point. Only differences are meaningful. */
+static double bench_now(void)
+{
+    #if defined(_WIN32)
+    {
+        LARGE_INTEGER counter;
+        LARGE_INTEGER frequency;
+        QueryPerformanceCounter(&counter);
+        QueryPerformanceFrequency(&frequency);
+        return (double)counter.QuadPart / (double)frequency.QuadPart;
+    }
+    #else
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+    }
+    #endif
+}
+
+static ma_uint8* bench_write_u16(ma_uint8* pDst, ma_uint16 value)
+{
+    pDst[0] = (ma_uint8)value;
+    pDst[1] = (ma_uint8)(value >> 8);
+    return pDst + 2;
+}
+
+static ma_uint8* bench_write_u32(ma_uint8* pDst, ma_uint32 value)
+{
+    pDst = bench_write_u16(pDst, (ma_uint16)value);
+    return bench_write_u16(pDst, (ma_uint16)(value >> 16));
+}
+
+/* The canonical 44 byte header for ma_format_s16 or ma_format_f32 samples. Returns the first byte after it. */
+static ma_uint8* bench_write_wav_header(ma_uint8* pDst, ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 frameCount)
+{
+    ma_uint32 bytesPerSample = (format == ma_format_f32) ? 4 : 2;
+    ma_uint32 dataSize = frameCount * channels * bytesPerSample;
+
+    memcpy(pDst, "RIFF", 4); pDst += 4;
+    pDst = bench_write_u32(pDst, 36 + dataSize);
+    memcpy(pDst, "WAVEfmt ", 8); pDst += 8;
+    pDst = bench_write_u32(pDst, 16);
+    pDst = bench_write_u16(pDst, (format == ma_format_f32) ? 3 : 1);   /* IEEE float or PCM */
+    pDst = bench_write_u16(pDst, (ma_uint16)channels);
+    pDst = bench_write_u32(pDst, sampleRate);
+    pDst = bench_write_u32(pDst, sampleRate * channels * bytesPerSample);
+    pDst = bench_write_u16(pDst, (ma_uint16)(channels * bytesPerSample));
+    pDst = bench_write_u16(pDst, (ma_uint16)(bytesPerSample * 8));
+    memcpy(pDst, "data", 4); pDst += 4;
+    pDst = bench_write_u32(pDst, dataSize);
+
+    return pDst;
+}
+
+/*
+A WAV file in memory with the same sawtooth on every channel. The samples start at BENCH_WAV_HEADER_SIZE. Free it with
+free(). Returns NULL if out of memory.
+*/
+static void* bench_make_wav(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 frameCount, size_t* pSize)
+{
+    ma_uint32 bytesPerSample = (format == ma_format_f32) ? 4 : 2;
+    size_t size = BENCH_WAV_HEADER_SIZE + (size_t)frameCount * channels * bytesPerSample;
+    ma_uint8* pWav;
+    ma_uint8* pDst;
+    ma_uint32 iSample;
+
+    pWav = (ma_uint8*)malloc(size);
+    if (pWav == NULL) {
+        return NULL;
+    }
+
+    pDst = bench_write_wav_header(pWav, format, channels, sampleRate, frameCount);
+
+    for (iSample = 0; iSample < frameCount * channels; iSample += 1) {
+        float x = (float)((iSample / channels) % 109) / 109.0f - 0.5f;
+
+        if (format == ma_format_f32) {
+            memcpy(pDst, &x, 4);
+            pDst += 4;
+        } else {
+            pDst = bench_write_u16(pDst, (ma_uint16)(ma_int16)(x * 32767));
+        }
+    }
+
+    *pSize = size;
+    return pWav;
+}
+
+/* bench_make_wav() written to a file. */
+static ma_result bench_write_wav(const char* pFilePath, ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 frameCount)
+{
+    void* pWav;
+    size_t size;
+    FILE* pFile;
+    size_t written;
+
+    pWav = bench_make_wav(format, channels, sampleRate, frameCount, &size);
+    if (pWav == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    pFile = fopen(pFilePath, "wb");
+    if (pFile == NULL) {
+        free(pWav);
+        return MA_ERROR;
+    }
+
+    written = fwrite(pWav, 1, size, pFile);
+    fclose(pFile);
+    free(pWav);
+
+    return (written == size) ? MA_SUCCESS : MA_ERROR;
+}
+
+#endif  /* BENCH_COMMON_H */
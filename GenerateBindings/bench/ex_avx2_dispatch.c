@@ -0,0 +1,245 @@
+/*
+Benchmarks the AVX2 build of miniaudio's decoding path (miniaudio_avx2.c) against the baseline build, and checks that
+miniaudio_ex.c dispatches to it. Each source is decoded in full to stereo f32 at 48kHz with 10ms reads, which takes it
+through the decoder, the format converter and the resampler, using:
+
+    baseline  - ma_decoder_init*() and ma_decoder_read_pcm_frames() from miniaudio.c.
+    avx2      - The same functions from miniaudio_avx2.c, called directly.
+    dispatch  - ma_ex_decoder_init*() and ma_ex_decoder_read_pcm_frames(), whichever build they picked.
+
+Two in-memory WAV files are always run, one at 44.1kHz and one at 48kHz. Any files given on the command line are run as
+well, which is how the other backends are covered. The output of each variant is hashed and compared with the baseline.
+
+Results are written to stdout as JSON. If the CPU has AVX2 and FMA but miniaudio_ex.c didn't pick the AVX2 build, the
+benchmark exits with a non-zero code.
+
+This includes miniaudio_ex.c directly so that it can see which build was picked. The AVX2 build is compiled into the
+benchmark on x86, so this works the same on Windows where the library doesn't export it.
+*/
+#include "../miniaudio_ex.c"
+#include "../miniaudio_libvorbis.h"
+
+#include "bench_common.h"
+
+#define BENCH_SAMPLE_RATE       48000       /* Output. */
+#define BENCH_WAV_SECONDS       30
+#define BENCH_CHUNK_FRAMES      480
+#define BENCH_RUN_COUNT         4           /* The first is hashed, best of the rest. */
+
+typedef struct
+{
+    const char* pName;
+    ma_ex_decoder_init_file_proc onInitFile;
+    ma_ex_decoder_init_memory_proc onInitMemory;
+    ma_ex_decoder_read_pcm_frames_proc onRead;
+} bench_variant;
+
+typedef struct
+{
+    const char* pName;
+    const char* pFilePath;  /* NULL for the in-memory WAV files. */
+    const void* pData;
+    size_t dataSize;
+} bench_source;
+
+/* Uses the ex decoder's init so the dispatch variant goes through the same backend selection as applications do. */
+static ma_result bench_dispatch_init_file(const char* pFilePath, const ma_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    ma_ex_decoder_config config = ma_ex_decoder_config_init(pConfig->format, pConfig->channels, pConfig->sampleRate);
+    config.baseConfig = *pConfig;
+    return ma_ex_decoder_init_file(pFilePath, &config, pDecoder);
+}
+
+static ma_result bench_dispatch_init_memory(const void* pData, size_t dataSize, const ma_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    ma_ex_decoder_config config = ma_ex_decoder_config_init(pConfig->format, pConfig->channels, pConfig->sampleRate);
+    config.baseConfig = *pConfig;
+    return ma_ex_decoder_init_memory(pData, dataSize, &config, pDecoder);
+}
+
+static ma_uint64 bench_hash(ma_uint64 hash, const void* pData, size_t size)
+{
+    const ma_uint8* pBytes = (const ma_uint8*)pData;
+    size_t i;
+
+    for (i = 0; i < size; i += 1) {
+        hash = (hash ^ pBytes[i]) * 0x100000001B3ULL;   /* FNV-1a */
+    }
+
+    return hash;
+}
+
+static ma_result bench_run(const bench_source* pSource, const bench_variant* pVariant, double* pNsPerFrame, ma_uint64* pHash)
+{
+    float frames[BENCH_CHUNK_FRAMES * 2];
+    ma_decoder_config config;
+    double best = 0;
+    ma_uint64 totalFramesRead = 0;
+    ma_uint32 iRun;
+
+    config = ma_decoder_config_init(ma_format_f32, 2, BENCH_SAMPLE_RATE);
+    ma_decoder_config_set_libvorbis_backend(&config);
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        ma_decoder decoder;
+        ma_result result;
+        ma_uint64 hash = 0xCBF29CE484222325ULL;
+        double start;
+        double elapsed;
+
+        if (pSource->pFilePath != NULL) {
+            result = pVariant->onInitFile(pSource->pFilePath, &config, &decoder);
+        } else {
+            result = pVariant->onInitMemory(pSource->pData, pSource->dataSize, &config, &decoder);
+        }
+
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize %s decoder for %s: %d\n", pVariant->pName, pSource->pName, result);
+            return result;
+        }
+
+        totalFramesRead = 0;
+        start = bench_now();
+
+        for (;;) {
+            ma_uint64 framesRead = 0;
+
+            result = pVariant->onRead(&decoder, frames, BENCH_CHUNK_FRAMES, &framesRead);
+            totalFramesRead += framesRead;
+
+            /* Only the first run is hashed, and it isn't timed. */
+            if (iRun == 0) {
+                hash = bench_hash(hash, frames, (size_t)framesRead * 2 * sizeof(float));
+            }
+
+            if (result != MA_SUCCESS || framesRead == 0) {
+                break;
+            }
+        }
+
+        elapsed = bench_now() - start;
+        ma_decoder_uninit(&decoder);
+
+        if (totalFramesRead == 0) {
+            fprintf(stderr, "Nothing decoded from %s\n", pSource->pName);
+            return MA_INVALID_FILE;
+        }
+
+        if (iRun == 0) {
+            *pHash = hash;
+        } else if (iRun == 1 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    *pNsPerFrame = best / totalFramesRead * 1e9;
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    bench_variant variants[3];
+    ma_uint32 variantCount = 0;
+    bench_source sources[64];
+    ma_uint32 sourceCount = 0;
+    ma_bool32 hasAvx2 = MA_FALSE;
+    ma_bool32 isAvx2Dispatched = MA_FALSE;
+    ma_result result = MA_SUCCESS;
+    ma_bool32 isFirstResult = MA_TRUE;
+    ma_uint32 iSource;
+    ma_uint32 iVariant;
+    int iArg;
+
+    ma_ex_init_simd();
+
+    #if defined(MA_EX_HAS_AVX2_BUILD)
+    {
+        hasAvx2 = ma_ex_has_avx2() && ma_ex_has_fma();
+        isAvx2Dispatched = (g_ma_ex_decoder_read_pcm_frames == ma_ex_avx2_decoder_read_pcm_frames);
+    }
+    #endif
+
+    variants[variantCount].pName        = "baseline";
+    variants[variantCount].onInitFile   = ma_decoder_init_file;
+    variants[variantCount].onInitMemory = ma_decoder_init_memory;
+    variants[variantCount].onRead       = ma_decoder_read_pcm_frames;
+    variantCount += 1;
+
+    #if defined(MA_EX_HAS_AVX2_BUILD)
+    if (hasAvx2) {
+        variants[variantCount].pName        = "avx2";
+        variants[variantCount].onInitFile   = ma_ex_avx2_decoder_init_file;
+        variants[variantCount].onInitMemory = ma_ex_avx2_decoder_init_memory;
+        variants[variantCount].onRead       = ma_ex_avx2_decoder_read_pcm_frames;
+        variantCount += 1;
+    }
+    #endif
+
+    variants[variantCount].pName        = "dispatch";
+    variants[variantCount].onInitFile   = bench_dispatch_init_file;
+    variants[variantCount].onInitMemory = bench_dispatch_init_memory;
+    variants[variantCount].onRead       = ma_ex_decoder_read_pcm_frames;
+    variantCount += 1;
+
+    sources[0].pName = "wav_s16_44100";
+    sources[0].pData = bench_make_wav(ma_format_s16, 2, 44100, 44100 * BENCH_WAV_SECONDS, &sources[0].dataSize);
+    sources[1].pName = "wav_s16_48000";
+    sources[1].pData = bench_make_wav(ma_format_s16, 2, 48000, 48000 * BENCH_WAV_SECONDS, &sources[1].dataSize);
+
+    for (iSource = 0; iSource < 2; iSource += 1) {
+        sources[iSource].pFilePath = NULL;
+        if (sources[iSource].pData == NULL) {
+            return 1;
+        }
+    }
+    sourceCount = 2;
+
+    for (iArg = 1; iArg < argc && sourceCount < sizeof(sources) / sizeof(sources[0]); iArg += 1) {
+        sources[sourceCount].pName     = argv[iArg];
+        sources[sourceCount].pFilePath = argv[iArg];
+        sources[sourceCount].pData     = NULL;
+        sources[sourceCount].dataSize  = 0;
+        sourceCount += 1;
+    }
+
+    printf("{\n  \"benchmark\": \"ex_avx2_dispatch\",\n  \"avx2Supported\": %s,\n  \"avx2Dispatched\": %s,\n  \"results\": [\n",
+        hasAvx2 ? "true" : "false", isAvx2Dispatched ? "true" : "false");
+
+    for (iSource = 0; iSource < sourceCount && result == MA_SUCCESS; iSource += 1) {
+        double baselineNsPerFrame = 0;
+        ma_uint64 baselineHash = 0;
+
+        for (iVariant = 0; iVariant < variantCount && result == MA_SUCCESS; iVariant += 1) {
+            double nsPerFrame = 0;
+            ma_uint64 hash = 0;
+
+            result = bench_run(&sources[iSource], &variants[iVariant], &nsPerFrame, &hash);
+            if (result != MA_SUCCESS) {
+                break;
+            }
+
+            if (iVariant == 0) {
+                baselineNsPerFrame = nsPerFrame;
+                baselineHash = hash;
+            }
+
+            printf("%s    { \"source\": \"%s\", \"variant\": \"%s\", \"nsPerFrame\": %.3f, \"speedup\": %.3f, \"matchesBaseline\": %s }",
+                isFirstResult ? "" : ",\n", sources[iSource].pName, variants[iVariant].pName, nsPerFrame, baselineNsPerFrame / nsPerFrame, (hash == baselineHash) ? "true" : "false");
+            isFirstResult = MA_FALSE;
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    for (iSource = 0; iSource < 2; iSource += 1) {
+        free((void*)sources[iSource].pData);
+    }
+
+    if (hasAvx2 && !isAvx2Dispatched) {
+        fprintf(stderr, "The CPU supports AVX2 and FMA but the baseline build was dispatched.\n");
+        return 1;
+    }
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
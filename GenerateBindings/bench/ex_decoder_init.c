@@ -0,0 +1,166 @@
+/*
+Benchmarks opening and closing lots of short files with ma_ex_decoder_init_file() against the previous init path, which
+ran the full upstream init with the output config and then rebuilt the data converter. The files are short mono s16 WAV
+files at 44100 Hz decoded to stereo f32 at 48000 Hz, so the converter does format, channel and rate conversion. Results
+are written to stdout as JSON.
+
+This includes miniaudio_ex.c directly so that it can get at ma_decoder__init_data_converter_ex().
+*/
+#include "../miniaudio_ex.c"
+
+#include "bench_common.h"
+
+#define BENCH_FILE_COUNT        2000
+#define BENCH_FILE_FRAME_COUNT  4410        /* 100ms. */
+#define BENCH_RUN_COUNT         5           /* Best of. */
+
+typedef ma_result (* bench_init_proc)(const char* pFilePath, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
+
+static struct
+{
+    ma_uint64 allocationCount;
+    ma_uint64 freeCount;
+} g_bench;
+
+static void* bench_malloc(size_t sz, void* pUserData)
+{
+    (void)pUserData;
+    g_bench.allocationCount += 1;
+    return malloc(sz);
+}
+
+static void* bench_realloc(void* p, size_t sz, void* pUserData)
+{
+    (void)pUserData;
+    g_bench.allocationCount += 1;
+    return realloc(p, sz);
+}
+
+static void bench_free(void* p, void* pUserData)
+{
+    (void)pUserData;
+    if (p != NULL) {
+        g_bench.freeCount += 1;
+    }
+    free(p);
+}
+
+static void bench_get_file_path(char* pFilePath, size_t filePathCap, const char* pDirectory, ma_uint32 iFile)
+{
+    snprintf(pFilePath, filePathCap, "%s/ex_decoder_init_bench_%u.wav", pDirectory, iFile);
+}
+
+/* The init path from before ma_ex_decoder__get_preinit_config(), kept here as the baseline. */
+static ma_result bench_legacy_init_file(const char* pFilePath, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    ma_result result;
+
+    result = ma_decoder_init_file(pFilePath, &pConfig->baseConfig, pDecoder);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    ma_data_converter_uninit(&pDecoder->converter, &pDecoder->allocationCallbacks);
+    result = ma_decoder__init_data_converter_ex(pDecoder, pConfig);
+    if (result != MA_SUCCESS) {
+        ma_decoder_uninit(pDecoder);
+        return result;
+    }
+
+    return result;
+}
+
+static ma_result bench_run(const char* pName, bench_init_proc onInit, const char* pDirectory, ma_bool32 allowDynamicSampleRate, ma_bool32 isFirstResult)
+{
+    ma_ex_decoder_config config;
+    double best = 0;
+    ma_uint64 allocationsPerOpen = 0;
+    ma_uint32 iRun;
+
+    config = ma_ex_decoder_config_init(ma_format_f32, 2, 48000);
+    config.allowDynamicSampleRate = allowDynamicSampleRate;
+    config.baseConfig.allocationCallbacks.onMalloc  = bench_malloc;
+    config.baseConfig.allocationCallbacks.onRealloc = bench_realloc;
+    config.baseConfig.allocationCallbacks.onFree    = bench_free;
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        double start;
+        double elapsed;
+        ma_uint32 iFile;
+
+        g_bench.allocationCount = 0;
+        g_bench.freeCount = 0;
+
+        start = bench_now();
+
+        for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+            char filePath[1024];
+            ma_decoder decoder;
+            ma_result result;
+
+            bench_get_file_path(filePath, sizeof(filePath), pDirectory, iFile);
+
+            result = onInit(filePath, &config, &decoder);
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to open %s: %d\n", filePath, result);
+                return result;
+            }
+
+            ma_decoder_uninit(&decoder);
+        }
+
+        elapsed = bench_now() - start;
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+
+        allocationsPerOpen = g_bench.allocationCount / BENCH_FILE_COUNT;
+    }
+
+    printf("%s    { \"path\": \"%s\", \"allowDynamicSampleRate\": %s, \"files\": %u, \"usPerOpen\": %.2f, \"allocationsPerOpen\": %u }",
+        isFirstResult ? "" : ",\n", pName, allowDynamicSampleRate ? "true" : "false", BENCH_FILE_COUNT, best / BENCH_FILE_COUNT * 1e6, (ma_uint32)allocationsPerOpen);
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    const char* pDirectory = ".";
+    ma_result result = MA_SUCCESS;
+    ma_uint32 iFile;
+    ma_uint32 iDynamic;
+
+    if (argc > 1) {
+        pDirectory = argv[1];
+    }
+
+    for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+        char filePath[1024];
+
+        bench_get_file_path(filePath, sizeof(filePath), pDirectory, iFile);
+        if (bench_write_wav(filePath, ma_format_s16, 1, 44100, BENCH_FILE_FRAME_COUNT) != MA_SUCCESS) {
+            fprintf(stderr, "Failed to write %s\n", filePath);
+            return 1;
+        }
+    }
+
+    printf("{\n  \"benchmark\": \"ex_decoder_init\",\n  \"results\": [\n");
+
+    for (iDynamic = 0; iDynamic < 2 && result == MA_SUCCESS; iDynamic += 1) {
+        result = bench_run("legacy", bench_legacy_init_file, pDirectory, (ma_bool32)iDynamic, iDynamic == 0);
+        if (result == MA_SUCCESS) {
+            result = bench_run("single_pass", ma_ex_decoder_init_file, pDirectory, (ma_bool32)iDynamic, MA_FALSE);
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+        char filePath[1024];
+
+        bench_get_file_path(filePath, sizeof(filePath), pDirectory, iFile);
+        remove(filePath);
+    }
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+/*
+Benchmarks opening a library of mixed-format files with ma_decoder_init_file() against ma_ex_decoder_init_file(), which
+works out the format from the first few bytes instead of trying backends until one works. Both have the libvorbis
+backend installed, which upstream tries first on every file, and both decode to the backend's native format so the data
+converter has nothing to do. Every file is opened twice per run, once with its real extension and once with a .bin
+extension to show what happens when the extension can't be used either.
+
+The library is written to a scratch directory given as the first argument. Without any other arguments it's all WAV
+files. Any further arguments are FLAC, MP3 or Ogg Vorbis files which are copied into the library in turn with the WAV
+files so the mix of formats is roughly even. Results are written to stdout as JSON.
+*/
+#include "../miniaudio_ex.h"
+#include "../miniaudio_libvorbis.h"
+
+#include "bench_common.h"
+
+#define BENCH_FILE_COUNT        500         /* Per extension. */
+#define BENCH_FILE_FRAME_COUNT  44100       /* 1 second. */
+#define BENCH_RUN_COUNT         3           /* Best of. */
+#define BENCH_MAX_SOURCES       16
+
+typedef ma_result (* bench_init_proc)(const char* pFilePath, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
+
+typedef struct
+{
+    const char* pExtension;
+    void* pData;
+    size_t dataSize;
+} bench_source;
+
+static ma_result bench_write_copy(const char* pFilePath, const bench_source* pSource)
+{
+    FILE* pFile;
+
+    pFile = fopen(pFilePath, "wb");
+    if (pFile == NULL) {
+        return MA_ERROR;
+    }
+
+    fwrite(pSource->pData, 1, pSource->dataSize, pFile);
+    fclose(pFile);
+
+    return MA_SUCCESS;
+}
+
+static ma_result bench_load_source(const char* pFilePath, bench_source* pSource)
+{
+    FILE* pFile;
+    long size;
+
+    pSource->pExtension = strrchr(pFilePath, '.');
+    if (pSource->pExtension == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    pFile = fopen(pFilePath, "rb");
+    if (pFile == NULL) {
+        return MA_DOES_NOT_EXIST;
+    }
+
+    fseek(pFile, 0, SEEK_END);
+    size = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+
+    pSource->pData = malloc(size > 0 ? (size_t)size : 1);
+    if (pSource->pData == NULL) {
+        fclose(pFile);
+        return MA_OUT_OF_MEMORY;
+    }
+
+    pSource->dataSize = fread(pSource->pData, 1, (size_t)size, pFile);
+    fclose(pFile);
+
+    return MA_SUCCESS;
+}
+
+static ma_result bench_upstream_init_file(const char* pFilePath, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    return ma_decoder_init_file(pFilePath, &pConfig->baseConfig, pDecoder);
+}
+
+static ma_result bench_run(const char* pName, bench_init_proc onInit, char** ppFilePaths, const char* pExtensionName, ma_bool32 isFirstResult)
+{
+    ma_ex_decoder_config config;
+    double best = 0;
+    ma_uint32 iRun;
+
+    config = ma_ex_decoder_config_init(ma_format_unknown, 0, 0);
+    ma_decoder_config_set_libvorbis_backend(&config.baseConfig);
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        double start;
+        double elapsed;
+        ma_uint32 iFile;
+
+        start = bench_now();
+
+        for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+            ma_decoder decoder;
+            ma_result result;
+
+            result = onInit(ppFilePaths[iFile], &config, &decoder);
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to open %s: %d\n", ppFilePaths[iFile], result);
+                return result;
+            }
+
+            ma_decoder_uninit(&decoder);
+        }
+
+        elapsed = bench_now() - start;
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    printf("%s    { \"init\": \"%s\", \"extensions\": \"%s\", \"files\": %u, \"usPerOpen\": %.2f }",
+        isFirstResult ? "" : ",\n", pName, pExtensionName, BENCH_FILE_COUNT, best / BENCH_FILE_COUNT * 1e6);
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    static char* ppFilePaths[2][BENCH_FILE_COUNT];  /* Real extensions, then .bin. */
+    static const char* pExtensionNames[2] = { "real", "bin" };
+    bench_source sources[BENCH_MAX_SOURCES];
+    ma_uint32 sourceCount = 0;
+    const char* pDirectory = ".";
+    ma_result result = MA_SUCCESS;
+    ma_uint32 iFile;
+    ma_uint32 iNaming;
+    int iArg;
+
+    if (argc > 1) {
+        pDirectory = argv[1];
+    }
+
+    for (iArg = 2; iArg < argc && sourceCount < BENCH_MAX_SOURCES; iArg += 1) {
+        if (bench_load_source(argv[iArg], &sources[sourceCount]) != MA_SUCCESS) {
+            fprintf(stderr, "Failed to load %s\n", argv[iArg]);
+            return 1;
+        }
+
+        sourceCount += 1;
+    }
+
+    /* Every (sourceCount + 1)th file is a generated WAV. The rest are copies of the sources in turn. */
+    for (iNaming = 0; iNaming < 2; iNaming += 1) {
+        for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+            ma_uint32 iSource = iFile % (sourceCount + 1);
+            const char* pExtension = (iSource == 0) ? ".wav" : sources[iSource - 1].pExtension;
+            size_t filePathCap = strlen(pDirectory) + 64;
+
+            if (iNaming == 1) {
+                pExtension = ".bin";
+            }
+
+            ppFilePaths[iNaming][iFile] = (char*)malloc(filePathCap);
+            if (ppFilePaths[iNaming][iFile] == NULL) {
+                return 1;
+            }
+
+            snprintf(ppFilePaths[iNaming][iFile], filePathCap, "%s/ex_decoder_load_bench_%u%s", pDirectory, iFile, pExtension);
+
+            if (iSource == 0) {
+                result = bench_write_wav(ppFilePaths[iNaming][iFile], ma_format_s16, 2, 44100, BENCH_FILE_FRAME_COUNT);
+            } else {
+                result = bench_write_copy(ppFilePaths[iNaming][iFile], &sources[iSource - 1]);
+            }
+
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to write %s\n", ppFilePaths[iNaming][iFile]);
+                return 1;
+            }
+        }
+    }
+
+    printf("{\n  \"benchmark\": \"ex_decoder_load\",\n  \"results\": [\n");
+
+    for (iNaming = 0; iNaming < 2 && result == MA_SUCCESS; iNaming += 1) {
+        result = bench_run("upstream", bench_upstream_init_file, ppFilePaths[iNaming], pExtensionNames[iNaming], iNaming == 0);
+        if (result == MA_SUCCESS) {
+            result = bench_run("sniffed", ma_ex_decoder_init_file, ppFilePaths[iNaming], pExtensionNames[iNaming], MA_FALSE);
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    for (iNaming = 0; iNaming < 2; iNaming += 1) {
+        for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+            remove(ppFilePaths[iNaming][iFile]);
+            free(ppFilePaths[iNaming][iFile]);
+        }
+    }
+
+    while (sourceCount > 0) {
+        sourceCount -= 1;
+        free(sources[sourceCount].pData);
+    }
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
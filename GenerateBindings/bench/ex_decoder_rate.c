@@ -0,0 +1,121 @@
+/*
+Benchmarks the CPU cost of one decoder stream at playback rates of 1.0x and 1.5x. The source is an in-memory stereo
+f32 WAV at 48000 Hz decoded to the same format, so the data converter has nothing to do but resample. Three setups are
+compared:
+
+    fixed                - allowDynamicSampleRate off. Only run at 1.0x since the rate can't be changed.
+    dynamic              - allowDynamicSampleRate on, rate set on the converter directly.
+    dynamic_passthrough  - allowDynamicSampleRate and preservePassthrough on, rate set with ma_ex_decoder_set_rate_ratio().
+
+Output is read in 10ms chunks like a device callback would. Results are written to stdout as JSON.
+*/
+#include "../miniaudio_ex.h"
+
+#include "bench_common.h"
+
+#define BENCH_SAMPLE_RATE       48000
+#define BENCH_CHANNELS          2
+#define BENCH_OUTPUT_SECONDS    10
+#define BENCH_SOURCE_SECONDS    20          /* Enough input for the output length at 1.5x. */
+#define BENCH_CHUNK_FRAMES      480
+#define BENCH_RUN_COUNT         3           /* Best of. */
+
+static ma_result bench_run(const char* pName, const void* pWav, size_t wavSize, ma_bool32 allowDynamicSampleRate, ma_bool32 preservePassthrough, float ratio, ma_bool32 isFirstResult)
+{
+    static float frames[BENCH_CHUNK_FRAMES * BENCH_CHANNELS];
+    ma_uint64 outputFrameCount = (ma_uint64)BENCH_SAMPLE_RATE * BENCH_OUTPUT_SECONDS;
+    double best = 0;
+    ma_uint32 iRun;
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        ma_ex_decoder_config config;
+        ma_decoder decoder;
+        ma_result result;
+        ma_uint64 totalFramesRead = 0;
+        double start;
+        double elapsed;
+
+        config = ma_ex_decoder_config_init(ma_format_f32, BENCH_CHANNELS, BENCH_SAMPLE_RATE);
+        config.allowDynamicSampleRate = allowDynamicSampleRate;
+        config.preservePassthrough    = preservePassthrough;
+
+        result = ma_ex_decoder_init_memory(pWav, wavSize, &config, &decoder);
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize decoder: %d\n", result);
+            return result;
+        }
+
+        if (allowDynamicSampleRate) {
+            if (preservePassthrough) {
+                result = ma_ex_decoder_set_rate_ratio(&decoder, ratio);
+            } else {
+                result = ma_data_converter_set_rate_ratio(&decoder.converter, ratio);
+            }
+
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to set rate: %d\n", result);
+                ma_decoder_uninit(&decoder);
+                return result;
+            }
+        }
+
+        start = bench_now();
+
+        while (totalFramesRead < outputFrameCount) {
+            ma_uint64 framesRead = 0;
+
+            result = ma_decoder_read_pcm_frames(&decoder, frames, BENCH_CHUNK_FRAMES, &framesRead);
+            totalFramesRead += framesRead;
+
+            if (result != MA_SUCCESS || framesRead == 0) {
+                break;
+            }
+        }
+
+        elapsed = bench_now() - start;
+        ma_decoder_uninit(&decoder);
+
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    printf("%s    { \"setup\": \"%s\", \"rate\": %.2f, \"nsPerFrame\": %.2f, \"cpuPercentPerStream\": %.4f }",
+        isFirstResult ? "" : ",\n", pName, ratio, best / outputFrameCount * 1e9, best / BENCH_OUTPUT_SECONDS * 100);
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    static const float ratios[2] = { 1.0f, 1.5f };
+    void* pWav;
+    size_t wavSize;
+    ma_result result;
+    ma_uint32 iRatio;
+
+    (void)argc;
+    (void)argv;
+
+    pWav = bench_make_wav(ma_format_f32, BENCH_CHANNELS, BENCH_SAMPLE_RATE, BENCH_SAMPLE_RATE * BENCH_SOURCE_SECONDS, &wavSize);
+    if (pWav == NULL) {
+        return 1;
+    }
+
+    printf("{\n  \"benchmark\": \"ex_decoder_rate\",\n  \"results\": [\n");
+
+    result = bench_run("fixed", pWav, wavSize, MA_FALSE, MA_FALSE, 1.0f, MA_TRUE);
+
+    for (iRatio = 0; iRatio < 2 && result == MA_SUCCESS; iRatio += 1) {
+        result = bench_run("dynamic", pWav, wavSize, MA_TRUE, MA_FALSE, ratios[iRatio], MA_FALSE);
+        if (result == MA_SUCCESS) {
+            result = bench_run("dynamic_passthrough", pWav, wavSize, MA_TRUE, MA_TRUE, ratios[iRatio], MA_FALSE);
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    free(pWav);
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+/*
+Benchmarks ma_ex_decoder_read_pcm_frames() against ma_decoder_read_pcm_frames() on the same decoder, decoding to stereo
+f32 at the source's own sample rate. Three in-memory WAV files are always run, one for each fused conversion:
+
+    wav_s16_stereo  - s16 to f32.
+    wav_s16_mono    - s16 mono to f32 stereo.
+    wav_f32_mono    - f32 mono to stereo.
+
+Any files given on the command line are run as well, which is how the other backends are covered. A FLAC file takes
+the s16 paths like WAV. MP3 and Vorbis (through the libvorbis backend) decode to f32, so a mono file takes the f32 mono
+path and a stereo one is a passthrough either way.
+
+Each source is decoded in full with 10ms reads, like a device callback, and with large reads, like a decode-ahead
+buffer. Results are written to stdout as JSON.
+*/
+#include "../miniaudio_ex.h"
+#include "../miniaudio_libvorbis.h"
+
+#include "bench_common.h"
+
+#define BENCH_SAMPLE_RATE       48000
+#define BENCH_WAV_SECONDS       30
+#define BENCH_RUN_COUNT         3           /* Best of. */
+
+typedef ma_result (* bench_read_proc)(ma_decoder* pDecoder, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);
+
+typedef struct
+{
+    const char* pName;
+    const char* pFilePath;  /* NULL for the in-memory WAV files. */
+    const void* pData;
+    size_t dataSize;
+} bench_source;
+
+static ma_result bench_init_decoder(const bench_source* pSource, ma_decoder* pDecoder)
+{
+    ma_ex_decoder_config config;
+
+    config = ma_ex_decoder_config_init(ma_format_f32, 2, 0);
+    ma_decoder_config_set_libvorbis_backend(&config.baseConfig);
+
+    if (pSource->pFilePath != NULL) {
+        return ma_ex_decoder_init_file(pSource->pFilePath, &config, pDecoder);
+    } else {
+        return ma_ex_decoder_init_memory(pSource->pData, pSource->dataSize, &config, pDecoder);
+    }
+}
+
+static ma_result bench_run(const bench_source* pSource, const char* pPathName, bench_read_proc onRead, ma_uint32 chunkFrameCount, ma_bool32 isFirstResult)
+{
+    float* pFrames;
+    double best = 0;
+    ma_uint64 totalFramesRead = 0;
+    ma_format nativeFormat = ma_format_unknown;
+    ma_uint32 nativeChannels = 0;
+    ma_uint32 iRun;
+
+    pFrames = (float*)malloc(chunkFrameCount * 2 * sizeof(float));
+    if (pFrames == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        ma_decoder decoder;
+        ma_result result;
+        double start;
+        double elapsed;
+
+        result = bench_init_decoder(pSource, &decoder);
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize decoder for %s: %d\n", pSource->pName, result);
+            free(pFrames);
+            return result;
+        }
+
+        ma_data_source_get_data_format(decoder.pBackend, &nativeFormat, &nativeChannels, NULL, NULL, 0);
+        totalFramesRead = 0;
+
+        start = bench_now();
+
+        for (;;) {
+            ma_uint64 framesRead = 0;
+
+            result = onRead(&decoder, pFrames, chunkFrameCount, &framesRead);
+            totalFramesRead += framesRead;
+
+            if (result != MA_SUCCESS || framesRead == 0) {
+                break;
+            }
+        }
+
+        elapsed = bench_now() - start;
+        ma_decoder_uninit(&decoder);
+
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    free(pFrames);
+
+    if (totalFramesRead == 0) {
+        fprintf(stderr, "Nothing decoded from %s\n", pSource->pName);
+        return MA_INVALID_FILE;
+    }
+
+    printf("%s    { \"source\": \"%s\", \"nativeFormat\": \"%s\", \"nativeChannels\": %u, \"path\": \"%s\", \"chunkFrames\": %u, \"nsPerFrame\": %.3f }",
+        isFirstResult ? "" : ",\n", pSource->pName, ma_get_format_name(nativeFormat), nativeChannels, pPathName, chunkFrameCount, best / totalFramesRead * 1e9);
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    static const ma_uint32 chunkFrameCounts[] = { 480, 16384 };
+    bench_source sources[64];
+    ma_uint32 sourceCount = 0;
+    ma_result result = MA_SUCCESS;
+    ma_bool32 isFirstResult = MA_TRUE;
+    ma_uint32 iSource;
+    ma_uint32 iChunk;
+    int iArg;
+
+    sources[0].pName = "wav_s16_stereo";
+    sources[0].pData = bench_make_wav(ma_format_s16, 2, BENCH_SAMPLE_RATE, BENCH_SAMPLE_RATE * BENCH_WAV_SECONDS, &sources[0].dataSize);
+    sources[1].pName = "wav_s16_mono";
+    sources[1].pData = bench_make_wav(ma_format_s16, 1, BENCH_SAMPLE_RATE, BENCH_SAMPLE_RATE * BENCH_WAV_SECONDS, &sources[1].dataSize);
+    sources[2].pName = "wav_f32_mono";
+    sources[2].pData = bench_make_wav(ma_format_f32, 1, BENCH_SAMPLE_RATE, BENCH_SAMPLE_RATE * BENCH_WAV_SECONDS, &sources[2].dataSize);
+
+    for (iSource = 0; iSource < 3; iSource += 1) {
+        sources[iSource].pFilePath = NULL;
+        if (sources[iSource].pData == NULL) {
+            return 1;
+        }
+    }
+    sourceCount = 3;
+
+    for (iArg = 1; iArg < argc && sourceCount < sizeof(sources) / sizeof(sources[0]); iArg += 1) {
+        sources[sourceCount].pName     = argv[iArg];
+        sources[sourceCount].pFilePath = argv[iArg];
+        sources[sourceCount].pData     = NULL;
+        sources[sourceCount].dataSize  = 0;
+        sourceCount += 1;
+    }
+
+    printf("{\n  \"benchmark\": \"ex_decoder_read\",\n  \"results\": [\n");
+
+    for (iSource = 0; iSource < sourceCount && result == MA_SUCCESS; iSource += 1) {
+        for (iChunk = 0; iChunk < sizeof(chunkFrameCounts) / sizeof(chunkFrameCounts[0]) && result == MA_SUCCESS; iChunk += 1) {
+            result = bench_run(&sources[iSource], "upstream", ma_decoder_read_pcm_frames, chunkFrameCounts[iChunk], isFirstResult);
+            isFirstResult = MA_FALSE;
+
+            if (result == MA_SUCCESS) {
+                result = bench_run(&sources[iSource], "fused", ma_ex_decoder_read_pcm_frames, chunkFrameCounts[iChunk], MA_FALSE);
+            }
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    for (iSource = 0; iSource < 3; iSource += 1) {
+        free((void*)sources[iSource].pData);
+    }
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+/*
+Stress test of ma_ex_pool against the allocator for the objects it pools. Every run keeps a set of live objects and
+repeatedly frees a random one and allocates a replacement, which is what creating and destroying sounds over a session
+looks like to the allocator:
+
+    churn        - Allocate and free only, touching the first cache line of each slot. One thread, then BENCH_THREAD_COUNT
+                   threads sharing one pool, or the allocator, at once.
+    soundGroups  - ma_sound_group_init() and ma_sound_group_uninit() on an engine without a device, so the cost of
+                   zeroing and setting up several KB of ma_sound is included.
+
+The allocator is ma_malloc() with default callbacks, which is what NativeMemory.Alloc() ends up in on most platforms.
+Results are written to stdout as JSON. nsPerPair is the time for one free plus one allocation. slotBytes and poolBytes
+are the pool's slot size and everything it has reserved at the end of the run.
+*/
+#include "../miniaudio_ex.h"
+
+#include "bench_common.h"
+
+#if !defined(_WIN32)
+    #include <pthread.h>
+#endif
+
+#define BENCH_LIVE_COUNT            4096
+#define BENCH_CHURN_COUNT           2000000
+#define BENCH_THREAD_COUNT          4
+#define BENCH_SOUND_LIVE_COUNT      1024
+#define BENCH_SOUND_CHURN_COUNT     100000
+
+typedef struct
+{
+    ma_ex_pool* pPool;              /* NULL to use ma_malloc(). */
+    ma_ex_pool_object object;
+    ma_uint32 seed;
+    double seconds;
+} bench_churn_job;
+
+static const char* g_objectNames[ma_ex_pool_object_count] = { "sound", "decoder", "resourceManagerDataSource", "audioBuffer" };
+
+static ma_uint32 bench_rand(ma_uint32* pState)
+{
+    /* xorshift32. */
+    ma_uint32 x = *pState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *pState = x;
+    return x;
+}
+
+static void* bench_alloc(ma_ex_pool* pPool, ma_ex_pool_object object)
+{
+    if (pPool != NULL) {
+        return ma_ex_pool_alloc(pPool, object);
+    } else {
+        return ma_malloc(ma_ex_pool_get_slot_size(object), NULL);
+    }
+}
+
+static void bench_free(ma_ex_pool* pPool, ma_ex_pool_object object, void* p)
+{
+    if (pPool != NULL) {
+        ma_ex_pool_free(pPool, object, p);
+    } else {
+        ma_free(p, NULL);
+    }
+}
+
+static void bench_churn(bench_churn_job* pJob)
+{
+    void* pLive[BENCH_LIVE_COUNT];
+    ma_uint32 seed = pJob->seed;
+    double start;
+    ma_uint32 i;
+
+    for (i = 0; i < BENCH_LIVE_COUNT; i += 1) {
+        pLive[i] = bench_alloc(pJob->pPool, pJob->object);
+        memset(pLive[i], 0, 64);
+    }
+
+    start = bench_now();
+    for (i = 0; i < BENCH_CHURN_COUNT; i += 1) {
+        ma_uint32 index = bench_rand(&seed) % BENCH_LIVE_COUNT;
+
+        bench_free(pJob->pPool, pJob->object, pLive[index]);
+        pLive[index] = bench_alloc(pJob->pPool, pJob->object);
+        memset(pLive[index], (int)i, 64);
+    }
+    pJob->seconds = bench_now() - start;
+
+    for (i = 0; i < BENCH_LIVE_COUNT; i += 1) {
+        bench_free(pJob->pPool, pJob->object, pLive[i]);
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI bench_churn_thread(LPVOID pUserData)
+{
+    bench_churn((bench_churn_job*)pUserData);
+    return 0;
+}
+#else
+static void* bench_churn_thread(void* pUserData)
+{
+    bench_churn((bench_churn_job*)pUserData);
+    return NULL;
+}
+#endif
+
+/* Runs a churn job on each thread at once. Returns the mean time per pair across all of them. */
+static double bench_churn_threaded(ma_ex_pool* pPool, ma_ex_pool_object object)
+{
+    bench_churn_job jobs[BENCH_THREAD_COUNT];
+    double seconds = 0;
+    ma_uint32 i;
+
+    #if defined(_WIN32)
+        HANDLE threads[BENCH_THREAD_COUNT];
+    #else
+        pthread_t threads[BENCH_THREAD_COUNT];
+    #endif
+
+    for (i = 0; i < BENCH_THREAD_COUNT; i += 1) {
+        jobs[i].pPool   = pPool;
+        jobs[i].object  = object;
+        jobs[i].seed    = 0x9E3779B9u * (i + 1);
+        jobs[i].seconds = 0;
+
+        #if defined(_WIN32)
+            threads[i] = CreateThread(NULL, 0, bench_churn_thread, &jobs[i], 0, NULL);
+        #else
+            pthread_create(&threads[i], NULL, bench_churn_thread, &jobs[i]);
+        #endif
+    }
+
+    for (i = 0; i < BENCH_THREAD_COUNT; i += 1) {
+        #if defined(_WIN32)
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+        #else
+            pthread_join(threads[i], NULL);
+        #endif
+
+        seconds += jobs[i].seconds;
+    }
+
+    return seconds / BENCH_THREAD_COUNT / BENCH_CHURN_COUNT * 1e9;
+}
+
+static double bench_churn_single(ma_ex_pool* pPool, ma_ex_pool_object object)
+{
+    bench_churn_job job;
+
+    job.pPool   = pPool;
+    job.object  = object;
+    job.seed    = 0x9E3779B9u;
+    job.seconds = 0;
+
+    bench_churn(&job);
+
+    return job.seconds / BENCH_CHURN_COUNT * 1e9;
+}
+
+static ma_uint64 bench_get_pool_bytes(ma_ex_pool* pPool, ma_ex_pool_object object)
+{
+    ma_uint32 slotCount;
+
+    ma_ex_pool_get_stats(pPool, object, NULL, &slotCount);
+
+    return (ma_uint64)slotCount * ma_ex_pool_get_slot_size(object) + (ma_uint64)pPool->classes[object].slabCount * 64;
+}
+
+static ma_result bench_sound_groups(ma_engine* pEngine, ma_ex_pool* pPool, double* pNsPerPair)
+{
+    ma_sound* pLive[BENCH_SOUND_LIVE_COUNT];
+    ma_uint32 seed = 0x9E3779B9u;
+    ma_result result = MA_SUCCESS;
+    double start;
+    ma_uint32 i;
+
+    for (i = 0; i < BENCH_SOUND_LIVE_COUNT; i += 1) {
+        pLive[i] = NULL;
+    }
+
+    for (i = 0; i < BENCH_SOUND_LIVE_COUNT && result == MA_SUCCESS; i += 1) {
+        pLive[i] = (ma_sound*)bench_alloc(pPool, ma_ex_pool_object_sound);
+        result = ma_sound_group_init(pEngine, 0, NULL, pLive[i]);
+        if (result != MA_SUCCESS) {
+            bench_free(pPool, ma_ex_pool_object_sound, pLive[i]);
+            pLive[i] = NULL;
+        }
+    }
+
+    start = bench_now();
+    for (i = 0; i < BENCH_SOUND_CHURN_COUNT && result == MA_SUCCESS; i += 1) {
+        ma_uint32 index = bench_rand(&seed) % BENCH_SOUND_LIVE_COUNT;
+
+        ma_sound_group_uninit(pLive[index]);
+        bench_free(pPool, ma_ex_pool_object_sound, pLive[index]);
+
+        pLive[index] = (ma_sound*)bench_alloc(pPool, ma_ex_pool_object_sound);
+        result = ma_sound_group_init(pEngine, 0, NULL, pLive[index]);
+        if (result != MA_SUCCESS) {
+            bench_free(pPool, ma_ex_pool_object_sound, pLive[index]);
+            pLive[index] = NULL;
+        }
+    }
+    *pNsPerPair = (bench_now() - start) / BENCH_SOUND_CHURN_COUNT * 1e9;
+
+    for (i = 0; i < BENCH_SOUND_LIVE_COUNT; i += 1) {
+        if (pLive[i] != NULL) {
+            ma_sound_group_uninit(pLive[i]);
+            bench_free(pPool, ma_ex_pool_object_sound, pLive[i]);
+        }
+    }
+
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    ma_ex_pool_config poolConfig;
+    ma_ex_pool pool;
+    ma_engine_config engineConfig;
+    ma_engine engine;
+    ma_result result;
+    double mallocNs;
+    double poolNs;
+    ma_uint32 iObject;
+
+    (void)argc;
+    (void)argv;
+
+    poolConfig = ma_ex_pool_config_init();
+
+    result = ma_ex_pool_init(&poolConfig, &pool);
+    if (result != MA_SUCCESS) {
+        fprintf(stderr, "Failed to initialize pool: %d\n", result);
+        return 1;
+    }
+
+    printf("{\n  \"benchmark\": \"ex_pool\",\n  \"liveCount\": %d,\n  \"threadCount\": %d,\n  \"churn\": [\n", BENCH_LIVE_COUNT, BENCH_THREAD_COUNT);
+
+    for (iObject = 0; iObject < ma_ex_pool_object_count; iObject += 1) {
+        ma_ex_pool_object object = (ma_ex_pool_object)iObject;
+        double mallocThreadedNs;
+        double poolThreadedNs;
+
+        mallocNs         = bench_churn_single(NULL, object);
+        poolNs           = bench_churn_single(&pool, object);
+        mallocThreadedNs = bench_churn_threaded(NULL, object);
+        poolThreadedNs   = bench_churn_threaded(&pool, object);
+
+        printf("    { \"object\": \"%s\", \"slotBytes\": %u, \"poolBytes\": %llu, \"mallocNsPerPair\": %.1f, \"poolNsPerPair\": %.1f, \"mallocThreadedNsPerPair\": %.1f, \"poolThreadedNsPerPair\": %.1f }%s\n",
+            g_objectNames[iObject], (unsigned int)ma_ex_pool_get_slot_size(object), (unsigned long long)bench_get_pool_bytes(&pool, object),
+            mallocNs, poolNs, mallocThreadedNs, poolThreadedNs, (iObject + 1 < ma_ex_pool_object_count) ? "," : "");
+    }
+
+    printf("  ],\n");
+
+    engineConfig = ma_engine_config_init();
+    engineConfig.noDevice   = MA_TRUE;
+    engineConfig.channels   = 2;
+    engineConfig.sampleRate = 48000;
+
+    result = ma_engine_init(&engineConfig, &engine);
+    if (result == MA_SUCCESS) {
+        result = bench_sound_groups(&engine, NULL, &mallocNs);
+        if (result == MA_SUCCESS) {
+            result = bench_sound_groups(&engine, &pool, &poolNs);
+        }
+
+        ma_engine_uninit(&engine);
+    }
+
+    if (result == MA_SUCCESS) {
+        printf("  \"soundGroups\": { \"liveCount\": %d, \"mallocNsPerPair\": %.1f, \"poolNsPerPair\": %.1f }\n}\n", BENCH_SOUND_LIVE_COUNT, mallocNs, poolNs);
+    } else {
+        printf("  \"soundGroups\": null\n}\n");
+        fprintf(stderr, "Sound group churn failed: %d\n", result);
+    }
+
+    ma_ex_pool_uninit(&pool);
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1,261 @@
+/*
+Benchmarks reading the format and length of a library of files with ma_ex_probe_files() against opening each one with
+ma_decoder_init_file() and asking the decoder. Four setups are compared:
+
+    decoder          - ma_decoder_init_file(), ma_decoder_get_data_format() and ma_decoder_get_length_in_pcm_frames().
+    probe_exact      - ma_ex_probe_files() on the calling thread with exact lengths.
+    probe_estimate   - ma_ex_probe_files() on the calling thread with estimated lengths.
+    probe_threaded   - ma_ex_probe_files() with estimated lengths, spread across the job threads of a resource manager.
+
+The library is written to a scratch directory given as the first argument. Without any other arguments it's all WAV
+files. Any further arguments are FLAC, MP3 or Ogg Vorbis files which are copied into the library in turn with the WAV
+files so the mix of formats is roughly even. Ogg Vorbis goes through the libvorbis backend. Results are written to
+stdout as JSON.
+*/
+#include "../miniaudio_ex.h"
+#include "../miniaudio_libvorbis.h"
+
+#include "bench_common.h"
+
+#define BENCH_FILE_COUNT        2000
+#define BENCH_FILE_FRAME_COUNT  44100       /* 1 second. Only the headers are read by the probes. */
+#define BENCH_JOB_THREAD_COUNT  7
+#define BENCH_RUN_COUNT         3           /* Best of. */
+#define BENCH_MAX_SOURCES       16
+
+typedef struct
+{
+    const char* pExtension;
+    void* pData;
+    size_t dataSize;
+} bench_source;
+
+static ma_result bench_write_copy(const char* pFilePath, const bench_source* pSource)
+{
+    FILE* pFile;
+
+    pFile = fopen(pFilePath, "wb");
+    if (pFile == NULL) {
+        return MA_ERROR;
+    }
+
+    fwrite(pSource->pData, 1, pSource->dataSize, pFile);
+    fclose(pFile);
+
+    return MA_SUCCESS;
+}
+
+static ma_result bench_load_source(const char* pFilePath, bench_source* pSource)
+{
+    FILE* pFile;
+    long size;
+
+    pSource->pExtension = strrchr(pFilePath, '.');
+    if (pSource->pExtension == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    pFile = fopen(pFilePath, "rb");
+    if (pFile == NULL) {
+        return MA_DOES_NOT_EXIST;
+    }
+
+    fseek(pFile, 0, SEEK_END);
+    size = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+
+    pSource->pData = malloc(size > 0 ? (size_t)size : 1);
+    if (pSource->pData == NULL) {
+        fclose(pFile);
+        return MA_OUT_OF_MEMORY;
+    }
+
+    pSource->dataSize = fread(pSource->pData, 1, (size_t)size, pFile);
+    fclose(pFile);
+
+    return MA_SUCCESS;
+}
+
+static ma_result bench_run_decoder(char** ppFilePaths, ma_bool32 isFirstResult)
+{
+    ma_decoder_config config;
+    double best = 0;
+    ma_uint32 iRun;
+
+    config = ma_decoder_config_init(ma_format_unknown, 0, 0);
+    ma_decoder_config_set_libvorbis_backend(&config);
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        double start;
+        double elapsed;
+        ma_uint32 iFile;
+
+        start = bench_now();
+
+        for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+            ma_decoder decoder;
+            ma_format format;
+            ma_uint32 channels;
+            ma_uint32 sampleRate;
+            ma_uint64 length;
+            ma_result result;
+
+            result = ma_decoder_init_file(ppFilePaths[iFile], &config, &decoder);
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to open %s: %d\n", ppFilePaths[iFile], result);
+                return result;
+            }
+
+            ma_decoder_get_data_format(&decoder, &format, &channels, &sampleRate, NULL, 0);
+            ma_decoder_get_length_in_pcm_frames(&decoder, &length);
+            ma_decoder_uninit(&decoder);
+        }
+
+        elapsed = bench_now() - start;
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    printf("%s    { \"setup\": \"decoder\", \"files\": %u, \"usPerFile\": %.2f, \"secondsPer50kFiles\": %.2f }",
+        isFirstResult ? "" : ",\n", BENCH_FILE_COUNT, best / BENCH_FILE_COUNT * 1e6, best / BENCH_FILE_COUNT * 50000);
+
+    return MA_SUCCESS;
+}
+
+static ma_result bench_run_probe(const char* pName, char** ppFilePaths, ma_bool32 estimateLength, ma_resource_manager* pResourceManager, ma_bool32 isFirstResult)
+{
+    static ma_ex_probe_info infos[BENCH_FILE_COUNT];
+    ma_decoding_backend_vtable* pCustomBackendVTables[1];
+    ma_ex_probe_config config;
+    double best = 0;
+    ma_uint32 iRun;
+    ma_uint32 iFile;
+
+    pCustomBackendVTables[0] = ma_decoding_backend_libvorbis_get_vtable();
+
+    config = ma_ex_probe_config_init(pResourceManager);
+    config.estimateLength         = estimateLength;
+    config.ppCustomBackendVTables = pCustomBackendVTables;
+    config.customBackendCount     = 1;
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        double start;
+        double elapsed;
+        ma_result result;
+
+        start = bench_now();
+        result = ma_ex_probe_files((const char**)ppFilePaths, BENCH_FILE_COUNT, &config, infos);
+        elapsed = bench_now() - start;
+
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to probe: %d\n", result);
+            return result;
+        }
+
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+        if (infos[iFile].result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to probe %s: %d\n", ppFilePaths[iFile], infos[iFile].result);
+            return infos[iFile].result;
+        }
+    }
+
+    printf("%s    { \"setup\": \"%s\", \"files\": %u, \"usPerFile\": %.2f, \"secondsPer50kFiles\": %.2f }",
+        isFirstResult ? "" : ",\n", pName, BENCH_FILE_COUNT, best / BENCH_FILE_COUNT * 1e6, best / BENCH_FILE_COUNT * 50000);
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    static char* ppFilePaths[BENCH_FILE_COUNT];
+    bench_source sources[BENCH_MAX_SOURCES];
+    ma_uint32 sourceCount = 0;
+    const char* pDirectory = ".";
+    ma_resource_manager_config resourceManagerConfig;
+    ma_resource_manager resourceManager;
+    ma_result result = MA_SUCCESS;
+    ma_uint32 iFile;
+    int iArg;
+
+    if (argc > 1) {
+        pDirectory = argv[1];
+    }
+
+    for (iArg = 2; iArg < argc && sourceCount < BENCH_MAX_SOURCES; iArg += 1) {
+        if (bench_load_source(argv[iArg], &sources[sourceCount]) != MA_SUCCESS) {
+            fprintf(stderr, "Failed to load %s\n", argv[iArg]);
+            return 1;
+        }
+
+        sourceCount += 1;
+    }
+
+    /* Every (sourceCount + 1)th file is a generated WAV. The rest are copies of the sources in turn. */
+    for (iFile = 0; iFile < BENCH_FILE_COUNT && result == MA_SUCCESS; iFile += 1) {
+        ma_uint32 iSource = iFile % (sourceCount + 1);
+        const char* pExtension = (iSource == 0) ? ".wav" : sources[iSource - 1].pExtension;
+        size_t filePathCap = strlen(pDirectory) + 64;
+
+        ppFilePaths[iFile] = (char*)malloc(filePathCap);
+        if (ppFilePaths[iFile] == NULL) {
+            return 1;
+        }
+
+        snprintf(ppFilePaths[iFile], filePathCap, "%s/ex_probe_bench_%u%s", pDirectory, iFile, pExtension);
+
+        if (iSource == 0) {
+            result = bench_write_wav(ppFilePaths[iFile], ma_format_s16, 2, 44100, BENCH_FILE_FRAME_COUNT);
+        } else {
+            result = bench_write_copy(ppFilePaths[iFile], &sources[iSource - 1]);
+        }
+
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to write %s\n", ppFilePaths[iFile]);
+            return 1;
+        }
+    }
+
+    resourceManagerConfig = ma_resource_manager_config_init();
+    resourceManagerConfig.jobThreadCount = BENCH_JOB_THREAD_COUNT;
+
+    result = ma_resource_manager_init(&resourceManagerConfig, &resourceManager);
+    if (result != MA_SUCCESS) {
+        fprintf(stderr, "Failed to initialize resource manager: %d\n", result);
+        return 1;
+    }
+
+    printf("{\n  \"benchmark\": \"ex_probe\",\n  \"results\": [\n");
+
+    result = bench_run_decoder(ppFilePaths, MA_TRUE);
+    if (result == MA_SUCCESS) {
+        result = bench_run_probe("probe_exact", ppFilePaths, MA_FALSE, NULL, MA_FALSE);
+    }
+    if (result == MA_SUCCESS) {
+        result = bench_run_probe("probe_estimate", ppFilePaths, MA_TRUE, NULL, MA_FALSE);
+    }
+    if (result == MA_SUCCESS) {
+        result = bench_run_probe("probe_threaded", ppFilePaths, MA_TRUE, &resourceManager, MA_FALSE);
+    }
+
+    printf("\n  ]\n}\n");
+
+    ma_resource_manager_uninit(&resourceManager);
+
+    for (iFile = 0; iFile < BENCH_FILE_COUNT; iFile += 1) {
+        remove(ppFilePaths[iFile]);
+        free(ppFilePaths[iFile]);
+    }
+
+    while (sourceCount > 0) {
+        sourceCount -= 1;
+        free(sources[sourceCount].pData);
+    }
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
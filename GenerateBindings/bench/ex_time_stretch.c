@@ -0,0 +1,145 @@
+/*
+Benchmarks the CPU cost of one time stretched stream at tempos from 0.5x to 2.0x. The source is an in-memory stereo f32
+WAV at 48000 Hz read through a decoder, with a ma_ex_time_stretch on top. The decoder on its own is included as the
+baseline, so the cost of the stretch is the difference.
+
+Output is read in 10ms chunks like a device callback would. Results are written to stdout as JSON.
+*/
+#include "../miniaudio_ex.h"
+
+#include "bench_common.h"
+#include <math.h>
+
+#define BENCH_SAMPLE_RATE       48000
+#define BENCH_CHANNELS          2
+#define BENCH_OUTPUT_SECONDS    10
+#define BENCH_SOURCE_SECONDS    25          /* Enough input for the output length at 2.0x. */
+#define BENCH_CHUNK_FRAMES      480
+#define BENCH_RUN_COUNT         3           /* Best of. */
+#define BENCH_TWO_PI            6.283185307179586
+
+/* The shared WAV with its sawtooth replaced by a chord with a slow tremolo, so the correlation search has something to find. */
+static void* bench_make_chord_wav(size_t* pSize)
+{
+    ma_uint32 frameCount = BENCH_SAMPLE_RATE * BENCH_SOURCE_SECONDS;
+    ma_uint8* pWav;
+    float* pSamples;
+    ma_uint32 iSample;
+
+    pWav = (ma_uint8*)bench_make_wav(ma_format_f32, BENCH_CHANNELS, BENCH_SAMPLE_RATE, frameCount, pSize);
+    if (pWav == NULL) {
+        return NULL;
+    }
+
+    pSamples = (float*)(pWav + BENCH_WAV_HEADER_SIZE);
+    for (iSample = 0; iSample < frameCount * BENCH_CHANNELS; iSample += 1) {
+        double t = BENCH_TWO_PI * (iSample / BENCH_CHANNELS) / BENCH_SAMPLE_RATE;
+        double tremolo = 0.75 + 0.25 * sin(3 * t);
+        pSamples[iSample] = (float)(tremolo * (0.3 * sin(220 * t) + 0.2 * sin(277.18 * t) + 0.1 * sin(329.63 * t + (iSample % BENCH_CHANNELS))));
+    }
+
+    return pWav;
+}
+
+static ma_result bench_run(const char* pName, const void* pWav, size_t wavSize, ma_bool32 isStretched, float tempo, ma_bool32 isFirstResult)
+{
+    static float frames[BENCH_CHUNK_FRAMES * BENCH_CHANNELS];
+    ma_uint64 outputFrameCount = (ma_uint64)BENCH_SAMPLE_RATE * BENCH_OUTPUT_SECONDS;
+    double best = 0;
+    ma_uint32 iRun;
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        ma_decoder_config decoderConfig;
+        ma_decoder decoder;
+        ma_ex_time_stretch_config timeStretchConfig;
+        ma_ex_time_stretch timeStretch;
+        ma_data_source* pDataSource;
+        ma_result result;
+        ma_uint64 totalFramesRead = 0;
+        double start;
+        double elapsed;
+
+        decoderConfig = ma_decoder_config_init(ma_format_f32, BENCH_CHANNELS, BENCH_SAMPLE_RATE);
+
+        result = ma_decoder_init_memory(pWav, wavSize, &decoderConfig, &decoder);
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize decoder: %d\n", result);
+            return result;
+        }
+
+        pDataSource = &decoder;
+
+        if (isStretched) {
+            timeStretchConfig = ma_ex_time_stretch_config_init(&decoder, tempo);
+
+            result = ma_ex_time_stretch_init(&timeStretchConfig, NULL, &timeStretch);
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to initialize time stretch: %d\n", result);
+                ma_decoder_uninit(&decoder);
+                return result;
+            }
+
+            pDataSource = &timeStretch;
+        }
+
+        start = bench_now();
+
+        while (totalFramesRead < outputFrameCount) {
+            ma_uint64 framesRead = 0;
+
+            result = ma_data_source_read_pcm_frames(pDataSource, frames, BENCH_CHUNK_FRAMES, &framesRead);
+            totalFramesRead += framesRead;
+
+            if (result != MA_SUCCESS || framesRead == 0) {
+                break;
+            }
+        }
+
+        elapsed = bench_now() - start;
+
+        if (isStretched) {
+            ma_ex_time_stretch_uninit(&timeStretch, NULL);
+        }
+        ma_decoder_uninit(&decoder);
+
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    printf("%s    { \"setup\": \"%s\", \"tempo\": %.2f, \"nsPerFrame\": %.2f, \"cpuPercentPerStream\": %.4f }",
+        isFirstResult ? "" : ",\n", pName, tempo, best / outputFrameCount * 1e9, best / BENCH_OUTPUT_SECONDS * 100);
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    static const float tempos[] = { 0.5f, 0.75f, 1.0f, 1.25f, 1.5f, 2.0f };
+    void* pWav;
+    size_t wavSize;
+    ma_result result;
+    ma_uint32 iTempo;
+
+    (void)argc;
+    (void)argv;
+
+    pWav = bench_make_chord_wav(&wavSize);
+    if (pWav == NULL) {
+        return 1;
+    }
+
+    printf("{\n  \"benchmark\": \"ex_time_stretch\",\n  \"results\": [\n");
+
+    result = bench_run("decoder", pWav, wavSize, MA_FALSE, 1.0f, MA_TRUE);
+
+    for (iTempo = 0; iTempo < sizeof(tempos) / sizeof(tempos[0]) && result == MA_SUCCESS; iTempo += 1) {
+        result = bench_run("time_stretch", pWav, wavSize, MA_TRUE, tempos[iTempo], MA_FALSE);
+    }
+
+    printf("\n  ]\n}\n");
+
+    free(pWav);
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+/*
+Compares the full library against miniaudio_headless on binary size, load time and ma_engine_init() latency. Takes the
+paths of the two libraries as arguments. Both are loaded at runtime rather than linked so that neither is already
+mapped when its load time is measured.
+
+    sizeBytes     - Size of the library file.
+    firstLoadUs   - The first dlopen() or LoadLibrary() in this process, which includes any page cache misses.
+    loadUs        - Mean of repeated load and unload cycles. Includes relocations and library constructors.
+    engineInitUs  - Mean of repeated ma_engine_init() and ma_engine_uninit() cycles with noDevice, as used for offline
+                    rendering with ma_engine_read_pcm_frames().
+
+Results are written to stdout as JSON.
+*/
+#include "../miniaudio/miniaudio.h"
+
+#include "bench_common.h"
+#include <stddef.h>
+
+#if !defined(_WIN32)
+    #include <dlfcn.h>
+#endif
+
+#define BENCH_LOAD_COUNT        50
+#define BENCH_ENGINE_INIT_COUNT 50
+
+/*
+The headless build has MA_NO_DEVICE_IO, which removes the device fields from ma_engine_config. This is compiled against
+the full header, so the config is treated as bytes and the fields after the device fields are moved back by their size
+when the library is headless. Both layouts are returned through a hidden pointer, so the full size is always enough.
+*/
+typedef struct
+{
+    ma_uint8 bytes[sizeof(ma_engine_config)];
+} bench_engine_config;
+
+typedef bench_engine_config (* bench_engine_config_init_proc)(void);
+typedef ma_result (* bench_engine_init_proc)(const bench_engine_config* pConfig, ma_engine* pEngine);
+typedef void (* bench_engine_uninit_proc)(ma_engine* pEngine);
+
+static void* bench_load(const char* pFilePath)
+{
+    #if defined(_WIN32)
+        return (void*)LoadLibraryA(pFilePath);
+    #else
+        return dlopen(pFilePath, RTLD_NOW | RTLD_LOCAL);
+    #endif
+}
+
+static void bench_unload(void* pLibrary)
+{
+    #if defined(_WIN32)
+        FreeLibrary((HMODULE)pLibrary);
+    #else
+        dlclose(pLibrary);
+    #endif
+}
+
+static void* bench_get_proc(void* pLibrary, const char* pName)
+{
+    #if defined(_WIN32)
+        return (void*)GetProcAddress((HMODULE)pLibrary, pName);
+    #else
+        return dlsym(pLibrary, pName);
+    #endif
+}
+
+static long bench_get_file_size(const char* pFilePath)
+{
+    FILE* pFile;
+    long size;
+
+    pFile = fopen(pFilePath, "rb");
+    if (pFile == NULL) {
+        return -1;
+    }
+
+    fseek(pFile, 0, SEEK_END);
+    size = ftell(pFile);
+    fclose(pFile);
+
+    return size;
+}
+
+static void bench_set_u32(bench_engine_config* pConfig, size_t offset, ma_uint32 value)
+{
+    memcpy(pConfig->bytes + offset, &value, sizeof(value));
+}
+
+static ma_result bench_run(const char* pName, const char* pFilePath, ma_bool32 isFirstResult)
+{
+    void* pLibrary;
+    bench_engine_config_init_proc onEngineConfigInit;
+    bench_engine_init_proc onEngineInit;
+    bench_engine_uninit_proc onEngineUninit;
+    bench_engine_config config;
+    ma_engine* pEngine;
+    ma_bool32 isHeadless;
+    size_t deviceFieldsSize = 0;
+    double start;
+    double firstLoad;
+    double load = 0;
+    double engineInit = 0;
+    ma_uint32 i;
+
+    start = bench_now();
+    pLibrary = bench_load(pFilePath);
+    firstLoad = bench_now() - start;
+
+    if (pLibrary == NULL) {
+        fprintf(stderr, "Failed to load %s\n", pFilePath);
+        return MA_ERROR;
+    }
+    bench_unload(pLibrary);
+
+    for (i = 0; i < BENCH_LOAD_COUNT; i += 1) {
+        start = bench_now();
+        pLibrary = bench_load(pFilePath);
+        load += bench_now() - start;
+
+        if (pLibrary == NULL) {
+            return MA_ERROR;
+        }
+
+        bench_unload(pLibrary);
+    }
+
+    /* Keep it loaded for the engine. */
+    pLibrary = bench_load(pFilePath);
+    if (pLibrary == NULL) {
+        return MA_ERROR;
+    }
+
+    onEngineConfigInit = (bench_engine_config_init_proc)bench_get_proc(pLibrary, "ma_engine_config_init");
+    onEngineInit       = (bench_engine_init_proc)bench_get_proc(pLibrary, "ma_engine_init");
+    onEngineUninit     = (bench_engine_uninit_proc)bench_get_proc(pLibrary, "ma_engine_uninit");
+    isHeadless         = bench_get_proc(pLibrary, "ma_device_init") == NULL;
+
+    if (onEngineConfigInit == NULL || onEngineInit == NULL || onEngineUninit == NULL) {
+        fprintf(stderr, "%s has no engine\n", pFilePath);
+        bench_unload(pLibrary);
+        return MA_ERROR;
+    }
+
+    if (isHeadless) {
+        deviceFieldsSize = offsetof(ma_engine_config, pLog) - offsetof(ma_engine_config, pContext);
+    }
+
+    config = onEngineConfigInit();
+    bench_set_u32(&config, offsetof(ma_engine_config, channels)   - deviceFieldsSize, 2);
+    bench_set_u32(&config, offsetof(ma_engine_config, sampleRate) - deviceFieldsSize, 48000);
+    bench_set_u32(&config, offsetof(ma_engine_config, noDevice)   - deviceFieldsSize, MA_TRUE);
+
+    pEngine = (ma_engine*)malloc(sizeof(*pEngine));     /* The full layout is the larger one. */
+    if (pEngine == NULL) {
+        bench_unload(pLibrary);
+        return MA_OUT_OF_MEMORY;
+    }
+
+    for (i = 0; i < BENCH_ENGINE_INIT_COUNT; i += 1) {
+        ma_result result;
+
+        start = bench_now();
+        result = onEngineInit(&config, pEngine);
+        engineInit += bench_now() - start;
+
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize engine with %s: %d\n", pFilePath, result);
+            free(pEngine);
+            bench_unload(pLibrary);
+            return result;
+        }
+
+        onEngineUninit(pEngine);
+    }
+
+    free(pEngine);
+    bench_unload(pLibrary);
+
+    printf("%s    { \"library\": \"%s\", \"headless\": %s, \"sizeBytes\": %ld, \"firstLoadUs\": %.1f, \"loadUs\": %.1f, \"engineInitUs\": %.1f }",
+        isFirstResult ? "" : ",\n", pName, isHeadless ? "true" : "false", bench_get_file_size(pFilePath),
+        firstLoad * 1e6, load / BENCH_LOAD_COUNT * 1e6, engineInit / BENCH_ENGINE_INIT_COUNT * 1e6);
+
+    return MA_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    ma_result result;
+
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <full library> <headless library>\n", argv[0]);
+        return 1;
+    }
+
+    printf("{\n  \"benchmark\": \"headless_load\",\n  \"results\": [\n");
+
+    result = bench_run("full", argv[1], MA_TRUE);
+    if (result == MA_SUCCESS) {
+        result = bench_run("headless", argv[2], MA_FALSE);
+    }
+
+    printf("\n  ]\n}\n");
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
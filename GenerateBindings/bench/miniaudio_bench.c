@@ -0,0 +1,940 @@
+/*
+Benchmark suite for the native library as a whole, meant to be run after bumping the miniaudio submodule and compared
+against the previous run. It doesn't need an audio device. It has four sections:
+
+    decode           - Decoding each source in full to its native format, one result per codec.
+    conversion       - ma_resampler and ma_data_converter on generated audio, for the conversions decoders and sounds
+                       commonly need.
+    mixing           - ma_engine_read_pcm_frames() on an engine without a device, against the number of playing sounds,
+                       with and without spatialization.
+    resourceManager  - How long ma_resource_manager_data_source_init() takes for each source, fully decoded and
+                       streamed.
+    vorbisThreads    - ma_libvorbis_decode_memory() on each Ogg Vorbis source with threadCount going from 1 to
+                       BENCH_MAX_DECODE_THREADS, and whether the output matches the single threaded decode.
+    vorbisMemory     - ma_libvorbis_init_memory() against ma_libvorbis_init() on read/seek/tell callbacks over the same
+                       memory, each followed by decoding up to BENCH_CORPUS_DECODE_FRAMES. The corpus is up to
+                       BENCH_CORPUS_COUNT separate copies of the Ogg Vorbis sources, like a large set of resident
+                       keysounds.
+    vorbisOpen       - Time to the first frame of each Ogg Vorbis file, from ma_libvorbis_init_file_lazy() against
+                       ma_libvorbis_init_file() with its end of file scan, each followed by one period's read.
+
+A 10 second WAV file is generated in a scratch directory given as the first argument, which defaults to the current
+directory. Any further arguments are FLAC, MP3 or Ogg Vorbis files to cover those codecs, the codec being worked out from
+the file contents. Ogg Vorbis goes through the libvorbis backend. Results are written to stdout as JSON.
+*/
+#include "../miniaudio_ex.h"
+#include "../miniaudio_libvorbis.h"
+
+#include "bench_common.h"
+
+#define BENCH_SAMPLE_RATE       48000
+#define BENCH_CHANNELS          2
+#define BENCH_WAV_SAMPLE_RATE   44100
+#define BENCH_WAV_SECONDS       10
+#define BENCH_CONVERT_SECONDS   10
+#define BENCH_MIX_SECONDS       5
+#define BENCH_PERIOD_FRAMES     480         /* 10ms, like a device callback. */
+#define BENCH_LOAD_COUNT        20
+#define BENCH_RUN_COUNT         3           /* Best of. */
+#define BENCH_MAX_SOURCES       16
+
+#ifndef BENCH_MAX_DECODE_THREADS
+#define BENCH_MAX_DECODE_THREADS 8          /* Including the calling thread. The resource manager gets one job thread less. */
+#endif
+#define BENCH_CORPUS_COUNT          1024
+#define BENCH_CORPUS_MAX_BYTES      (256 * 1024 * 1024)
+#define BENCH_CORPUS_DECODE_FRAMES  48000
+
+typedef struct
+{
+    const char* pName;
+    const char* pFilePath;
+    const char* pCodec;
+} bench_source;
+
+static ma_bool32 g_isFirstResult;
+
+static void bench_begin_section(const char* pName, ma_bool32 isFirstSection)
+{
+    printf("%s  \"%s\": [\n", isFirstSection ? "" : "\n  ],\n", pName);
+    g_isFirstResult = MA_TRUE;
+}
+
+static void bench_begin_result(void)
+{
+    printf("%s    { ", g_isFirstResult ? "" : ",\n");
+    g_isFirstResult = MA_FALSE;
+}
+
+static const char* bench_get_codec_name(ma_encoding_format encodingFormat)
+{
+    switch (encodingFormat)
+    {
+        case ma_encoding_format_wav:    return "wav";
+        case ma_encoding_format_flac:   return "flac";
+        case ma_encoding_format_mp3:    return "mp3";
+        case ma_encoding_format_vorbis: return "vorbis";
+        default:                        return "unknown";
+    }
+}
+
+/* A sawtooth in any format supported by the converters. The content doesn't matter, but silence could be special cased. */
+static void* bench_make_frames(ma_format format, ma_uint32 channels, ma_uint64 frameCount)
+{
+    ma_uint64 sampleCount = frameCount * channels;
+    ma_uint64 iSample;
+    void* pFrames;
+
+    pFrames = malloc((size_t)(sampleCount * ma_get_bytes_per_sample(format)));
+    if (pFrames == NULL) {
+        return NULL;
+    }
+
+    for (iSample = 0; iSample < sampleCount; iSample += 1) {
+        float x = (float)((iSample / channels) % 109) / 109.0f - 0.5f;
+
+        if (format == ma_format_f32) {
+            ((float*)pFrames)[iSample] = x;
+        } else {
+            ((ma_int16*)pFrames)[iSample] = (ma_int16)(x * 32767);
+        }
+    }
+
+    return pFrames;
+}
+
+
+/*
+Decode
+*/
+static ma_result bench_run_decode(const bench_source* pSource)
+{
+    ma_decoder_config config;
+    float* pFrames;
+    double best = 0;
+    ma_uint64 totalFramesRead = 0;
+    ma_format format = ma_format_unknown;
+    ma_uint32 channels = 0;
+    ma_uint32 sampleRate = 0;
+    ma_uint32 iRun;
+
+    /* Native format, so the decoder's converter is a passthrough and this is only the codec. */
+    config = ma_decoder_config_init(ma_format_unknown, 0, 0);
+    ma_decoder_config_set_libvorbis_backend(&config);
+
+    pFrames = (float*)malloc(4096 * MA_MAX_CHANNELS * sizeof(float));
+    if (pFrames == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        ma_decoder decoder;
+        ma_result result;
+        double start;
+        double elapsed;
+
+        result = ma_decoder_init_file(pSource->pFilePath, &config, &decoder);
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to open %s: %d\n", pSource->pFilePath, result);
+            free(pFrames);
+            return result;
+        }
+
+        ma_decoder_get_data_format(&decoder, &format, &channels, &sampleRate, NULL, 0);
+        totalFramesRead = 0;
+
+        start = bench_now();
+
+        for (;;) {
+            ma_uint64 framesRead = 0;
+
+            result = ma_decoder_read_pcm_frames(&decoder, pFrames, 4096, &framesRead);
+            totalFramesRead += framesRead;
+
+            if (result != MA_SUCCESS || framesRead == 0) {
+                break;
+            }
+        }
+
+        elapsed = bench_now() - start;
+        ma_decoder_uninit(&decoder);
+
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    free(pFrames);
+
+    if (totalFramesRead == 0 || sampleRate == 0) {
+        fprintf(stderr, "Nothing decoded from %s\n", pSource->pFilePath);
+        return MA_INVALID_FILE;
+    }
+
+    bench_begin_result();
+    printf("\"codec\": \"%s\", \"source\": \"%s\", \"format\": \"%s\", \"channels\": %u, \"sampleRate\": %u, \"nsPerFrame\": %.3f, \"xRealtime\": %.1f }",
+        pSource->pCodec, pSource->pName, ma_get_format_name(format), channels, sampleRate, best / totalFramesRead * 1e9, (double)totalFramesRead / sampleRate / best);
+
+    return MA_SUCCESS;
+}
+
+
+/*
+Conversion
+*/
+typedef struct
+{
+    const char* pName;
+    ma_bool32 isResampler;      /* ma_resampler rather than ma_data_converter. Only uses the input side of the formats. */
+    ma_format formatIn;
+    ma_format formatOut;
+    ma_uint32 channelsIn;
+    ma_uint32 channelsOut;
+    ma_uint32 sampleRateIn;
+    ma_uint32 sampleRateOut;
+} bench_conversion;
+
+static ma_result bench_process(const bench_conversion* pConversion, void* pConverter, const void* pFramesIn, ma_uint64* pFrameCountIn, void* pFramesOut, ma_uint64* pFrameCountOut)
+{
+    if (pConversion->isResampler) {
+        return ma_resampler_process_pcm_frames((ma_resampler*)pConverter, pFramesIn, pFrameCountIn, pFramesOut, pFrameCountOut);
+    } else {
+        return ma_data_converter_process_pcm_frames((ma_data_converter*)pConverter, pFramesIn, pFrameCountIn, pFramesOut, pFrameCountOut);
+    }
+}
+
+static ma_result bench_run_conversion(const bench_conversion* pConversion)
+{
+    ma_uint64 frameCountIn = (ma_uint64)pConversion->sampleRateIn * BENCH_CONVERT_SECONDS;
+    ma_uint32 bytesPerFrameIn = ma_get_bytes_per_frame(pConversion->formatIn, pConversion->channelsIn);
+    ma_uint32 bytesPerFrameOut = ma_get_bytes_per_frame(pConversion->formatOut, pConversion->channelsOut);
+    ma_uint64 periodFrameCountOut = 4096;
+    void* pFramesIn;
+    void* pFramesOut;
+    double best = 0;
+    ma_uint32 iRun;
+
+    pFramesIn  = bench_make_frames(pConversion->formatIn, pConversion->channelsIn, frameCountIn);
+    pFramesOut = malloc((size_t)(periodFrameCountOut * bytesPerFrameOut));
+    if (pFramesIn == NULL || pFramesOut == NULL) {
+        free(pFramesIn);
+        free(pFramesOut);
+        return MA_OUT_OF_MEMORY;
+    }
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        ma_resampler resampler;
+        ma_data_converter converter;
+        void* pConverter;
+        ma_uint64 totalFramesProcessed = 0;
+        ma_result result;
+        double start;
+        double elapsed;
+
+        if (pConversion->isResampler) {
+            ma_resampler_config config = ma_resampler_config_init(pConversion->formatIn, pConversion->channelsIn, pConversion->sampleRateIn, pConversion->sampleRateOut, ma_resample_algorithm_linear);
+            result = ma_resampler_init(&config, NULL, &resampler);
+            pConverter = &resampler;
+        } else {
+            ma_data_converter_config config = ma_data_converter_config_init(pConversion->formatIn, pConversion->formatOut, pConversion->channelsIn, pConversion->channelsOut, pConversion->sampleRateIn, pConversion->sampleRateOut);
+            result = ma_data_converter_init(&config, NULL, &converter);
+            pConverter = &converter;
+        }
+
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize %s: %d\n", pConversion->pName, result);
+            free(pFramesIn);
+            free(pFramesOut);
+            return result;
+        }
+
+        start = bench_now();
+
+        while (totalFramesProcessed < frameCountIn) {
+            ma_uint64 framesIn  = frameCountIn - totalFramesProcessed;
+            ma_uint64 framesOut = periodFrameCountOut;
+
+            result = bench_process(pConversion, pConverter, (const ma_uint8*)pFramesIn + totalFramesProcessed*bytesPerFrameIn, &framesIn, pFramesOut, &framesOut);
+            if (result != MA_SUCCESS || framesIn == 0) {
+                break;
+            }
+
+            totalFramesProcessed += framesIn;
+        }
+
+        elapsed = bench_now() - start;
+
+        if (pConversion->isResampler) {
+            ma_resampler_uninit(&resampler, NULL);
+        } else {
+            ma_data_converter_uninit(&converter, NULL);
+        }
+
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    free(pFramesIn);
+    free(pFramesOut);
+
+    bench_begin_result();
+    printf("\"conversion\": \"%s\", \"nsPerFrameIn\": %.3f, \"xRealtime\": %.1f }",
+        pConversion->pName, best / frameCountIn * 1e9, (double)BENCH_CONVERT_SECONDS / best);
+
+    return MA_SUCCESS;
+}
+
+
+/*
+Mixing
+*/
+static ma_result bench_run_mixing(ma_uint32 voiceCount, ma_bool32 isSpatialized, const float* pVoiceFrames, ma_uint64 voiceFrameCount)
+{
+    ma_engine_config engineConfig;
+    ma_engine engine;
+    ma_audio_buffer* pBuffers;
+    ma_sound* pSounds;
+    float frames[BENCH_PERIOD_FRAMES * BENCH_CHANNELS];
+    ma_uint64 frameCount = (ma_uint64)BENCH_SAMPLE_RATE * BENCH_MIX_SECONDS;
+    ma_uint32 flags = isSpatialized ? 0 : MA_SOUND_FLAG_NO_SPATIALIZATION;
+    ma_uint32 voicesInitialized = 0;
+    double best = 0;
+    ma_result result;
+    ma_uint32 iRun;
+    ma_uint32 iVoice;
+
+    engineConfig = ma_engine_config_init();
+    engineConfig.noDevice   = MA_TRUE;
+    engineConfig.channels   = BENCH_CHANNELS;
+    engineConfig.sampleRate = BENCH_SAMPLE_RATE;
+
+    result = ma_engine_init(&engineConfig, &engine);
+    if (result != MA_SUCCESS) {
+        fprintf(stderr, "Failed to initialize engine: %d\n", result);
+        return result;
+    }
+
+    pBuffers = (ma_audio_buffer*)calloc(voiceCount, sizeof(*pBuffers));
+    pSounds  = (ma_sound*)calloc(voiceCount, sizeof(*pSounds));
+    if (pBuffers == NULL || pSounds == NULL) {
+        result = MA_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* Every sound has its own buffer over the same frames so no two sounds share a cursor. */
+    for (iVoice = 0; iVoice < voiceCount; iVoice += 1) {
+        ma_audio_buffer_config bufferConfig = ma_audio_buffer_config_init(ma_format_f32, BENCH_CHANNELS, voiceFrameCount, pVoiceFrames, NULL);
+        bufferConfig.sampleRate = BENCH_SAMPLE_RATE;
+
+        result = ma_audio_buffer_init(&bufferConfig, &pBuffers[iVoice]);
+        if (result != MA_SUCCESS) {
+            goto done;
+        }
+
+        result = ma_sound_init_from_data_source(&engine, &pBuffers[iVoice], flags, NULL, &pSounds[iVoice]);
+        if (result != MA_SUCCESS) {
+            ma_audio_buffer_uninit(&pBuffers[iVoice]);
+            goto done;
+        }
+
+        voicesInitialized += 1;
+
+        if (isSpatialized) {
+            ma_sound_set_position(&pSounds[iVoice], (float)(iVoice % 7) - 3, 0, (float)(iVoice % 5) - 2);
+        }
+
+        ma_sound_set_looping(&pSounds[iVoice], MA_TRUE);
+        ma_sound_start(&pSounds[iVoice]);
+    }
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        ma_uint64 totalFramesRead = 0;
+        double start;
+        double elapsed;
+
+        start = bench_now();
+
+        while (totalFramesRead < frameCount) {
+            ma_uint64 framesRead = 0;
+
+            result = ma_engine_read_pcm_frames(&engine, frames, BENCH_PERIOD_FRAMES, &framesRead);
+            if (result != MA_SUCCESS || framesRead == 0) {
+                break;
+            }
+
+            totalFramesRead += framesRead;
+        }
+
+        elapsed = bench_now() - start;
+
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    bench_begin_result();
+    printf("\"voices\": %u, \"spatialized\": %s, \"nsPerFrame\": %.3f, \"nsPerVoiceFrame\": %.3f, \"cpuPercent\": %.3f }",
+        voiceCount, isSpatialized ? "true" : "false", best / frameCount * 1e9, best / frameCount / voiceCount * 1e9, best / BENCH_MIX_SECONDS * 100);
+
+    result = MA_SUCCESS;
+
+done:
+    for (iVoice = 0; iVoice < voicesInitialized; iVoice += 1) {
+        ma_sound_uninit(&pSounds[iVoice]);
+        ma_audio_buffer_uninit(&pBuffers[iVoice]);
+    }
+
+    free(pSounds);
+    free(pBuffers);
+    ma_engine_uninit(&engine);
+
+    if (result != MA_SUCCESS) {
+        fprintf(stderr, "Failed to set up %u voices: %d\n", voiceCount, result);
+    }
+
+    return result;
+}
+
+
+/*
+Resource manager
+*/
+static ma_result bench_run_load(ma_resource_manager* pResourceManager, const bench_source* pSource, const char* pMode, ma_uint32 flags)
+{
+    double total = 0;
+    double worst = 0;
+    ma_uint32 iLoad;
+
+    for (iLoad = 0; iLoad < BENCH_LOAD_COUNT; iLoad += 1) {
+        ma_resource_manager_data_source dataSource;
+        ma_result result;
+        double start;
+        double elapsed;
+
+        start = bench_now();
+        result = ma_resource_manager_data_source_init(pResourceManager, pSource->pFilePath, flags, NULL, &dataSource);
+        elapsed = bench_now() - start;
+
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to load %s: %d\n", pSource->pFilePath, result);
+            return result;
+        }
+
+        /* Nothing else holds a reference, so this releases the decoded data and the next load starts from scratch. */
+        ma_resource_manager_data_source_uninit(&dataSource);
+
+        total += elapsed;
+        if (elapsed > worst) {
+            worst = elapsed;
+        }
+    }
+
+    bench_begin_result();
+    printf("\"codec\": \"%s\", \"source\": \"%s\", \"mode\": \"%s\", \"loads\": %u, \"usMean\": %.1f, \"usMax\": %.1f }",
+        pSource->pCodec, pSource->pName, pMode, BENCH_LOAD_COUNT, total / BENCH_LOAD_COUNT * 1e6, worst * 1e6);
+
+    return MA_SUCCESS;
+}
+
+
+/*
+Vorbis decode threads
+*/
+static ma_result bench_run_vorbis_threads(ma_resource_manager* pResourceManager, const bench_source* pSource, const void* pData, size_t dataSize)
+{
+    void* pSerialFrames = NULL;
+    ma_uint64 serialFrameCount = 0;
+    double serialBest = 0;
+    ma_result result = MA_SUCCESS;
+    ma_uint32 threadCount;
+
+    for (threadCount = 1; threadCount <= BENCH_MAX_DECODE_THREADS && result == MA_SUCCESS; threadCount += 1) {
+        ma_libvorbis_decode_config config;
+        ma_bool32 isIdentical = MA_TRUE;
+        double best = 0;
+        ma_uint32 iRun;
+
+        config = ma_libvorbis_decode_config_init(ma_format_f32, pResourceManager);
+        config.threadCount = threadCount;
+
+        for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+            void* pFrames;
+            ma_uint64 frameCount;
+            double start;
+            double elapsed;
+
+            start = bench_now();
+            result = ma_libvorbis_decode_memory(pData, dataSize, &config, NULL, &frameCount, &pFrames);
+            elapsed = bench_now() - start;
+
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to decode %s on %u threads: %d\n", pSource->pFilePath, threadCount, result);
+                break;
+            }
+
+            /* The first decode is on one thread and everything after is compared with it. */
+            if (pSerialFrames == NULL) {
+                pSerialFrames    = pFrames;
+                serialFrameCount = frameCount;
+            } else {
+                if (frameCount != serialFrameCount || memcmp(pFrames, pSerialFrames, (size_t)(frameCount * ma_get_bytes_per_frame(config.format, config.channels))) != 0) {
+                    isIdentical = MA_FALSE;
+                }
+
+                ma_free(pFrames, NULL);
+            }
+
+            if (iRun == 0 || elapsed < best) {
+                best = elapsed;
+            }
+        }
+
+        if (result != MA_SUCCESS) {
+            break;
+        }
+
+        if (threadCount == 1) {
+            serialBest = best;
+        }
+
+        bench_begin_result();
+        printf("\"source\": \"%s\", \"threads\": %u, \"ms\": %.2f, \"xRealtime\": %.1f, \"speedup\": %.2f, \"identical\": %s }",
+            pSource->pName, threadCount, best * 1e3, (double)serialFrameCount / config.sampleRate / best, serialBest / best, isIdentical ? "true" : "false");
+    }
+
+    ma_free(pSerialFrames, NULL);
+
+    return result;
+}
+
+
+/*
+Vorbis in memory
+*/
+typedef struct
+{
+    void* pData;
+    size_t dataSize;
+} bench_memory_file;
+
+/* Like ma_decoder_init_memory()'s read/seek/tell, which the libvorbis backend went through before it had onInitMemory. */
+typedef struct
+{
+    const ma_uint8* pData;
+    size_t dataSize;
+    size_t cursor;
+} bench_memory_stream;
+
+static ma_result bench_memory_stream_read(void* pUserData, void* pBufferOut, size_t bytesToRead, size_t* pBytesRead)
+{
+    bench_memory_stream* pStream = (bench_memory_stream*)pUserData;
+
+    if (bytesToRead > pStream->dataSize - pStream->cursor) {
+        bytesToRead = pStream->dataSize - pStream->cursor;
+    }
+
+    memcpy(pBufferOut, pStream->pData + pStream->cursor, bytesToRead);
+    pStream->cursor += bytesToRead;
+    *pBytesRead = bytesToRead;
+
+    return MA_SUCCESS;
+}
+
+static ma_result bench_memory_stream_seek(void* pUserData, ma_int64 offset, ma_seek_origin origin)
+{
+    bench_memory_stream* pStream = (bench_memory_stream*)pUserData;
+    ma_int64 cursor;
+
+    if (origin == ma_seek_origin_start) {
+        cursor = offset;
+    } else if (origin == ma_seek_origin_current) {
+        cursor = (ma_int64)pStream->cursor + offset;
+    } else {
+        cursor = (ma_int64)pStream->dataSize + offset;
+    }
+
+    if (cursor < 0 || cursor > (ma_int64)pStream->dataSize) {
+        return MA_BAD_SEEK;
+    }
+
+    pStream->cursor = (size_t)cursor;
+
+    return MA_SUCCESS;
+}
+
+static ma_result bench_memory_stream_tell(void* pUserData, ma_int64* pCursor)
+{
+    *pCursor = (ma_int64)((bench_memory_stream*)pUserData)->cursor;
+    return MA_SUCCESS;
+}
+
+/*
+Separate copies of each Ogg Vorbis source so the corpus isn't all in cache. It stops at whichever limit comes first, but
+always has every source at least once.
+*/
+static ma_result bench_make_vorbis_corpus(const bench_source* pSources, ma_uint32 sourceCount, bench_memory_file* pCorpus, ma_uint32* pCorpusCount)
+{
+    bench_memory_file originals[BENCH_MAX_SOURCES];
+    ma_uint32 originalCount = 0;
+    ma_uint32 corpusCount = 0;
+    size_t corpusSize = 0;
+    ma_result result = MA_SUCCESS;
+    ma_uint32 iSource;
+
+    for (iSource = 0; iSource < sourceCount; iSource += 1) {
+        if (strcmp(pSources[iSource].pCodec, "vorbis") != 0) {
+            continue;
+        }
+
+        result = ma_vfs_open_and_read_file(NULL, pSources[iSource].pFilePath, &originals[originalCount].pData, &originals[originalCount].dataSize, NULL);
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to read %s: %d\n", pSources[iSource].pFilePath, result);
+            break;
+        }
+
+        originalCount += 1;
+    }
+
+    while (result == MA_SUCCESS && originalCount > 0 && corpusCount < BENCH_CORPUS_COUNT) {
+        const bench_memory_file* pOriginal = &originals[corpusCount % originalCount];
+
+        if (corpusCount >= originalCount && corpusSize + pOriginal->dataSize > BENCH_CORPUS_MAX_BYTES) {
+            break;
+        }
+
+        pCorpus[corpusCount].pData = malloc(pOriginal->dataSize);
+        if (pCorpus[corpusCount].pData == NULL) {
+            result = MA_OUT_OF_MEMORY;
+            break;
+        }
+
+        memcpy(pCorpus[corpusCount].pData, pOriginal->pData, pOriginal->dataSize);
+        pCorpus[corpusCount].dataSize = pOriginal->dataSize;
+        corpusSize += pOriginal->dataSize;
+        corpusCount += 1;
+    }
+
+    for (iSource = 0; iSource < originalCount; iSource += 1) {
+        ma_free(originals[iSource].pData, NULL);
+    }
+
+    *pCorpusCount = corpusCount;
+
+    return result;
+}
+
+static ma_result bench_run_vorbis_memory(const bench_memory_file* pCorpus, ma_uint32 corpusCount, ma_bool32 useCallbacks)
+{
+    ma_decoding_backend_config config;
+    float* pFrames;
+    double bestInit = 0;
+    double bestDecode = 0;
+    ma_uint64 totalFramesRead = 0;
+    ma_uint32 iRun;
+
+    config = ma_decoding_backend_config_init(ma_format_f32, 0);
+
+    pFrames = (float*)malloc(4096 * MA_MAX_CHANNELS * sizeof(float));
+    if (pFrames == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        double initTime = 0;
+        double decodeTime = 0;
+        ma_uint32 iFile;
+
+        totalFramesRead = 0;
+
+        for (iFile = 0; iFile < corpusCount; iFile += 1) {
+            bench_memory_stream stream;
+            ma_libvorbis vorbis;
+            ma_uint64 framesDecoded = 0;
+            ma_result result;
+            double start;
+
+            start = bench_now();
+
+            if (useCallbacks) {
+                stream.pData    = (const ma_uint8*)pCorpus[iFile].pData;
+                stream.dataSize = pCorpus[iFile].dataSize;
+                stream.cursor   = 0;
+                result = ma_libvorbis_init(bench_memory_stream_read, bench_memory_stream_seek, bench_memory_stream_tell, &stream, &config, NULL, &vorbis);
+            } else {
+                result = ma_libvorbis_init_memory(pCorpus[iFile].pData, pCorpus[iFile].dataSize, &config, NULL, &vorbis);
+            }
+
+            initTime += bench_now() - start;
+
+            if (result != MA_SUCCESS) {
+                fprintf(stderr, "Failed to open corpus entry %u: %d\n", iFile, result);
+                free(pFrames);
+                return result;
+            }
+
+            start = bench_now();
+
+            while (framesDecoded < BENCH_CORPUS_DECODE_FRAMES) {
+                ma_uint64 framesToRead = BENCH_CORPUS_DECODE_FRAMES - framesDecoded;
+                ma_uint64 framesRead = 0;
+
+                if (framesToRead > 4096) {
+                    framesToRead = 4096;
+                }
+
+                result = ma_libvorbis_read_pcm_frames(&vorbis, pFrames, framesToRead, &framesRead);
+                framesDecoded += framesRead;
+
+                if (result != MA_SUCCESS || framesRead == 0) {
+                    break;
+                }
+            }
+
+            decodeTime += bench_now() - start;
+            totalFramesRead += framesDecoded;
+
+            ma_libvorbis_uninit(&vorbis, NULL);
+        }
+
+        if (iRun == 0 || initTime < bestInit) {
+            bestInit = initTime;
+        }
+        if (iRun == 0 || decodeTime < bestDecode) {
+            bestDecode = decodeTime;
+        }
+    }
+
+    free(pFrames);
+
+    bench_begin_result();
+    printf("\"path\": \"%s\", \"streams\": %u, \"usInitMean\": %.2f, \"nsPerFrame\": %.3f, \"msTotal\": %.2f }",
+        useCallbacks ? "callbacks" : "memory", corpusCount, bestInit / corpusCount * 1e6, (totalFramesRead > 0) ? bestDecode / totalFramesRead * 1e9 : 0.0, (bestInit + bestDecode) * 1e3);
+
+    return MA_SUCCESS;
+}
+
+
+/*
+Vorbis open
+*/
+static ma_result bench_run_vorbis_open(const bench_source* pSource, ma_bool32 isLazy)
+{
+    ma_decoding_backend_config config;
+    float frames[BENCH_PERIOD_FRAMES * MA_MAX_CHANNELS];
+    double total = 0;
+    double worst = 0;
+    ma_uint32 iLoad;
+
+    config = ma_decoding_backend_config_init(ma_format_f32, 0);
+
+    for (iLoad = 0; iLoad < BENCH_LOAD_COUNT; iLoad += 1) {
+        ma_libvorbis vorbis;
+        ma_uint64 framesRead = 0;
+        ma_result result;
+        double start;
+        double elapsed;
+
+        start = bench_now();
+
+        if (isLazy) {
+            result = ma_libvorbis_init_file_lazy(pSource->pFilePath, &config, NULL, &vorbis);
+        } else {
+            result = ma_libvorbis_init_file(pSource->pFilePath, &config, NULL, &vorbis);
+        }
+
+        if (result == MA_SUCCESS) {
+            result = ma_libvorbis_read_pcm_frames(&vorbis, frames, BENCH_PERIOD_FRAMES, &framesRead);
+            elapsed = bench_now() - start;
+            ma_libvorbis_uninit(&vorbis, NULL);
+        }
+
+        if (result != MA_SUCCESS || framesRead == 0) {
+            fprintf(stderr, "Failed to read the first frames of %s: %d\n", pSource->pFilePath, result);
+            return (result != MA_SUCCESS) ? result : MA_INVALID_FILE;
+        }
+
+        total += elapsed;
+        if (elapsed > worst) {
+            worst = elapsed;
+        }
+    }
+
+    bench_begin_result();
+    printf("\"source\": \"%s\", \"mode\": \"%s\", \"loads\": %u, \"usMean\": %.1f, \"usMax\": %.1f }",
+        pSource->pName, isLazy ? "lazy" : "eager", BENCH_LOAD_COUNT, total / BENCH_LOAD_COUNT * 1e6, worst * 1e6);
+
+    return MA_SUCCESS;
+}
+
+
+int main(int argc, char** argv)
+{
+    static const bench_conversion conversions[] =
+    {
+        { "resampler_f32_stereo_44100_to_48000",      MA_TRUE,  ma_format_f32, ma_format_f32, 2, 2, 44100, 48000 },
+        { "resampler_f32_stereo_48000_to_44100",      MA_TRUE,  ma_format_f32, ma_format_f32, 2, 2, 48000, 44100 },
+        { "converter_s16_to_f32_stereo",              MA_FALSE, ma_format_s16, ma_format_f32, 2, 2, 48000, 48000 },
+        { "converter_s16_mono_to_f32_stereo",         MA_FALSE, ma_format_s16, ma_format_f32, 1, 2, 48000, 48000 },
+        { "converter_f32_5.1_to_stereo",              MA_FALSE, ma_format_f32, ma_format_f32, 6, 2, 48000, 48000 },
+        { "converter_s16_stereo_44100_to_f32_48000",  MA_FALSE, ma_format_s16, ma_format_f32, 2, 2, 44100, 48000 }
+    };
+    static const ma_uint32 voiceCounts[] = { 1, 8, 32, 128 };
+    bench_source sources[BENCH_MAX_SOURCES];
+    ma_uint32 sourceCount = 0;
+    const char* pDirectory = ".";
+    char wavFilePath[4096];
+    ma_decoding_backend_vtable* pCustomBackendVTables[1];
+    ma_resource_manager_config resourceManagerConfig;
+    ma_resource_manager resourceManager;
+    float* pVoiceFrames;
+    bench_memory_file* pCorpus;
+    ma_uint32 corpusCount = 0;
+    ma_result result = MA_SUCCESS;
+    ma_uint32 iSource;
+    ma_uint32 i;
+    int iArg;
+
+    if (argc > 1) {
+        pDirectory = argv[1];
+    }
+
+    snprintf(wavFilePath, sizeof(wavFilePath), "%s/miniaudio_bench.wav", pDirectory);
+    if (bench_write_wav(wavFilePath, ma_format_s16, 2, BENCH_WAV_SAMPLE_RATE, BENCH_WAV_SAMPLE_RATE * BENCH_WAV_SECONDS) != MA_SUCCESS) {
+        fprintf(stderr, "Failed to write %s\n", wavFilePath);
+        return 1;
+    }
+
+    sources[0].pName     = "generated";
+    sources[0].pFilePath = wavFilePath;
+    sources[0].pCodec    = "wav";
+    sourceCount = 1;
+
+    for (iArg = 2; iArg < argc && sourceCount < BENCH_MAX_SOURCES; iArg += 1) {
+        sources[sourceCount].pName     = argv[iArg];
+        sources[sourceCount].pFilePath = argv[iArg];
+        sources[sourceCount].pCodec    = bench_get_codec_name(ma_ex_get_encoding_format_from_file(argv[iArg]));
+        sourceCount += 1;
+    }
+
+    printf("{\n  \"benchmark\": \"miniaudio\",\n  \"miniaudioVersion\": \"%s\",\n", ma_version_string());
+
+    bench_begin_section("decode", MA_TRUE);
+    for (iSource = 0; iSource < sourceCount && result == MA_SUCCESS; iSource += 1) {
+        result = bench_run_decode(&sources[iSource]);
+    }
+
+    bench_begin_section("conversion", MA_FALSE);
+    for (i = 0; i < sizeof(conversions) / sizeof(conversions[0]) && result == MA_SUCCESS; i += 1) {
+        result = bench_run_conversion(&conversions[i]);
+    }
+
+    bench_begin_section("mixing", MA_FALSE);
+    pVoiceFrames = (float*)bench_make_frames(ma_format_f32, BENCH_CHANNELS, BENCH_SAMPLE_RATE);   /* 1 second, looped. */
+    if (pVoiceFrames == NULL) {
+        result = MA_OUT_OF_MEMORY;
+    }
+    for (i = 0; i < sizeof(voiceCounts) / sizeof(voiceCounts[0]) && result == MA_SUCCESS; i += 1) {
+        result = bench_run_mixing(voiceCounts[i], MA_FALSE, pVoiceFrames, BENCH_SAMPLE_RATE);
+        if (result == MA_SUCCESS) {
+            result = bench_run_mixing(voiceCounts[i], MA_TRUE, pVoiceFrames, BENCH_SAMPLE_RATE);
+        }
+    }
+    free(pVoiceFrames);
+
+    bench_begin_section("resourceManager", MA_FALSE);
+    pCustomBackendVTables[0] = ma_decoding_backend_libvorbis_get_vtable();
+
+    resourceManagerConfig = ma_resource_manager_config_init();
+    resourceManagerConfig.decodedFormat                  = ma_format_f32;
+    resourceManagerConfig.decodedChannels                = BENCH_CHANNELS;
+    resourceManagerConfig.decodedSampleRate              = BENCH_SAMPLE_RATE;
+    resourceManagerConfig.ppCustomDecodingBackendVTables = pCustomBackendVTables;
+    resourceManagerConfig.customDecodingBackendCount     = 1;
+
+    if (result == MA_SUCCESS) {
+        result = ma_resource_manager_init(&resourceManagerConfig, &resourceManager);
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize resource manager: %d\n", result);
+        } else {
+            for (iSource = 0; iSource < sourceCount && result == MA_SUCCESS; iSource += 1) {
+                result = bench_run_load(&resourceManager, &sources[iSource], "decode", MA_RESOURCE_MANAGER_DATA_SOURCE_FLAG_DECODE);
+                if (result == MA_SUCCESS) {
+                    result = bench_run_load(&resourceManager, &sources[iSource], "stream", MA_RESOURCE_MANAGER_DATA_SOURCE_FLAG_STREAM);
+                }
+            }
+
+            ma_resource_manager_uninit(&resourceManager);
+        }
+    }
+
+    bench_begin_section("vorbisThreads", MA_FALSE);
+
+    /* A resource manager of its own for the job threads. Nothing is loaded through it. */
+    resourceManagerConfig = ma_resource_manager_config_init();
+    resourceManagerConfig.jobThreadCount = BENCH_MAX_DECODE_THREADS - 1;
+
+    if (result == MA_SUCCESS) {
+        result = ma_resource_manager_init(&resourceManagerConfig, &resourceManager);
+        if (result != MA_SUCCESS) {
+            fprintf(stderr, "Failed to initialize resource manager: %d\n", result);
+        } else {
+            for (iSource = 0; iSource < sourceCount && result == MA_SUCCESS; iSource += 1) {
+                void* pData;
+                size_t dataSize;
+
+                if (strcmp(sources[iSource].pCodec, "vorbis") != 0) {
+                    continue;
+                }
+
+                result = ma_vfs_open_and_read_file(NULL, sources[iSource].pFilePath, &pData, &dataSize, NULL);
+                if (result != MA_SUCCESS) {
+                    fprintf(stderr, "Failed to read %s: %d\n", sources[iSource].pFilePath, result);
+                    break;
+                }
+
+                result = bench_run_vorbis_threads(&resourceManager, &sources[iSource], pData, dataSize);
+                ma_free(pData, NULL);
+            }
+
+            ma_resource_manager_uninit(&resourceManager);
+        }
+    }
+
+    bench_begin_section("vorbisMemory", MA_FALSE);
+    pCorpus = (bench_memory_file*)calloc(BENCH_CORPUS_COUNT, sizeof(*pCorpus));
+    if (pCorpus == NULL && result == MA_SUCCESS) {
+        result = MA_OUT_OF_MEMORY;
+    }
+    if (result == MA_SUCCESS) {
+        result = bench_make_vorbis_corpus(sources, sourceCount, pCorpus, &corpusCount);
+    }
+    if (result == MA_SUCCESS && corpusCount > 0) {
+        result = bench_run_vorbis_memory(pCorpus, corpusCount, MA_FALSE);
+        if (result == MA_SUCCESS) {
+            result = bench_run_vorbis_memory(pCorpus, corpusCount, MA_TRUE);
+        }
+    }
+    for (i = 0; i < corpusCount; i += 1) {
+        free(pCorpus[i].pData);
+    }
+    free(pCorpus);
+
+    bench_begin_section("vorbisOpen", MA_FALSE);
+    for (iSource = 0; iSource < sourceCount && result == MA_SUCCESS; iSource += 1) {
+        if (strcmp(sources[iSource].pCodec, "vorbis") != 0) {
+            continue;
+        }
+
+        result = bench_run_vorbis_open(&sources[iSource], MA_FALSE);
+        if (result == MA_SUCCESS) {
+            result = bench_run_vorbis_open(&sources[iSource], MA_TRUE);
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    remove(wavFilePath);
+
+    return (result == MA_SUCCESS) ? 0 : 1;
+}
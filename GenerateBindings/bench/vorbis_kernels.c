@@ -0,0 +1,391 @@
+/*
+Microbenchmarks for the libvorbis kernels in miniaudio_libvorbis.c. Every variant the CPU supports is first checked
+against the reference kernel for bit-exact output and then timed on the same input. Results are written to stdout as
+JSON. A variant that doesn't match makes the benchmark exit with a non-zero code.
+
+The interleave kernels are compared with ma_interleave_pcm_frames(), the per-sample loop they replaced, for 1, 2 and 6
+channels. Their results also have the throughput in frames per second.
+
+This includes miniaudio_libvorbis.c directly so that it can get at the static kernels.
+*/
+#include "../miniaudio_libvorbis.c"
+
+#include "bench_common.h"
+
+#define BENCH_MDCT_SIZE         2048        /* Long block. */
+#define BENCH_BLOCK_SIZE        1024        /* Samples per channel for everything else. */
+#define BENCH_MAX_CHANNELS      6
+#define BENCH_MAX_OUTPUT_SIZE   (BENCH_BLOCK_SIZE * BENCH_MAX_CHANNELS)
+#define BENCH_ENTRY_COUNT       256
+#define BENCH_MIN_RUN_TIME      0.02        /* Seconds. Iteration counts are calibrated against the reference kernel. */
+#define BENCH_RUN_COUNT         5           /* Best of. */
+
+typedef void (* bench_proc)(void);
+typedef void (* bench_run_proc)(bench_proc proc, float* pOut);
+
+typedef struct
+{
+    const char* pName;
+    bench_proc proc;
+} bench_variant;
+
+#if defined(MA_LIBVORBIS_X86)
+    #define BENCH_X86(proc)  ((bench_proc)(proc))
+#else
+    #define BENCH_X86(proc)  NULL
+#endif
+
+#if defined(MA_LIBVORBIS_NEON)
+    #define BENCH_NEON(proc) ((bench_proc)(proc))
+#else
+    #define BENCH_NEON(proc) NULL
+#endif
+
+static struct
+{
+    mdct_lookup mdct;
+    float input[BENCH_MDCT_SIZE];
+    float input2[BENCH_BLOCK_SIZE];
+    float window[BENCH_BLOCK_SIZE];
+    float valueList[BENCH_ENTRY_COUNT * 8];
+    const float* ppEntries[BENCH_BLOCK_SIZE];
+    int residueDim;
+    int floorPosts[17][2];                  /* x, y */
+    float planar[BENCH_MAX_CHANNELS][BENCH_BLOCK_SIZE];
+    const float* ppPlanar[BENCH_MAX_CHANNELS];
+    ma_uint32 framesPerCall;                /* Non-zero to report frames per second as well. */
+} g_bench;
+
+static float bench_random_float(void)
+{
+    return (float)rand() / (float)RAND_MAX * 2 - 1;
+}
+
+static void bench_init_inputs(void)
+{
+    int i;
+
+    srand(1234);
+
+    mdct_init(&g_bench.mdct, BENCH_MDCT_SIZE);
+
+    for (i = 0; i < BENCH_MDCT_SIZE; i += 1) {
+        g_bench.input[i] = bench_random_float();
+    }
+
+    for (i = 0; i < BENCH_BLOCK_SIZE; i += 1) {
+        g_bench.input2[i] = bench_random_float();
+        g_bench.window[i] = (float)i / BENCH_BLOCK_SIZE;
+    }
+
+    /* Some exact zeros so that every branch of the inverse coupling is taken. */
+    for (i = 0; i < BENCH_BLOCK_SIZE; i += 7) {
+        g_bench.input2[i] = 0;
+    }
+
+    for (i = 0; i < BENCH_ENTRY_COUNT * 8; i += 1) {
+        g_bench.valueList[i] = (float)(rand() % 17 - 8);
+    }
+
+    for (i = 0; i < BENCH_MAX_CHANNELS * BENCH_BLOCK_SIZE; i += 1) {
+        g_bench.planar[i / BENCH_BLOCK_SIZE][i % BENCH_BLOCK_SIZE] = bench_random_float();
+    }
+
+    for (i = 0; i < BENCH_MAX_CHANNELS; i += 1) {
+        g_bench.ppPlanar[i] = g_bench.planar[i];
+    }
+
+    /* Floor1 posts spread over the block, with the last one past the end like libvorbis does for short curves. */
+    for (i = 0; i < 17; i += 1) {
+        g_bench.floorPosts[i][0] = (i * (BENCH_BLOCK_SIZE + 32)) / 16;
+        g_bench.floorPosts[i][1] = rand() % 256;
+    }
+}
+
+static void bench_set_residue_dim(int dim)
+{
+    int i;
+
+    g_bench.residueDim = dim;
+
+    for (i = 0; i < BENCH_BLOCK_SIZE; i += 1) {
+        g_bench.ppEntries[i] = g_bench.valueList + (rand() % BENCH_ENTRY_COUNT) * dim;
+    }
+}
+
+
+static void bench_run_mdct_butterfly(bench_proc proc, float* pOut)
+{
+    /* All butterfly stages of a long block inverse MDCT, as done by mdct_butterflies(). */
+    ma_libvorbis_mdct_butterfly_proc butterfly = (ma_libvorbis_mdct_butterfly_proc)proc;
+    float* pTrig = g_bench.mdct.trig;
+    int points = BENCH_MDCT_SIZE / 2;
+    int stages = g_bench.mdct.log2n - 5;
+    int i;
+    int j;
+
+    memcpy(pOut, g_bench.input, points * sizeof(float));
+
+    if (--stages > 0) {
+        butterfly(pTrig, pOut, points, 4);
+    }
+
+    for (i = 1; --stages > 0; i += 1) {
+        for (j = 0; j < (1 << i); j += 1) {
+            butterfly(pTrig, pOut + (points >> i)*j, points >> i, 4 << i);
+        }
+    }
+}
+
+static void bench_run_overlap_add(bench_proc proc, float* pOut)
+{
+    memcpy(pOut, g_bench.input, BENCH_BLOCK_SIZE * sizeof(float));
+    ((ma_libvorbis_overlap_add_proc)proc)(pOut, g_bench.input2, g_bench.window, BENCH_BLOCK_SIZE);
+}
+
+static void bench_run_inverse_coupling(bench_proc proc, float* pOut)
+{
+    memcpy(pOut + 0,                g_bench.input,  BENCH_BLOCK_SIZE * sizeof(float));
+    memcpy(pOut + BENCH_BLOCK_SIZE, g_bench.input2, BENCH_BLOCK_SIZE * sizeof(float));
+    ((ma_libvorbis_inverse_coupling_proc)proc)(pOut, pOut + BENCH_BLOCK_SIZE, BENCH_BLOCK_SIZE);
+}
+
+static void bench_run_residue_add(bench_proc proc, float* pOut)
+{
+    memcpy(pOut, g_bench.input, BENCH_BLOCK_SIZE * sizeof(float));
+    ((ma_libvorbis_residue_add_proc)proc)(pOut, BENCH_BLOCK_SIZE, g_bench.ppEntries, g_bench.residueDim);
+}
+
+static void bench_run_residue_add_stereo(bench_proc proc, float* pOut)
+{
+    memcpy(pOut + 0,                g_bench.input,  BENCH_BLOCK_SIZE * sizeof(float));
+    memcpy(pOut + BENCH_BLOCK_SIZE, g_bench.input2, BENCH_BLOCK_SIZE * sizeof(float));
+    ((ma_libvorbis_residue_add_stereo_proc)proc)(pOut, pOut + BENCH_BLOCK_SIZE, BENCH_BLOCK_SIZE, g_bench.ppEntries, g_bench.residueDim);
+}
+
+static void bench_run_interleave(bench_proc proc, float* pOut)
+{
+    ((ma_libvorbis_interleave_f32_proc)proc)(pOut, g_bench.ppPlanar, BENCH_BLOCK_SIZE);
+}
+
+/* What ma_libvorbis_read_pcm_frames() did for every channel count before it had its own kernels. */
+static void bench_interleave_f32_1__generic(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    ma_interleave_pcm_frames(ma_format_f32, 1, frameCount, (const void**)ppFramesIn, pFramesOut);
+}
+
+static void bench_interleave_f32_2__generic(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    ma_interleave_pcm_frames(ma_format_f32, 2, frameCount, (const void**)ppFramesIn, pFramesOut);
+}
+
+static void bench_interleave_f32_6__generic(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    ma_interleave_pcm_frames(ma_format_f32, 6, frameCount, (const void**)ppFramesIn, pFramesOut);
+}
+
+/* Mono is a copy in ma_libvorbis_interleave_f32(). */
+static void bench_interleave_f32_1__memcpy(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    memcpy(pFramesOut, ppFramesIn[0], (size_t)frameCount * sizeof(float));
+}
+
+static void bench_run_render_floor_line(bench_proc proc, float* pOut)
+{
+    ma_libvorbis_render_floor_line_proc render = (ma_libvorbis_render_floor_line_proc)proc;
+    int i;
+
+    memcpy(pOut, g_bench.input, BENCH_BLOCK_SIZE * sizeof(float));
+
+    for (i = 0; i < 16; i += 1) {
+        render(BENCH_BLOCK_SIZE, g_bench.floorPosts[i][0], g_bench.floorPosts[i+1][0], g_bench.floorPosts[i][1], g_bench.floorPosts[i+1][1], pOut, FLOOR1_fromdB_LOOKUP);
+    }
+}
+
+
+static ma_uint32 bench_get_variants(bench_variant* pVariants, bench_proc reference, bench_proc sse2, bench_proc avx2, bench_proc neon)
+{
+    ma_uint32 count = 0;
+
+    pVariants[count].pName = "reference";
+    pVariants[count].proc  = reference;
+    count += 1;
+
+    #if defined(MA_LIBVORBIS_X86)
+    {
+        if (sse2 != NULL && ma_libvorbis_has_sse2()) {
+            pVariants[count].pName = "sse2";
+            pVariants[count].proc  = sse2;
+            count += 1;
+        }
+        if (avx2 != NULL && ma_libvorbis_has_avx2()) {
+            pVariants[count].pName = "avx2";
+            pVariants[count].proc  = avx2;
+            count += 1;
+        }
+    }
+    #endif
+
+    if (neon != NULL) {
+        pVariants[count].pName = "neon";
+        pVariants[count].proc  = neon;
+        count += 1;
+    }
+
+    return count;
+}
+
+static double bench_time(bench_run_proc run, bench_proc proc, float* pOut, ma_uint32 iterations)
+{
+    double best = 0;
+    ma_uint32 iRun;
+    ma_uint32 iIteration;
+
+    for (iRun = 0; iRun < BENCH_RUN_COUNT; iRun += 1) {
+        double start = bench_now();
+        double elapsed;
+
+        for (iIteration = 0; iIteration < iterations; iIteration += 1) {
+            run(proc, pOut);
+        }
+
+        elapsed = bench_now() - start;
+        if (iRun == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    return best / iterations;
+}
+
+static ma_bool32 g_bench_is_first_result = MA_TRUE;
+
+static ma_bool32 bench_kernel(const char* pKernelName, bench_run_proc run, size_t outputSize, const bench_variant* pVariants, ma_uint32 variantCount)
+{
+    static float expected[BENCH_MAX_OUTPUT_SIZE];
+    static float actual[BENCH_MAX_OUTPUT_SIZE];
+    ma_bool32 allExact = MA_TRUE;
+    ma_uint32 iterations = 1;
+    double referenceTime = 0;
+    ma_uint32 iVariant;
+
+    run(pVariants[0].proc, expected);
+
+    /* Calibrate against the reference kernel so that every variant runs the same number of iterations. */
+    for (;;) {
+        double start = bench_now();
+        ma_uint32 iIteration;
+
+        for (iIteration = 0; iIteration < iterations; iIteration += 1) {
+            run(pVariants[0].proc, actual);
+        }
+
+        if (bench_now() - start >= BENCH_MIN_RUN_TIME || iterations >= 0x10000000) {
+            break;
+        }
+
+        iterations *= 2;
+    }
+
+    for (iVariant = 0; iVariant < variantCount; iVariant += 1) {
+        ma_bool32 isExact;
+        double timePerCall;
+
+        run(pVariants[iVariant].proc, actual);
+        isExact = memcmp(expected, actual, outputSize * sizeof(float)) == 0;
+        if (!isExact) {
+            allExact = MA_FALSE;
+        }
+
+        timePerCall = bench_time(run, pVariants[iVariant].proc, actual, iterations);
+        if (iVariant == 0) {
+            referenceTime = timePerCall;
+        }
+
+        printf("%s    { \"kernel\": \"%s\", \"variant\": \"%s\", \"bitExact\": %s, \"nsPerCall\": %.1f, \"speedup\": %.2f",
+            g_bench_is_first_result ? "" : ",\n", pKernelName, pVariants[iVariant].pName, isExact ? "true" : "false", timePerCall * 1e9, referenceTime / timePerCall);
+        if (g_bench.framesPerCall != 0) {
+            printf(", \"framesPerSecond\": %.0f", g_bench.framesPerCall / timePerCall);
+        }
+        printf(" }");
+        g_bench_is_first_result = MA_FALSE;
+    }
+
+    return allExact;
+}
+
+int main(int argc, char** argv)
+{
+    bench_variant variants[5];
+    ma_uint32 variantCount;
+    ma_bool32 allExact = MA_TRUE;
+    int dims[3] = { 2, 4, 8 };
+    char name[64];
+    int iDim;
+
+    (void)argc;
+    (void)argv;
+
+    bench_init_inputs();
+
+    printf("{\n  \"benchmark\": \"vorbis_kernels\",\n  \"results\": [\n");
+
+    variantCount = bench_get_variants(variants, (bench_proc)ma_libvorbis_mdct_butterfly__reference,
+        BENCH_X86(ma_libvorbis_mdct_butterfly__sse2), BENCH_X86(ma_libvorbis_mdct_butterfly__avx2), BENCH_NEON(ma_libvorbis_mdct_butterfly__neon));
+    allExact &= bench_kernel("mdct_butterfly", bench_run_mdct_butterfly, BENCH_MDCT_SIZE / 2, variants, variantCount);
+
+    variantCount = bench_get_variants(variants, (bench_proc)ma_libvorbis_overlap_add__reference,
+        BENCH_X86(ma_libvorbis_overlap_add__sse2), BENCH_X86(ma_libvorbis_overlap_add__avx2), BENCH_NEON(ma_libvorbis_overlap_add__neon));
+    allExact &= bench_kernel("overlap_add", bench_run_overlap_add, BENCH_BLOCK_SIZE, variants, variantCount);
+
+    variantCount = bench_get_variants(variants, (bench_proc)ma_libvorbis_inverse_coupling__reference,
+        BENCH_X86(ma_libvorbis_inverse_coupling__sse2), BENCH_X86(ma_libvorbis_inverse_coupling__avx2), BENCH_NEON(ma_libvorbis_inverse_coupling__neon));
+    allExact &= bench_kernel("inverse_coupling", bench_run_inverse_coupling, BENCH_BLOCK_SIZE * 2, variants, variantCount);
+
+    for (iDim = 0; iDim < 3; iDim += 1) {
+        bench_set_residue_dim(dims[iDim]);
+
+        variantCount = bench_get_variants(variants, (bench_proc)ma_libvorbis_residue_add__reference,
+            BENCH_X86(ma_libvorbis_residue_add__sse2), NULL, BENCH_NEON(ma_libvorbis_residue_add__neon));
+        snprintf(name, sizeof(name), "residue_add_dim%d", dims[iDim]);
+        allExact &= bench_kernel(name, bench_run_residue_add, BENCH_BLOCK_SIZE, variants, variantCount);
+
+        variantCount = bench_get_variants(variants, (bench_proc)ma_libvorbis_residue_add_stereo__reference,
+            BENCH_X86(ma_libvorbis_residue_add_stereo__sse2), NULL, BENCH_NEON(ma_libvorbis_residue_add_stereo__neon));
+        snprintf(name, sizeof(name), "residue_add_stereo_dim%d", dims[iDim]);
+        allExact &= bench_kernel(name, bench_run_residue_add_stereo, BENCH_BLOCK_SIZE * 2, variants, variantCount);
+    }
+
+    variantCount = bench_get_variants(variants, (bench_proc)ma_libvorbis_render_floor_line__reference,
+        BENCH_X86(ma_libvorbis_render_floor_line__sse2), BENCH_X86(ma_libvorbis_render_floor_line__avx2), NULL);
+    allExact &= bench_kernel("render_floor_line", bench_run_render_floor_line, BENCH_BLOCK_SIZE, variants, variantCount);
+
+    /* The generic loop comes first so the speedups are against it. */
+    g_bench.framesPerCall = BENCH_BLOCK_SIZE;
+
+    variants[0].pName = "generic";
+    variants[0].proc  = (bench_proc)bench_interleave_f32_1__generic;
+    variants[1].pName = "memcpy";
+    variants[1].proc  = (bench_proc)bench_interleave_f32_1__memcpy;
+    allExact &= bench_kernel("interleave_f32_1", bench_run_interleave, BENCH_BLOCK_SIZE, variants, 2);
+
+    variants[0].pName = "generic";
+    variants[0].proc  = (bench_proc)bench_interleave_f32_2__generic;
+    variantCount = 1 + bench_get_variants(variants + 1, (bench_proc)ma_libvorbis_interleave_f32_2__reference,
+        BENCH_X86(ma_libvorbis_interleave_f32_2__sse2), BENCH_X86(ma_libvorbis_interleave_f32_2__avx2), BENCH_NEON(ma_libvorbis_interleave_f32_2__neon));
+    allExact &= bench_kernel("interleave_f32_2", bench_run_interleave, BENCH_BLOCK_SIZE * 2, variants, variantCount);
+
+    variants[0].pName = "generic";
+    variants[0].proc  = (bench_proc)bench_interleave_f32_6__generic;
+    variantCount = 1 + bench_get_variants(variants + 1, (bench_proc)ma_libvorbis_interleave_f32_6__reference,
+        BENCH_X86(ma_libvorbis_interleave_f32_6__sse2), BENCH_X86(ma_libvorbis_interleave_f32_6__avx2), BENCH_NEON(ma_libvorbis_interleave_f32_6__neon));
+    allExact &= bench_kernel("interleave_f32_6", bench_run_interleave, BENCH_BLOCK_SIZE * 6, variants, variantCount);
+
+    g_bench.framesPerCall = 0;
+
+    printf("\n  ]\n}\n");
+
+    mdct_clear(&g_bench.mdct);
+
+    return allExact ? 0 : 1;
+}
@@ -0,0 +1,63 @@
+/*
+AVX2/FMA build of miniaudio's decoding path.
+
+This compiles a second, private copy of miniaudio with AVX2 and FMA enabled (see CMakeLists.txt) so the compiler can
+vectorize the decoders (dr_wav, dr_flac, dr_mp3), the format and channel converters and the resamplers for it.
+MA_API is made static so none of it clashes with the baseline copy in miniaudio.c, and only the entry points below are
+visible outside of this file. miniaudio_ex.c calls them instead of the baseline ones when the CPU supports AVX2 and FMA.
+
+Everything that isn't needed for decoding is compiled out. The structures are the same in both copies, so a decoder
+initialized here can be read, seeked and uninitialized through the baseline API. Its vtables and callbacks point back
+into this file, so it keeps running AVX2 code.
+
+FP contraction is disabled like it is for miniaudio_libvorbis.c so the output is the same as the baseline build.
+
+Some of these are already defined when this is part of miniaudio_headless.
+*/
+#define MA_API static
+#if !defined(MA_NO_DEVICE_IO)
+    #define MA_NO_DEVICE_IO
+#endif
+#define MA_NO_RESOURCE_MANAGER
+#define MA_NO_NODE_GRAPH
+#define MA_NO_ENGINE
+#if !defined(MA_NO_GENERATION)
+    #define MA_NO_GENERATION
+#endif
+#if !defined(MA_NO_ENCODING)
+    #define MA_NO_ENCODING
+#endif
+#define MINIAUDIO_IMPLEMENTATION
+#include "./miniaudio/miniaudio.h"
+
+/* These are only for miniaudio_ex.c so keep them out of the shared library's exports. */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+    #define MA_EX_AVX2_API __attribute__((visibility("hidden")))
+#else
+    #define MA_EX_AVX2_API
+#endif
+
+MA_EX_AVX2_API ma_result ma_ex_avx2_decoder_init(ma_decoder_read_proc onRead, ma_decoder_seek_proc onSeek, void* pUserData, const ma_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    return ma_decoder_init(onRead, onSeek, pUserData, pConfig, pDecoder);
+}
+
+MA_EX_AVX2_API ma_result ma_ex_avx2_decoder_init_file(const char* pFilePath, const ma_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    return ma_decoder_init_file(pFilePath, pConfig, pDecoder);
+}
+
+MA_EX_AVX2_API ma_result ma_ex_avx2_decoder_init_memory(const void* pData, size_t dataSize, const ma_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    return ma_decoder_init_memory(pData, dataSize, pConfig, pDecoder);
+}
+
+MA_EX_AVX2_API ma_result ma_ex_avx2_decoder_read_pcm_frames(ma_decoder* pDecoder, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    return ma_decoder_read_pcm_frames(pDecoder, pFramesOut, frameCount, pFramesRead);
+}
+
+MA_EX_AVX2_API ma_result ma_ex_avx2_data_converter_init(const ma_data_converter_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_converter* pConverter)
+{
+    return ma_data_converter_init(pConfig, pAllocationCallbacks, pConverter);
+}
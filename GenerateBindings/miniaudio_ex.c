@@ -1,94 +1,2873 @@
+/* 64-bit off_t, so fseeko() and ftello() reach past 2GB on 32-bit targets. It has to come before any system header. */
+#if !defined(_WIN32) && !defined(_FILE_OFFSET_BITS)
+    #define _FILE_OFFSET_BITS 64
+#endif
+
 #define MINIAUDIO_EX_IMPLEMENTATION
 #include "./miniaudio_ex.h"
 
-#ifndef MA_ASSERT
-    #include <assert.h>
-    #define MA_ASSERT(x) assert(x)
-#endif
+#ifndef MA_ASSERT
+    #include <assert.h>
+    #define MA_ASSERT(x) assert(x)
+#endif
+
+#ifndef MA_ZERO_OBJECT
+    #define MA_ZERO_OBJECT(p) memset((p), 0, sizeof(*(p)))
+#endif
+
+#ifndef ma_countof
+    #define ma_countof(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+#ifndef MA_DATA_CONVERTER_STACK_BUFFER_SIZE
+    #define MA_DATA_CONVERTER_STACK_BUFFER_SIZE  4096
+#endif
+
+#ifndef MA_EX_DECODER_RATE_PRIME_FRAMES
+    #define MA_EX_DECODER_RATE_PRIME_FRAMES  32  /* Frames fed through the resampler when leaving passthrough. */
+#endif
+
+#ifndef MA_EX_SNIFF_SIZE
+    #define MA_EX_SNIFF_SIZE  64    /* Bytes read from the start of a file, or from the end of its ID3v2 tag, to work out its format. */
+#endif
+
+#ifndef MA_EX_TIME_STRETCH_DEFAULT_SEQUENCE_MS
+    #define MA_EX_TIME_STRETCH_DEFAULT_SEQUENCE_MS      40
+#endif
+
+#ifndef MA_EX_TIME_STRETCH_DEFAULT_SEEK_WINDOW_MS
+    #define MA_EX_TIME_STRETCH_DEFAULT_SEEK_WINDOW_MS   15
+#endif
+
+#ifndef MA_EX_TIME_STRETCH_DEFAULT_OVERLAP_MS
+    #define MA_EX_TIME_STRETCH_DEFAULT_OVERLAP_MS       8
+#endif
+
+#ifndef MA_EX_POOL_DEFAULT_SLAB_SIZE
+    #define MA_EX_POOL_DEFAULT_SLAB_SIZE  65536
+#endif
+
+#include <stdio.h>  /* For FILE, used when sniffing and probing. */
+#include <string.h> /* For memcpy() and memmove(). */
+#include <math.h>   /* For sqrt(). */
+
+/*
+ma_malloc() and friends only fall back to the default allocator when they're given NULL. Configs that are zeroed by
+their init function, like ma_ex_probe_config, have callbacks that are all NULL instead, which miniaudio's own objects
+handle with ma_allocation_callbacks_init_copy(). That isn't exported, so this does the same for direct allocations.
+*/
+static const ma_allocation_callbacks* ma_ex__get_allocation_callbacks(const ma_allocation_callbacks* pAllocationCallbacks)
+{
+    if (pAllocationCallbacks == NULL || (pAllocationCallbacks->onMalloc == NULL && pAllocationCallbacks->onRealloc == NULL && pAllocationCallbacks->onFree == NULL)) {
+        return NULL;
+    }
+
+    return pAllocationCallbacks;
+}
+
+/*
+fseek() and ftell() take a long, which is 32 bits on Windows, including MinGW, and on 32-bit Linux. Files are sniffed
+and probed through these instead so offsets past 2GB aren't truncated.
+*/
+static int ma_ex__fseek64(FILE* pFile, ma_int64 offset, int whence)
+{
+    #if defined(_WIN32)
+        return _fseeki64(pFile, offset, whence);
+    #else
+        return fseeko(pFile, (off_t)offset, whence);
+    #endif
+}
+
+static ma_int64 ma_ex__ftell64(FILE* pFile)
+{
+    #if defined(_WIN32)
+        return _ftelli64(pFile);
+    #else
+        return ftello(pFile);
+    #endif
+}
+
+/*
+SIMD support for fused reads and time stretching, done the same way as in miniaudio_libvorbis.c. x86 kernels are
+always compiled and selected at runtime. NEON is part of the arm64 baseline so it's selected at compile time.
+*/
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+    #if defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__)
+        #define MA_EX_X86
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__) || (defined(__ARM_NEON) && defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+    #define MA_EX_NEON
+#endif
+
+#if defined(MA_EX_X86)
+    #include <emmintrin.h>
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+    #if defined(__GNUC__) || defined(__clang__)
+        #define MA_EX_TARGET_SSE2 __attribute__((target("sse2")))
+        #define MA_EX_TARGET_AVX2 __attribute__((target("avx2")))
+    #else
+        #define MA_EX_TARGET_SSE2
+        #define MA_EX_TARGET_AVX2
+    #endif
+#endif
+
+#if defined(MA_EX_NEON)
+    #include <arm_neon.h>
+#endif
+
+/*
+Entry points into miniaudio's decoding path. When the library is built with MA_EX_AVX2_DISPATCH (see CMakeLists.txt)
+there's a second copy of it in miniaudio_avx2.c compiled for AVX2 and FMA, and ma_ex_init_simd() points these at it if
+the CPU has both. Otherwise they stay on the baseline build in miniaudio.c.
+*/
+#if defined(MA_EX_X86) && defined(MA_EX_AVX2_DISPATCH)
+    #define MA_EX_HAS_AVX2_BUILD
+
+ma_result ma_ex_avx2_decoder_init(ma_decoder_read_proc onRead, ma_decoder_seek_proc onSeek, void* pUserData, const ma_decoder_config* pConfig, ma_decoder* pDecoder);
+ma_result ma_ex_avx2_decoder_init_file(const char* pFilePath, const ma_decoder_config* pConfig, ma_decoder* pDecoder);
+ma_result ma_ex_avx2_decoder_init_memory(const void* pData, size_t dataSize, const ma_decoder_config* pConfig, ma_decoder* pDecoder);
+ma_result ma_ex_avx2_decoder_read_pcm_frames(ma_decoder* pDecoder, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);
+ma_result ma_ex_avx2_data_converter_init(const ma_data_converter_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_converter* pConverter);
+#endif
+
+typedef ma_result (* ma_ex_decoder_init_proc)(ma_decoder_read_proc onRead, ma_decoder_seek_proc onSeek, void* pUserData, const ma_decoder_config* pConfig, ma_decoder* pDecoder);
+typedef ma_result (* ma_ex_decoder_init_file_proc)(const char* pFilePath, const ma_decoder_config* pConfig, ma_decoder* pDecoder);
+typedef ma_result (* ma_ex_decoder_init_memory_proc)(const void* pData, size_t dataSize, const ma_decoder_config* pConfig, ma_decoder* pDecoder);
+typedef ma_result (* ma_ex_decoder_read_pcm_frames_proc)(ma_decoder* pDecoder, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);
+typedef ma_result (* ma_ex_data_converter_init_proc)(const ma_data_converter_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_converter* pConverter);
+
+static ma_ex_decoder_init_proc            g_ma_ex_decoder_init                = ma_decoder_init;
+static ma_ex_decoder_init_file_proc       g_ma_ex_decoder_init_file           = ma_decoder_init_file;
+static ma_ex_decoder_init_memory_proc     g_ma_ex_decoder_init_memory         = ma_decoder_init_memory;
+static ma_ex_decoder_read_pcm_frames_proc g_ma_ex_decoder_read_pcm_frames     = ma_decoder_read_pcm_frames;
+static ma_ex_data_converter_init_proc     g_ma_ex_data_converter_init         = ma_data_converter_init;
+
+static void ma_ex_init_simd(void);
+
+static ma_result ma_decoder__init_data_converter_ex(ma_decoder* pDecoder, const ma_ex_decoder_config* pConfigEx);
+static ma_bool32 ma_ex_decoder__can_preserve_passthrough(const ma_decoder* pDecoder);
+static void ma_ex_decoder__set_passthrough(ma_decoder* pDecoder, ma_bool32 isPassthrough);
+static void ma_ex_decoder__init_fused_read(ma_decoder* pDecoder);
+
+MA_EX_API ma_ex_decoder_config ma_ex_decoder_config_init(ma_format format, ma_uint32 channels, ma_uint32 sampleRate) {
+    ma_ex_decoder_config config;
+    config.baseConfig = ma_decoder_config_init(format, channels, sampleRate);
+    config.allowDynamicSampleRate = MA_FALSE;
+    config.preservePassthrough = MA_FALSE;
+
+    return config;
+}
+
+/*
+The upstream init always builds a data converter for the output format in the config, and that converter is replaced
+straight away with one built from the extended config. To avoid paying for the setup (and for resampling configs, the
+input cache allocation) twice, the upstream init is asked for the backend's native channel count and sample rate. The
+converter it builds is then a passthrough, or a format conversion when the backend can't output the requested format.
+Neither has a heap or an input cache, so the converter built by ma_decoder__init_data_converter_ex() is the only real
+one. The format is kept since it's also what the backend is asked to decode to.
+*/
+static ma_decoder_config ma_ex_decoder__get_preinit_config(const ma_ex_decoder_config* pConfig)
+{
+    ma_decoder_config config = pConfig->baseConfig;
+
+    config.channels       = 0;
+    config.sampleRate     = 0;
+    config.pChannelMap    = NULL;
+    config.channelMixMode = ma_channel_mix_mode_default;
+    config.ditherMode     = ma_dither_mode_none;
+
+    return config;
+}
+
+static ma_result ma_ex_decoder__postinit(const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder)
+{
+    ma_result result;
+
+    ma_data_converter_uninit(&pDecoder->converter, &pDecoder->allocationCallbacks);
+    result = ma_decoder__init_data_converter_ex(pDecoder, pConfig);
+    if (result != MA_SUCCESS) {
+        ma_decoder_uninit(pDecoder);
+        return result;
+    }
+
+    if (pConfig->allowDynamicSampleRate && pConfig->preservePassthrough && ma_ex_decoder__can_preserve_passthrough(pDecoder)) {
+        if (pDecoder->converter.sampleRateIn == pDecoder->converter.sampleRateOut) {
+            ma_ex_decoder__set_passthrough(pDecoder, MA_TRUE);
+        }
+    }
+
+    ma_ex_decoder__init_fused_read(pDecoder);
+
+    return result;
+}
+
+MA_EX_API ma_result ma_ex_decoder_init(ma_decoder_read_proc onRead, ma_decoder_seek_proc onSeek, void* pUserData, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder) {
+    ma_result result;
+    ma_decoder_config config;
+
+    if (pConfig == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_ex_init_simd();
+
+    config = ma_ex_decoder__get_preinit_config(pConfig);
+
+    result = g_ma_ex_decoder_init(onRead, onSeek, pUserData, &config, pDecoder);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    return ma_ex_decoder__postinit(pConfig, pDecoder);
+}
+
+MA_EX_API ma_result ma_ex_decoder_init_file(const char* pFilePath, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder) {
+    ma_result result;
+    ma_decoder_config config;
+
+    if (pConfig == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_ex_init_simd();
+
+    config = ma_ex_decoder__get_preinit_config(pConfig);
+
+    if (config.encodingFormat == ma_encoding_format_unknown) {
+        config.encodingFormat = ma_ex_get_encoding_format_from_file(pFilePath);
+    }
+
+    result = g_ma_ex_decoder_init_file(pFilePath, &config, pDecoder);
+    if (result != MA_SUCCESS && config.encodingFormat != pConfig->baseConfig.encodingFormat) {
+        /* It only looked like something we know. Let upstream work it out. */
+        config.encodingFormat = pConfig->baseConfig.encodingFormat;
+        result = g_ma_ex_decoder_init_file(pFilePath, &config, pDecoder);
+    }
+
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    return ma_ex_decoder__postinit(pConfig, pDecoder);
+}
+
+MA_EX_API ma_result ma_ex_decoder_init_memory(const void* pData, size_t dataSize, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder) {
+    ma_result result;
+    ma_decoder_config config;
+
+    if (pConfig == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_ex_init_simd();
+
+    config = ma_ex_decoder__get_preinit_config(pConfig);
+
+    if (config.encodingFormat == ma_encoding_format_unknown) {
+        config.encodingFormat = ma_ex_get_encoding_format_from_memory(pData, dataSize);
+    }
+
+    result = g_ma_ex_decoder_init_memory(pData, dataSize, &config, pDecoder);
+    if (result != MA_SUCCESS && config.encodingFormat != pConfig->baseConfig.encodingFormat) {
+        config.encodingFormat = pConfig->baseConfig.encodingFormat;
+        result = g_ma_ex_decoder_init_memory(pData, dataSize, &config, pDecoder);
+    }
+
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    return ma_ex_decoder__postinit(pConfig, pDecoder);
+}
+
+/*
+Passthrough-preserving dynamic sample rate
+
+allowDynamicSampleRate makes the data converter keep its resampler for the lifetime of the decoder, which also takes it
+off the passthrough path that ma_decoder_read_pcm_frames() reads the backend directly on. With preservePassthrough the
+converter is flipped onto the passthrough path whenever the rate is 1:1 and back onto the resample only path when it
+isn't. The resampler stays allocated the whole time so switching costs nothing but the state carry-over below.
+
+This is only done when the resampler is the converter's only stage. With format or channel conversion the converter
+can't be a passthrough anyway, and ma_ex_decoder_set_rate*() just forwards the rate to it.
+
+The converter's own passthrough flag is the only state. A converter with a resampler that is marked as passthrough can
+only have come from here.
+*/
+static ma_bool32 ma_ex_decoder__can_preserve_passthrough(const ma_decoder* pDecoder)
+{
+    const ma_data_converter* pConverter = &pDecoder->converter;
+
+    if (!pConverter->hasResampler || pConverter->hasPreFormatConversion || pConverter->hasPostFormatConversion || pConverter->hasChannelConverter) {
+        return MA_FALSE;
+    }
+
+    return pConverter->executionPath == ma_data_converter_execution_path_resample_only || pConverter->executionPath == ma_data_converter_execution_path_passthrough;
+}
+
+static ma_result ma_ex_decoder__get_backend_cursor(ma_decoder* pDecoder, ma_uint64* pCursor)
+{
+    ma_result result;
+
+    result = ma_data_source_get_cursor_in_pcm_frames(pDecoder->pBackend, pCursor);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    /* Frames sitting in the input cache have been read from the backend but not converted yet. */
+    if (pDecoder->inputCacheRemaining > *pCursor) {
+        return MA_INVALID_OPERATION;
+    }
+
+    *pCursor -= pDecoder->inputCacheRemaining;
+    return MA_SUCCESS;
+}
+
+static void ma_ex_decoder__prime_resampler(ma_decoder* pDecoder, ma_uint64 cursor)
+{
+    /*
+    A reset resampler starts from silence. Feeding it the frames just before the cursor means its first output is
+    interpolated from the audio that was just played rather than from zero. The output of the priming is discarded and
+    the backend ends up back at the cursor.
+    */
+    ma_data_converter* pConverter = &pDecoder->converter;
+    ma_uint8 inputFrames[MA_DATA_CONVERTER_STACK_BUFFER_SIZE];
+    ma_uint8 outputFrames[MA_DATA_CONVERTER_STACK_BUFFER_SIZE];
+    ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(pConverter->formatIn, pConverter->channelsIn);
+    ma_uint64 framesToPrime = MA_EX_DECODER_RATE_PRIME_FRAMES;
+    ma_uint64 framesRead;
+    ma_uint64 framesConsumed = 0;
+
+    if (framesToPrime > cursor) {
+        framesToPrime = cursor;
+    }
+    if (framesToPrime > sizeof(inputFrames) / bytesPerFrame) {
+        framesToPrime = sizeof(inputFrames) / bytesPerFrame;
+    }
+
+    if (framesToPrime == 0 || ma_data_source_seek_to_pcm_frame(pDecoder->pBackend, cursor - framesToPrime) != MA_SUCCESS) {
+        return;
+    }
+
+    ma_data_source_read_pcm_frames(pDecoder->pBackend, inputFrames, framesToPrime, &framesRead);
+
+    while (framesConsumed < framesRead) {
+        ma_uint64 frameCountIn  = framesRead - framesConsumed;
+        ma_uint64 frameCountOut = sizeof(outputFrames) / bytesPerFrame;
+
+        if (ma_resampler_process_pcm_frames(&pConverter->resampler, inputFrames + framesConsumed*bytesPerFrame, &frameCountIn, outputFrames, &frameCountOut) != MA_SUCCESS || frameCountIn == 0) {
+            break;
+        }
+
+        framesConsumed += frameCountIn;
+    }
+
+    /* Should already be there unless the read came up short. */
+    if (framesRead != framesToPrime) {
+        ma_data_source_seek_to_pcm_frame(pDecoder->pBackend, cursor);
+    }
+}
+
+static void ma_ex_decoder__set_passthrough(ma_decoder* pDecoder, ma_bool32 isPassthrough)
+{
+    ma_data_converter* pConverter = &pDecoder->converter;
+    ma_uint64 cursor;
+    ma_bool32 hasCursor;
+
+    if ((ma_bool32)pConverter->isPassthrough == isPassthrough) {
+        return;
+    }
+
+    hasCursor = (ma_ex_decoder__get_backend_cursor(pDecoder, &cursor) == MA_SUCCESS);
+
+    if (isPassthrough) {
+        /*
+        The last few frames read by the resampler haven't come out of it yet. Rewind over them so the passthrough path
+        picks up where the resampled output left off.
+        */
+        if (hasCursor) {
+            ma_uint64 latency = ma_data_converter_get_input_latency(pConverter);
+            ma_uint64 target  = (latency < cursor) ? cursor - latency : 0;
+
+            if (target != cursor + pDecoder->inputCacheRemaining) {
+                ma_data_source_seek_to_pcm_frame(pDecoder->pBackend, target);
+            }
+        }
+
+        pConverter->executionPath = ma_data_converter_execution_path_passthrough;
+        pConverter->isPassthrough = MA_TRUE;
+    } else {
+        /* The passthrough path doesn't use the input cache so the backend is exactly at the cursor. */
+        ma_resampler_reset(&pConverter->resampler);
+
+        if (hasCursor) {
+            ma_ex_decoder__prime_resampler(pDecoder, cursor);
+        }
+
+        pConverter->executionPath = ma_data_converter_execution_path_resample_only;
+        pConverter->isPassthrough = MA_FALSE;
+    }
+
+    /* Anything cached was accounted for in the cursor above. */
+    pDecoder->inputCacheConsumed  = 0;
+    pDecoder->inputCacheRemaining = 0;
+}
+
+MA_EX_API ma_result ma_ex_decoder_set_rate(ma_decoder* pDecoder, ma_uint32 sampleRateIn, ma_uint32 sampleRateOut)
+{
+    ma_result result;
+
+    if (pDecoder == NULL || sampleRateIn == 0 || sampleRateOut == 0) {
+        return MA_INVALID_ARGS;
+    }
+
+    result = ma_data_converter_set_rate(&pDecoder->converter, sampleRateIn, sampleRateOut);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    if (ma_ex_decoder__can_preserve_passthrough(pDecoder)) {
+        ma_ex_decoder__set_passthrough(pDecoder, sampleRateIn == sampleRateOut);
+    }
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API ma_result ma_ex_decoder_set_rate_ratio(ma_decoder* pDecoder, float ratioInOut)
+{
+    ma_result result;
+
+    if (pDecoder == NULL || !(ratioInOut > 0)) {
+        return MA_INVALID_ARGS;
+    }
+
+    result = ma_data_converter_set_rate_ratio(&pDecoder->converter, ratioInOut);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    if (ma_ex_decoder__can_preserve_passthrough(pDecoder)) {
+        ma_ex_decoder__set_passthrough(pDecoder, ratioInOut == 1);
+    }
+
+    return MA_SUCCESS;
+}
+
+/*
+SIMD kernels
+
+The sample conversions used by ma_ex_decoder_read_pcm_frames() and the dot product used by the time stretch. Each has a
+reference implementation, which the vector versions also use for the frames left over at the end.
+
+The conversions are run in place, from a narrower input at the end of the buffer to the wider output at the start of
+it. Going front to back, every block of output only overwrites input that's already been converted, as long as the
+block's input is loaded before its output is stored.
+*/
+typedef void (* ma_ex_s16_to_f32_proc)(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 count);
+typedef void (* ma_ex_f32_to_f32_proc)(float* pFramesOut, const float* pFramesIn, ma_uint64 count);
+typedef float (* ma_ex_dot_f32_proc)(const float* pA, const float* pB, ma_uint32 count);
+
+/* Same scale as miniaudio's s16 to f32 conversion. A power of two, so every kernel gives identical results. */
+#define MA_EX_S16_TO_F32_SCALE  0.000030517578125f
+
+static void ma_ex_s16_to_f32__reference(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 sampleCount)
+{
+    ma_uint64 i;
+
+    for (i = 0; i < sampleCount; i += 1) {
+        pFramesOut[i] = pFramesIn[i] * MA_EX_S16_TO_F32_SCALE;
+    }
+}
+
+static void ma_ex_s16_mono_to_f32_stereo__reference(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount; iFrame += 1) {
+        float x = pFramesIn[iFrame] * MA_EX_S16_TO_F32_SCALE;
+        pFramesOut[iFrame*2 + 0] = x;
+        pFramesOut[iFrame*2 + 1] = x;
+    }
+}
+
+static void ma_ex_f32_mono_to_stereo__reference(float* pFramesOut, const float* pFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount; iFrame += 1) {
+        float x = pFramesIn[iFrame];
+        pFramesOut[iFrame*2 + 0] = x;
+        pFramesOut[iFrame*2 + 1] = x;
+    }
+}
+
+static float ma_ex_dot_f32__reference(const float* pA, const float* pB, ma_uint32 count)
+{
+    float sum = 0;
+    ma_uint32 i;
+
+    for (i = 0; i < count; i += 1) {
+        sum += pA[i] * pB[i];
+    }
+
+    return sum;
+}
+
+#if defined(MA_EX_X86)
+MA_EX_TARGET_SSE2
+static void ma_ex_s16_to_f32__sse2(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 sampleCount)
+{
+    __m128 scale = _mm_set1_ps(MA_EX_S16_TO_F32_SCALE);
+    ma_uint64 sampleCount8 = sampleCount & ~(ma_uint64)7;
+    ma_uint64 i;
+
+    for (i = 0; i < sampleCount8; i += 8) {
+        __m128i x  = _mm_loadu_si128((const __m128i*)(pFramesIn + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+        _mm_storeu_ps(pFramesOut + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(pFramesOut + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+
+    ma_ex_s16_to_f32__reference(pFramesOut + i, pFramesIn + i, sampleCount - i);
+}
+
+MA_EX_TARGET_SSE2
+static void ma_ex_s16_mono_to_f32_stereo__sse2(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 frameCount)
+{
+    __m128 scale = _mm_set1_ps(MA_EX_S16_TO_F32_SCALE);
+    ma_uint64 frameCount8 = frameCount & ~(ma_uint64)7;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount8; iFrame += 8) {
+        __m128i x  = _mm_loadu_si128((const __m128i*)(pFramesIn + iFrame));
+        __m128  lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), scale);
+        __m128  hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), scale);
+        _mm_storeu_ps(pFramesOut + iFrame*2 +  0, _mm_unpacklo_ps(lo, lo));
+        _mm_storeu_ps(pFramesOut + iFrame*2 +  4, _mm_unpackhi_ps(lo, lo));
+        _mm_storeu_ps(pFramesOut + iFrame*2 +  8, _mm_unpacklo_ps(hi, hi));
+        _mm_storeu_ps(pFramesOut + iFrame*2 + 12, _mm_unpackhi_ps(hi, hi));
+    }
+
+    ma_ex_s16_mono_to_f32_stereo__reference(pFramesOut + iFrame*2, pFramesIn + iFrame, frameCount - iFrame);
+}
+
+MA_EX_TARGET_SSE2
+static void ma_ex_f32_mono_to_stereo__sse2(float* pFramesOut, const float* pFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 frameCount4 = frameCount & ~(ma_uint64)3;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount4; iFrame += 4) {
+        __m128 x = _mm_loadu_ps(pFramesIn + iFrame);
+        _mm_storeu_ps(pFramesOut + iFrame*2 + 0, _mm_unpacklo_ps(x, x));
+        _mm_storeu_ps(pFramesOut + iFrame*2 + 4, _mm_unpackhi_ps(x, x));
+    }
+
+    ma_ex_f32_mono_to_stereo__reference(pFramesOut + iFrame*2, pFramesIn + iFrame, frameCount - iFrame);
+}
+
+MA_EX_TARGET_SSE2
+static float ma_ex_dot_f32__sse2(const float* pA, const float* pB, ma_uint32 count)
+{
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    ma_uint32 count8 = count & ~7U;
+    ma_uint32 i;
+    float sum;
+
+    for (i = 0; i < count8; i += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(pA + i + 0), _mm_loadu_ps(pB + i + 0)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(pA + i + 4), _mm_loadu_ps(pB + i + 4)));
+    }
+
+    sum0 = _mm_add_ps(sum0, sum1);
+    sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+    sum0 = _mm_add_ss(sum0, _mm_shuffle_ps(sum0, sum0, 1));
+    sum  = _mm_cvtss_f32(sum0);
+
+    for (; i < count; i += 1) {
+        sum += pA[i] * pB[i];
+    }
+
+    return sum;
+}
+
+MA_EX_TARGET_AVX2
+static void ma_ex_s16_to_f32__avx2(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 sampleCount)
+{
+    __m256 scale = _mm256_set1_ps(MA_EX_S16_TO_F32_SCALE);
+    ma_uint64 sampleCount16 = sampleCount & ~(ma_uint64)15;
+    ma_uint64 i;
+
+    for (i = 0; i < sampleCount16; i += 16) {
+        __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pFramesIn + i + 0)));
+        __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pFramesIn + i + 8)));
+        _mm256_storeu_ps(pFramesOut + i + 0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+        _mm256_storeu_ps(pFramesOut + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    }
+
+    ma_ex_s16_to_f32__reference(pFramesOut + i, pFramesIn + i, sampleCount - i);
+}
+
+MA_EX_TARGET_AVX2
+static void ma_ex_s16_mono_to_f32_stereo__avx2(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 frameCount)
+{
+    __m256 scale = _mm256_set1_ps(MA_EX_S16_TO_F32_SCALE);
+    ma_uint64 frameCount8 = frameCount & ~(ma_uint64)7;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount8; iFrame += 8) {
+        __m256 x  = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(pFramesIn + iFrame)))), scale);
+        __m256 lo = _mm256_unpacklo_ps(x, x);   /* 0 0 1 1 | 4 4 5 5 */
+        __m256 hi = _mm256_unpackhi_ps(x, x);   /* 2 2 3 3 | 6 6 7 7 */
+        _mm256_storeu_ps(pFramesOut + iFrame*2 + 0, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(pFramesOut + iFrame*2 + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    ma_ex_s16_mono_to_f32_stereo__reference(pFramesOut + iFrame*2, pFramesIn + iFrame, frameCount - iFrame);
+}
+
+MA_EX_TARGET_AVX2
+static void ma_ex_f32_mono_to_stereo__avx2(float* pFramesOut, const float* pFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 frameCount8 = frameCount & ~(ma_uint64)7;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount8; iFrame += 8) {
+        __m256 x  = _mm256_loadu_ps(pFramesIn + iFrame);
+        __m256 lo = _mm256_unpacklo_ps(x, x);
+        __m256 hi = _mm256_unpackhi_ps(x, x);
+        _mm256_storeu_ps(pFramesOut + iFrame*2 + 0, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(pFramesOut + iFrame*2 + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    ma_ex_f32_mono_to_stereo__reference(pFramesOut + iFrame*2, pFramesIn + iFrame, frameCount - iFrame);
+}
+
+MA_EX_TARGET_AVX2
+static float ma_ex_dot_f32__avx2(const float* pA, const float* pB, ma_uint32 count)
+{
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m128 sum4;
+    ma_uint32 count16 = count & ~15U;
+    ma_uint32 i;
+    float sum;
+
+    for (i = 0; i < count16; i += 16) {
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(pA + i + 0), _mm256_loadu_ps(pB + i + 0)));
+        sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(pA + i + 8), _mm256_loadu_ps(pB + i + 8)));
+    }
+
+    sum0 = _mm256_add_ps(sum0, sum1);
+    sum4 = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+    sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+    sum4 = _mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 1));
+    sum  = _mm_cvtss_f32(sum4);
+
+    for (; i < count; i += 1) {
+        sum += pA[i] * pB[i];
+    }
+
+    return sum;
+}
+
+static ma_bool32 ma_ex_has_sse2(void)
+{
+    #if defined(_MSC_VER)
+    {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[3] & (1 << 26)) != 0;
+    }
+    #else
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2") != 0;
+    }
+    #endif
+}
+
+static ma_bool32 ma_ex_has_avx2(void)
+{
+    #if defined(_MSC_VER)
+    {
+        int info[4];
+
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return MA_FALSE;
+        }
+
+        /* AVX and OSXSAVE must be set, and the OS must be saving YMM state. */
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) {
+            return MA_FALSE;
+        }
+        if ((_xgetbv(0) & 6) != 6) {
+            return MA_FALSE;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }
+    #else
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }
+    #endif
+}
+
+/* Only used for the AVX2 build of the decoding path, which the compiler is free to use FMA instructions in. */
+static ma_bool32 ma_ex_has_fma(void)
+{
+    #if defined(_MSC_VER)
+    {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 12)) != 0;
+    }
+    #else
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("fma") != 0;
+    }
+    #endif
+}
+#endif  /* MA_EX_X86 */
+
+#if defined(MA_EX_NEON)
+static void ma_ex_s16_to_f32__neon(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 sampleCount)
+{
+    ma_uint64 sampleCount8 = sampleCount & ~(ma_uint64)7;
+    ma_uint64 i;
+
+    for (i = 0; i < sampleCount8; i += 8) {
+        int16x8_t x = vld1q_s16(pFramesIn + i);
+        vst1q_f32(pFramesOut + i + 0, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))),  MA_EX_S16_TO_F32_SCALE));
+        vst1q_f32(pFramesOut + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), MA_EX_S16_TO_F32_SCALE));
+    }
+
+    ma_ex_s16_to_f32__reference(pFramesOut + i, pFramesIn + i, sampleCount - i);
+}
+
+static void ma_ex_s16_mono_to_f32_stereo__neon(float* pFramesOut, const ma_int16* pFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 frameCount8 = frameCount & ~(ma_uint64)7;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount8; iFrame += 8) {
+        int16x8_t x = vld1q_s16(pFramesIn + iFrame);
+        float32x4x2_t lo;
+        float32x4x2_t hi;
+        lo.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))),  MA_EX_S16_TO_F32_SCALE);
+        hi.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), MA_EX_S16_TO_F32_SCALE);
+        lo.val[1] = lo.val[0];
+        hi.val[1] = hi.val[0];
+        vst2q_f32(pFramesOut + iFrame*2 + 0, lo);
+        vst2q_f32(pFramesOut + iFrame*2 + 8, hi);
+    }
+
+    ma_ex_s16_mono_to_f32_stereo__reference(pFramesOut + iFrame*2, pFramesIn + iFrame, frameCount - iFrame);
+}
+
+static void ma_ex_f32_mono_to_stereo__neon(float* pFramesOut, const float* pFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 frameCount4 = frameCount & ~(ma_uint64)3;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount4; iFrame += 4) {
+        float32x4x2_t x;
+        x.val[0] = vld1q_f32(pFramesIn + iFrame);
+        x.val[1] = x.val[0];
+        vst2q_f32(pFramesOut + iFrame*2, x);
+    }
+
+    ma_ex_f32_mono_to_stereo__reference(pFramesOut + iFrame*2, pFramesIn + iFrame, frameCount - iFrame);
+}
+
+static float ma_ex_dot_f32__neon(const float* pA, const float* pB, ma_uint32 count)
+{
+    float32x4_t sum0 = vdupq_n_f32(0);
+    float32x4_t sum1 = vdupq_n_f32(0);
+    ma_uint32 count8 = count & ~7U;
+    ma_uint32 i;
+    float sum;
+
+    for (i = 0; i < count8; i += 8) {
+        sum0 = vaddq_f32(sum0, vmulq_f32(vld1q_f32(pA + i + 0), vld1q_f32(pB + i + 0)));
+        sum1 = vaddq_f32(sum1, vmulq_f32(vld1q_f32(pA + i + 4), vld1q_f32(pB + i + 4)));
+    }
+
+    sum0 = vaddq_f32(sum0, sum1);
+    sum  = (vgetq_lane_f32(sum0, 0) + vgetq_lane_f32(sum0, 1)) + (vgetq_lane_f32(sum0, 2) + vgetq_lane_f32(sum0, 3));
+
+    for (; i < count; i += 1) {
+        sum += pA[i] * pB[i];
+    }
+
+    return sum;
+}
+#endif  /* MA_EX_NEON */
+
+static ma_ex_s16_to_f32_proc g_ma_ex_s16_to_f32                 = ma_ex_s16_to_f32__reference;
+static ma_ex_s16_to_f32_proc g_ma_ex_s16_mono_to_f32_stereo     = ma_ex_s16_mono_to_f32_stereo__reference;
+static ma_ex_f32_to_f32_proc g_ma_ex_f32_mono_to_stereo         = ma_ex_f32_mono_to_stereo__reference;
+static ma_ex_dot_f32_proc    g_ma_ex_dot_f32                    = ma_ex_dot_f32__reference;
+
+static ma_spinlock g_ma_ex_simd_lock = 0;
+static ma_bool32 g_ma_ex_is_simd_initialized = MA_FALSE;
+
+static void ma_ex_init_simd(void)
+{
+    ma_spinlock_lock(&g_ma_ex_simd_lock);
+    {
+        if (!g_ma_ex_is_simd_initialized) {
+            #if defined(MA_EX_X86)
+            {
+                if (ma_ex_has_avx2()) {
+                    g_ma_ex_s16_to_f32             = ma_ex_s16_to_f32__avx2;
+                    g_ma_ex_s16_mono_to_f32_stereo = ma_ex_s16_mono_to_f32_stereo__avx2;
+                    g_ma_ex_f32_mono_to_stereo     = ma_ex_f32_mono_to_stereo__avx2;
+                    g_ma_ex_dot_f32                = ma_ex_dot_f32__avx2;
+
+                    #if defined(MA_EX_HAS_AVX2_BUILD)
+                    {
+                        if (ma_ex_has_fma()) {
+                            g_ma_ex_decoder_init             = ma_ex_avx2_decoder_init;
+                            g_ma_ex_decoder_init_file        = ma_ex_avx2_decoder_init_file;
+                            g_ma_ex_decoder_init_memory      = ma_ex_avx2_decoder_init_memory;
+                            g_ma_ex_decoder_read_pcm_frames  = ma_ex_avx2_decoder_read_pcm_frames;
+                            g_ma_ex_data_converter_init      = ma_ex_avx2_data_converter_init;
+                        }
+                    }
+                    #endif
+                } else if (ma_ex_has_sse2()) {
+                    g_ma_ex_s16_to_f32             = ma_ex_s16_to_f32__sse2;
+                    g_ma_ex_s16_mono_to_f32_stereo = ma_ex_s16_mono_to_f32_stereo__sse2;
+                    g_ma_ex_f32_mono_to_stereo     = ma_ex_f32_mono_to_stereo__sse2;
+                    g_ma_ex_dot_f32                = ma_ex_dot_f32__sse2;
+                }
+            }
+            #elif defined(MA_EX_NEON)
+            {
+                g_ma_ex_s16_to_f32             = ma_ex_s16_to_f32__neon;
+                g_ma_ex_s16_mono_to_f32_stereo = ma_ex_s16_mono_to_f32_stereo__neon;
+                g_ma_ex_f32_mono_to_stereo     = ma_ex_f32_mono_to_stereo__neon;
+                g_ma_ex_dot_f32                = ma_ex_dot_f32__neon;
+            }
+            #endif
+
+            g_ma_ex_is_simd_initialized = MA_TRUE;
+        }
+    }
+    ma_spinlock_unlock(&g_ma_ex_simd_lock);
+}
+
+/*
+Fused reads
+
+When the converter does nothing but widen s16 to f32 and/or duplicate mono to stereo, ma_decoder_read_pcm_frames() still
+reads the backend into a 4KB buffer on the stack and converts out of it a slice at a time. ma_ex_decoder_read_pcm_frames()
+instead reads the backend straight into the end of the caller's buffer and converts it in place, so a read is normally
+one backend call and one pass of a SIMD kernel. Anything else is forwarded to ma_decoder_read_pcm_frames().
+
+Decoders initialized with ma_ex_decoder_init*() read through here when used as a data source, so sounds and data
+source chains pick it up too.
+*/
+typedef enum
+{
+    ma_ex_decoder_fused_path_none,
+    ma_ex_decoder_fused_path_s16_to_f32,
+    ma_ex_decoder_fused_path_s16_mono_to_f32_stereo,
+    ma_ex_decoder_fused_path_f32_mono_to_stereo
+} ma_ex_decoder_fused_path;
+
+static ma_ex_decoder_fused_path ma_ex_decoder__get_fused_path(const ma_decoder* pDecoder)
+{
+    const ma_data_converter* pConverter = &pDecoder->converter;
+
+    if (pConverter->isPassthrough || pConverter->hasResampler || pConverter->formatOut != ma_format_f32) {
+        return ma_ex_decoder_fused_path_none;
+    }
+
+    /* The input cache is only used with a resampler, but anything left in it has to come out first. */
+    if (pDecoder->inputCacheRemaining > 0) {
+        return ma_ex_decoder_fused_path_none;
+    }
+
+    if (!pConverter->hasChannelConverter) {
+        if (pConverter->formatIn == ma_format_s16) {
+            return ma_ex_decoder_fused_path_s16_to_f32;
+        }
+
+        return ma_ex_decoder_fused_path_none;
+    }
+
+    /* The mono expansion path copies the mono channel to every output channel, which for stereo is both. */
+    if (pConverter->channelsIn == 1 && pConverter->channelsOut == 2 && pConverter->channelConverter.conversionPath == ma_channel_conversion_path_mono_in) {
+        if (pConverter->formatIn == ma_format_s16) {
+            return ma_ex_decoder_fused_path_s16_mono_to_f32_stereo;
+        }
+        if (pConverter->formatIn == ma_format_f32) {
+            return ma_ex_decoder_fused_path_f32_mono_to_stereo;
+        }
+    }
+
+    return ma_ex_decoder_fused_path_none;
+}
+
+MA_EX_API ma_result ma_ex_decoder_read_pcm_frames(ma_decoder* pDecoder, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    ma_ex_decoder_fused_path fusedPath;
+    ma_uint32 bytesPerFrameIn;
+    ma_uint32 bytesPerFrameOut;
+    ma_uint64 totalFramesRead = 0;
+
+    if (pFramesRead != NULL) {
+        *pFramesRead = 0;
+    }
+
+    if (pDecoder == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    fusedPath = ma_ex_decoder__get_fused_path(pDecoder);
+    if (fusedPath == ma_ex_decoder_fused_path_none || pFramesOut == NULL) {
+        return g_ma_ex_decoder_read_pcm_frames(pDecoder, pFramesOut, frameCount, pFramesRead);
+    }
+
+    bytesPerFrameIn  = ma_get_bytes_per_frame(pDecoder->converter.formatIn,  pDecoder->converter.channelsIn);
+    bytesPerFrameOut = ma_get_bytes_per_frame(pDecoder->converter.formatOut, pDecoder->converter.channelsOut);
+
+    while (totalFramesRead < frameCount) {
+        ma_uint64 framesToRead = frameCount - totalFramesRead;
+        ma_uint64 framesRead = 0;
+        ma_uint8* pRunningFramesOut = (ma_uint8*)pFramesOut + totalFramesRead*bytesPerFrameOut;
+        void* pRunningFramesIn = pRunningFramesOut + framesToRead*(bytesPerFrameOut - bytesPerFrameIn);
+        ma_result result;
+
+        result = ma_data_source_read_pcm_frames(pDecoder->pBackend, pRunningFramesIn, framesToRead, &framesRead);
+
+        switch (fusedPath)
+        {
+            case ma_ex_decoder_fused_path_s16_to_f32:
+            {
+                g_ma_ex_s16_to_f32((float*)pRunningFramesOut, (const ma_int16*)pRunningFramesIn, framesRead * pDecoder->converter.channelsIn);
+            } break;
+
+            case ma_ex_decoder_fused_path_s16_mono_to_f32_stereo:
+            {
+                g_ma_ex_s16_mono_to_f32_stereo((float*)pRunningFramesOut, (const ma_int16*)pRunningFramesIn, framesRead);
+            } break;
+
+            case ma_ex_decoder_fused_path_f32_mono_to_stereo:
+            {
+                g_ma_ex_f32_mono_to_stereo((float*)pRunningFramesOut, (const float*)pRunningFramesIn, framesRead);
+            } break;
+
+            default: break;
+        }
+
+        totalFramesRead += framesRead;
+
+        if (result != MA_SUCCESS || framesRead == 0) {
+            break;
+        }
+    }
+
+    pDecoder->readPointerInPCMFrames += totalFramesRead;
+
+    if (pFramesRead != NULL) {
+        *pFramesRead = totalFramesRead;
+    }
+
+    if (totalFramesRead == 0 && frameCount > 0) {
+        return MA_AT_END;
+    }
+
+    return MA_SUCCESS;
+}
+
+static ma_result ma_ex_decoder_ds_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    return ma_ex_decoder_read_pcm_frames((ma_decoder*)pDataSource, pFramesOut, frameCount, pFramesRead);
+}
+
+static ma_result ma_ex_decoder_ds_seek(ma_data_source* pDataSource, ma_uint64 frameIndex)
+{
+    return ma_decoder_seek_to_pcm_frame((ma_decoder*)pDataSource, frameIndex);
+}
+
+static ma_result ma_ex_decoder_ds_get_data_format(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+{
+    return ma_decoder_get_data_format((ma_decoder*)pDataSource, pFormat, pChannels, pSampleRate, pChannelMap, channelMapCap);
+}
+
+static ma_result ma_ex_decoder_ds_get_cursor(ma_data_source* pDataSource, ma_uint64* pCursor)
+{
+    return ma_decoder_get_cursor_in_pcm_frames((ma_decoder*)pDataSource, pCursor);
+}
+
+static ma_result ma_ex_decoder_ds_get_length(ma_data_source* pDataSource, ma_uint64* pLength)
+{
+    return ma_decoder_get_length_in_pcm_frames((ma_decoder*)pDataSource, pLength);
+}
+
+/* Same as the upstream decoder's vtable apart from reads. */
+static ma_data_source_vtable g_ma_ex_decoder_ds_vtable =
+{
+    ma_ex_decoder_ds_read,
+    ma_ex_decoder_ds_seek,
+    ma_ex_decoder_ds_get_data_format,
+    ma_ex_decoder_ds_get_cursor,
+    ma_ex_decoder_ds_get_length,
+    NULL,   /* onSetLooping */
+    0
+};
+
+static void ma_ex_decoder__init_fused_read(ma_decoder* pDecoder)
+{
+    ma_ex_init_simd();
+    pDecoder->ds.vtable = &g_ma_ex_decoder_ds_vtable;
+}
+
+/*
+Time stretching
+
+This is WSOLA. The source is cut into overlapping sequences which are spliced back together, each one crossfaded into
+the tail of the last. The tempo is changed by advancing through the source faster or slower than the output, which
+drops or repeats whole sequences rather than resampling, so the pitch is unchanged. To avoid a phase jump at each
+splice, the start of the next sequence is searched for over a short window past its nominal position. The offset whose
+audio is most like the tail of the last sequence, by normalized cross-correlation, is the one spliced in.
+
+The search is where the time goes. Every candidate offset costs a dot product over the whole overlap, so that's the
+SIMD kernel. The energy of each candidate is updated incrementally as the window slides along.
+
+With a tempo of exactly 1 the source is read straight through. Stretching stops at a splice point so that there's no
+discontinuity on the way in or out.
+*/
+static ma_result ma_ex_time_stretch_ds_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    return ma_ex_time_stretch_read_pcm_frames((ma_ex_time_stretch*)pDataSource, pFramesOut, frameCount, pFramesRead);
+}
+
+static ma_result ma_ex_time_stretch_ds_seek(ma_data_source* pDataSource, ma_uint64 frameIndex)
+{
+    return ma_ex_time_stretch_seek_to_pcm_frame((ma_ex_time_stretch*)pDataSource, frameIndex);
+}
+
+static ma_result ma_ex_time_stretch_ds_get_data_format(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+{
+    return ma_ex_time_stretch_get_data_format((ma_ex_time_stretch*)pDataSource, pFormat, pChannels, pSampleRate, pChannelMap, channelMapCap);
+}
+
+static ma_result ma_ex_time_stretch_ds_get_cursor(ma_data_source* pDataSource, ma_uint64* pCursor)
+{
+    return ma_ex_time_stretch_get_cursor_in_pcm_frames((ma_ex_time_stretch*)pDataSource, pCursor);
+}
+
+static ma_result ma_ex_time_stretch_ds_get_length(ma_data_source* pDataSource, ma_uint64* pLength)
+{
+    return ma_ex_time_stretch_get_length_in_pcm_frames((ma_ex_time_stretch*)pDataSource, pLength);
+}
+
+static ma_data_source_vtable g_ma_ex_time_stretch_ds_vtable =
+{
+    ma_ex_time_stretch_ds_read,
+    ma_ex_time_stretch_ds_seek,
+    ma_ex_time_stretch_ds_get_data_format,
+    ma_ex_time_stretch_ds_get_cursor,
+    ma_ex_time_stretch_ds_get_length,
+    NULL,   /* onSetLooping */
+    0
+};
+
+MA_EX_API ma_ex_time_stretch_config ma_ex_time_stretch_config_init(ma_data_source* pDataSource, float tempo)
+{
+    ma_ex_time_stretch_config config;
+
+    MA_ZERO_OBJECT(&config);
+    config.pDataSource = pDataSource;
+    config.tempo       = tempo;
+
+    return config;
+}
+
+static ma_uint32 ma_ex_time_stretch__ms_to_frames(ma_uint32 ms, ma_uint32 defaultMs, ma_uint32 sampleRate)
+{
+    if (ms == 0) {
+        ms = defaultMs;
+    }
+
+    return (ma_uint32)(((ma_uint64)ms * sampleRate) / 1000);
+}
+
+MA_EX_API ma_result ma_ex_time_stretch_init(const ma_ex_time_stretch_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_ex_time_stretch* pTimeStretch)
+{
+    ma_result result;
+    ma_data_source_config dataSourceConfig;
+    size_t inputSizeInBytes;
+    size_t overlapSizeInBytes;
+
+    if (pTimeStretch == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    MA_ZERO_OBJECT(pTimeStretch);
+
+    if (pConfig == NULL || pConfig->pDataSource == NULL || !(pConfig->tempo > 0)) {
+        return MA_INVALID_ARGS;
+    }
+
+    result = ma_data_source_get_data_format(pConfig->pDataSource, &pTimeStretch->formatIn, &pTimeStretch->channels, &pTimeStretch->sampleRate, NULL, 0);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    if (pTimeStretch->channels == 0 || pTimeStretch->channels > MA_MAX_CHANNELS || pTimeStretch->sampleRate == 0) {
+        return MA_INVALID_ARGS;
+    }
+
+    pTimeStretch->pDataSource      = pConfig->pDataSource;
+    pTimeStretch->tempo            = pConfig->tempo;
+    pTimeStretch->sequenceFrames   = ma_ex_time_stretch__ms_to_frames(pConfig->sequenceMs,   MA_EX_TIME_STRETCH_DEFAULT_SEQUENCE_MS,    pTimeStretch->sampleRate);
+    pTimeStretch->seekWindowFrames = ma_ex_time_stretch__ms_to_frames(pConfig->seekWindowMs, MA_EX_TIME_STRETCH_DEFAULT_SEEK_WINDOW_MS, pTimeStretch->sampleRate);
+    pTimeStretch->overlapFrames    = ma_ex_time_stretch__ms_to_frames(pConfig->overlapMs,    MA_EX_TIME_STRETCH_DEFAULT_OVERLAP_MS,     pTimeStretch->sampleRate);
+
+    /* Each sequence starts and ends with an overlap and has to have something in between. */
+    if (pTimeStretch->overlapFrames == 0 || pTimeStretch->seekWindowFrames == 0 || pTimeStretch->sequenceFrames <= pTimeStretch->overlapFrames*2) {
+        return MA_INVALID_ARGS;
+    }
+
+    /* Enough input to search the whole window and then copy a full sequence from the far end of it. */
+    pTimeStretch->inputFrameCap = pTimeStretch->seekWindowFrames + pTimeStretch->sequenceFrames;
+
+    inputSizeInBytes   = (size_t)pTimeStretch->inputFrameCap * pTimeStretch->channels * sizeof(float);
+    overlapSizeInBytes = (size_t)pTimeStretch->overlapFrames * pTimeStretch->channels * sizeof(float);
+
+    /* Input and pending output are the same size since a flush can output everything that's buffered. */
+    pTimeStretch->_pHeap = ma_malloc(inputSizeInBytes*2 + overlapSizeInBytes*2, pAllocationCallbacks);
+    if (pTimeStretch->_pHeap == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    pTimeStretch->pInput   = (float*)pTimeStretch->_pHeap;
+    pTimeStretch->pPending = (float*)((ma_uint8*)pTimeStretch->_pHeap + inputSizeInBytes);
+    pTimeStretch->pMid     = (float*)((ma_uint8*)pTimeStretch->_pHeap + inputSizeInBytes*2);
+    pTimeStretch->pMidRef  = (float*)((ma_uint8*)pTimeStretch->_pHeap + inputSizeInBytes*2 + overlapSizeInBytes);
+
+    result = ma_data_source_get_cursor_in_pcm_frames(pConfig->pDataSource, &pTimeStretch->inputCursor);
+    if (result != MA_SUCCESS) {
+        pTimeStretch->inputCursor = 0;
+    }
+
+    dataSourceConfig = ma_data_source_config_init();
+    dataSourceConfig.vtable = &g_ma_ex_time_stretch_ds_vtable;
+
+    result = ma_data_source_init(&dataSourceConfig, &pTimeStretch->ds);
+    if (result != MA_SUCCESS) {
+        ma_free(pTimeStretch->_pHeap, pAllocationCallbacks);
+        pTimeStretch->_pHeap = NULL;
+        return result;
+    }
+
+    ma_ex_init_simd();
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API void ma_ex_time_stretch_uninit(ma_ex_time_stretch* pTimeStretch, const ma_allocation_callbacks* pAllocationCallbacks)
+{
+    if (pTimeStretch == NULL) {
+        return;
+    }
+
+    ma_data_source_uninit(&pTimeStretch->ds);
+    ma_free(pTimeStretch->_pHeap, pAllocationCallbacks);
+    pTimeStretch->_pHeap = NULL;
+}
+
+/* Reads from the source as f32, converting if the source is in some other format. */
+static ma_result ma_ex_time_stretch__read_source(ma_ex_time_stretch* pTimeStretch, float* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    ma_uint8 temp[MA_DATA_CONVERTER_STACK_BUFFER_SIZE];
+    ma_uint32 bytesPerFrameIn;
+    ma_uint64 tempCapInFrames;
+    ma_uint64 totalFramesRead = 0;
+
+    if (pTimeStretch->formatIn == ma_format_f32) {
+        return ma_data_source_read_pcm_frames(pTimeStretch->pDataSource, pFramesOut, frameCount, pFramesRead);
+    }
+
+    bytesPerFrameIn = ma_get_bytes_per_frame(pTimeStretch->formatIn, pTimeStretch->channels);
+    tempCapInFrames = sizeof(temp) / bytesPerFrameIn;
+    if (tempCapInFrames == 0) {
+        return MA_INVALID_ARGS;     /* Too many channels for the conversion buffer. */
+    }
+
+    while (totalFramesRead < frameCount) {
+        ma_uint64 framesToRead = frameCount - totalFramesRead;
+        ma_uint64 framesRead = 0;
+        ma_result result;
+
+        if (framesToRead > tempCapInFrames) {
+            framesToRead = tempCapInFrames;
+        }
+
+        result = ma_data_source_read_pcm_frames(pTimeStretch->pDataSource, temp, framesToRead, &framesRead);
+        ma_pcm_convert(pFramesOut + totalFramesRead*pTimeStretch->channels, ma_format_f32, temp, pTimeStretch->formatIn, framesRead*pTimeStretch->channels, ma_dither_mode_none);
+        totalFramesRead += framesRead;
+
+        if (result != MA_SUCCESS || framesRead < framesToRead) {
+            break;
+        }
+    }
+
+    *pFramesRead = totalFramesRead;
+    return (totalFramesRead == 0) ? MA_AT_END : MA_SUCCESS;
+}
+
+/* Tops up the input buffer, first discarding anything left to skip. Stops short only at the end of the source. */
+static void ma_ex_time_stretch__fill_input(ma_ex_time_stretch* pTimeStretch)
+{
+    ma_uint32 channels = pTimeStretch->channels;
+
+    while (pTimeStretch->skipRemaining > 0) {
+        ma_uint64 framesToSkip = pTimeStretch->skipRemaining;
+        ma_uint64 framesRead = 0;
+
+        MA_ASSERT(pTimeStretch->inputFrameCount == 0);
+
+        if (framesToSkip > pTimeStretch->inputFrameCap) {
+            framesToSkip = pTimeStretch->inputFrameCap;
+        }
+
+        ma_ex_time_stretch__read_source(pTimeStretch, pTimeStretch->pInput, framesToSkip, &framesRead);
+        pTimeStretch->skipRemaining -= framesRead;
+        pTimeStretch->inputCursor   += framesRead;
+
+        if (framesRead == 0) {
+            pTimeStretch->skipRemaining = 0;
+            return;
+        }
+    }
+
+    while (pTimeStretch->inputFrameCount < pTimeStretch->inputFrameCap) {
+        ma_uint64 framesRead = 0;
+
+        ma_ex_time_stretch__read_source(pTimeStretch, pTimeStretch->pInput + pTimeStretch->inputFrameCount*channels, pTimeStretch->inputFrameCap - pTimeStretch->inputFrameCount, &framesRead);
+        pTimeStretch->inputFrameCount += (ma_uint32)framesRead;
+
+        if (framesRead == 0) {
+            return;
+        }
+    }
+}
+
+/* Finds the offset into the input, less than searchFrameCount, that best continues from pMid. */
+static ma_uint32 ma_ex_time_stretch__find_best_offset(ma_ex_time_stretch* pTimeStretch, ma_uint32 searchFrameCount)
+{
+    ma_uint32 channels = pTimeStretch->channels;
+    ma_uint32 overlapFrames = pTimeStretch->overlapFrames;
+    ma_uint32 sampleCount = overlapFrames * channels;
+    const float* pInput = pTimeStretch->pInput;
+    double energy;
+    double bestScore = 0;
+    ma_uint32 bestOffset = 0;
+    ma_uint32 iFrame;
+    ma_uint32 iChannel;
+    ma_uint32 offset;
+
+    /* Weight the middle of the overlap over its edges. The scale doesn't matter since only the best score is kept. */
+    for (iFrame = 0; iFrame < overlapFrames; iFrame += 1) {
+        float weight = (float)iFrame * (float)(overlapFrames - iFrame);
+
+        for (iChannel = 0; iChannel < channels; iChannel += 1) {
+            pTimeStretch->pMidRef[iFrame*channels + iChannel] = pTimeStretch->pMid[iFrame*channels + iChannel] * weight;
+        }
+    }
+
+    energy = g_ma_ex_dot_f32(pInput, pInput, sampleCount);
+
+    for (offset = 0; offset < searchFrameCount; offset += 1) {
+        const float* pCandidate = pInput + offset*channels;
+        double score = g_ma_ex_dot_f32(pTimeStretch->pMidRef, pCandidate, sampleCount) / sqrt(energy + 1e-9);
+
+        if (offset == 0 || score > bestScore) {
+            bestScore  = score;
+            bestOffset = offset;
+        }
+
+        /* Slide the energy along by one frame. Clamped since rounding can take it just below zero on silence. */
+        if (offset + 1 < searchFrameCount) {
+            for (iChannel = 0; iChannel < channels; iChannel += 1) {
+                float sampleOut = pCandidate[iChannel];
+                float sampleIn  = pCandidate[sampleCount + iChannel];
+                energy += (double)sampleIn*sampleIn - (double)sampleOut*sampleOut;
+            }
+
+            if (energy < 0) {
+                energy = 0;
+            }
+        }
+    }
+
+    return bestOffset;
+}
+
+static void ma_ex_time_stretch__crossfade(float* pFramesOut, const float* pFrom, const float* pTo, ma_uint32 frameCount, ma_uint32 channels)
+{
+    float step = 1.0f / frameCount;
+    ma_uint32 iFrame;
+    ma_uint32 iChannel;
+
+    for (iFrame = 0; iFrame < frameCount; iFrame += 1) {
+        float t = iFrame * step;
+
+        for (iChannel = 0; iChannel < channels; iChannel += 1) {
+            ma_uint32 iSample = iFrame*channels + iChannel;
+            pFramesOut[iSample] = pFrom[iSample] + (pTo[iSample] - pFrom[iSample]) * t;
+        }
+    }
+}
+
+/*
+Drops frames from the front of the input. Anything past the end of the buffered input is skipped by the next fill. The
+cursor only moves over frames from the source, not over the padding.
+*/
+static void ma_ex_time_stretch__consume_input(ma_ex_time_stretch* pTimeStretch, ma_uint64 frameCount)
+{
+    ma_uint32 channels = pTimeStretch->channels;
+    ma_uint32 sourceFrameCount = pTimeStretch->inputFrameCount - pTimeStretch->paddedFrameCount;
+
+    if (frameCount < pTimeStretch->inputFrameCount) {
+        pTimeStretch->inputFrameCount -= (ma_uint32)frameCount;
+        memmove(pTimeStretch->pInput, pTimeStretch->pInput + frameCount*channels, (size_t)pTimeStretch->inputFrameCount * channels * sizeof(float));
+        pTimeStretch->inputCursor += (frameCount < sourceFrameCount) ? frameCount : sourceFrameCount;
+
+        if (pTimeStretch->paddedFrameCount > pTimeStretch->inputFrameCount) {
+            pTimeStretch->paddedFrameCount = pTimeStretch->inputFrameCount;
+        }
+    } else {
+        pTimeStretch->skipRemaining += frameCount - pTimeStretch->inputFrameCount;
+        pTimeStretch->inputCursor   += sourceFrameCount;
+        pTimeStretch->inputFrameCount  = 0;
+        pTimeStretch->paddedFrameCount = 0;
+    }
+}
+
+/* Drops the rest of the input, padding included, once the tail has been output. */
+static void ma_ex_time_stretch__end_tail(ma_ex_time_stretch* pTimeStretch)
+{
+    ma_ex_time_stretch__consume_input(pTimeStretch, pTimeStretch->inputFrameCount);
+    pTimeStretch->skipRemaining = 0;
+    pTimeStretch->skipFrac      = 0;
+    pTimeStretch->isPrimed      = MA_FALSE;
+    pTimeStretch->isAtEnd       = MA_FALSE;
+}
+
+/* Fills the rest of the input with silence. Used once the source has run out so the last of it can still be stretched. */
+static void ma_ex_time_stretch__pad_input(ma_ex_time_stretch* pTimeStretch)
+{
+    ma_uint32 channels = pTimeStretch->channels;
+    ma_uint32 paddingFrameCount = pTimeStretch->inputFrameCap - pTimeStretch->inputFrameCount;
+
+    memset(pTimeStretch->pInput + pTimeStretch->inputFrameCount*channels, 0, (size_t)paddingFrameCount * channels * sizeof(float));
+    pTimeStretch->inputFrameCount   = pTimeStretch->inputFrameCap;
+    pTimeStretch->paddedFrameCount += paddingFrameCount;
+}
+
+/* Outputs one sequence. The input buffer must be full. Returns the number of frames written, always sequence - overlap. */
+static ma_uint32 ma_ex_time_stretch__process_sequence(ma_ex_time_stretch* pTimeStretch, float tempo, float* pFramesOut)
+{
+    ma_uint32 channels = pTimeStretch->channels;
+    ma_uint32 overlapFrames = pTimeStretch->overlapFrames;
+    ma_uint32 sequenceFrames = pTimeStretch->sequenceFrames;
+    ma_uint32 sourceFrameCount = pTimeStretch->inputFrameCount - pTimeStretch->paddedFrameCount;
+    ma_uint32 searchFrameCount = pTimeStretch->seekWindowFrames;
+    ma_uint32 offset;
+    ma_uint64 advance;
+
+    MA_ASSERT(pTimeStretch->inputFrameCount == pTimeStretch->inputFrameCap);
+
+    /* Splicing in silence from the padding would cut off what's left of the source, so the search stays short of it. */
+    if (sourceFrameCount < searchFrameCount + overlapFrames) {
+        searchFrameCount = (sourceFrameCount > overlapFrames) ? sourceFrameCount - overlapFrames + 1 : 1;
+    }
+
+    if (!pTimeStretch->isPrimed) {
+        /* Nothing to splice onto. Crossfading the start of the input into itself makes the first overlap a straight copy. */
+        memcpy(pTimeStretch->pMid, pTimeStretch->pInput, (size_t)overlapFrames * channels * sizeof(float));
+        pTimeStretch->isPrimed = MA_TRUE;
+        offset = 0;
+    } else {
+        offset = ma_ex_time_stretch__find_best_offset(pTimeStretch, searchFrameCount);
+    }
+
+    ma_ex_time_stretch__crossfade(pFramesOut, pTimeStretch->pMid, pTimeStretch->pInput + offset*channels, overlapFrames, channels);
+    memcpy(pFramesOut + overlapFrames*channels, pTimeStretch->pInput + (offset + overlapFrames)*channels, (size_t)(sequenceFrames - overlapFrames*2) * channels * sizeof(float));
+    memcpy(pTimeStretch->pMid, pTimeStretch->pInput + (offset + sequenceFrames - overlapFrames)*channels, (size_t)overlapFrames * channels * sizeof(float));
+
+    pTimeStretch->skipFrac += (double)(sequenceFrames - overlapFrames) * tempo;
+    advance = (ma_uint64)pTimeStretch->skipFrac;
+    pTimeStretch->skipFrac -= (double)advance;
+
+    ma_ex_time_stretch__consume_input(pTimeStretch, advance);
+
+    return sequenceFrames - overlapFrames;
+}
+
+/*
+Splices the last sequence onto whatever input is buffered and outputs all of it, leaving the input empty. Used when going
+back to a tempo of 1, and at the end of the source while the tempo is 1. Returns the number of frames written, at most
+inputFrameCap.
+*/
+static ma_uint32 ma_ex_time_stretch__flush(ma_ex_time_stretch* pTimeStretch, float* pFramesOut)
+{
+    ma_uint32 channels = pTimeStretch->channels;
+    ma_uint32 overlapFrames = pTimeStretch->overlapFrames;
+    ma_uint32 inputFrameCount = pTimeStretch->inputFrameCount;
+    ma_uint32 framesWritten;
+
+    if (!pTimeStretch->isPrimed) {
+        memcpy(pFramesOut, pTimeStretch->pInput, (size_t)inputFrameCount * channels * sizeof(float));
+        framesWritten = inputFrameCount;
+    } else if (inputFrameCount < overlapFrames) {
+        /* Not enough left to splice onto. The tail of the last sequence goes out as it is with the rest after it. */
+        memcpy(pFramesOut, pTimeStretch->pMid, (size_t)overlapFrames * channels * sizeof(float));
+        memcpy(pFramesOut + overlapFrames*channels, pTimeStretch->pInput, (size_t)inputFrameCount * channels * sizeof(float));
+        framesWritten = overlapFrames + inputFrameCount;
+    } else {
+        ma_uint32 searchFrameCount = inputFrameCount - overlapFrames + 1;
+        ma_uint32 offset;
+
+        if (searchFrameCount > pTimeStretch->seekWindowFrames) {
+            searchFrameCount = pTimeStretch->seekWindowFrames;
+        }
+
+        offset = ma_ex_time_stretch__find_best_offset(pTimeStretch, searchFrameCount);
+
+        ma_ex_time_stretch__crossfade(pFramesOut, pTimeStretch->pMid, pTimeStretch->pInput + offset*channels, overlapFrames, channels);
+        memcpy(pFramesOut + overlapFrames*channels, pTimeStretch->pInput + (offset + overlapFrames)*channels, (size_t)(inputFrameCount - offset - overlapFrames) * channels * sizeof(float));
+        framesWritten = inputFrameCount - offset;
+    }
+
+    pTimeStretch->inputCursor    += inputFrameCount;
+    pTimeStretch->inputFrameCount = 0;
+    pTimeStretch->skipFrac        = 0;
+    pTimeStretch->isPrimed        = MA_FALSE;
+
+    return framesWritten;
+}
+
+MA_EX_API ma_result ma_ex_time_stretch_read_pcm_frames(ma_ex_time_stretch* pTimeStretch, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    float* pFramesOutF32 = (float*)pFramesOut;
+    ma_uint64 totalFramesRead = 0;
+    ma_uint32 channels;
+    float tempo;
+
+    if (pFramesRead != NULL) {
+        *pFramesRead = 0;
+    }
+
+    if (pTimeStretch == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    channels = pTimeStretch->channels;
+    tempo = ma_ex_time_stretch_get_tempo(pTimeStretch);
+
+    while (totalFramesRead < frameCount) {
+        ma_uint64 framesRemaining = frameCount - totalFramesRead;
+        float* pRunningFramesOut = (pFramesOutF32 != NULL) ? pFramesOutF32 + totalFramesRead*channels : NULL;
+        ma_bool32 isFlushing;
+        ma_uint32 maxFramesToWrite;
+        ma_uint32 framesWritten;
+        float* pDst;
+
+        /* Whatever didn't fit last time goes first. */
+        if (pTimeStretch->pendingFrameCount > 0) {
+            ma_uint64 framesToCopy = pTimeStretch->pendingFrameCount;
+            if (framesToCopy > framesRemaining) {
+                framesToCopy = framesRemaining;
+            }
+
+            if (pRunningFramesOut != NULL) {
+                memcpy(pRunningFramesOut, pTimeStretch->pPending + pTimeStretch->pendingFrameOffset*channels, (size_t)framesToCopy * channels * sizeof(float));
+            }
+
+            pTimeStretch->pendingFrameCount  -= (ma_uint32)framesToCopy;
+            pTimeStretch->pendingFrameOffset += (ma_uint32)framesToCopy;
+            totalFramesRead += framesToCopy;
+            continue;
+        }
+
+        if (tempo == 1 && !pTimeStretch->isPrimed && pTimeStretch->inputFrameCount == 0 && pTimeStretch->skipRemaining == 0 && pRunningFramesOut != NULL) {
+            ma_uint64 framesRead = 0;
+
+            ma_ex_time_stretch__read_source(pTimeStretch, pRunningFramesOut, framesRemaining, &framesRead);
+            pTimeStretch->inputCursor += framesRead;
+            totalFramesRead += framesRead;
+
+            if (framesRead == 0) {
+                break;
+            }
+
+            continue;
+        }
+
+        ma_ex_time_stretch__fill_input(pTimeStretch);
+
+        if (pTimeStretch->inputFrameCount == 0 && !pTimeStretch->isPrimed) {
+            break;  /* At the end. */
+        }
+
+        /*
+        When the source runs out the buffered input still has to be stretched, or the end of every stream would be cut
+        short at slow tempos and run long at fast ones. Sequences carry on over silence padding until the output is as
+        long as the rest of the source at this tempo.
+        */
+        if (pTimeStretch->inputFrameCount < pTimeStretch->inputFrameCap && tempo != 1 && !pTimeStretch->isAtEnd) {
+            pTimeStretch->isAtEnd = MA_TRUE;
+            pTimeStretch->tailFrameCount = (ma_uint64)(pTimeStretch->inputFrameCount / tempo + 0.5);
+        }
+
+        if (pTimeStretch->isAtEnd) {
+            if (pTimeStretch->tailFrameCount == 0) {
+                ma_ex_time_stretch__end_tail(pTimeStretch);
+                break;
+            }
+
+            ma_ex_time_stretch__pad_input(pTimeStretch);
+        }
+
+        isFlushing = !pTimeStretch->isAtEnd && ((pTimeStretch->inputFrameCount < pTimeStretch->inputFrameCap) || (tempo == 1 && pTimeStretch->isPrimed));
+        if (isFlushing) {
+            maxFramesToWrite = (pTimeStretch->isPrimed && pTimeStretch->inputFrameCount < pTimeStretch->overlapFrames) ? pTimeStretch->overlapFrames + pTimeStretch->inputFrameCount : pTimeStretch->inputFrameCount;
+        } else {
+            maxFramesToWrite = pTimeStretch->sequenceFrames - pTimeStretch->overlapFrames;
+        }
+
+        /* Straight into the output when it fits, otherwise via the pending buffer. */
+        if (pRunningFramesOut != NULL && framesRemaining >= maxFramesToWrite) {
+            pDst = pRunningFramesOut;
+        } else {
+            pDst = pTimeStretch->pPending;
+        }
+
+        if (isFlushing) {
+            framesWritten = ma_ex_time_stretch__flush(pTimeStretch, pDst);
+        } else {
+            framesWritten = ma_ex_time_stretch__process_sequence(pTimeStretch, tempo, pDst);
+
+            /* Whatever the last sequence has past the end of the tail is dropped. */
+            if (pTimeStretch->isAtEnd) {
+                if (framesWritten > pTimeStretch->tailFrameCount) {
+                    framesWritten = (ma_uint32)pTimeStretch->tailFrameCount;
+                }
+
+                pTimeStretch->tailFrameCount -= framesWritten;
+                if (pTimeStretch->tailFrameCount == 0) {
+                    ma_ex_time_stretch__end_tail(pTimeStretch);
+                }
+            }
+        }
+
+        if (pDst == pTimeStretch->pPending) {
+            pTimeStretch->pendingFrameCount  = framesWritten;
+            pTimeStretch->pendingFrameOffset = 0;
+        } else {
+            totalFramesRead += framesWritten;
+        }
+    }
+
+    if (pFramesRead != NULL) {
+        *pFramesRead = totalFramesRead;
+    }
+
+    if (totalFramesRead == 0) {
+        return MA_AT_END;
+    }
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API ma_result ma_ex_time_stretch_seek_to_pcm_frame(ma_ex_time_stretch* pTimeStretch, ma_uint64 frameIndex)
+{
+    ma_result result;
+
+    if (pTimeStretch == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    result = ma_data_source_seek_to_pcm_frame(pTimeStretch->pDataSource, frameIndex);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    pTimeStretch->inputCursor        = frameIndex;
+    pTimeStretch->tailFrameCount     = 0;
+    pTimeStretch->inputFrameCount    = 0;
+    pTimeStretch->paddedFrameCount   = 0;
+    pTimeStretch->skipRemaining      = 0;
+    pTimeStretch->skipFrac           = 0;
+    pTimeStretch->pendingFrameCount  = 0;
+    pTimeStretch->pendingFrameOffset = 0;
+    pTimeStretch->isPrimed           = MA_FALSE;
+    pTimeStretch->isAtEnd            = MA_FALSE;
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API ma_result ma_ex_time_stretch_get_data_format(ma_ex_time_stretch* pTimeStretch, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+{
+    if (pFormat != NULL) {
+        *pFormat = ma_format_unknown;
+    }
+    if (pChannels != NULL) {
+        *pChannels = 0;
+    }
+    if (pSampleRate != NULL) {
+        *pSampleRate = 0;
+    }
+
+    if (pTimeStretch == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (pFormat != NULL) {
+        *pFormat = ma_format_f32;
+    }
+    if (pChannels != NULL) {
+        *pChannels = pTimeStretch->channels;
+    }
+    if (pSampleRate != NULL) {
+        *pSampleRate = pTimeStretch->sampleRate;
+    }
+
+    if (pChannelMap != NULL && channelMapCap > 0) {
+        return ma_data_source_get_data_format(pTimeStretch->pDataSource, NULL, NULL, NULL, pChannelMap, channelMapCap);
+    }
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API ma_result ma_ex_time_stretch_get_cursor_in_pcm_frames(ma_ex_time_stretch* pTimeStretch, ma_uint64* pCursor)
+{
+    if (pCursor == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *pCursor = 0;
+
+    if (pTimeStretch == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    /* The position in the source of the audio that's being stretched. Ahead of what's been output by up to a sequence. */
+    *pCursor = pTimeStretch->inputCursor;
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API ma_result ma_ex_time_stretch_get_length_in_pcm_frames(ma_ex_time_stretch* pTimeStretch, ma_uint64* pLength)
+{
+    if (pLength == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *pLength = 0;
+
+    if (pTimeStretch == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    return ma_data_source_get_length_in_pcm_frames(pTimeStretch->pDataSource, pLength);
+}
+
+MA_EX_API ma_result ma_ex_time_stretch_set_tempo(ma_ex_time_stretch* pTimeStretch, float tempo)
+{
+    if (pTimeStretch == NULL || !(tempo > 0)) {
+        return MA_INVALID_ARGS;
+    }
+
+    ma_spinlock_lock(&pTimeStretch->lock);
+    {
+        pTimeStretch->tempo = tempo;
+    }
+    ma_spinlock_unlock(&pTimeStretch->lock);
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API float ma_ex_time_stretch_get_tempo(ma_ex_time_stretch* pTimeStretch)
+{
+    float tempo;
+
+    if (pTimeStretch == NULL) {
+        return 0;
+    }
+
+    ma_spinlock_lock(&pTimeStretch->lock);
+    {
+        tempo = pTimeStretch->tempo;
+    }
+    ma_spinlock_unlock(&pTimeStretch->lock);
+
+    return tempo;
+}
+
+/*
+Content sniffing
+
+Upstream, ma_decoder_init_file() with no encoding format tries every custom backend before the built-in ones, and then
+picks a built-in one by extension before falling back to trying them all in turn. With the libvorbis backend that means
+a full ov_open_callbacks() on every WAV, FLAC and MP3 file, and each failed attempt seeks back to the start. Looking at
+the first few bytes is enough to tell the formats we have backends for apart, so ma_ex_decoder_init_file() and
+ma_ex_decoder_init_memory() work it out up front and pass it on as the encoding format. A file that doesn't look like
+anything we know, or that fails to open as what it looked like, goes through the upstream trial and error as before.
+
+An ID3v2 tag at the start is skipped since they're used on FLAC files as well as MP3 files. Ogg is only reported as
+Vorbis when the first packet says so. Ogg FLAC is reported as FLAC since dr_flac handles both.
+*/
+static ma_uint32 ma_ex__be32(const ma_uint8* p)
+{
+    return ((ma_uint32)p[0] << 24) | ((ma_uint32)p[1] << 16) | ((ma_uint32)p[2] << 8) | (ma_uint32)p[3];
+}
+
+static ma_uint32 ma_ex__le32(const ma_uint8* p)
+{
+    return ((ma_uint32)p[3] << 24) | ((ma_uint32)p[2] << 16) | ((ma_uint32)p[1] << 8) | (ma_uint32)p[0];
+}
+
+typedef struct
+{
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    ma_uint32 bitrate;              /* In bits per second. */
+    ma_uint32 frameSize;            /* In bytes, including the header. */
+    ma_uint32 samplesPerFrame;
+    ma_uint32 sideInfoSize;         /* Layer III only. The Xing header comes straight after it. */
+    ma_uint32 version;              /* As encoded. Used to check that consecutive frames belong together. */
+    ma_uint32 layer;
+} ma_ex_mp3_frame_header;
+
+static ma_bool32 ma_ex__parse_mp3_frame_header(const ma_uint8* pHeader, ma_ex_mp3_frame_header* pFrame)
+{
+    static const ma_uint16 bitratesKbps[5][15] =
+    {
+        { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 },  /* MPEG-1 Layer I */
+        { 0, 32, 48, 56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 384 },  /* MPEG-1 Layer II */
+        { 0, 32, 40, 48,  56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320 },  /* MPEG-1 Layer III */
+        { 0, 32, 48, 56,  64,  80,  96, 112, 128, 144, 160, 176, 192, 224, 256 },  /* MPEG-2/2.5 Layer I */
+        { 0,  8, 16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160 }   /* MPEG-2/2.5 Layer II and III */
+    };
+    static const ma_uint32 sampleRates[3] = { 44100, 48000, 32000 };
+    ma_uint32 version;
+    ma_uint32 layer;
+    ma_uint32 bitrateIndex;
+    ma_uint32 sampleRateIndex;
+    ma_uint32 padding;
+    ma_bool32 isMPEG1;
+
+    if (pHeader[0] != 0xFF || (pHeader[1] & 0xE0) != 0xE0) {
+        return MA_FALSE;
+    }
+
+    version         = (pHeader[1] >> 3) & 3;    /* 0 = MPEG-2.5, 1 = reserved, 2 = MPEG-2, 3 = MPEG-1 */
+    layer           = (pHeader[1] >> 1) & 3;    /* 0 = reserved, 1 = III, 2 = II, 3 = I */
+    bitrateIndex    =  pHeader[2] >> 4;
+    sampleRateIndex = (pHeader[2] >> 2) & 3;
+    padding         = (pHeader[2] >> 1) & 1;
+
+    if (version == 1 || layer == 0 || bitrateIndex == 0 || bitrateIndex == 15 || sampleRateIndex == 3) {
+        return MA_FALSE;    /* Free format streams are valid but too rare to be worth handling. */
+    }
+
+    isMPEG1 = (version == 3);
+
+    pFrame->version    = version;
+    pFrame->layer      = layer;
+    pFrame->channels   = ((pHeader[3] >> 6) == 3) ? 1 : 2;
+    pFrame->sampleRate = sampleRates[sampleRateIndex] >> (isMPEG1 ? 0 : (version == 2 ? 1 : 2));
+    pFrame->bitrate    = bitratesKbps[isMPEG1 ? (3 - layer) : (layer == 3 ? 3 : 4)][bitrateIndex] * 1000;
+
+    if (layer == 3) {
+        pFrame->samplesPerFrame = 384;
+        pFrame->frameSize       = (12 * pFrame->bitrate / pFrame->sampleRate + padding) * 4;
+    } else {
+        pFrame->samplesPerFrame = (layer == 1 && !isMPEG1) ? 576 : 1152;
+        pFrame->frameSize       = pFrame->samplesPerFrame / 8 * pFrame->bitrate / pFrame->sampleRate + padding;
+    }
+
+    if (isMPEG1) {
+        pFrame->sideInfoSize = (pFrame->channels == 1) ? 17 : 32;
+    } else {
+        pFrame->sideInfoSize = (pFrame->channels == 1) ?  9 : 17;
+    }
+
+    return MA_TRUE;
+}
+
+static ma_encoding_format ma_ex__get_encoding_format_from_path(const char* pFilePath)
+{
+    static const struct { const char* pExtension; ma_encoding_format encodingFormat; } extensions[] =
+    {
+        { "wav",  ma_encoding_format_wav    },
+        { "wave", ma_encoding_format_wav    },
+        { "flac", ma_encoding_format_flac   },
+        { "mp3",  ma_encoding_format_mp3    },
+        { "ogg",  ma_encoding_format_vorbis },
+        { "oga",  ma_encoding_format_vorbis }
+    };
+    const char* pExtension;
+    size_t iExtension;
+
+    pExtension = strrchr(pFilePath, '.');
+    if (pExtension == NULL || strchr(pExtension, '/') != NULL || strchr(pExtension, '\\') != NULL) {
+        return ma_encoding_format_unknown;
+    }
+
+    pExtension += 1;
+
+    for (iExtension = 0; iExtension < ma_countof(extensions); iExtension += 1) {
+        const char* a = pExtension;
+        const char* b = extensions[iExtension].pExtension;
+
+        while (*a != '\0' && (*a | 0x20) == *b) {
+            a += 1;
+            b += 1;
+        }
+
+        if (*a == '\0' && *b == '\0') {
+            return extensions[iExtension].encodingFormat;
+        }
+    }
+
+    return ma_encoding_format_unknown;
+}
+
+static size_t ma_ex__get_id3_tag_size(const ma_uint8* pData, size_t dataSize)
+{
+    if (dataSize < 10 || pData[0] != 'I' || pData[1] != 'D' || pData[2] != '3') {
+        return 0;
+    }
+
+    return 10 + ((size_t)(pData[6] & 0x7F) << 21) + ((size_t)(pData[7] & 0x7F) << 14) + ((size_t)(pData[8] & 0x7F) << 7) + (size_t)(pData[9] & 0x7F) + (((pData[5] & 0x10) != 0) ? 10 : 0);
+}
+
+/* Expects the data following any ID3v2 tag. */
+static ma_encoding_format ma_ex__sniff_encoding_format(const ma_uint8* pData, size_t dataSize)
+{
+    static const ma_uint8 w64Guid[16] = { 'r', 'i', 'f', 'f', 0x2E, 0x91, 0xCF, 0x11, 0xA5, 0xD6, 0x28, 0xDB, 0x04, 0xC1, 0x00, 0x00 };
+    ma_ex_mp3_frame_header frame;
+
+    if (dataSize >= 12 && (memcmp(pData, "RIFF", 4) == 0 || memcmp(pData, "RIFX", 4) == 0 || memcmp(pData, "RF64", 4) == 0) && memcmp(pData + 8, "WAVE", 4) == 0) {
+        return ma_encoding_format_wav;
+    }
+
+    if (dataSize >= 12 && memcmp(pData, "FORM", 4) == 0 && (memcmp(pData + 8, "AIFF", 4) == 0 || memcmp(pData + 8, "AIFC", 4) == 0)) {
+        return ma_encoding_format_wav;
+    }
+
+    if (dataSize >= 16 && memcmp(pData, w64Guid, 16) == 0) {
+        return ma_encoding_format_wav;
+    }
+
+    if (dataSize >= 4 && memcmp(pData, "fLaC", 4) == 0) {
+        return ma_encoding_format_flac;
+    }
+
+    if (dataSize >= 27 && memcmp(pData, "OggS", 4) == 0) {
+        size_t packetOffset = 27 + pData[26];
+
+        if (packetOffset + 7 <= dataSize && memcmp(pData + packetOffset, "\x01vorbis", 7) == 0) {
+            return ma_encoding_format_vorbis;
+        }
+
+        if (packetOffset + 5 <= dataSize && memcmp(pData + packetOffset, "\x7F" "FLAC", 5) == 0) {
+            return ma_encoding_format_flac;
+        }
+
+        return ma_encoding_format_unknown;  /* Opus or something else a custom backend might know about. */
+    }
+
+    if (dataSize >= 4 && ma_ex__parse_mp3_frame_header(pData, &frame)) {
+        return ma_encoding_format_mp3;
+    }
+
+    return ma_encoding_format_unknown;
+}
+
+static ma_encoding_format ma_ex__sniff_encoding_format_from_stdio(FILE* pFile)
+{
+    ma_uint8 header[MA_EX_SNIFF_SIZE];
+    size_t headerSize;
+    size_t tagSize;
+
+    if (ma_ex__fseek64(pFile, 0, SEEK_SET) != 0) {
+        return ma_encoding_format_unknown;
+    }
+
+    headerSize = fread(header, 1, sizeof(header), pFile);
+
+    tagSize = ma_ex__get_id3_tag_size(header, headerSize);
+    if (tagSize > 0) {
+        if (ma_ex__fseek64(pFile, (ma_int64)tagSize, SEEK_SET) != 0) {
+            return ma_encoding_format_unknown;
+        }
+
+        headerSize = fread(header, 1, sizeof(header), pFile);
+        if (headerSize == 0) {
+            return ma_encoding_format_unknown;
+        }
+    }
+
+    return ma_ex__sniff_encoding_format(header, headerSize);
+}
+
+MA_EX_API ma_encoding_format ma_ex_get_encoding_format_from_memory(const void* pData, size_t dataSize)
+{
+    size_t tagSize;
+
+    if (pData == NULL) {
+        return ma_encoding_format_unknown;
+    }
+
+    tagSize = ma_ex__get_id3_tag_size((const ma_uint8*)pData, dataSize);
+    if (tagSize > 0) {
+        if (tagSize >= dataSize) {
+            return ma_encoding_format_unknown;
+        }
+
+        pData     = (const ma_uint8*)pData + tagSize;
+        dataSize -= tagSize;
+    }
+
+    return ma_ex__sniff_encoding_format((const ma_uint8*)pData, dataSize);
+}
+
+MA_EX_API ma_encoding_format ma_ex_get_encoding_format_from_file(const char* pFilePath)
+{
+    ma_encoding_format encodingFormat;
+    FILE* pFile;
+
+    if (pFilePath == NULL || ma_fopen(&pFile, pFilePath, "rb") != MA_SUCCESS) {
+        return ma_encoding_format_unknown;
+    }
+
+    encodingFormat = ma_ex__sniff_encoding_format_from_stdio(pFile);
+    fclose(pFile);
+
+    return encodingFormat;
+}
+
+/*
+Probing
+
+Every file is opened once with stdio and each backend is given the same FILE through read/seek/tell callbacks, so a
+backend that doesn't recognize the file costs a failed header parse rather than another open. The backend the content
+sniffer picks goes first, or the one matching the extension if the sniffer doesn't know, and the rest are tried in
+order after it.
+
+MP3 and Ogg Vorbis lengths are estimated without touching the stream data. For MP3 that's the frame count in a Xing,
+Info or VBRI header, or the size of the audio data divided by the bitrate of the first frame for CBR files. For Ogg it's
+the granule position of the last page, which is exact for anything that starts at 0 and has a single logical stream.
+
+Batches use the same scheme as ma_libvorbis_decode_memory(). The calling thread and any jobs posted to the resource
+manager claim files one at a time until there are none left, and the shared state is refcounted so a job that only
+gets to run after we've returned can still safely find there's nothing to do.
+*/
+#define MA_EX_PROBE_MP3_SCAN_SIZE   8192    /* Enough for junk before the first frame plus the largest possible frame. */
+#define MA_EX_PROBE_OGG_TAIL_SIZE   65536   /* Larger than the largest possible Ogg page. */
+
+static ma_result ma_ex_probe__on_read(void* pUserData, void* pBufferOut, size_t bytesToRead, size_t* pBytesRead)
+{
+    FILE* pFile = (FILE*)pUserData;
+    size_t bytesRead;
+
+    bytesRead = fread(pBufferOut, 1, bytesToRead, pFile);
+
+    if (pBytesRead != NULL) {
+        *pBytesRead = bytesRead;
+    }
+
+    if (bytesRead < bytesToRead) {
+        if (ferror(pFile)) {
+            return MA_IO_ERROR;
+        }
+
+        if (bytesRead == 0) {
+            return MA_AT_END;
+        }
+    }
+
+    return MA_SUCCESS;
+}
+
+static ma_result ma_ex_probe__on_seek(void* pUserData, ma_int64 offset, ma_seek_origin origin)
+{
+    int whence = SEEK_SET;
+    int result;
+
+    if (origin == ma_seek_origin_current) {
+        whence = SEEK_CUR;
+    } else if (origin == ma_seek_origin_end) {
+        whence = SEEK_END;
+    }
+
+    result = ma_ex__fseek64((FILE*)pUserData, offset, whence);
+
+    return (result == 0) ? MA_SUCCESS : MA_BAD_SEEK;
+}
+
+static ma_result ma_ex_probe__on_tell(void* pUserData, ma_int64* pCursor)
+{
+    ma_int64 cursor;
+
+    cursor = ma_ex__ftell64((FILE*)pUserData);
+
+    if (cursor < 0) {
+        return MA_ERROR;
+    }
+
+    *pCursor = cursor;
+    return MA_SUCCESS;
+}
+
+/* Reads up to bufferSize bytes at the given offset. Anything short of that is only an error if nothing could be read. */
+static ma_result ma_ex_probe__read_at(FILE* pFile, ma_int64 offset, void* pBuffer, size_t bufferSize, size_t* pBytesRead)
+{
+    ma_result result;
+
+    *pBytesRead = 0;
+
+    result = ma_ex_probe__on_seek(pFile, offset, ma_seek_origin_start);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    return ma_ex_probe__on_read(pFile, pBuffer, bufferSize, pBytesRead);
+}
+
+static ma_result ma_ex_probe__wav(FILE* pFile, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo)
+{
+    #if !defined(MA_NO_WAV)
+    {
+        ma_result result;
+        ma_decoding_backend_config backendConfig = ma_decoding_backend_config_init(ma_format_unknown, 0);
+        ma_wav wav;
+
+        result = ma_wav_init(ma_ex_probe__on_read, ma_ex_probe__on_seek, ma_ex_probe__on_tell, pFile, &backendConfig, &pConfig->allocationCallbacks, &wav);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        result = ma_wav_get_data_format(&wav, &pInfo->format, &pInfo->channels, &pInfo->sampleRate, NULL, 0);
+        if (result == MA_SUCCESS) {
+            result = ma_wav_get_length_in_pcm_frames(&wav, &pInfo->lengthInPCMFrames);
+        }
+
+        ma_wav_uninit(&wav, &pConfig->allocationCallbacks);
+
+        return result;
+    }
+    #else
+    {
+        (void)pFile;
+        (void)pConfig;
+        (void)pInfo;
+        return MA_NO_BACKEND;
+    }
+    #endif
+}
+
+static ma_result ma_ex_probe__flac(FILE* pFile, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo)
+{
+    #if !defined(MA_NO_FLAC)
+    {
+        ma_result result;
+        ma_decoding_backend_config backendConfig = ma_decoding_backend_config_init(ma_format_unknown, 0);
+        ma_flac flac;
+
+        result = ma_flac_init(ma_ex_probe__on_read, ma_ex_probe__on_seek, ma_ex_probe__on_tell, pFile, &backendConfig, &pConfig->allocationCallbacks, &flac);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        /* The length comes from STREAMINFO. It's 0 when the encoder didn't know it, which is also what we report. */
+        result = ma_flac_get_data_format(&flac, &pInfo->format, &pInfo->channels, &pInfo->sampleRate, NULL, 0);
+        if (result == MA_SUCCESS) {
+            result = ma_flac_get_length_in_pcm_frames(&flac, &pInfo->lengthInPCMFrames);
+        }
+
+        ma_flac_uninit(&flac, &pConfig->allocationCallbacks);
+
+        return result;
+    }
+    #else
+    {
+        (void)pFile;
+        (void)pConfig;
+        (void)pInfo;
+        return MA_NO_BACKEND;
+    }
+    #endif
+}
+
+static ma_result ma_ex_probe__mp3_estimate(FILE* pFile, ma_int64 fileSize, ma_ex_probe_info* pInfo)
+{
+    ma_result result;
+    ma_uint8 buffer[MA_EX_PROBE_MP3_SCAN_SIZE];
+    size_t bytesRead;
+    ma_int64 audioStart = 0;
+    ma_int64 audioEnd = fileSize;
+    ma_ex_mp3_frame_header frame;
+    size_t iByte;
+
+    result = ma_ex_probe__read_at(pFile, 0, buffer, 10, &bytesRead);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    /* Skip over an ID3v2 tag. These can be large when there's cover art in them. */
+    if (bytesRead == 10 && buffer[0] == 'I' && buffer[1] == 'D' && buffer[2] == '3') {
+        audioStart = 10 + (((ma_int64)(buffer[6] & 0x7F) << 21) | ((buffer[7] & 0x7F) << 14) | ((buffer[8] & 0x7F) << 7) | (buffer[9] & 0x7F));
+        if ((buffer[5] & 0x10) != 0) {
+            audioStart += 10;   /* Footer. */
+        }
+    }
+
+    result = ma_ex_probe__read_at(pFile, audioStart, buffer, sizeof(buffer), &bytesRead);
+    if (result != MA_SUCCESS) {
+        return MA_INVALID_FILE;
+    }
+
+    /* The first frame is the first header that's followed by another compatible one, which rules out stray sync words. */
+    for (iByte = 0; iByte + 4 <= bytesRead; iByte += 1) {
+        ma_ex_mp3_frame_header nextFrame;
+
+        if (!ma_ex__parse_mp3_frame_header(buffer + iByte, &frame)) {
+            continue;
+        }
+
+        if (iByte + frame.frameSize + 4 > bytesRead) {
+            continue;
+        }
+
+        if (ma_ex__parse_mp3_frame_header(buffer + iByte + frame.frameSize, &nextFrame) && nextFrame.version == frame.version && nextFrame.layer == frame.layer && nextFrame.sampleRate == frame.sampleRate) {
+            break;
+        }
+    }
+
+    if (iByte + 4 > bytesRead) {
+        return MA_INVALID_FILE;
+    }
+
+    pInfo->format     = ma_format_f32;
+    pInfo->channels   = frame.channels;
+    pInfo->sampleRate = frame.sampleRate;
+
+    /* VBR files normally start with a Xing or Info frame (LAME) or a VBRI frame (Fraunhofer) holding the frame count. */
+    if (frame.layer == 1) {
+        const ma_uint8* pXing = buffer + iByte + 4 + frame.sideInfoSize;
+        const ma_uint8* pVBRI = buffer + iByte + 4 + 32;
+
+        if (pXing + 12 <= buffer + iByte + frame.frameSize && (memcmp(pXing, "Xing", 4) == 0 || memcmp(pXing, "Info", 4) == 0)) {
+            if ((ma_ex__be32(pXing + 4) & 0x01) != 0) {
+                pInfo->lengthInPCMFrames = (ma_uint64)ma_ex__be32(pXing + 8) * frame.samplesPerFrame;
+                return MA_SUCCESS;
+            }
+        }
+
+        if (pVBRI + 18 <= buffer + iByte + frame.frameSize && memcmp(pVBRI, "VBRI", 4) == 0) {
+            pInfo->lengthInPCMFrames = (ma_uint64)ma_ex__be32(pVBRI + 14) * frame.samplesPerFrame;
+            return MA_SUCCESS;
+        }
+    }
+
+    /* Otherwise assume a constant bitrate. An ID3v1 tag at the end isn't audio. */
+    if (fileSize >= 128 && ma_ex_probe__read_at(pFile, fileSize - 128, buffer, 3, &bytesRead) == MA_SUCCESS && bytesRead == 3 && memcmp(buffer, "TAG", 3) == 0) {
+        audioEnd -= 128;
+    }
+
+    audioStart += iByte;
+    if (audioEnd > audioStart) {
+        pInfo->lengthInPCMFrames = (ma_uint64)(audioEnd - audioStart) * 8 * frame.sampleRate / frame.bitrate;
+    }
+
+    return MA_SUCCESS;
+}
+
+static ma_result ma_ex_probe__mp3(FILE* pFile, ma_int64 fileSize, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo)
+{
+    if (pConfig->estimateLength) {
+        pInfo->isLengthEstimated = MA_TRUE;
+        return ma_ex_probe__mp3_estimate(pFile, fileSize, pInfo);
+    }
+
+    #if !defined(MA_NO_MP3)
+    {
+        ma_result result;
+        ma_decoding_backend_config backendConfig = ma_decoding_backend_config_init(ma_format_unknown, 0);
+        ma_mp3 mp3;
+
+        result = ma_mp3_init(ma_ex_probe__on_read, ma_ex_probe__on_seek, ma_ex_probe__on_tell, pFile, &backendConfig, &pConfig->allocationCallbacks, &mp3);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        /* This is the part that scans the whole file. */
+        result = ma_mp3_get_data_format(&mp3, &pInfo->format, &pInfo->channels, &pInfo->sampleRate, NULL, 0);
+        if (result == MA_SUCCESS) {
+            result = ma_mp3_get_length_in_pcm_frames(&mp3, &pInfo->lengthInPCMFrames);
+        }
+
+        ma_mp3_uninit(&mp3, &pConfig->allocationCallbacks);
+
+        return result;
+    }
+    #else
+    {
+        (void)pFile;
+        (void)pConfig;
+        (void)pInfo;
+        return MA_NO_BACKEND;
+    }
+    #endif
+}
+
+static ma_result ma_ex_probe__custom(FILE* pFile, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo)
+{
+    ma_uint32 iVTable;
+
+    for (iVTable = 0; iVTable < pConfig->customBackendCount; iVTable += 1) {
+        const ma_decoding_backend_vtable* pVTable = pConfig->ppCustomBackendVTables[iVTable];
+        ma_decoding_backend_config backendConfig = ma_decoding_backend_config_init(ma_format_unknown, 0);
+        ma_data_source* pBackend;
+        ma_result result;
+
+        if (pVTable == NULL || pVTable->onInit == NULL) {
+            continue;
+        }
+
+        if (ma_ex_probe__on_seek(pFile, 0, ma_seek_origin_start) != MA_SUCCESS) {
+            return MA_BAD_SEEK;
+        }
+
+        result = pVTable->onInit(pConfig->pCustomBackendUserData, ma_ex_probe__on_read, ma_ex_probe__on_seek, ma_ex_probe__on_tell, pFile, &backendConfig, &pConfig->allocationCallbacks, &pBackend);
+        if (result != MA_SUCCESS) {
+            continue;
+        }
+
+        result = ma_data_source_get_data_format(pBackend, &pInfo->format, &pInfo->channels, &pInfo->sampleRate, NULL, 0);
+        if (result == MA_SUCCESS) {
+            ma_data_source_get_length_in_pcm_frames(pBackend, &pInfo->lengthInPCMFrames);  /* Not an error if the backend doesn't know. */
+        }
+
+        pVTable->onUninit(pConfig->pCustomBackendUserData, pBackend, &pConfig->allocationCallbacks);
+
+        if (result == MA_SUCCESS) {
+            return MA_SUCCESS;
+        }
+    }
+
+    return MA_NO_BACKEND;
+}
+
+static ma_result ma_ex_probe__vorbis_estimate(FILE* pFile, ma_int64 fileSize, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo)
+{
+    ma_result result;
+    ma_uint8 header[27 + 255 + 30];
+    size_t bytesRead;
+    const ma_uint8* pPacket;
+    ma_uint32 serial;
+    ma_uint8* pTail;
+    size_t tailSize;
+    size_t iByte;
+
+    /* The first page holds nothing but the identification header. */
+    result = ma_ex_probe__read_at(pFile, 0, header, sizeof(header), &bytesRead);
+    if (result != MA_SUCCESS || bytesRead < 27 || memcmp(header, "OggS", 4) != 0 || header[4] != 0) {
+        return MA_INVALID_FILE;
+    }
+
+    pPacket = header + 27 + header[26];
+    if (pPacket + 16 > header + bytesRead || memcmp(pPacket, "\x01vorbis", 7) != 0) {
+        return MA_INVALID_FILE;
+    }
+
+    pInfo->format     = ma_format_f32;
+    pInfo->channels   = pPacket[11];
+    pInfo->sampleRate = ma_ex__le32(pPacket + 12);
+
+    if (pInfo->channels == 0 || pInfo->sampleRate == 0) {
+        return MA_INVALID_FILE;
+    }
+
+    /* The granule position of the last page of this stream is the frame count. Pages with no packet ending on them have it set to -1. */
+    serial = ma_ex__le32(header + 14);
+
+    tailSize = (fileSize < MA_EX_PROBE_OGG_TAIL_SIZE) ? (size_t)fileSize : MA_EX_PROBE_OGG_TAIL_SIZE;
 
-#ifndef MA_ZERO_OBJECT
-    #define MA_ZERO_OBJECT(p) memset((p), 0, sizeof(*(p)))
-#endif
+    pTail = (ma_uint8*)ma_malloc(tailSize, ma_ex__get_allocation_callbacks(&pConfig->allocationCallbacks));
+    if (pTail == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
 
-#ifndef ma_countof
-    #define ma_countof(x) (sizeof(x) / sizeof((x)[0]))
-#endif
+    result = ma_ex_probe__read_at(pFile, fileSize - (ma_int64)tailSize, pTail, tailSize, &bytesRead);
+    if (result == MA_SUCCESS) {
+        for (iByte = bytesRead; iByte >= 27; iByte -= 1) {
+            const ma_uint8* pPage = pTail + iByte - 27;
+            ma_uint64 granule;
 
-#ifndef MA_DATA_CONVERTER_STACK_BUFFER_SIZE
-    #define MA_DATA_CONVERTER_STACK_BUFFER_SIZE  4096
-#endif
+            if (memcmp(pPage, "OggS", 4) != 0 || pPage[4] != 0 || ma_ex__le32(pPage + 14) != serial) {
+                continue;
+            }
 
-static ma_result ma_decoder__init_data_converter_ex(ma_decoder* pDecoder, const ma_ex_decoder_config* pConfigEx);
+            granule = ((ma_uint64)ma_ex__le32(pPage + 10) << 32) | ma_ex__le32(pPage + 6);
+            if (granule != ~(ma_uint64)0) {
+                pInfo->lengthInPCMFrames = granule;
+                break;
+            }
+        }
+    }
 
-MA_EX_API ma_ex_decoder_config ma_ex_decoder_config_init(ma_format format, ma_uint32 channels, ma_uint32 sampleRate) {
-    ma_ex_decoder_config config;
-    config.baseConfig = ma_decoder_config_init(format, channels, sampleRate);
-    config.allowDynamicSampleRate = MA_FALSE;
+    ma_free(pTail, ma_ex__get_allocation_callbacks(&pConfig->allocationCallbacks));
+
+    return MA_SUCCESS;
+}
+
+static ma_result ma_ex_probe__vorbis(FILE* pFile, ma_int64 fileSize, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo, ma_bool32* pIsCustomBackendTried)
+{
+    /* There's no built-in Vorbis backend so exact lengths need a custom one, normally libvorbis. */
+    if (!pConfig->estimateLength && pConfig->customBackendCount > 0) {
+        *pIsCustomBackendTried = MA_TRUE;
+
+        if (ma_ex_probe__custom(pFile, pConfig, pInfo) == MA_SUCCESS) {
+            return MA_SUCCESS;
+        }
+
+        MA_ZERO_OBJECT(pInfo);
+    }
+
+    pInfo->isLengthEstimated = MA_TRUE;
+    return ma_ex_probe__vorbis_estimate(pFile, fileSize, pConfig, pInfo);
+}
+
+MA_EX_API ma_ex_probe_config ma_ex_probe_config_init(ma_resource_manager* pResourceManager)
+{
+    ma_ex_probe_config config;
+
+    MA_ZERO_OBJECT(&config);
+    config.pResourceManager = pResourceManager;
 
     return config;
 }
 
-MA_EX_API ma_result ma_ex_decoder_init(ma_decoder_read_proc onRead, ma_decoder_seek_proc onSeek, void* pUserData, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder) {
+MA_EX_API ma_result ma_ex_probe_file(const char* pFilePath, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo)
+{
+    static const ma_encoding_format encodingFormats[4] = { ma_encoding_format_wav, ma_encoding_format_flac, ma_encoding_format_mp3, ma_encoding_format_vorbis };
     ma_result result;
+    FILE* pFile;
+    ma_int64 fileSize;
+    ma_encoding_format firstFormat;
+    ma_bool32 isCustomBackendTried = MA_FALSE;
+    ma_uint32 iFormat;
+
+    if (pInfo == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    MA_ZERO_OBJECT(pInfo);
+
+    if (pFilePath == NULL || pConfig == NULL) {
+        pInfo->result = MA_INVALID_ARGS;
+        return MA_INVALID_ARGS;
+    }
 
-    result = ma_decoder_init(onRead, onSeek, pUserData, &pConfig->baseConfig, pDecoder);
+    result = ma_fopen(&pFile, pFilePath, "rb");
     if (result != MA_SUCCESS) {
+        pInfo->result = result;
         return result;
     }
 
-    /*
-        HACK: Uninit any existing data converter
-        and re-init with extended config support
-        since we don't want to modify the original
-        ma_decoder_init function signature to allow
-        upstream compatibility.
-    */
-    ma_data_converter_uninit(&pDecoder->converter, &pDecoder->allocationCallbacks);
-    result = ma_decoder__init_data_converter_ex(pDecoder, pConfig);
+    if (ma_ex_probe__on_seek(pFile, 0, ma_seek_origin_end) != MA_SUCCESS || ma_ex_probe__on_tell(pFile, &fileSize) != MA_SUCCESS) {
+        fclose(pFile);
+        pInfo->result = MA_IO_ERROR;
+        return MA_IO_ERROR;
+    }
+
+    firstFormat = ma_ex__sniff_encoding_format_from_stdio(pFile);
+    if (firstFormat == ma_encoding_format_unknown) {
+        firstFormat = ma_ex__get_encoding_format_from_path(pFilePath);
+    }
+
+    result = MA_NO_BACKEND;
+
+    /* The sniffed backend goes first, then the rest in order. */
+    for (iFormat = 0; iFormat <= ma_countof(encodingFormats) && result != MA_SUCCESS; iFormat += 1) {
+        ma_encoding_format encodingFormat;
+
+        if (iFormat == 0) {
+            encodingFormat = firstFormat;
+        } else {
+            encodingFormat = encodingFormats[iFormat - 1];
+            if (encodingFormat == firstFormat) {
+                continue;
+            }
+        }
+
+        if (encodingFormat == ma_encoding_format_unknown) {
+            continue;
+        }
+
+        MA_ZERO_OBJECT(pInfo);
+
+        if (ma_ex_probe__on_seek(pFile, 0, ma_seek_origin_start) != MA_SUCCESS) {
+            result = MA_BAD_SEEK;
+            break;
+        }
+
+        switch (encodingFormat)
+        {
+            case ma_encoding_format_wav:    result = ma_ex_probe__wav(pFile, pConfig, pInfo); break;
+            case ma_encoding_format_flac:   result = ma_ex_probe__flac(pFile, pConfig, pInfo); break;
+            case ma_encoding_format_mp3:    result = ma_ex_probe__mp3(pFile, fileSize, pConfig, pInfo); break;
+            case ma_encoding_format_vorbis: result = ma_ex_probe__vorbis(pFile, fileSize, pConfig, pInfo, &isCustomBackendTried); break;
+            default: break;
+        }
+
+        if (result == MA_SUCCESS) {
+            pInfo->encodingFormat = encodingFormat;
+        }
+    }
+
+    /* Custom backends get a go at anything the built-in ones didn't recognize. */
+    if (result != MA_SUCCESS && result != MA_BAD_SEEK && !isCustomBackendTried) {
+        MA_ZERO_OBJECT(pInfo);
+        result = ma_ex_probe__custom(pFile, pConfig, pInfo);
+    }
+
+    fclose(pFile);
+
     if (result != MA_SUCCESS) {
-        ma_decoder_uninit(pDecoder);
-        return result;
+        MA_ZERO_OBJECT(pInfo);
     }
 
+    pInfo->result = result;
     return result;
 }
 
-MA_EX_API ma_result ma_ex_decoder_init_file(const char* pFilePath, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder) {
-    ma_result result;
+typedef struct
+{
+    const char** ppFilePaths;
+    ma_ex_probe_info* pInfos;
+    ma_uint32 fileCount;
+    const ma_ex_probe_config* pConfig;  /* The caller's. Only used while the caller is waiting on completedEvent. */
+    ma_spinlock lock;
+    ma_uint32 refCount;
+    ma_uint32 nextFile;
+    ma_uint32 completedFileCount;
+    ma_event completedEvent;            /* Signaled once every file has been probed. */
+} ma_ex_probe_job_state;
 
-    result = ma_decoder_init_file(pFilePath, &pConfig->baseConfig, pDecoder);
-    if (result != MA_SUCCESS) {
-        return result;
+static void ma_ex_probe_job_state_release(ma_ex_probe_job_state* pState)
+{
+    ma_bool32 isLastReference;
+
+    ma_spinlock_lock(&pState->lock);
+    {
+        pState->refCount -= 1;
+        isLastReference = (pState->refCount == 0);
     }
+    ma_spinlock_unlock(&pState->lock);
 
-    /* Samething */
-    ma_data_converter_uninit(&pDecoder->converter, &pDecoder->allocationCallbacks);
-    result = ma_decoder__init_data_converter_ex(pDecoder, pConfig);
-    if (result != MA_SUCCESS) {
-        ma_decoder_uninit(pDecoder);
-        return result;
+    if (isLastReference) {
+        ma_event_uninit(&pState->completedEvent);
+        ma_free(pState, NULL);
     }
+}
 
-    return result;
+static void ma_ex_probe_job_run(ma_ex_probe_job_state* pState)
+{
+    for (;;) {
+        ma_uint32 iFile;
+        ma_bool32 isDone;
+
+        ma_spinlock_lock(&pState->lock);
+        {
+            iFile = pState->nextFile;
+            if (iFile < pState->fileCount) {
+                pState->nextFile += 1;
+            }
+        }
+        ma_spinlock_unlock(&pState->lock);
+
+        if (iFile >= pState->fileCount) {
+            break;
+        }
+
+        ma_ex_probe_file(pState->ppFilePaths[iFile], pState->pConfig, &pState->pInfos[iFile]);
+
+        ma_spinlock_lock(&pState->lock);
+        {
+            pState->completedFileCount += 1;
+            isDone = (pState->completedFileCount == pState->fileCount);
+        }
+        ma_spinlock_unlock(&pState->lock);
+
+        if (isDone) {
+            ma_event_signal(&pState->completedEvent);
+        }
+    }
 }
 
-MA_EX_API ma_result ma_ex_decoder_init_memory(const void* pData, size_t dataSize, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder) {
+static ma_result ma_ex_probe_job_proc(ma_job* pJob)
+{
+    ma_ex_probe_job_state* pState = (ma_ex_probe_job_state*)pJob->data.custom.data0;
+
+    ma_ex_probe_job_run(pState);
+    ma_ex_probe_job_state_release(pState);
+
+    return MA_SUCCESS;
+}
+
+static ma_uint32 ma_ex_probe__get_thread_count(const ma_ex_probe_config* pConfig)
+{
+    ma_uint32 jobThreadCount;
+
+    if (pConfig->pResourceManager == NULL || (pConfig->pResourceManager->config.flags & MA_RESOURCE_MANAGER_FLAG_NO_THREADING) != 0) {
+        return 1;   /* Nowhere to post jobs to. */
+    }
+
+    jobThreadCount = pConfig->pResourceManager->config.jobThreadCount;
+
+    if (pConfig->threadCount == 0 || pConfig->threadCount > jobThreadCount + 1) {
+        return jobThreadCount + 1;  /* +1 for the calling thread. */
+    }
+
+    return pConfig->threadCount;
+}
+
+MA_EX_API ma_result ma_ex_probe_files(const char** ppFilePaths, ma_uint32 fileCount, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfos)
+{
     ma_result result;
+    ma_ex_probe_job_state* pState;
+    ma_uint32 threadCount;
+    ma_uint32 jobCount;
+    ma_uint32 iJob;
+    ma_uint32 iFile;
 
-    result = ma_decoder_init_memory(pData, dataSize, &pConfig->baseConfig, pDecoder);
-    if (result != MA_SUCCESS) {
-        return result;
+    if (ppFilePaths == NULL || pConfig == NULL || pInfos == NULL) {
+        return MA_INVALID_ARGS;
     }
 
-    /* Samething */
-    ma_data_converter_uninit(&pDecoder->converter, &pDecoder->allocationCallbacks);
-    result = ma_decoder__init_data_converter_ex(pDecoder, pConfig);
+    threadCount = ma_ex_probe__get_thread_count(pConfig);
+
+    if (threadCount == 1 || fileCount < 2) {
+        for (iFile = 0; iFile < fileCount; iFile += 1) {
+            ma_ex_probe_file(ppFilePaths[iFile], pConfig, &pInfos[iFile]);
+        }
+
+        return MA_SUCCESS;
+    }
+
+    /* Jobs can outlive this call so the state can't use the caller's allocator. */
+    pState = (ma_ex_probe_job_state*)ma_calloc(sizeof(*pState), NULL);
+    if (pState == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    result = ma_event_init(&pState->completedEvent);
     if (result != MA_SUCCESS) {
-        ma_decoder_uninit(pDecoder);
+        ma_free(pState, NULL);
         return result;
     }
 
-    return result;
+    pState->ppFilePaths = ppFilePaths;
+    pState->pInfos      = pInfos;
+    pState->fileCount   = fileCount;
+    pState->pConfig     = pConfig;
+    pState->refCount    = 1;
+
+    /* The calling thread is one of the workers so we only need to post jobs for the rest. */
+    jobCount = threadCount - 1;
+    if (jobCount > fileCount - 1) {
+        jobCount = fileCount - 1;
+    }
+
+    for (iJob = 0; iJob < jobCount; iJob += 1) {
+        ma_job job = ma_job_init(MA_JOB_TYPE_CUSTOM);
+        job.data.custom.proc  = ma_ex_probe_job_proc;
+        job.data.custom.data0 = (ma_uintptr)pState;
+
+        ma_spinlock_lock(&pState->lock);
+        {
+            pState->refCount += 1;
+        }
+        ma_spinlock_unlock(&pState->lock);
+
+        if (ma_resource_manager_post_job(pConfig->pResourceManager, &job) != MA_SUCCESS) {
+            ma_ex_probe_job_state_release(pState);  /* Can't be the last reference since we're holding one. */
+            break;  /* The queue is full. We'll just have fewer workers. */
+        }
+    }
+
+    ma_ex_probe_job_run(pState);
+    ma_event_wait(&pState->completedEvent);
+
+    ma_ex_probe_job_state_release(pState);
+
+    return MA_SUCCESS;
+}
+
+/*
+Object pools
+
+Each class is a free list of slots behind a spinlock that's only held for a couple of pointer updates. A class that
+runs out allocates a slab with its lock released, so a slow allocator doesn't leave other threads spinning, then links
+the slab in and takes the first slot from it. Slabs are aligned to a cache line and start with a cache line that holds
+the link to the next slab, so every slot starts on a cache line and two objects never share one. The free list is LIFO,
+so the slot handed out is usually the one most recently freed, which is likely still in cache.
+*/
+#define MA_EX_POOL_ALIGNMENT    64
+
+static ma_ex_pool g_ma_ex_pool;
+static ma_spinlock g_ma_ex_pool_lock = 0;
+static ma_bool32 g_ma_ex_is_pool_initialized = MA_FALSE;
+
+MA_EX_API size_t ma_ex_pool_get_slot_size(ma_ex_pool_object object)
+{
+    size_t size;
+
+    switch (object)
+    {
+        case ma_ex_pool_object_sound:                        size = sizeof(ma_sound);                        break;
+        case ma_ex_pool_object_decoder:                      size = sizeof(ma_decoder);                      break;
+        case ma_ex_pool_object_resource_manager_data_source: size = sizeof(ma_resource_manager_data_source); break;
+        case ma_ex_pool_object_audio_buffer:                 size = sizeof(ma_audio_buffer);                 break;
+        default: return 0;
+    }
+
+    return (size + MA_EX_POOL_ALIGNMENT - 1) & ~(size_t)(MA_EX_POOL_ALIGNMENT - 1);
+}
+
+MA_EX_API ma_ex_pool_config ma_ex_pool_config_init(void)
+{
+    ma_ex_pool_config config;
+
+    MA_ZERO_OBJECT(&config);
+
+    return config;
+}
+
+/* The class's lock must not be held. */
+static void* ma_ex_pool__alloc_slab(ma_ex_pool* pPool, const ma_ex_pool_class* pClass)
+{
+    return ma_aligned_malloc(MA_EX_POOL_ALIGNMENT + (size_t)pClass->slotSize * pClass->slotsPerSlab, MA_EX_POOL_ALIGNMENT, ma_ex__get_allocation_callbacks(&pPool->allocationCallbacks));
+}
+
+/* Puts the slots of a new slab on the free list. The class's lock must be held. */
+static void ma_ex_pool__link_slab(ma_ex_pool_class* pClass, void* pSlab)
+{
+    ma_uint8* pSlots = (ma_uint8*)pSlab + MA_EX_POOL_ALIGNMENT;
+    ma_uint32 iSlot;
+
+    *(void**)pSlab = pClass->pSlabs;
+    pClass->pSlabs = pSlab;
+    pClass->slabCount += 1;
+
+    /* Back to front so they're handed out in address order. */
+    for (iSlot = pClass->slotsPerSlab; iSlot > 0; iSlot -= 1) {
+        void* pSlot = pSlots + (size_t)(iSlot - 1) * pClass->slotSize;
+
+        *(void**)pSlot = pClass->pFreeSlots;
+        pClass->pFreeSlots = pSlot;
+    }
+}
+
+MA_EX_API ma_result ma_ex_pool_init(const ma_ex_pool_config* pConfig, ma_ex_pool* pPool)
+{
+    ma_uint32 iClass;
+
+    if (pPool == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    MA_ZERO_OBJECT(pPool);
+
+    if (pConfig == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    pPool->slabSizeInBytes     = (pConfig->slabSizeInBytes != 0) ? pConfig->slabSizeInBytes : MA_EX_POOL_DEFAULT_SLAB_SIZE;
+    pPool->allocationCallbacks = pConfig->allocationCallbacks;
+
+    for (iClass = 0; iClass < ma_ex_pool_object_count; iClass += 1) {
+        ma_ex_pool_class* pClass = &pPool->classes[iClass];
+        ma_uint32 iSlab;
+
+        pClass->slotSize = (ma_uint32)ma_ex_pool_get_slot_size((ma_ex_pool_object)iClass);
+
+        if (pPool->slabSizeInBytes >= MA_EX_POOL_ALIGNMENT + pClass->slotSize) {
+            pClass->slotsPerSlab = (pPool->slabSizeInBytes - MA_EX_POOL_ALIGNMENT) / pClass->slotSize;
+        } else {
+            pClass->slotsPerSlab = 1;
+        }
+
+        for (iSlab = 0; iSlab < pConfig->initialSlabCount; iSlab += 1) {
+            void* pSlab = ma_ex_pool__alloc_slab(pPool, pClass);
+            if (pSlab == NULL) {
+                ma_ex_pool_uninit(pPool);
+                return MA_OUT_OF_MEMORY;
+            }
+
+            ma_ex_pool__link_slab(pClass, pSlab);
+        }
+    }
+
+    return MA_SUCCESS;
+}
+
+MA_EX_API void ma_ex_pool_uninit(ma_ex_pool* pPool)
+{
+    ma_uint32 iClass;
+
+    if (pPool == NULL) {
+        return;
+    }
+
+    for (iClass = 0; iClass < ma_ex_pool_object_count; iClass += 1) {
+        void* pSlab = pPool->classes[iClass].pSlabs;
+
+        while (pSlab != NULL) {
+            void* pNextSlab = *(void**)pSlab;
+            ma_aligned_free(pSlab, ma_ex__get_allocation_callbacks(&pPool->allocationCallbacks));
+            pSlab = pNextSlab;
+        }
+
+        pPool->classes[iClass].pSlabs     = NULL;
+        pPool->classes[iClass].pFreeSlots = NULL;
+    }
+}
+
+/* The process-wide pool when pPool is NULL. It has no slabs to start with, so initializing it can't fail. */
+static ma_ex_pool* ma_ex_pool__get(ma_ex_pool* pPool)
+{
+    if (pPool != NULL) {
+        return pPool;
+    }
+
+    ma_spinlock_lock(&g_ma_ex_pool_lock);
+    {
+        if (!g_ma_ex_is_pool_initialized) {
+            ma_ex_pool_config config = ma_ex_pool_config_init();
+            ma_ex_pool_init(&config, &g_ma_ex_pool);
+            g_ma_ex_is_pool_initialized = MA_TRUE;
+        }
+    }
+    ma_spinlock_unlock(&g_ma_ex_pool_lock);
+
+    return &g_ma_ex_pool;
+}
+
+MA_EX_API void* ma_ex_pool_alloc(ma_ex_pool* pPool, ma_ex_pool_object object)
+{
+    ma_ex_pool_class* pClass;
+    void* pSlot;
+    void* pSlab;
+
+    if ((ma_uint32)object >= ma_ex_pool_object_count) {
+        return NULL;
+    }
+
+    pPool  = ma_ex_pool__get(pPool);
+    pClass = &pPool->classes[object];
+
+    ma_spinlock_lock(&pClass->lock);
+    {
+        pSlot = pClass->pFreeSlots;
+        if (pSlot != NULL) {
+            pClass->pFreeSlots = *(void**)pSlot;
+            pClass->usedSlotCount += 1;
+        }
+    }
+    ma_spinlock_unlock(&pClass->lock);
+
+    if (pSlot != NULL) {
+        return pSlot;
+    }
+
+    pSlab = ma_ex_pool__alloc_slab(pPool, pClass);
+    if (pSlab == NULL) {
+        return NULL;
+    }
+
+    ma_spinlock_lock(&pClass->lock);
+    {
+        ma_ex_pool__link_slab(pClass, pSlab);
+
+        pSlot = pClass->pFreeSlots;
+        pClass->pFreeSlots = *(void**)pSlot;
+        pClass->usedSlotCount += 1;
+    }
+    ma_spinlock_unlock(&pClass->lock);
+
+    return pSlot;
+}
+
+MA_EX_API void ma_ex_pool_free(ma_ex_pool* pPool, ma_ex_pool_object object, void* p)
+{
+    ma_ex_pool_class* pClass;
+
+    if (p == NULL || (ma_uint32)object >= ma_ex_pool_object_count) {
+        return;
+    }
+
+    pPool  = ma_ex_pool__get(pPool);
+    pClass = &pPool->classes[object];
+
+    ma_spinlock_lock(&pClass->lock);
+    {
+        *(void**)p = pClass->pFreeSlots;
+        pClass->pFreeSlots = p;
+        pClass->usedSlotCount -= 1;
+    }
+    ma_spinlock_unlock(&pClass->lock);
+}
+
+MA_EX_API ma_result ma_ex_pool_get_stats(ma_ex_pool* pPool, ma_ex_pool_object object, ma_uint32* pUsedSlotCount, ma_uint32* pSlotCount)
+{
+    ma_ex_pool_class* pClass;
+
+    if ((ma_uint32)object >= ma_ex_pool_object_count) {
+        return MA_INVALID_ARGS;
+    }
+
+    pPool  = ma_ex_pool__get(pPool);
+    pClass = &pPool->classes[object];
+
+    ma_spinlock_lock(&pClass->lock);
+    {
+        if (pUsedSlotCount != NULL) {
+            *pUsedSlotCount = pClass->usedSlotCount;
+        }
+
+        if (pSlotCount != NULL) {
+            *pSlotCount = pClass->slabCount * pClass->slotsPerSlab;
+        }
+    }
+    ma_spinlock_unlock(&pClass->lock);
+
+    return MA_SUCCESS;
 }
 
 // Copy of ma_decoder_config_init_copy with extended config support.
@@ -153,7 +2932,7 @@ static ma_result ma_decoder__init_data_converter_ex(ma_decoder* pDecoder, const
     converterConfig.allowDynamicSampleRate = pConfigEx->allowDynamicSampleRate; /* Setting this to true will disable passthrough optimizations. */
     converterConfig.resampling             = pConfig->resampling;
 
-    result = ma_data_converter_init(&converterConfig, &pDecoder->allocationCallbacks, &pDecoder->converter);
+    result = g_ma_ex_data_converter_init(&converterConfig, &pDecoder->allocationCallbacks, &pDecoder->converter);
     if (result != MA_SUCCESS) {
         return result;
     }
@@ -183,9 +2962,9 @@ static ma_result ma_decoder__init_data_converter_ex(ma_decoder* pDecoder, const
                 return MA_OUT_OF_MEMORY;
             }
 
-            /* 
-            Since we did HACK ways, we need to deallocate the pInputCache as well
-            since it might have been allocated with different size before
+            /*
+            The converter built by the upstream init never needs a cache (see ma_ex_decoder__get_preinit_config()),
+            but free it anyway in case that ever changes upstream.
             */
             if (pDecoder->pInputCache != NULL) {
                 ma_free(pDecoder->pInputCache, &pDecoder->allocationCallbacks);
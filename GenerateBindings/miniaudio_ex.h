@@ -41,12 +41,161 @@ typedef struct
 {
     ma_decoder_config baseConfig;
     ma_bool32 allowDynamicSampleRate; /* When set to true, allows the sample rate to change dynamically. */
+    ma_bool32 preservePassthrough;    /* With allowDynamicSampleRate, starts on the passthrough path if the rate is 1:1. Change the rate with ma_ex_decoder_set_rate*() rather than on the converter so it only resamples while the rate isn't 1:1. */
 } ma_ex_decoder_config;
 
 MA_EX_API ma_ex_decoder_config ma_ex_decoder_config_init(ma_format format, ma_uint32 channels, ma_uint32 sampleRate);
 MA_EX_API ma_result ma_ex_decoder_init(ma_decoder_read_proc onRead, ma_decoder_seek_proc onSeek, void* pUserData, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
 MA_EX_API ma_result ma_ex_decoder_init_file(const char* pFilePath, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
 MA_EX_API ma_result ma_ex_decoder_init_memory(const void* pData, size_t dataSize, const ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
+MA_EX_API ma_result ma_ex_decoder_set_rate(ma_decoder* pDecoder, ma_uint32 sampleRateIn, ma_uint32 sampleRateOut);    /* Same as ma_data_converter_set_rate() on the decoder's converter. When resampling is its only stage it also switches between the passthrough and resampling paths. */
+MA_EX_API ma_result ma_ex_decoder_set_rate_ratio(ma_decoder* pDecoder, float ratioInOut);
+MA_EX_API ma_result ma_ex_decoder_read_pcm_frames(ma_decoder* pDecoder, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);   /* Same as ma_decoder_read_pcm_frames(), but s16 to f32 and mono to stereo conversions are done in place in pFramesOut. Used for data source reads of decoders initialized with ma_ex_decoder_init*(). */
+MA_EX_API ma_encoding_format ma_ex_get_encoding_format_from_file(const char* pFilePath);     /* Works out the format from the first few bytes. ma_encoding_format_unknown if it's not one there's a built-in or libvorbis backend for. Used by ma_ex_decoder_init_file() when the config doesn't give one. */
+MA_EX_API ma_encoding_format ma_ex_get_encoding_format_from_memory(const void* pData, size_t dataSize);
+
+
+/*
+Time stretching
+
+Wraps another data source and changes its speed without changing its pitch. Output is always f32 with the channel
+count and sample rate of the source. The cursor and length are reported in source frames so they track the position
+in the source rather than how much audio has been played out.
+*/
+typedef struct
+{
+    ma_data_source* pDataSource;    /* The source to stretch. Any format, read as f32. */
+    float tempo;                    /* 1 is normal speed, 2 is twice as fast. Meant for 0.5 to 2. */
+    ma_uint32 sequenceMs;           /* Length of each piece of the source that's spliced into the output, including the crossfade. 0 = 40. */
+    ma_uint32 seekWindowMs;         /* How far ahead of the nominal position to look for the best splice point. 0 = 15. */
+    ma_uint32 overlapMs;            /* Length of the crossfade between pieces. 0 = 8. */
+} ma_ex_time_stretch_config;
+
+typedef struct
+{
+    ma_data_source_base ds;
+    ma_data_source* pDataSource;
+    ma_format formatIn;
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    ma_spinlock lock;               /* Protects tempo, which is usually set from a different thread to the one reading. */
+    float tempo;
+    ma_uint32 sequenceFrames;
+    ma_uint32 seekWindowFrames;
+    ma_uint32 overlapFrames;
+    double skipFrac;                /* Fractional part of the source advance, carried over to the next sequence. */
+    ma_uint64 skipRemaining;        /* Source frames still to be discarded when an advance went past the buffered input. */
+    ma_uint64 inputCursor;          /* Source frame index of the first buffered input frame. */
+    ma_uint64 tailFrameCount;       /* Output frames still to come once isAtEnd is set. */
+    float* pInput;
+    ma_uint32 inputFrameCount;
+    ma_uint32 inputFrameCap;
+    ma_uint32 paddedFrameCount;     /* Silence at the end of the input, after the last frame of the source. */
+    float* pMid;                    /* Tail of the last sequence, crossfaded into the start of the next one. */
+    float* pMidRef;                 /* pMid with a window applied. Used for the correlation search. */
+    float* pPending;                /* Output that didn't fit into the caller's buffer. */
+    ma_uint32 pendingFrameCount;
+    ma_uint32 pendingFrameOffset;
+    ma_bool32 isPrimed;             /* Whether pMid holds audio. Cleared after seeking and while the tempo is 1. */
+    ma_bool32 isAtEnd;              /* The source has run out and the rest of the input is being stretched. */
+    void* _pHeap;
+} ma_ex_time_stretch;
+
+MA_EX_API ma_ex_time_stretch_config ma_ex_time_stretch_config_init(ma_data_source* pDataSource, float tempo);
+MA_EX_API ma_result ma_ex_time_stretch_init(const ma_ex_time_stretch_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_ex_time_stretch* pTimeStretch);
+MA_EX_API void ma_ex_time_stretch_uninit(ma_ex_time_stretch* pTimeStretch, const ma_allocation_callbacks* pAllocationCallbacks);
+MA_EX_API ma_result ma_ex_time_stretch_read_pcm_frames(ma_ex_time_stretch* pTimeStretch, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);
+MA_EX_API ma_result ma_ex_time_stretch_seek_to_pcm_frame(ma_ex_time_stretch* pTimeStretch, ma_uint64 frameIndex);
+MA_EX_API ma_result ma_ex_time_stretch_get_data_format(ma_ex_time_stretch* pTimeStretch, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap);
+MA_EX_API ma_result ma_ex_time_stretch_get_cursor_in_pcm_frames(ma_ex_time_stretch* pTimeStretch, ma_uint64* pCursor);
+MA_EX_API ma_result ma_ex_time_stretch_get_length_in_pcm_frames(ma_ex_time_stretch* pTimeStretch, ma_uint64* pLength);
+MA_EX_API ma_result ma_ex_time_stretch_set_tempo(ma_ex_time_stretch* pTimeStretch, float tempo);    /* Safe to call while another thread is reading. Takes effect from the next read. */
+MA_EX_API float ma_ex_time_stretch_get_tempo(ma_ex_time_stretch* pTimeStretch);
+
+
+/*
+Probing
+
+Reads the format, channel count, sample rate and length of files without initializing a decoder. Only the backend's
+own headers are parsed, so there's no data converter, no input cache and, unless exact lengths are asked for, no scan
+through MP3 files. Batches can be spread across the job threads of a resource manager.
+*/
+typedef struct
+{
+    ma_bool32 estimateLength;                           /* Estimate MP3 and Ogg Vorbis lengths from their headers rather than scanning or opening the stream. WAV and FLAC lengths are always exact. */
+    ma_resource_manager* pResourceManager;              /* Optional. ma_ex_probe_files() posts jobs to it to probe files in parallel. */
+    ma_uint32 threadCount;                              /* Threads to use with pResourceManager, including the calling thread. 0 = every job thread. */
+    ma_decoding_backend_vtable** ppCustomBackendVTables; /* Same as ma_decoder_config. Used for Ogg Vorbis when lengths are exact, and for anything the built-in backends don't recognize. */
+    ma_uint32 customBackendCount;
+    void* pCustomBackendUserData;
+    ma_allocation_callbacks allocationCallbacks;
+} ma_ex_probe_config;
+
+typedef struct
+{
+    ma_result result;
+    ma_encoding_format encodingFormat;      /* ma_encoding_format_unknown when a custom backend recognized the file. */
+    ma_format format;                       /* The format the backend decodes to natively. */
+    ma_uint32 channels;
+    ma_uint32 sampleRate;
+    ma_uint64 lengthInPCMFrames;            /* 0 if unknown. */
+    ma_bool32 isLengthEstimated;
+} ma_ex_probe_info;
+
+MA_EX_API ma_ex_probe_config ma_ex_probe_config_init(ma_resource_manager* pResourceManager);
+MA_EX_API ma_result ma_ex_probe_file(const char* pFilePath, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo);
+MA_EX_API ma_result ma_ex_probe_files(const char** ppFilePaths, ma_uint32 fileCount, const ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfos);   /* Each file's own result goes in pInfos[i].result. Only returns an error if the batch couldn't be run at all. */
+
+
+/*
+Object pools
+
+Memory for the structs that miniaudio leaves to the caller to allocate. Each kind of object is its own size class, with
+slots rounded up to a whole number of cache lines and carved out of larger slabs. Freed slots are handed out again
+before any new ones, so allocating and freeing are O(1) and only go to the allocator when a class needs another slab.
+Slabs are kept until the pool is uninitialized. Safe to use from any thread.
+*/
+typedef enum
+{
+    ma_ex_pool_object_sound = 0,                        /* ma_sound and ma_sound_group. */
+    ma_ex_pool_object_decoder,
+    ma_ex_pool_object_resource_manager_data_source,
+    ma_ex_pool_object_audio_buffer,                     /* For ma_audio_buffer_init(). ma_audio_buffer_alloc_and_init() allocates its own. */
+    ma_ex_pool_object_count
+} ma_ex_pool_object;
+
+typedef struct
+{
+    ma_uint32 slabSizeInBytes;                          /* 0 = 64 KB. Grown to fit at least one slot. */
+    ma_uint32 initialSlabCount;                         /* Slabs to allocate for each class up front. */
+    ma_allocation_callbacks allocationCallbacks;
+} ma_ex_pool_config;
+
+typedef struct
+{
+    ma_spinlock lock;
+    ma_uint32 slotSize;
+    ma_uint32 slotsPerSlab;
+    ma_uint32 slabCount;
+    ma_uint32 usedSlotCount;
+    void* pFreeSlots;                                   /* Each free slot starts with a pointer to the next one. */
+    void* pSlabs;                                       /* Each slab starts with a pointer to the next one. */
+} ma_ex_pool_class;
+
+typedef struct
+{
+    ma_ex_pool_class classes[ma_ex_pool_object_count];
+    ma_uint32 slabSizeInBytes;
+    ma_allocation_callbacks allocationCallbacks;
+} ma_ex_pool;
+
+MA_EX_API ma_ex_pool_config ma_ex_pool_config_init(void);
+MA_EX_API ma_result ma_ex_pool_init(const ma_ex_pool_config* pConfig, ma_ex_pool* pPool);
+MA_EX_API void ma_ex_pool_uninit(ma_ex_pool* pPool);   /* Frees every slab, including any slots that are still in use. */
+MA_EX_API void* ma_ex_pool_alloc(ma_ex_pool* pPool, ma_ex_pool_object object);     /* NULL pool = a process-wide pool created on first use. The slot isn't zeroed, which the object's init function does anyway. NULL if out of memory. */
+MA_EX_API void ma_ex_pool_free(ma_ex_pool* pPool, ma_ex_pool_object object, void* p);   /* Same pool and object as the allocation. Uninitialize the object first. */
+MA_EX_API size_t ma_ex_pool_get_slot_size(ma_ex_pool_object object);
+MA_EX_API ma_result ma_ex_pool_get_stats(ma_ex_pool* pPool, ma_ex_pool_object object, ma_uint32* pUsedSlotCount, ma_uint32* pSlotCount);
 
 #ifdef __cplusplus
 }
@@ -1,10 +1,47 @@
 #ifndef miniaudio_libvorbis_c
 #define miniaudio_libvorbis_c
 
+/* 64-bit off_t, so the stdio callbacks reach past 2GB on 32-bit targets. It has to come before any system header. */
+#if !defined(_WIN32) && !defined(_FILE_OFFSET_BITS)
+    #define _FILE_OFFSET_BITS 64
+#endif
+
 #define MINIAUDIO_VORBIS_IMPLEMENTATION
 #include "./miniaudio_libvorbis.h"
 
 #if !defined(MA_NO_LIBVORBIS)
+    /*
+    libogg and libvorbis allocate through the _ogg_* macros. These are routed to the allocator of the decoder that is
+    currently calling into libvorbisfile. See the allocation section below.
+    */
+    static void* ma_libvorbis_ogg_malloc(size_t sz);
+    static void* ma_libvorbis_ogg_calloc(size_t count, size_t sz);
+    static void* ma_libvorbis_ogg_realloc(void* p, size_t sz);
+    static void  ma_libvorbis_ogg_free(void* p);
+    static int   ma_libvorbis_unpack_books(void* pInfo, void* pPacket, void* pBitReader);
+    static void  ma_libvorbis_release_shared_setup(void* pSharedSetup);
+
+    /* The hot loops inside libvorbis are replaced with runtime dispatched kernels. See the kernels section below. */
+    static void  ma_libvorbis_mdct_butterfly(float* pTrig, float* pX, int points, int trigStride);
+    static void  ma_libvorbis_overlap_add(float* pPCM, const float* pIn, const float* pWindow, int count);
+    static void  ma_libvorbis_inverse_coupling(float* pMag, float* pAng, int count);
+    static void  ma_libvorbis_residue_add(float* pOut, long count, const float** ppEntries, int dim);
+    static void  ma_libvorbis_residue_add_stereo(float* pOutL, float* pOutR, long frameCount, const float** ppEntries, int dim);
+    static void  ma_libvorbis_render_floor_line(int n, int x0, int x1, int y0, int y1, float* pOut, const float* pLookup);
+
+    #define _ogg_malloc  ma_libvorbis_ogg_malloc
+    #define _ogg_calloc  ma_libvorbis_ogg_calloc
+    #define _ogg_realloc ma_libvorbis_ogg_realloc
+    #define _ogg_free    ma_libvorbis_ogg_free
+    #define VORBIS_UNPACK_BOOKS_HOOK(vi, op, opb) ma_libvorbis_unpack_books((vi), (op), (opb))
+    #define VORBIS_SETUP_RELEASE_HOOK(pSharedSetup) ma_libvorbis_release_shared_setup(pSharedSetup)
+    #define VORBIS_MDCT_BUTTERFLY_HOOK(T, x, points, trigint) ma_libvorbis_mdct_butterfly((T), (x), (points), (trigint))
+    #define VORBIS_OVERLAP_ADD_HOOK(pcm, p, w, n) ma_libvorbis_overlap_add((pcm), (p), (w), (n))
+    #define VORBIS_INVERSE_COUPLING_HOOK(pcmM, pcmA, n) ma_libvorbis_inverse_coupling((pcmM), (pcmA), (n))
+    #define VORBIS_RESIDUE_ADD_HOOK(a, n, t, dim) ma_libvorbis_residue_add((a), (n), (t), (dim))
+    #define VORBIS_RESIDUE_ADD_STEREO_HOOK(l, r, frames, t, dim) ma_libvorbis_residue_add_stereo((l), (r), (frames), (t), (dim))
+    #define VORBIS_RENDER_LINE_HOOK(n, x0, x1, y0, y1, d, lookup) ma_libvorbis_render_floor_line((n), (x0), (x1), (y0), (y1), (d), (lookup))
+
     #ifndef OV_EXCLUDE_STATIC_CALLBACKS
         #define OV_EXCLUDE_STATIC_CALLBACKS
     #endif
@@ -15,525 +52,3631 @@
 
 #include <string.h> /* For memset(). */
 #include <assert.h>
+#include <limits.h> /* For INT_MAX. */
 
-static ma_result ma_libvorbis_ds_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+/*
+SIMD support for the hot loops, both our own and the ones inside libvorbis. x86 kernels are always compiled (using
+target attributes with GCC and Clang so that no global ISA flags are needed) and selected at runtime. NEON is
+part of the arm64 baseline so it's selected at compile time.
+*/
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+    #if defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__)
+        #define MA_LIBVORBIS_X86
+    #endif
+#elif defined(_M_ARM64) || defined(__aarch64__) || (defined(__ARM_NEON) && defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+    #define MA_LIBVORBIS_NEON
+#endif
+
+#if defined(MA_LIBVORBIS_X86)
+    #include <emmintrin.h>
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+    #if defined(__GNUC__) || defined(__clang__)
+        #define MA_LIBVORBIS_TARGET_SSE2 __attribute__((target("sse2")))
+        #define MA_LIBVORBIS_TARGET_AVX2 __attribute__((target("avx2")))
+    #else
+        #define MA_LIBVORBIS_TARGET_SSE2
+        #define MA_LIBVORBIS_TARGET_AVX2
+    #endif
+#endif
+
+#if defined(MA_LIBVORBIS_NEON)
+    #include <arm_neon.h>
+#endif
+
+/*
+Allocations
+
+Every decoder owns an allocator which lives in the same heap block as its OggVorbis_File. Public entry points that can
+make libogg or libvorbis allocate make that allocator current for the calling thread, and the _ogg_* hooks pick it up
+from there. Each block is prefixed with a small header recording the allocator it came from, so frees and reallocs
+always go back to the right place regardless of what's current. Allocations made with no current allocator use the
+default allocator.
+
+The arena is optional. When enabled, allocations made while opening a decoder (which is where the codebooks and most
+of the other long lived state comes from) are carved out of large chunks instead of going to the heap one by one.
+A chunk sized from the setup header is reserved just before the codebooks are unpacked. Arena blocks are only
+released when the decoder is uninitialized. Allocations made after the open always go to the heap so that seeking
+and the like can't grow the arena without bound.
+*/
+static size_t g_ma_libvorbis_default_arena_size = 0;
+
+#if !defined(MA_NO_LIBVORBIS)
+#if defined(_MSC_VER)
+    #define MA_LIBVORBIS_THREADLOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define MA_LIBVORBIS_THREADLOCAL __thread
+#else
+    #define MA_LIBVORBIS_THREADLOCAL _Thread_local
+#endif
+
+#define MA_LIBVORBIS_ALLOCATION_HEADER_SIZE 16
+#define MA_LIBVORBIS_ARENA_CHUNK_HEADER_SIZE 32
+#define MA_LIBVORBIS_ARENA_FLAG             ((size_t)1 << (sizeof(size_t)*8 - 1))
+#define MA_LIBVORBIS_ARENA_SETUP_SCALE      16      /* Rough ratio of unpacked codebook memory to setup header size. */
+#define MA_LIBVORBIS_ARENA_BASE_SIZE        16384
+
+typedef struct ma_libvorbis_arena_chunk ma_libvorbis_arena_chunk;
+struct ma_libvorbis_arena_chunk
 {
-    return ma_libvorbis_read_pcm_frames((ma_libvorbis*)pDataSource, pFramesOut, frameCount, pFramesRead);
-}
+    ma_libvorbis_arena_chunk* pNext;
+    size_t capacity;
+    size_t cursor;
+};
 
-static ma_result ma_libvorbis_ds_seek(ma_data_source* pDataSource, ma_uint64 frameIndex)
+typedef struct
 {
-    return ma_libvorbis_seek_to_pcm_frame((ma_libvorbis*)pDataSource, frameIndex);
+    ma_allocation_callbacks allocationCallbacks;
+    const ma_allocation_callbacks* pAllocationCallbacks;    /* Points to allocationCallbacks, or null for the default allocator. */
+    ma_bool32 isArenaActive;
+    size_t arenaChunkSize;
+    ma_libvorbis_arena_chunk* pArenaChunks;                 /* Most recent chunk first. */
+    ma_libvorbis_allocation_stats stats;
+} ma_libvorbis_allocator;
+
+typedef struct
+{
+    ma_libvorbis_allocator* pAllocator;
+    size_t size;                                            /* MA_LIBVORBIS_ARENA_FLAG is set for arena blocks. */
+} ma_libvorbis_allocation_header;
+
+static MA_LIBVORBIS_THREADLOCAL ma_libvorbis_allocator* g_ma_libvorbis_current_allocator = NULL;
+
+static void ma_libvorbis_allocator_init(ma_libvorbis_allocator* pAllocator, const ma_allocation_callbacks* pAllocationCallbacks)
+{
+    memset(pAllocator, 0, sizeof(*pAllocator));
+
+    if (pAllocationCallbacks != NULL) {
+        pAllocator->allocationCallbacks  = *pAllocationCallbacks;
+        pAllocator->pAllocationCallbacks = &pAllocator->allocationCallbacks;
+    }
+
+    pAllocator->arenaChunkSize = g_ma_libvorbis_default_arena_size;
 }
 
-static ma_result ma_libvorbis_ds_get_data_format(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+static void ma_libvorbis_allocator_uninit(ma_libvorbis_allocator* pAllocator)
 {
-    return ma_libvorbis_get_data_format((ma_libvorbis*)pDataSource, pFormat, pChannels, pSampleRate, pChannelMap, channelMapCap);
+    ma_libvorbis_arena_chunk* pChunk = pAllocator->pArenaChunks;
+
+    while (pChunk != NULL) {
+        ma_libvorbis_arena_chunk* pNext = pChunk->pNext;
+        ma_free(pChunk, pAllocator->pAllocationCallbacks);
+        pChunk = pNext;
+    }
+
+    pAllocator->pArenaChunks = NULL;
 }
 
-static ma_result ma_libvorbis_ds_get_cursor(ma_data_source* pDataSource, ma_uint64* pCursor)
+static ma_libvorbis_allocator* ma_libvorbis_push_allocator(ma_libvorbis_allocator* pAllocator)
 {
-    return ma_libvorbis_get_cursor_in_pcm_frames((ma_libvorbis*)pDataSource, pCursor);
+    ma_libvorbis_allocator* pPrevAllocator = g_ma_libvorbis_current_allocator;
+    g_ma_libvorbis_current_allocator = pAllocator;
+    return pPrevAllocator;
 }
 
-static ma_result ma_libvorbis_ds_get_length(ma_data_source* pDataSource, ma_uint64* pLength)
+static void ma_libvorbis_pop_allocator(ma_libvorbis_allocator* pPrevAllocator)
 {
-    return ma_libvorbis_get_length_in_pcm_frames((ma_libvorbis*)pDataSource, pLength);
+    g_ma_libvorbis_current_allocator = pPrevAllocator;
 }
 
-static ma_data_source_vtable g_ma_libvorbis_ds_vtable =
+static ma_libvorbis_arena_chunk* ma_libvorbis_arena_add_chunk(ma_libvorbis_allocator* pAllocator, size_t capacity)
 {
-    ma_libvorbis_ds_read,
-    ma_libvorbis_ds_seek,
-    ma_libvorbis_ds_get_data_format,
-    ma_libvorbis_ds_get_cursor,
-    ma_libvorbis_ds_get_length,
-    NULL,   /* onSetLooping */
-    0       /* flags */
-};
+    ma_libvorbis_arena_chunk* pChunk;
 
+    pChunk = (ma_libvorbis_arena_chunk*)ma_malloc(MA_LIBVORBIS_ARENA_CHUNK_HEADER_SIZE + capacity, pAllocator->pAllocationCallbacks);
+    if (pChunk == NULL) {
+        return NULL;
+    }
 
-#if !defined(MA_NO_LIBVORBIS)
-static size_t ma_libvorbis_vf_callback__read(void* pBufferOut, size_t size, size_t count, void* pUserData)
+    pChunk->pNext    = pAllocator->pArenaChunks;
+    pChunk->capacity = capacity;
+    pChunk->cursor   = 0;
+    pAllocator->pArenaChunks = pChunk;
+
+    pAllocator->stats.heapAllocationCount  += 1;
+    pAllocator->stats.arenaChunkCount      += 1;
+    pAllocator->stats.arenaCapacityInBytes += capacity;
+
+    return pChunk;
+}
+
+static void* ma_libvorbis_arena_alloc(ma_libvorbis_allocator* pAllocator, size_t sz)
 {
-    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
-    ma_result result;
-    size_t bytesToRead;
-    size_t bytesRead;
+    ma_libvorbis_arena_chunk* pChunk = pAllocator->pArenaChunks;
+    void* p;
 
-    /* For consistency with fread(). If `size` of `count` is 0, return 0 immediately without changing anything. */
-    if (size == 0 || count == 0) {
-        return 0;
-    }
+    sz = (sz + 15) & ~(size_t)15;
 
-    bytesToRead = size * count;
-    result = pVorbis->onRead(pVorbis->pReadSeekTellUserData, pBufferOut, bytesToRead, &bytesRead);
-    if (result != MA_SUCCESS) {
-        /* Not entirely sure what to return here. What if an error occurs, but some data was read and bytesRead is > 0? */
-        return 0;
+    if (pChunk == NULL || pChunk->capacity - pChunk->cursor < sz) {
+        pChunk = ma_libvorbis_arena_add_chunk(pAllocator, (pAllocator->arenaChunkSize > sz) ? pAllocator->arenaChunkSize : sz);
+        if (pChunk == NULL) {
+            return NULL;    /* The caller will fall back to the heap. */
+        }
     }
 
-    return bytesRead / size;
+    p = (ma_uint8*)pChunk + MA_LIBVORBIS_ARENA_CHUNK_HEADER_SIZE + pChunk->cursor;
+    pChunk->cursor += sz;
+    pAllocator->stats.arenaUsedInBytes += sz;
+
+    return p;
 }
 
-static int ma_libvorbis_vf_callback__seek(void* pUserData, ogg_int64_t offset, int whence)
+static void* ma_libvorbis_allocator_malloc(ma_libvorbis_allocator* pAllocator, size_t sz)
 {
-    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
-    ma_result result;
-    ma_seek_origin origin;
+    ma_libvorbis_allocation_header* pHeader = NULL;
+    size_t flags = 0;
 
-    if (whence == SEEK_SET) {
-        origin = ma_seek_origin_start;
-    } else if (whence == SEEK_END) {
-        origin = ma_seek_origin_end;
-    } else {
-        origin = ma_seek_origin_current;
+    if (sz >= (MA_LIBVORBIS_ARENA_FLAG - MA_LIBVORBIS_ALLOCATION_HEADER_SIZE)) {
+        return NULL;    /* Too big. */
     }
 
-    result = pVorbis->onSeek(pVorbis->pReadSeekTellUserData, offset, origin);
-    if (result != MA_SUCCESS) {
-        return -1;
+    if (pAllocator != NULL && pAllocator->isArenaActive) {
+        pHeader = (ma_libvorbis_allocation_header*)ma_libvorbis_arena_alloc(pAllocator, MA_LIBVORBIS_ALLOCATION_HEADER_SIZE + sz);
+        if (pHeader != NULL) {
+            flags = MA_LIBVORBIS_ARENA_FLAG;
+        }
     }
 
-    return 0;
+    if (pHeader == NULL) {
+        pHeader = (ma_libvorbis_allocation_header*)ma_malloc(MA_LIBVORBIS_ALLOCATION_HEADER_SIZE + sz, (pAllocator != NULL) ? pAllocator->pAllocationCallbacks : NULL);
+        if (pHeader == NULL) {
+            return NULL;
+        }
+
+        if (pAllocator != NULL) {
+            pAllocator->stats.heapAllocationCount += 1;
+        }
+    }
+
+    pHeader->pAllocator = pAllocator;
+    pHeader->size       = sz | flags;
+
+    if (pAllocator != NULL) {
+        pAllocator->stats.allocationCount += 1;
+        pAllocator->stats.bytesInUse      += sz;
+        if (pAllocator->stats.peakBytesInUse < pAllocator->stats.bytesInUse) {
+            pAllocator->stats.peakBytesInUse = pAllocator->stats.bytesInUse;
+        }
+    }
+
+    return (ma_uint8*)pHeader + MA_LIBVORBIS_ALLOCATION_HEADER_SIZE;
 }
 
-static long ma_libvorbis_vf_callback__tell(void* pUserData)
+typedef struct
 {
-    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
-    ma_result result;
-    ma_int64 cursor;
-    
-    result = pVorbis->onTell(pVorbis->pReadSeekTellUserData, &cursor);
-    if (result != MA_SUCCESS) {
-        return -1;
-    }
+    OggVorbis_File vf;                  /* Must be first. pVorbis->vf points here and is what gets freed. */
+    ma_libvorbis_allocator allocator;
+} ma_libvorbis_vf_block;
 
-    return (long)cursor;
+static void* ma_libvorbis_ogg_malloc(size_t sz)
+{
+    return ma_libvorbis_allocator_malloc(g_ma_libvorbis_current_allocator, sz);
 }
-#endif
 
-static ma_result ma_libvorbis_init_internal(const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+static void* ma_libvorbis_ogg_calloc(size_t count, size_t sz)
 {
-    if (pVorbis == NULL) {
-        return MA_INVALID_ARGS;
-    }
+    void* p;
 
-    memset(pVorbis, 0, sizeof(*pVorbis));
-    pVorbis->format = ma_format_f32;    /* f32 by default. */
+    if (sz != 0 && count > ((size_t)-1) / sz) {
+        return NULL;
+    }
 
-    if (pConfig != NULL && (pConfig->preferredFormat == ma_format_f32 || pConfig->preferredFormat == ma_format_s16)) {
-        pVorbis->format = pConfig->preferredFormat;
-    } else {
-        /* Getting here means something other than f32 and s16 was specified. Just leave this unset to use the default format. */
+    p = ma_libvorbis_ogg_malloc(count * sz);
+    if (p != NULL) {
+        memset(p, 0, count * sz);   /* Arena memory is not zeroed so always clear. */
     }
 
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        ma_result result;
-        ma_data_source_config dataSourceConfig;
+    return p;
+}
 
-        dataSourceConfig = ma_data_source_config_init();
-        dataSourceConfig.vtable = &g_ma_libvorbis_ds_vtable;
+static void ma_libvorbis_ogg_free(void* p)
+{
+    ma_libvorbis_allocation_header* pHeader;
+    ma_libvorbis_allocator* pAllocator;
+    size_t sz;
 
-        result = ma_data_source_init(&dataSourceConfig, &pVorbis->ds);
-        if (result != MA_SUCCESS) {
-            return result;  /* Failed to initialize the base data source. */
-        }
+    if (p == NULL) {
+        return;
+    }
 
-        pVorbis->vf = (OggVorbis_File*)ma_malloc(sizeof(OggVorbis_File), pAllocationCallbacks);
-        if (pVorbis->vf == NULL) {
-            ma_data_source_uninit(&pVorbis->ds);
-            return MA_OUT_OF_MEMORY;
-        }
+    pHeader    = (ma_libvorbis_allocation_header*)((ma_uint8*)p - MA_LIBVORBIS_ALLOCATION_HEADER_SIZE);
+    pAllocator = pHeader->pAllocator;
+    sz         = pHeader->size & ~MA_LIBVORBIS_ARENA_FLAG;
 
-        return MA_SUCCESS;
+    if (pAllocator != NULL) {
+        pAllocator->stats.freeCount  += 1;
+        pAllocator->stats.bytesInUse -= sz;
     }
-    #else
-    {
-        /* libvorbis is disabled. */
-        (void)pAllocationCallbacks;
-        return MA_NOT_IMPLEMENTED;
+
+    if ((pHeader->size & MA_LIBVORBIS_ARENA_FLAG) == 0) {
+        ma_free(pHeader, (pAllocator != NULL) ? pAllocator->pAllocationCallbacks : NULL);
+    } else {
+        /* Arena blocks are released with the arena. */
     }
-    #endif
 }
 
-MA_VORBIS_API ma_result ma_libvorbis_init(ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+static void* ma_libvorbis_ogg_realloc(void* p, size_t sz)
 {
-    ma_result result;
+    ma_libvorbis_allocation_header* pHeader;
+    ma_libvorbis_allocator* pAllocator;
+    size_t oldSize;
 
-    (void)pAllocationCallbacks; /* Can't seem to find a way to configure memory allocations in libvorbis. */
-
-    if (onRead == NULL || onSeek == NULL) {
-        return MA_INVALID_ARGS; /* onRead and onSeek are mandatory. */
+    if (p == NULL) {
+        return ma_libvorbis_ogg_malloc(sz);
     }
-    
-    result = ma_libvorbis_init_internal(pConfig, pAllocationCallbacks, pVorbis);
-    if (result != MA_SUCCESS) {
-        return result;
+
+    if (sz == 0) {
+        ma_libvorbis_ogg_free(p);
+        return NULL;
     }
 
-    pVorbis->onRead = onRead;
-    pVorbis->onSeek = onSeek;
-    pVorbis->onTell = onTell;
-    pVorbis->pReadSeekTellUserData = pReadSeekTellUserData;
+    pHeader    = (ma_libvorbis_allocation_header*)((ma_uint8*)p - MA_LIBVORBIS_ALLOCATION_HEADER_SIZE);
+    pAllocator = pHeader->pAllocator;   /* Always stays with the allocator that made the original allocation. */
+    oldSize    = pHeader->size & ~MA_LIBVORBIS_ARENA_FLAG;
 
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        int libvorbisResult;
-        ov_callbacks libvorbisCallbacks;
+    if ((pHeader->size & MA_LIBVORBIS_ARENA_FLAG) != 0) {
+        /* Arena blocks can't be resized in place. Move it to a new block. */
+        void* pNew = ma_libvorbis_allocator_malloc(pAllocator, sz);
+        if (pNew == NULL) {
+            return NULL;
+        }
 
-        /* We can now initialize the vorbis decoder. This must be done after we've set up the callbacks. */
-        libvorbisCallbacks.read_func  = ma_libvorbis_vf_callback__read;
-        libvorbisCallbacks.seek_func  = ma_libvorbis_vf_callback__seek;
-        libvorbisCallbacks.close_func = NULL;
-        libvorbisCallbacks.tell_func  = ma_libvorbis_vf_callback__tell;
+        memcpy(pNew, p, (oldSize < sz) ? oldSize : sz);
+        ma_libvorbis_ogg_free(p);
 
-        libvorbisResult = ov_open_callbacks(pVorbis, (OggVorbis_File*)pVorbis->vf, NULL, 0, libvorbisCallbacks);
-        if (libvorbisResult < 0) {
-            ma_data_source_uninit(&pVorbis->ds);
-            ma_free(pVorbis->vf, pAllocationCallbacks);
-            return MA_INVALID_FILE;
+        if (pAllocator != NULL) {
+            pAllocator->stats.reallocationCount += 1;
         }
 
-        return MA_SUCCESS;
+        return pNew;
     }
-    #else
-    {
-        /* libvorbis is disabled. */
-        return MA_NOT_IMPLEMENTED;
-    }
-    #endif
-}
-
-MA_VORBIS_API ma_result ma_libvorbis_init_file(const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
-{
-    ma_result result;
 
-    (void)pAllocationCallbacks; /* Can't seem to find a way to configure memory allocations in libvorbis. */
+    if (sz >= (MA_LIBVORBIS_ARENA_FLAG - MA_LIBVORBIS_ALLOCATION_HEADER_SIZE)) {
+        return NULL;
+    }
 
-    result = ma_libvorbis_init_internal(pConfig, pAllocationCallbacks, pVorbis);
-    if (result != MA_SUCCESS) {
-        return result;
+    pHeader = (ma_libvorbis_allocation_header*)ma_realloc(pHeader, MA_LIBVORBIS_ALLOCATION_HEADER_SIZE + sz, (pAllocator != NULL) ? pAllocator->pAllocationCallbacks : NULL);
+    if (pHeader == NULL) {
+        return NULL;
     }
 
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        int libvorbisResult;
+    pHeader->size = sz;
 
-        libvorbisResult = ov_fopen(pFilePath, (OggVorbis_File*)pVorbis->vf);
-        if (libvorbisResult < 0) {
-            ma_data_source_uninit(&pVorbis->ds);
-            ma_free(pVorbis->vf, pAllocationCallbacks);
-            return MA_INVALID_FILE;
+    if (pAllocator != NULL) {
+        pAllocator->stats.reallocationCount += 1;
+        pAllocator->stats.bytesInUse        += sz;
+        pAllocator->stats.bytesInUse        -= oldSize;
+        if (pAllocator->stats.peakBytesInUse < pAllocator->stats.bytesInUse) {
+            pAllocator->stats.peakBytesInUse = pAllocator->stats.bytesInUse;
         }
-
-        return MA_SUCCESS;
-    }
-    #else
-    {
-        /* libvorbis is disabled. */
-        (void)pFilePath;
-        return MA_NOT_IMPLEMENTED;
     }
-    #endif
+
+    return (ma_uint8*)pHeader + MA_LIBVORBIS_ALLOCATION_HEADER_SIZE;
 }
 
-MA_VORBIS_API void ma_libvorbis_uninit(ma_libvorbis* pVorbis, const ma_allocation_callbacks* pAllocationCallbacks)
+static void ma_libvorbis_reserve_arena_for_setup(vorbis_info* vi, long setupHeaderSizeInBytes, ma_bool32 includeCodebooks)
 {
-    if (pVorbis == NULL) {
+    codec_setup_info* ci = (codec_setup_info*)vi->codec_setup;
+    ma_libvorbis_allocator* pAllocator = g_ma_libvorbis_current_allocator;
+    size_t reserveSize;
+
+    if (pAllocator == NULL || !pAllocator->isArenaActive) {
         return;
     }
 
-    (void)pAllocationCallbacks;
-
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        ov_clear((OggVorbis_File*)pVorbis->vf);
-    }
-    #else
-    {
-        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
-        assert(MA_FALSE);
+    /*
+    Most of what's left to allocate while opening is the unpacked codebooks, which scale with the size of the setup
+    header, and the synthesis buffers, which scale with the channel count and the long block size. Codebooks coming
+    out of the setup cache are not allocated by the decoder so they're not included in that case.
+    */
+    reserveSize = MA_LIBVORBIS_ARENA_BASE_SIZE + (size_t)vi->channels * (size_t)ci->blocksizes[1] * sizeof(float) * 2;
+    if (includeCodebooks) {
+        reserveSize += (size_t)setupHeaderSizeInBytes * MA_LIBVORBIS_ARENA_SETUP_SCALE;
     }
-    #endif
 
-    ma_data_source_uninit(&pVorbis->ds);
-    ma_free(pVorbis->vf, pAllocationCallbacks);
+    if (pAllocator->pArenaChunks == NULL || pAllocator->pArenaChunks->capacity - pAllocator->pArenaChunks->cursor < reserveSize) {
+        ma_libvorbis_arena_add_chunk(pAllocator, (pAllocator->arenaChunkSize > reserveSize) ? pAllocator->arenaChunkSize : reserveSize);  /* Failure is fine. We'll just fall back to smaller chunks or the heap. */
+    }
 }
 
-MA_VORBIS_API ma_result ma_libvorbis_read_pcm_frames(ma_libvorbis* pVorbis, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+
+/*
+Setup cache
+
+Files encoded with the same settings have byte identical setup headers, and unpacking one (codebooks, floors,
+residues, mappings and modes, plus building the Huffman decode tables) is by far the most expensive part of opening
+a decoder. Unpacked setups are therefore kept in a refcounted cache keyed on a hash of the setup header.
+
+Each decoder still has its own codec_setup_info, but the params and fullbooks in it point into the cache entry and
+ci->shared_setup is set so that vorbis_info_clear() releases the reference instead of freeing them. The fullbooks
+are built when the entry is created rather than lazily by vorbis_synthesis_init() so that shared state is never
+written to after it's been published. Since entries outlive the decoder that created them they are allocated
+with the default allocator rather than the decoder's.
+*/
+#define MA_LIBVORBIS_SETUP_CACHE_BUCKET_COUNT  64
+
+typedef struct ma_libvorbis_setup_cache_entry ma_libvorbis_setup_cache_entry;
+struct ma_libvorbis_setup_cache_entry
 {
-    if (pFramesRead != NULL) {
-        *pFramesRead = 0;
-    }
+    ma_libvorbis_setup_cache_entry* pNext;
+    ma_uint32 hash;
+    ma_uint32 refCount;
+    int channels;                       /* The setup header is interpreted in terms of these so they're part of the key. */
+    long blocksizes[2];
+    long setupHeaderSizeInBytes;
+    unsigned char* pSetupHeader;
+    codec_setup_info* pSetup;           /* Owns the params and fullbooks. */
+};
 
-    if (frameCount == 0) {
-        return MA_INVALID_ARGS;
-    }
+static ma_spinlock g_ma_libvorbis_setup_cache_lock = 0;
+static ma_libvorbis_setup_cache_entry* g_ma_libvorbis_setup_cache[MA_LIBVORBIS_SETUP_CACHE_BUCKET_COUNT];
 
-    if (pVorbis == NULL) {
-        return MA_INVALID_ARGS;
+static ma_uint32 ma_libvorbis_hash_setup_header(const unsigned char* pData, long dataSize)
+{
+    /* FNV-1a. */
+    ma_uint32 hash = 2166136261u;
+    long i;
+
+    for (i = 0; i < dataSize; i += 1) {
+        hash ^= pData[i];
+        hash *= 16777619u;
     }
 
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        /* We always use floating point format. */
-        ma_result result = MA_SUCCESS;  /* Must be initialized to MA_SUCCESS. */
-        ma_uint64 totalFramesRead;
-        ma_format format;
-        ma_uint32 channels;
+    return hash;
+}
 
-        ma_libvorbis_get_data_format(pVorbis, &format, &channels, NULL, NULL, 0);
+/* Must be called with the lock held. */
+static ma_libvorbis_setup_cache_entry* ma_libvorbis_setup_cache_find(ma_uint32 hash, const vorbis_info* vi, const ogg_packet* op)
+{
+    const codec_setup_info* ci = (const codec_setup_info*)vi->codec_setup;
+    ma_libvorbis_setup_cache_entry* pEntry;
+
+    for (pEntry = g_ma_libvorbis_setup_cache[hash % MA_LIBVORBIS_SETUP_CACHE_BUCKET_COUNT]; pEntry != NULL; pEntry = pEntry->pNext) {
+        if (pEntry->hash == hash &&
+            pEntry->channels == vi->channels &&
+            pEntry->blocksizes[0] == ci->blocksizes[0] &&
+            pEntry->blocksizes[1] == ci->blocksizes[1] &&
+            pEntry->setupHeaderSizeInBytes == op->bytes &&
+            memcmp(pEntry->pSetupHeader, op->packet, (size_t)op->bytes) == 0) {
+            return pEntry;
+        }
+    }
 
-        totalFramesRead = 0;
-        while (totalFramesRead < frameCount) {
-            long libvorbisResult;
-            ma_uint64 framesToRead;
-            ma_uint64 framesRemaining;
-
-            framesRemaining = (frameCount - totalFramesRead);
-            framesToRead = 1024;
-            if (framesToRead > framesRemaining) {
-                framesToRead = framesRemaining;
-            }
+    return NULL;
+}
 
-            if (format == ma_format_f32) {
-                float** ppFramesF32;
+static void ma_libvorbis_setup_cache_entry_destroy(ma_libvorbis_setup_cache_entry* pEntry)
+{
+    vorbis_info vi;
 
-                libvorbisResult = ov_read_float((OggVorbis_File*)pVorbis->vf, &ppFramesF32, (int)framesToRead, NULL);
-                if (libvorbisResult < 0) {
-                    result = MA_ERROR;  /* Error while decoding. */
-                    break;
-                } else {
-                    /* Frames need to be interleaved. */
-                    ma_interleave_pcm_frames(format, channels, libvorbisResult, (const void**)ppFramesF32, ma_offset_pcm_frames_ptr(pFramesOut, totalFramesRead, format, channels));
-                    totalFramesRead += libvorbisResult;
+    /* vorbis_info_clear() knows how to free everything the entry owns, including pSetup itself. */
+    memset(&vi, 0, sizeof(vi));
+    vi.codec_setup = pEntry->pSetup;
+    vorbis_info_clear(&vi);
+
+    _ogg_free(pEntry->pSetupHeader);
+    _ogg_free(pEntry);
+}
+
+/*
+Takes ownership of the freshly unpacked setup in ci. Returns null, leaving ci as it was, if the fullbooks can't be
+built or we run out of memory, in which case the decoder just keeps its own private copy.
+*/
+static ma_libvorbis_setup_cache_entry* ma_libvorbis_setup_cache_entry_create(vorbis_info* vi, const ogg_packet* op, ma_uint32 hash)
+{
+    codec_setup_info* ci = (codec_setup_info*)vi->codec_setup;
+    ma_libvorbis_setup_cache_entry* pEntry;
+    int i;
+
+    pEntry = (ma_libvorbis_setup_cache_entry*)_ogg_calloc(1, sizeof(*pEntry));
+    if (pEntry == NULL) {
+        return NULL;
+    }
+
+    pEntry->pSetupHeader = (unsigned char*)_ogg_malloc((size_t)op->bytes);
+    pEntry->pSetup       = (codec_setup_info*)_ogg_malloc(sizeof(*pEntry->pSetup));
+    ci->fullbooks        = (codebook*)_ogg_calloc(ci->books, sizeof(*ci->fullbooks));
+    if (pEntry->pSetupHeader == NULL || pEntry->pSetup == NULL || ci->fullbooks == NULL) {
+        goto on_error;
+    }
+
+    /* Same as what vorbis_synthesis_init() does, except the static books are only dropped once all of them succeed. */
+    for (i = 0; i < ci->books; i += 1) {
+        if (ci->book_param[i] == NULL || vorbis_book_init_decode(ci->fullbooks + i, ci->book_param[i]) != 0) {
+            goto on_error;
+        }
+    }
+
+    for (i = 0; i < ci->books; i += 1) {
+        vorbis_staticbook_destroy(ci->book_param[i]);
+        ci->book_param[i] = NULL;
+    }
+
+    memcpy(pEntry->pSetupHeader, op->packet, (size_t)op->bytes);
+    memcpy(pEntry->pSetup, ci, sizeof(*ci));
+    pEntry->pSetup->shared_setup = NULL;
+
+    pEntry->hash                   = hash;
+    pEntry->refCount               = 1;
+    pEntry->channels               = vi->channels;
+    pEntry->blocksizes[0]          = ci->blocksizes[0];
+    pEntry->blocksizes[1]          = ci->blocksizes[1];
+    pEntry->setupHeaderSizeInBytes = op->bytes;
+
+    return pEntry;
+
+on_error:
+    if (ci->fullbooks != NULL) {
+        for (i = 0; i < ci->books; i += 1) {
+            vorbis_book_clear(ci->fullbooks + i);
+        }
+
+        _ogg_free(ci->fullbooks);
+        ci->fullbooks = NULL;
+    }
+
+    _ogg_free(pEntry->pSetup);
+    _ogg_free(pEntry->pSetupHeader);
+    _ogg_free(pEntry);
+
+    return NULL;
+}
+
+static void ma_libvorbis_setup_cache_attach(codec_setup_info* ci, ma_libvorbis_setup_cache_entry* pEntry)
+{
+    const codec_setup_info* pShared = pEntry->pSetup;
+
+    ci->modes    = pShared->modes;
+    ci->maps     = pShared->maps;
+    ci->floors   = pShared->floors;
+    ci->residues = pShared->residues;
+    ci->books    = pShared->books;
+
+    memcpy(ci->mode_param,    pShared->mode_param,    sizeof(ci->mode_param));
+    memcpy(ci->map_type,      pShared->map_type,      sizeof(ci->map_type));
+    memcpy(ci->map_param,     pShared->map_param,     sizeof(ci->map_param));
+    memcpy(ci->floor_type,    pShared->floor_type,    sizeof(ci->floor_type));
+    memcpy(ci->floor_param,   pShared->floor_param,   sizeof(ci->floor_param));
+    memcpy(ci->residue_type,  pShared->residue_type,  sizeof(ci->residue_type));
+    memcpy(ci->residue_param, pShared->residue_param, sizeof(ci->residue_param));
+    memset(ci->book_param, 0, sizeof(ci->book_param));
+    ci->fullbooks = pShared->fullbooks;
+
+    ci->shared_setup = pEntry;
+}
+
+static volatile ma_bool32 g_ma_libvorbis_setup_cache_enabled = MA_TRUE;
+
+static int ma_libvorbis_unpack_books(void* pInfo, void* pPacket, void* pBitReader)
+{
+    vorbis_info* vi = (vorbis_info*)pInfo;
+    ogg_packet* op = (ogg_packet*)pPacket;
+    codec_setup_info* ci = (codec_setup_info*)vi->codec_setup;
+    ma_libvorbis_setup_cache_entry* pEntry;
+    ma_libvorbis_setup_cache_entry* pExistingEntry;
+    ma_libvorbis_allocator* pPrevAllocator;
+    ma_uint32 hash;
+    int libvorbisResult;
+
+    if (!g_ma_libvorbis_setup_cache_enabled) {
+        ma_libvorbis_reserve_arena_for_setup(vi, op->bytes, MA_TRUE);
+        return _vorbis_unpack_books(vi, (oggpack_buffer*)pBitReader);
+    }
+
+    ma_libvorbis_reserve_arena_for_setup(vi, op->bytes, MA_FALSE);
+
+    hash = ma_libvorbis_hash_setup_header(op->packet, op->bytes);
+
+    ma_spinlock_lock(&g_ma_libvorbis_setup_cache_lock);
+    {
+        pEntry = ma_libvorbis_setup_cache_find(hash, vi, op);
+        if (pEntry != NULL) {
+            pEntry->refCount += 1;
+        }
+    }
+    ma_spinlock_unlock(&g_ma_libvorbis_setup_cache_lock);
+
+    if (pEntry != NULL) {
+        ma_libvorbis_setup_cache_attach(ci, pEntry);
+        return 0;
+    }
+
+    /* Not cached. Unpack it ourselves outside of the lock since this is the slow part. */
+    pPrevAllocator = ma_libvorbis_push_allocator(NULL);
+    {
+        libvorbisResult = _vorbis_unpack_books(vi, (oggpack_buffer*)pBitReader);
+        if (libvorbisResult == 0) {
+            pEntry = ma_libvorbis_setup_cache_entry_create(vi, op, hash);
+        }
+    }
+    ma_libvorbis_pop_allocator(pPrevAllocator);
+
+    if (libvorbisResult != 0 || pEntry == NULL) {
+        return libvorbisResult;
+    }
+
+    /* Somebody else may have unpacked the same setup while we weren't holding the lock. If so, use theirs. */
+    ma_spinlock_lock(&g_ma_libvorbis_setup_cache_lock);
+    {
+        pExistingEntry = ma_libvorbis_setup_cache_find(hash, vi, op);
+        if (pExistingEntry != NULL) {
+            pExistingEntry->refCount += 1;
+        } else {
+            pEntry->pNext = g_ma_libvorbis_setup_cache[hash % MA_LIBVORBIS_SETUP_CACHE_BUCKET_COUNT];
+            g_ma_libvorbis_setup_cache[hash % MA_LIBVORBIS_SETUP_CACHE_BUCKET_COUNT] = pEntry;
+        }
+    }
+    ma_spinlock_unlock(&g_ma_libvorbis_setup_cache_lock);
+
+    if (pExistingEntry != NULL) {
+        ma_libvorbis_setup_cache_entry_destroy(pEntry);
+        pEntry = pExistingEntry;
+    }
+
+    ma_libvorbis_setup_cache_attach(ci, pEntry);
+
+    return 0;
+}
+
+static void ma_libvorbis_release_shared_setup(void* pSharedSetup)
+{
+    ma_libvorbis_setup_cache_entry* pEntry = (ma_libvorbis_setup_cache_entry*)pSharedSetup;
+    ma_bool32 isLastReference = MA_FALSE;
+
+    ma_spinlock_lock(&g_ma_libvorbis_setup_cache_lock);
+    {
+        pEntry->refCount -= 1;
+        if (pEntry->refCount == 0) {
+            ma_libvorbis_setup_cache_entry** ppEntry = &g_ma_libvorbis_setup_cache[pEntry->hash % MA_LIBVORBIS_SETUP_CACHE_BUCKET_COUNT];
+            while (*ppEntry != pEntry) {
+                ppEntry = &(*ppEntry)->pNext;
+            }
+
+            *ppEntry = pEntry->pNext;
+            isLastReference = MA_TRUE;
+        }
+    }
+    ma_spinlock_unlock(&g_ma_libvorbis_setup_cache_lock);
+
+    if (isLastReference) {
+        ma_libvorbis_setup_cache_entry_destroy(pEntry);
+    }
+}
+#endif
+
+MA_VORBIS_API void ma_libvorbis_set_setup_cache_enabled(ma_bool32 isEnabled)
+{
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        g_ma_libvorbis_setup_cache_enabled = isEnabled;
+    }
+    #else
+    {
+        (void)isEnabled;
+    }
+    #endif
+}
+
+MA_VORBIS_API void ma_libvorbis_set_default_arena_size(size_t arenaSizeInBytes)
+{
+    g_ma_libvorbis_default_arena_size = arenaSizeInBytes;
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_get_allocation_stats(ma_libvorbis* pVorbis, ma_libvorbis_allocation_stats* pStats)
+{
+    if (pStats == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    memset(pStats, 0, sizeof(*pStats));
+
+    if (pVorbis == NULL || pVorbis->pAllocator == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        *pStats = ((ma_libvorbis_allocator*)pVorbis->pAllocator)->stats;
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+
+static ma_result ma_libvorbis_ds_read(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    return ma_libvorbis_read_pcm_frames((ma_libvorbis*)pDataSource, pFramesOut, frameCount, pFramesRead);
+}
+
+static ma_result ma_libvorbis_ds_seek(ma_data_source* pDataSource, ma_uint64 frameIndex)
+{
+    return ma_libvorbis_seek_to_pcm_frame((ma_libvorbis*)pDataSource, frameIndex);
+}
+
+static ma_result ma_libvorbis_ds_get_data_format(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+{
+    return ma_libvorbis_get_data_format((ma_libvorbis*)pDataSource, pFormat, pChannels, pSampleRate, pChannelMap, channelMapCap);
+}
+
+static ma_result ma_libvorbis_ds_get_cursor(ma_data_source* pDataSource, ma_uint64* pCursor)
+{
+    return ma_libvorbis_get_cursor_in_pcm_frames((ma_libvorbis*)pDataSource, pCursor);
+}
+
+static ma_result ma_libvorbis_ds_get_length(ma_data_source* pDataSource, ma_uint64* pLength)
+{
+    return ma_libvorbis_get_length_in_pcm_frames((ma_libvorbis*)pDataSource, pLength);
+}
+
+static ma_data_source_vtable g_ma_libvorbis_ds_vtable =
+{
+    ma_libvorbis_ds_read,
+    ma_libvorbis_ds_seek,
+    ma_libvorbis_ds_get_data_format,
+    ma_libvorbis_ds_get_cursor,
+    ma_libvorbis_ds_get_length,
+    NULL,   /* onSetLooping */
+    MA_LIBVORBIS_DATA_SOURCE_FLAG_PLANAR
+};
+
+
+#if !defined(MA_NO_LIBVORBIS)
+static size_t ma_libvorbis_vf_callback__read(void* pBufferOut, size_t size, size_t count, void* pUserData)
+{
+    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
+    ma_result result;
+    size_t bytesToRead;
+    size_t bytesRead;
+
+    /* For consistency with fread(). If `size` of `count` is 0, return 0 immediately without changing anything. */
+    if (size == 0 || count == 0) {
+        return 0;
+    }
+
+    bytesToRead = size * count;
+    result = pVorbis->onRead(pVorbis->pReadSeekTellUserData, pBufferOut, bytesToRead, &bytesRead);
+    if (result != MA_SUCCESS) {
+        /* Not entirely sure what to return here. What if an error occurs, but some data was read and bytesRead is > 0? */
+        return 0;
+    }
+
+    return bytesRead / size;
+}
+
+static int ma_libvorbis_vf_callback__seek(void* pUserData, ogg_int64_t offset, int whence)
+{
+    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
+    ma_result result;
+    ma_seek_origin origin;
+
+    if (whence == SEEK_SET) {
+        origin = ma_seek_origin_start;
+    } else if (whence == SEEK_END) {
+        origin = ma_seek_origin_end;
+    } else {
+        origin = ma_seek_origin_current;
+    }
+
+    result = pVorbis->onSeek(pVorbis->pReadSeekTellUserData, offset, origin);
+    if (result != MA_SUCCESS) {
+        return -1;
+    }
+
+    return 0;
+}
+
+static ogg_int64_t ma_libvorbis_vf_callback__tell(void* pUserData)
+{
+    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
+    ma_result result;
+    ma_int64 cursor;
+    
+    result = pVorbis->onTell(pVorbis->pReadSeekTellUserData, &cursor);
+    if (result != MA_SUCCESS) {
+        return -1;
+    }
+
+    return cursor;
+}
+
+/*
+The memory callbacks below read straight out of the buffer passed to ma_libvorbis_init_memory(). The only copy
+is the one into libogg's sync buffer which can't be avoided since libogg owns page and packet assembly.
+*/
+static size_t ma_libvorbis_vf_callback__read_memory(void* pBufferOut, size_t size, size_t count, void* pUserData)
+{
+    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
+    size_t bytesRemaining;
+    size_t bytesToRead;
+
+    /* For consistency with fread(). If `size` of `count` is 0, return 0 immediately without changing anything. */
+    if (size == 0 || count == 0) {
+        return 0;
+    }
+
+    bytesRemaining = pVorbis->memory.dataSize - pVorbis->memory.currentReadPos;
+    bytesToRead = size * count;
+    if (bytesToRead > bytesRemaining) {
+        bytesToRead = bytesRemaining;
+    }
+
+    if (bytesToRead > 0) {
+        memcpy(pBufferOut, pVorbis->memory.pData + pVorbis->memory.currentReadPos, bytesToRead);
+        pVorbis->memory.currentReadPos += bytesToRead;
+    }
+
+    return bytesToRead / size;
+}
+
+static int ma_libvorbis_vf_callback__seek_memory(void* pUserData, ogg_int64_t offset, int whence)
+{
+    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
+    ogg_int64_t newReadPos;
+
+    if (whence == SEEK_SET) {
+        newReadPos = offset;
+    } else if (whence == SEEK_END) {
+        newReadPos = (ogg_int64_t)pVorbis->memory.dataSize + offset;
+    } else {
+        newReadPos = (ogg_int64_t)pVorbis->memory.currentReadPos + offset;
+    }
+
+    if (newReadPos < 0 || newReadPos > (ogg_int64_t)pVorbis->memory.dataSize) {
+        return -1;  /* Trying to seek outside the buffer. */
+    }
+
+    pVorbis->memory.currentReadPos = (size_t)newReadPos;
+
+    return 0;
+}
+
+static ogg_int64_t ma_libvorbis_vf_callback__tell_memory(void* pUserData)
+{
+    ma_libvorbis* pVorbis = (ma_libvorbis*)pUserData;
+
+    return (ogg_int64_t)pVorbis->memory.currentReadPos;
+}
+#endif
+
+/*
+Interleaving of the planar output of ov_read_float(). Mono, stereo and 5.1 have dedicated kernels. Everything else
+goes through the generic ma_interleave_pcm_frames().
+*/
+typedef void (* ma_libvorbis_interleave_f32_proc)(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount);
+
+static void ma_libvorbis_interleave_f32_2__reference(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    const float* pL = ppFramesIn[0];
+    const float* pR = ppFramesIn[1];
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount; iFrame += 1) {
+        pFramesOut[iFrame*2 + 0] = pL[iFrame];
+        pFramesOut[iFrame*2 + 1] = pR[iFrame];
+    }
+}
+
+static void ma_libvorbis_interleave_f32_6__reference(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 iFrame;
+    ma_uint32 iChannel;
+
+    for (iFrame = 0; iFrame < frameCount; iFrame += 1) {
+        for (iChannel = 0; iChannel < 6; iChannel += 1) {
+            pFramesOut[iFrame*6 + iChannel] = ppFramesIn[iChannel][iFrame];
+        }
+    }
+}
+
+static void ma_libvorbis_interleave_f32_6__tail(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameIndex, ma_uint64 frameCount)
+{
+    ma_uint32 iChannel;
+
+    for (; frameIndex < frameCount; frameIndex += 1) {
+        for (iChannel = 0; iChannel < 6; iChannel += 1) {
+            pFramesOut[frameIndex*6 + iChannel] = ppFramesIn[iChannel][frameIndex];
+        }
+    }
+}
+
+#if defined(MA_LIBVORBIS_X86)
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_interleave_f32_2__sse2(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    const float* pL = ppFramesIn[0];
+    const float* pR = ppFramesIn[1];
+    ma_uint64 frameCount4 = frameCount & ~(ma_uint64)3;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount4; iFrame += 4) {
+        __m128 l = _mm_loadu_ps(pL + iFrame);
+        __m128 r = _mm_loadu_ps(pR + iFrame);
+
+        _mm_storeu_ps(pFramesOut + iFrame*2 + 0, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(pFramesOut + iFrame*2 + 4, _mm_unpackhi_ps(l, r));
+    }
+
+    for (; iFrame < frameCount; iFrame += 1) {
+        pFramesOut[iFrame*2 + 0] = pL[iFrame];
+        pFramesOut[iFrame*2 + 1] = pR[iFrame];
+    }
+}
+
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_interleave_f32_6__sse2(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 frameCount4 = frameCount & ~(ma_uint64)3;
+    ma_uint64 iFrame;
+
+    /* Four frames at a time. Channels 0-3 are a plain 4x4 transpose and channels 4 and 5 are spliced in between. */
+    for (iFrame = 0; iFrame < frameCount4; iFrame += 4) {
+        __m128 c0 = _mm_loadu_ps(ppFramesIn[0] + iFrame);
+        __m128 c1 = _mm_loadu_ps(ppFramesIn[1] + iFrame);
+        __m128 c2 = _mm_loadu_ps(ppFramesIn[2] + iFrame);
+        __m128 c3 = _mm_loadu_ps(ppFramesIn[3] + iFrame);
+        __m128 c4 = _mm_loadu_ps(ppFramesIn[4] + iFrame);
+        __m128 c5 = _mm_loadu_ps(ppFramesIn[5] + iFrame);
+        __m128 t0 = _mm_unpacklo_ps(c0, c1);
+        __m128 t1 = _mm_unpacklo_ps(c2, c3);
+        __m128 t2 = _mm_unpackhi_ps(c0, c1);
+        __m128 t3 = _mm_unpackhi_ps(c2, c3);
+        __m128 r1 = _mm_movehl_ps(t1, t0);
+        __m128 r3 = _mm_movehl_ps(t3, t2);
+        __m128 lo45 = _mm_unpacklo_ps(c4, c5);
+        __m128 hi45 = _mm_unpackhi_ps(c4, c5);
+        float* pOut = pFramesOut + iFrame*6;
+
+        _mm_storeu_ps(pOut +  0, _mm_movelh_ps(t0, t1));
+        _mm_storeu_ps(pOut +  4, _mm_movelh_ps(lo45, r1));
+        _mm_storeu_ps(pOut +  8, _mm_movehl_ps(lo45, r1));
+        _mm_storeu_ps(pOut + 12, _mm_movelh_ps(t2, t3));
+        _mm_storeu_ps(pOut + 16, _mm_movelh_ps(hi45, r3));
+        _mm_storeu_ps(pOut + 20, _mm_movehl_ps(hi45, r3));
+    }
+
+    ma_libvorbis_interleave_f32_6__tail(pFramesOut, ppFramesIn, iFrame, frameCount);
+}
+
+MA_LIBVORBIS_TARGET_AVX2
+static void ma_libvorbis_interleave_f32_2__avx2(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    const float* pL = ppFramesIn[0];
+    const float* pR = ppFramesIn[1];
+    ma_uint64 frameCount8 = frameCount & ~(ma_uint64)7;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount8; iFrame += 8) {
+        __m256 l  = _mm256_loadu_ps(pL + iFrame);
+        __m256 r  = _mm256_loadu_ps(pR + iFrame);
+        __m256 lo = _mm256_unpacklo_ps(l, r);   /* L0 R0 L1 R1 | L4 R4 L5 R5 */
+        __m256 hi = _mm256_unpackhi_ps(l, r);   /* L2 R2 L3 R3 | L6 R6 L7 R7 */
+
+        _mm256_storeu_ps(pFramesOut + iFrame*2 + 0, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(pFramesOut + iFrame*2 + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    for (; iFrame < frameCount; iFrame += 1) {
+        pFramesOut[iFrame*2 + 0] = pL[iFrame];
+        pFramesOut[iFrame*2 + 1] = pR[iFrame];
+    }
+}
+
+MA_LIBVORBIS_TARGET_AVX2
+static void ma_libvorbis_interleave_f32_6__avx2(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 frameCount8 = frameCount & ~(ma_uint64)7;
+    ma_uint64 iFrame;
+
+    /* Same as the SSE2 kernel in each 128-bit lane, with the low lanes holding frames 0-3 and the high lanes frames 4-7. */
+    for (iFrame = 0; iFrame < frameCount8; iFrame += 8) {
+        __m256 c0 = _mm256_loadu_ps(ppFramesIn[0] + iFrame);
+        __m256 c1 = _mm256_loadu_ps(ppFramesIn[1] + iFrame);
+        __m256 c2 = _mm256_loadu_ps(ppFramesIn[2] + iFrame);
+        __m256 c3 = _mm256_loadu_ps(ppFramesIn[3] + iFrame);
+        __m256 c4 = _mm256_loadu_ps(ppFramesIn[4] + iFrame);
+        __m256 c5 = _mm256_loadu_ps(ppFramesIn[5] + iFrame);
+        __m256 t0 = _mm256_unpacklo_ps(c0, c1);
+        __m256 t1 = _mm256_unpacklo_ps(c2, c3);
+        __m256 t2 = _mm256_unpackhi_ps(c0, c1);
+        __m256 t3 = _mm256_unpackhi_ps(c2, c3);
+        __m256 r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 lo45 = _mm256_unpacklo_ps(c4, c5);
+        __m256 hi45 = _mm256_unpackhi_ps(c4, c5);
+        __m256 o0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 o1 = _mm256_shuffle_ps(lo45, r1, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 o2 = _mm256_shuffle_ps(r1, lo45, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 o3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 o4 = _mm256_shuffle_ps(hi45, r3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 o5 = _mm256_shuffle_ps(r3, hi45, _MM_SHUFFLE(3, 2, 3, 2));
+        float* pOut = pFramesOut + iFrame*6;
+
+        _mm256_storeu_ps(pOut +  0, _mm256_permute2f128_ps(o0, o1, 0x20));
+        _mm256_storeu_ps(pOut +  8, _mm256_permute2f128_ps(o2, o3, 0x20));
+        _mm256_storeu_ps(pOut + 16, _mm256_permute2f128_ps(o4, o5, 0x20));
+        _mm256_storeu_ps(pOut + 24, _mm256_permute2f128_ps(o0, o1, 0x31));
+        _mm256_storeu_ps(pOut + 32, _mm256_permute2f128_ps(o2, o3, 0x31));
+        _mm256_storeu_ps(pOut + 40, _mm256_permute2f128_ps(o4, o5, 0x31));
+    }
+
+    ma_libvorbis_interleave_f32_6__tail(pFramesOut, ppFramesIn, iFrame, frameCount);
+}
+
+static ma_bool32 ma_libvorbis_has_sse2(void)
+{
+    #if defined(_MSC_VER)
+    {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[3] & (1 << 26)) != 0;
+    }
+    #else
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2") != 0;
+    }
+    #endif
+}
+
+static ma_bool32 ma_libvorbis_has_avx2(void)
+{
+    #if defined(_MSC_VER)
+    {
+        int info[4];
+
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return MA_FALSE;
+        }
+
+        /* AVX and OSXSAVE must be set, and the OS must be saving YMM state. */
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) {
+            return MA_FALSE;
+        }
+        if ((_xgetbv(0) & 6) != 6) {
+            return MA_FALSE;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }
+    #else
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }
+    #endif
+}
+#endif  /* MA_LIBVORBIS_X86 */
+
+#if defined(MA_LIBVORBIS_NEON)
+static void ma_libvorbis_interleave_f32_2__neon(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    const float* pL = ppFramesIn[0];
+    const float* pR = ppFramesIn[1];
+    ma_uint64 frameCount4 = frameCount & ~(ma_uint64)3;
+    ma_uint64 iFrame;
+
+    for (iFrame = 0; iFrame < frameCount4; iFrame += 4) {
+        float32x4x2_t lr;
+        lr.val[0] = vld1q_f32(pL + iFrame);
+        lr.val[1] = vld1q_f32(pR + iFrame);
+        vst2q_f32(pFramesOut + iFrame*2, lr);
+    }
+
+    for (; iFrame < frameCount; iFrame += 1) {
+        pFramesOut[iFrame*2 + 0] = pL[iFrame];
+        pFramesOut[iFrame*2 + 1] = pR[iFrame];
+    }
+}
+
+static void ma_libvorbis_interleave_f32_6__neon(float* pFramesOut, const float* const* ppFramesIn, ma_uint64 frameCount)
+{
+    ma_uint64 frameCount4 = frameCount & ~(ma_uint64)3;
+    ma_uint64 iFrame;
+
+    /* Same shuffle as the SSE2 kernel. */
+    for (iFrame = 0; iFrame < frameCount4; iFrame += 4) {
+        float32x4x2_t t01  = vzipq_f32(vld1q_f32(ppFramesIn[0] + iFrame), vld1q_f32(ppFramesIn[1] + iFrame));
+        float32x4x2_t t23  = vzipq_f32(vld1q_f32(ppFramesIn[2] + iFrame), vld1q_f32(ppFramesIn[3] + iFrame));
+        float32x4x2_t t45  = vzipq_f32(vld1q_f32(ppFramesIn[4] + iFrame), vld1q_f32(ppFramesIn[5] + iFrame));
+        float* pOut = pFramesOut + iFrame*6;
+
+        vst1q_f32(pOut +  0, vcombine_f32(vget_low_f32 (t01.val[0]), vget_low_f32 (t23.val[0])));
+        vst1q_f32(pOut +  4, vcombine_f32(vget_low_f32 (t45.val[0]), vget_high_f32(t01.val[0])));
+        vst1q_f32(pOut +  8, vcombine_f32(vget_high_f32(t23.val[0]), vget_high_f32(t45.val[0])));
+        vst1q_f32(pOut + 12, vcombine_f32(vget_low_f32 (t01.val[1]), vget_low_f32 (t23.val[1])));
+        vst1q_f32(pOut + 16, vcombine_f32(vget_low_f32 (t45.val[1]), vget_high_f32(t01.val[1])));
+        vst1q_f32(pOut + 20, vcombine_f32(vget_high_f32(t23.val[1]), vget_high_f32(t45.val[1])));
+    }
+
+    ma_libvorbis_interleave_f32_6__tail(pFramesOut, ppFramesIn, iFrame, frameCount);
+}
+#endif  /* MA_LIBVORBIS_NEON */
+
+#if !defined(MA_NO_LIBVORBIS)
+/*
+Kernels for the hot loops inside libvorbis. minivorbis.h calls into these through the VORBIS_*_HOOK macros defined at
+the top of this file, and the reference kernels are the libvorbis loops they replace. The vectorized kernels perform
+exactly the same float operations per element as the reference kernels so decoding is bit-exact whichever path is
+selected. This is also why none of them use FMA, and why CMakeLists.txt disables contraction for this file.
+*/
+typedef void (* ma_libvorbis_mdct_butterfly_proc)(float* pTrig, float* pX, int points, int trigStride);
+typedef void (* ma_libvorbis_overlap_add_proc)(float* pPCM, const float* pIn, const float* pWindow, int count);
+typedef void (* ma_libvorbis_inverse_coupling_proc)(float* pMag, float* pAng, int count);
+typedef void (* ma_libvorbis_residue_add_proc)(float* pOut, long count, const float** ppEntries, int dim);
+typedef void (* ma_libvorbis_residue_add_stereo_proc)(float* pOutL, float* pOutR, long frameCount, const float** ppEntries, int dim);
+typedef void (* ma_libvorbis_render_floor_line_proc)(int n, int x0, int x1, int y0, int y1, float* pOut, const float* pLookup);
+
+/* Bresenham state for floor1 line rendering, shared by all render_floor_line kernels. */
+typedef struct
+{
+    int adx;
+    int ady;
+    int base;
+    int sy;
+    int err;
+    int y;
+} ma_libvorbis_floor_line;
+
+static int ma_libvorbis_floor_line_init(ma_libvorbis_floor_line* pLine, int n, int x0, int x1, int y0, int y1)
+{
+    int dy = y1 - y0;
+
+    pLine->adx  = x1 - x0;
+    pLine->base = dy / pLine->adx;
+    pLine->sy   = (dy < 0) ? pLine->base - 1 : pLine->base + 1;
+    pLine->ady  = abs(dy) - abs(pLine->base * pLine->adx);
+    pLine->err  = 0;
+    pLine->y    = y0;
+
+    /* Returns the end of the line, clamped to the output. */
+    return (n > x1) ? x1 : n;
+}
+
+static MA_INLINE int ma_libvorbis_floor_line_next(ma_libvorbis_floor_line* pLine)
+{
+    pLine->err += pLine->ady;
+    if (pLine->err >= pLine->adx) {
+        pLine->err -= pLine->adx;
+        pLine->y   += pLine->sy;
+    } else {
+        pLine->y   += pLine->base;
+    }
+
+    return pLine->y;
+}
+
+
+static void ma_libvorbis_mdct_butterfly__reference(float* pTrig, float* pX, int points, int trigStride)
+{
+    int half = points >> 1;
+    int iBlock;
+
+    /* Blocks of 8 from the top, with the pairs within a block also processed from the top. */
+    for (iBlock = half - 8; iBlock >= 0; iBlock -= 8) {
+        float* pX1 = pX + half + iBlock;
+        float* pX2 = pX + iBlock;
+        int iPair;
+
+        for (iPair = 6; iPair >= 0; iPair -= 2) {
+            float r0 = pX1[iPair + 0] - pX2[iPair + 0];
+            float r1 = pX1[iPair + 1] - pX2[iPair + 1];
+
+            pX1[iPair + 0] += pX2[iPair + 0];
+            pX1[iPair + 1] += pX2[iPair + 1];
+            pX2[iPair + 0]  = r1 * pTrig[1] + r0 * pTrig[0];
+            pX2[iPair + 1]  = r1 * pTrig[0] - r0 * pTrig[1];
+
+            pTrig += trigStride;
+        }
+    }
+}
+
+static void ma_libvorbis_overlap_add__reference(float* pPCM, const float* pIn, const float* pWindow, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i += 1) {
+        pPCM[i] = pPCM[i]*pWindow[count - i - 1] + pIn[i]*pWindow[i];
+    }
+}
+
+static void ma_libvorbis_inverse_coupling__tail(float* pMag, float* pAng, int i, int count)
+{
+    for (; i < count; i += 1) {
+        float mag = pMag[i];
+        float ang = pAng[i];
+
+        if (mag > 0) {
+            if (ang > 0) {
+                pMag[i] = mag;
+                pAng[i] = mag - ang;
+            } else {
+                pAng[i] = mag;
+                pMag[i] = mag + ang;
+            }
+        } else {
+            if (ang > 0) {
+                pMag[i] = mag;
+                pAng[i] = mag + ang;
+            } else {
+                pAng[i] = mag;
+                pMag[i] = mag - ang;
+            }
+        }
+    }
+}
+
+static void ma_libvorbis_inverse_coupling__reference(float* pMag, float* pAng, int count)
+{
+    ma_libvorbis_inverse_coupling__tail(pMag, pAng, 0, count);
+}
+
+static void ma_libvorbis_residue_add__tail(float* pOut, long i, long count, const float** ppEntries, int dim)
+{
+    /* i must be at the start of an entry. */
+    const float** ppEntry = ppEntries + i/dim;
+
+    while (i < count) {
+        const float* pEntry = *ppEntry++;
+        int j;
+
+        for (j = 0; j < dim && i < count; j += 1) {
+            pOut[i++] += pEntry[j];
+        }
+    }
+}
+
+static void ma_libvorbis_residue_add__reference(float* pOut, long count, const float** ppEntries, int dim)
+{
+    ma_libvorbis_residue_add__tail(pOut, 0, count, ppEntries, dim);
+}
+
+static void ma_libvorbis_residue_add_stereo__tail(float* pOutL, float* pOutR, long iFrame, long frameCount, const float** ppEntries, int dim)
+{
+    /* iFrame must be at the start of an entry. dim is always even. */
+    const float** ppEntry = ppEntries + iFrame/(dim/2);
+
+    while (iFrame < frameCount) {
+        const float* pEntry = *ppEntry++;
+        int j;
+
+        for (j = 0; j < dim && iFrame < frameCount; j += 2) {
+            pOutL[iFrame] += pEntry[j + 0];
+            pOutR[iFrame] += pEntry[j + 1];
+            iFrame += 1;
+        }
+    }
+}
+
+static void ma_libvorbis_residue_add_stereo__reference(float* pOutL, float* pOutR, long frameCount, const float** ppEntries, int dim)
+{
+    ma_libvorbis_residue_add_stereo__tail(pOutL, pOutR, 0, frameCount, ppEntries, dim);
+}
+
+static void ma_libvorbis_render_floor_line__reference(int n, int x0, int x1, int y0, int y1, float* pOut, const float* pLookup)
+{
+    ma_libvorbis_floor_line line;
+    int x = x0;
+
+    n = ma_libvorbis_floor_line_init(&line, n, x0, x1, y0, y1);
+    if (x >= n) {
+        return;
+    }
+
+    pOut[x] *= pLookup[line.y];
+
+    while (++x < n) {
+        pOut[x] *= pLookup[ma_libvorbis_floor_line_next(&line)];
+    }
+}
+
+#if defined(MA_LIBVORBIS_X86)
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_mdct_butterfly__sse2(float* pTrig, float* pX, int points, int trigStride)
+{
+    /*
+    Each pair is computed as d*A + swap(d)*B where d = x1 - x2, A = {T0, T0} and B = {T1, -T1}. The products and the
+    sum are the same as in the reference kernel, just with the operands of the addition swapped.
+    */
+    const __m128 signOdd = _mm_castsi128_ps(_mm_set_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+    int half = points >> 1;
+    int iBlock;
+
+    for (iBlock = half - 8; iBlock >= 0; iBlock -= 8) {
+        float* pX1 = pX + half + iBlock;
+        float* pX2 = pX + iBlock;
+        __m128 tHi = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(pTrig + trigStride*1)), (const __m64*)(pTrig + trigStride*0));
+        __m128 tLo = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(pTrig + trigStride*3)), (const __m64*)(pTrig + trigStride*2));
+        __m128 x1Hi = _mm_loadu_ps(pX1 + 4);
+        __m128 x2Hi = _mm_loadu_ps(pX2 + 4);
+        __m128 x1Lo = _mm_loadu_ps(pX1 + 0);
+        __m128 x2Lo = _mm_loadu_ps(pX2 + 0);
+        __m128 dHi  = _mm_sub_ps(x1Hi, x2Hi);
+        __m128 dLo  = _mm_sub_ps(x1Lo, x2Lo);
+
+        _mm_storeu_ps(pX1 + 4, _mm_add_ps(x1Hi, x2Hi));
+        _mm_storeu_ps(pX1 + 0, _mm_add_ps(x1Lo, x2Lo));
+
+        _mm_storeu_ps(pX2 + 4, _mm_add_ps(
+            _mm_mul_ps(_mm_shuffle_ps(dHi, dHi, _MM_SHUFFLE(2, 3, 0, 1)), _mm_xor_ps(_mm_shuffle_ps(tHi, tHi, _MM_SHUFFLE(3, 3, 1, 1)), signOdd)),
+            _mm_mul_ps(dHi, _mm_shuffle_ps(tHi, tHi, _MM_SHUFFLE(2, 2, 0, 0)))));
+        _mm_storeu_ps(pX2 + 0, _mm_add_ps(
+            _mm_mul_ps(_mm_shuffle_ps(dLo, dLo, _MM_SHUFFLE(2, 3, 0, 1)), _mm_xor_ps(_mm_shuffle_ps(tLo, tLo, _MM_SHUFFLE(3, 3, 1, 1)), signOdd)),
+            _mm_mul_ps(dLo, _mm_shuffle_ps(tLo, tLo, _MM_SHUFFLE(2, 2, 0, 0)))));
+
+        pTrig += trigStride*4;
+    }
+}
+
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_overlap_add__sse2(float* pPCM, const float* pIn, const float* pWindow, int count)
+{
+    int count4 = count & ~3;
+    int i;
+
+    for (i = 0; i < count4; i += 4) {
+        __m128 w  = _mm_loadu_ps(pWindow + i);
+        __m128 wr = _mm_loadu_ps(pWindow + count - i - 4);
+
+        wr = _mm_shuffle_ps(wr, wr, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm_storeu_ps(pPCM + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(pPCM + i), wr), _mm_mul_ps(_mm_loadu_ps(pIn + i), w)));
+    }
+
+    for (; i < count; i += 1) {
+        pPCM[i] = pPCM[i]*pWindow[count - i - 1] + pIn[i]*pWindow[i];
+    }
+}
+
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_inverse_coupling__sse2(float* pMag, float* pAng, int count)
+{
+    /*
+    The angle is added to the magnitude, negated when both or neither of them are positive, and the sum goes to
+    whichever of the two didn't keep the magnitude. x - y and x + (-y) are the same IEEE operation.
+    */
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    int count4 = count & ~3;
+    int i;
+
+    for (i = 0; i < count4; i += 4) {
+        __m128 mag  = _mm_loadu_ps(pMag + i);
+        __m128 ang  = _mm_loadu_ps(pAng + i);
+        __m128 mPos = _mm_cmpgt_ps(mag, zero);
+        __m128 aPos = _mm_cmpgt_ps(ang, zero);
+        __m128 sum  = _mm_add_ps(mag, _mm_xor_ps(ang, _mm_andnot_ps(_mm_xor_ps(mPos, aPos), sign)));
+
+        _mm_storeu_ps(pMag + i, _mm_or_ps(_mm_and_ps(aPos, mag), _mm_andnot_ps(aPos, sum)));
+        _mm_storeu_ps(pAng + i, _mm_or_ps(_mm_and_ps(aPos, sum), _mm_andnot_ps(aPos, mag)));
+    }
+
+    ma_libvorbis_inverse_coupling__tail(pMag, pAng, i, count);
+}
+
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_residue_add__sse2(float* pOut, long count, const float** ppEntries, int dim)
+{
+    long i = 0;
+
+    if ((dim & 3) == 0) {
+        long entryCount = count / dim;
+        long iEntry;
+
+        for (iEntry = 0; iEntry < entryCount; iEntry += 1) {
+            const float* pEntry = ppEntries[iEntry];
+            int j;
+
+            for (j = 0; j < dim; j += 4) {
+                _mm_storeu_ps(pOut + i + j, _mm_add_ps(_mm_loadu_ps(pOut + i + j), _mm_loadu_ps(pEntry + j)));
+            }
+
+            i += dim;
+        }
+    } else if (dim == 2) {
+        long count4 = count & ~3L;
+
+        for (; i < count4; i += 4) {
+            __m128 t = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)ppEntries[i/2 + 0]), (const __m64*)ppEntries[i/2 + 1]);
+            _mm_storeu_ps(pOut + i, _mm_add_ps(_mm_loadu_ps(pOut + i), t));
+        }
+    }
+
+    ma_libvorbis_residue_add__tail(pOut, i, count, ppEntries, dim);
+}
+
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_residue_add_stereo__sse2(float* pOutL, float* pOutR, long frameCount, const float** ppEntries, int dim)
+{
+    /* Four frames at a time. They come from part of an entry, one dim 4 entry pair or four dim 2 entries. */
+    long framesPerEntry = dim/2;
+    long iFrame = 0;
+
+    if ((dim & 7) == 0 || dim == 4 || dim == 2) {
+        long frameCount4 = (frameCount / framesPerEntry * framesPerEntry) & ~3L;
+
+        for (; iFrame < frameCount4; iFrame += 4) {
+            __m128 t0;
+            __m128 t1;
+
+            if (dim == 2) {
+                const float** ppEntry = ppEntries + iFrame;
+                t0 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)ppEntry[0]), (const __m64*)ppEntry[1]);
+                t1 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)ppEntry[2]), (const __m64*)ppEntry[3]);
+            } else if (dim == 4) {
+                t0 = _mm_loadu_ps(ppEntries[iFrame/2 + 0]);
+                t1 = _mm_loadu_ps(ppEntries[iFrame/2 + 1]);
+            } else {
+                const float* pEntry = ppEntries[iFrame/framesPerEntry] + (iFrame % framesPerEntry)*2;
+                t0 = _mm_loadu_ps(pEntry + 0);
+                t1 = _mm_loadu_ps(pEntry + 4);
+            }
+
+            _mm_storeu_ps(pOutL + iFrame, _mm_add_ps(_mm_loadu_ps(pOutL + iFrame), _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0))));
+            _mm_storeu_ps(pOutR + iFrame, _mm_add_ps(_mm_loadu_ps(pOutR + iFrame), _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1))));
+        }
+    }
+
+    ma_libvorbis_residue_add_stereo__tail(pOutL, pOutR, iFrame, frameCount, ppEntries, dim);
+}
+
+MA_LIBVORBIS_TARGET_SSE2
+static void ma_libvorbis_render_floor_line__sse2(int n, int x0, int x1, int y0, int y1, float* pOut, const float* pLookup)
+{
+    /* Same as the AVX2 kernel, with the index math done in float since SSE2 has no 32-bit integer multiply and no gather. */
+    ma_libvorbis_floor_line line;
+    int x;
+
+    n = ma_libvorbis_floor_line_init(&line, n, x0, x1, y0, y1);
+
+    x = x0;
+    if (x < n && (n - x0) <= (1 << 16)) {
+        __m128 step  = _mm_set1_ps((float)(line.sy - line.base));
+        __m128 base  = _mm_set1_ps((float)line.base);
+        __m128 ady   = _mm_set1_ps((float)line.ady);
+        __m128 adx   = _mm_set1_ps((float)line.adx);
+        __m128 y0v   = _mm_set1_ps((float)y0);
+        __m128 k     = _mm_set_ps(3, 2, 1, 0);
+        __m128 kStep = _mm_set1_ps(4);
+
+        for (; x + 4 <= n; x += 4) {
+            __m128 wraps = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(k, ady), adx)));
+            __m128i y    = _mm_cvttps_epi32(_mm_add_ps(_mm_add_ps(y0v, _mm_mul_ps(k, base)), _mm_mul_ps(wraps, step)));
+            ma_int32 yi[4];
+
+            _mm_storeu_si128((__m128i*)yi, y);
+            _mm_storeu_ps(pOut + x, _mm_mul_ps(_mm_loadu_ps(pOut + x), _mm_setr_ps(pLookup[yi[0]], pLookup[yi[1]], pLookup[yi[2]], pLookup[yi[3]])));
+            k = _mm_add_ps(k, kStep);
+        }
+
+        if (x > x0) {
+            int kLast = x - 1 - x0;
+            int wraps = (int)(((ma_int64)kLast * line.ady) / line.adx);
+            line.err  = (int)(((ma_int64)kLast * line.ady) % line.adx);
+            line.y    = y0 + kLast*line.base + wraps*(line.sy - line.base);
+        }
+    }
+
+    if (x == x0 && x < n) {
+        pOut[x] *= pLookup[line.y];
+        x += 1;
+    }
+
+    for (; x < n; x += 1) {
+        pOut[x] *= pLookup[ma_libvorbis_floor_line_next(&line)];
+    }
+}
+
+MA_LIBVORBIS_TARGET_AVX2
+static void ma_libvorbis_mdct_butterfly__avx2(float* pTrig, float* pX, int points, int trigStride)
+{
+    /* Same as the SSE2 kernel with the whole block of 8 in one register. */
+    const __m256 signOdd = _mm256_castsi256_ps(_mm256_set_epi32((int)0x80000000, 0, (int)0x80000000, 0, (int)0x80000000, 0, (int)0x80000000, 0));
+    int half = points >> 1;
+    int iBlock;
+
+    for (iBlock = half - 8; iBlock >= 0; iBlock -= 8) {
+        float* pX1 = pX + half + iBlock;
+        float* pX2 = pX + iBlock;
+        __m128 tHi = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(pTrig + trigStride*1)), (const __m64*)(pTrig + trigStride*0));
+        __m128 tLo = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(pTrig + trigStride*3)), (const __m64*)(pTrig + trigStride*2));
+        __m256 t   = _mm256_insertf128_ps(_mm256_castps128_ps256(tLo), tHi, 1);
+        __m256 x1  = _mm256_loadu_ps(pX1);
+        __m256 x2  = _mm256_loadu_ps(pX2);
+        __m256 d   = _mm256_sub_ps(x1, x2);
+
+        _mm256_storeu_ps(pX1, _mm256_add_ps(x1, x2));
+        _mm256_storeu_ps(pX2, _mm256_add_ps(
+            _mm256_mul_ps(_mm256_permute_ps(d, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_xor_ps(_mm256_permute_ps(t, _MM_SHUFFLE(3, 3, 1, 1)), signOdd)),
+            _mm256_mul_ps(d, _mm256_permute_ps(t, _MM_SHUFFLE(2, 2, 0, 0)))));
+
+        pTrig += trigStride*4;
+    }
+}
+
+MA_LIBVORBIS_TARGET_AVX2
+static void ma_libvorbis_overlap_add__avx2(float* pPCM, const float* pIn, const float* pWindow, int count)
+{
+    const __m256i reverse = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    int count8 = count & ~7;
+    int i;
+
+    for (i = 0; i < count8; i += 8) {
+        __m256 w  = _mm256_loadu_ps(pWindow + i);
+        __m256 wr = _mm256_permutevar8x32_ps(_mm256_loadu_ps(pWindow + count - i - 8), reverse);
+
+        _mm256_storeu_ps(pPCM + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(pPCM + i), wr), _mm256_mul_ps(_mm256_loadu_ps(pIn + i), w)));
+    }
+
+    for (; i < count; i += 1) {
+        pPCM[i] = pPCM[i]*pWindow[count - i - 1] + pIn[i]*pWindow[i];
+    }
+}
+
+MA_LIBVORBIS_TARGET_AVX2
+static void ma_libvorbis_inverse_coupling__avx2(float* pMag, float* pAng, int count)
+{
+    /* Same as the SSE2 kernel. */
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    int count8 = count & ~7;
+    int i;
+
+    for (i = 0; i < count8; i += 8) {
+        __m256 mag  = _mm256_loadu_ps(pMag + i);
+        __m256 ang  = _mm256_loadu_ps(pAng + i);
+        __m256 mPos = _mm256_cmp_ps(mag, zero, _CMP_GT_OQ);
+        __m256 aPos = _mm256_cmp_ps(ang, zero, _CMP_GT_OQ);
+        __m256 sum  = _mm256_add_ps(mag, _mm256_xor_ps(ang, _mm256_andnot_ps(_mm256_xor_ps(mPos, aPos), sign)));
+
+        _mm256_storeu_ps(pMag + i, _mm256_blendv_ps(sum, mag, aPos));
+        _mm256_storeu_ps(pAng + i, _mm256_blendv_ps(mag, sum, aPos));
+    }
+
+    ma_libvorbis_inverse_coupling__tail(pMag, pAng, i, count);
+}
+
+MA_LIBVORBIS_TARGET_AVX2
+static void ma_libvorbis_render_floor_line__avx2(int n, int x0, int x1, int y0, int y1, float* pOut, const float* pLookup)
+{
+    /*
+    The Bresenham walk is serial, but its position k steps in has a closed form. The error term has wrapped
+    floor(k*ady / adx) times by then, each of which stepped by sy instead of base, and sy - base is always +-1. The
+    operands are exact in single precision (k*ady is below 2^24) and the quotient can't round up to the next integer, so
+    the float division gives the same result as the integer one.
+    */
+    ma_libvorbis_floor_line line;
+    int x;
+
+    n = ma_libvorbis_floor_line_init(&line, n, x0, x1, y0, y1);
+
+    x = x0;
+    if (x < n && (n - x0) <= (1 << 16)) {
+        __m256i step   = _mm256_set1_epi32(line.sy - line.base);
+        __m256i base   = _mm256_set1_epi32(line.base);
+        __m256i ady    = _mm256_set1_epi32(line.ady);
+        __m256  adx    = _mm256_set1_ps((float)line.adx);
+        __m256i y0v    = _mm256_set1_epi32(y0);
+        __m256i k      = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        __m256i kStep  = _mm256_set1_epi32(8);
+
+        for (; x + 8 <= n; x += 8) {
+            __m256i wraps = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_mullo_epi32(k, ady)), adx));
+            __m256i y     = _mm256_add_epi32(_mm256_add_epi32(y0v, _mm256_mullo_epi32(k, base)), _mm256_mullo_epi32(wraps, step));
+
+            _mm256_storeu_ps(pOut + x, _mm256_mul_ps(_mm256_loadu_ps(pOut + x), _mm256_i32gather_ps(pLookup, y, 4)));
+            k = _mm256_add_epi32(k, kStep);
+        }
+
+        /* Bring the scalar state up to x - 1 for the tail. */
+        if (x > x0) {
+            int kLast = x - 1 - x0;
+            int wraps = (int)(((ma_int64)kLast * line.ady) / line.adx);
+            line.err  = (int)(((ma_int64)kLast * line.ady) % line.adx);
+            line.y    = y0 + kLast*line.base + wraps*(line.sy - line.base);
+        }
+    }
+
+    if (x == x0 && x < n) {
+        pOut[x] *= pLookup[line.y];
+        x += 1;
+    }
+
+    for (; x < n; x += 1) {
+        pOut[x] *= pLookup[ma_libvorbis_floor_line_next(&line)];
+    }
+}
+
+#endif  /* MA_LIBVORBIS_X86 */
+
+#if defined(MA_LIBVORBIS_NEON)
+static void ma_libvorbis_mdct_butterfly__neon(float* pTrig, float* pX, int points, int trigStride)
+{
+    /* Same as the SSE2 kernel. vtrnq() with both operands the same splats the even and odd trig values. */
+    static const float signOdd[4] = { 1, -1, 1, -1 };
+    const float32x4_t sign = vld1q_f32(signOdd);
+    int half = points >> 1;
+    int iBlock;
+
+    for (iBlock = half - 8; iBlock >= 0; iBlock -= 8) {
+        float* pX1 = pX + half + iBlock;
+        float* pX2 = pX + iBlock;
+        float32x4_t tHi = vcombine_f32(vld1_f32(pTrig + trigStride*1), vld1_f32(pTrig + trigStride*0));
+        float32x4_t tLo = vcombine_f32(vld1_f32(pTrig + trigStride*3), vld1_f32(pTrig + trigStride*2));
+        float32x4x2_t splatHi = vtrnq_f32(tHi, tHi);
+        float32x4x2_t splatLo = vtrnq_f32(tLo, tLo);
+        float32x4_t x1Hi = vld1q_f32(pX1 + 4);
+        float32x4_t x2Hi = vld1q_f32(pX2 + 4);
+        float32x4_t x1Lo = vld1q_f32(pX1 + 0);
+        float32x4_t x2Lo = vld1q_f32(pX2 + 0);
+        float32x4_t dHi  = vsubq_f32(x1Hi, x2Hi);
+        float32x4_t dLo  = vsubq_f32(x1Lo, x2Lo);
+
+        vst1q_f32(pX1 + 4, vaddq_f32(x1Hi, x2Hi));
+        vst1q_f32(pX1 + 0, vaddq_f32(x1Lo, x2Lo));
+        vst1q_f32(pX2 + 4, vaddq_f32(vmulq_f32(vrev64q_f32(dHi), vmulq_f32(splatHi.val[1], sign)), vmulq_f32(dHi, splatHi.val[0])));
+        vst1q_f32(pX2 + 0, vaddq_f32(vmulq_f32(vrev64q_f32(dLo), vmulq_f32(splatLo.val[1], sign)), vmulq_f32(dLo, splatLo.val[0])));
+
+        pTrig += trigStride*4;
+    }
+}
+
+static void ma_libvorbis_overlap_add__neon(float* pPCM, const float* pIn, const float* pWindow, int count)
+{
+    int count4 = count & ~3;
+    int i;
+
+    for (i = 0; i < count4; i += 4) {
+        float32x4_t w  = vld1q_f32(pWindow + i);
+        float32x4_t wr = vrev64q_f32(vld1q_f32(pWindow + count - i - 4));
+
+        wr = vcombine_f32(vget_high_f32(wr), vget_low_f32(wr));
+        vst1q_f32(pPCM + i, vaddq_f32(vmulq_f32(vld1q_f32(pPCM + i), wr), vmulq_f32(vld1q_f32(pIn + i), w)));
+    }
+
+    for (; i < count; i += 1) {
+        pPCM[i] = pPCM[i]*pWindow[count - i - 1] + pIn[i]*pWindow[i];
+    }
+}
+
+static void ma_libvorbis_inverse_coupling__neon(float* pMag, float* pAng, int count)
+{
+    /* Same as the SSE2 kernel. */
+    const float32x4_t zero = vdupq_n_f32(0);
+    const uint32x4_t sign = vdupq_n_u32(0x80000000);
+    int count4 = count & ~3;
+    int i;
+
+    for (i = 0; i < count4; i += 4) {
+        float32x4_t mag  = vld1q_f32(pMag + i);
+        float32x4_t ang  = vld1q_f32(pAng + i);
+        uint32x4_t  mPos = vcgtq_f32(mag, zero);
+        uint32x4_t  aPos = vcgtq_f32(ang, zero);
+        float32x4_t sum  = vaddq_f32(mag, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(ang), vbicq_u32(sign, veorq_u32(mPos, aPos)))));
+
+        vst1q_f32(pMag + i, vbslq_f32(aPos, mag, sum));
+        vst1q_f32(pAng + i, vbslq_f32(aPos, sum, mag));
+    }
+
+    ma_libvorbis_inverse_coupling__tail(pMag, pAng, i, count);
+}
+
+static void ma_libvorbis_residue_add__neon(float* pOut, long count, const float** ppEntries, int dim)
+{
+    long i = 0;
+
+    if ((dim & 3) == 0) {
+        long entryCount = count / dim;
+        long iEntry;
+
+        for (iEntry = 0; iEntry < entryCount; iEntry += 1) {
+            const float* pEntry = ppEntries[iEntry];
+            int j;
+
+            for (j = 0; j < dim; j += 4) {
+                vst1q_f32(pOut + i + j, vaddq_f32(vld1q_f32(pOut + i + j), vld1q_f32(pEntry + j)));
+            }
+
+            i += dim;
+        }
+    } else if (dim == 2) {
+        long count4 = count & ~3L;
+
+        for (; i < count4; i += 4) {
+            float32x4_t t = vcombine_f32(vld1_f32(ppEntries[i/2 + 0]), vld1_f32(ppEntries[i/2 + 1]));
+            vst1q_f32(pOut + i, vaddq_f32(vld1q_f32(pOut + i), t));
+        }
+    }
+
+    ma_libvorbis_residue_add__tail(pOut, i, count, ppEntries, dim);
+}
+
+static void ma_libvorbis_residue_add_stereo__neon(float* pOutL, float* pOutR, long frameCount, const float** ppEntries, int dim)
+{
+    /* Same grouping as the SSE2 kernel, with vuzpq() doing the deinterleave. */
+    long framesPerEntry = dim/2;
+    long iFrame = 0;
+
+    if ((dim & 7) == 0 || dim == 4 || dim == 2) {
+        long frameCount4 = (frameCount / framesPerEntry * framesPerEntry) & ~3L;
+
+        for (; iFrame < frameCount4; iFrame += 4) {
+            float32x4_t t0;
+            float32x4_t t1;
+            float32x4x2_t lr;
+
+            if (dim == 2) {
+                const float** ppEntry = ppEntries + iFrame;
+                t0 = vcombine_f32(vld1_f32(ppEntry[0]), vld1_f32(ppEntry[1]));
+                t1 = vcombine_f32(vld1_f32(ppEntry[2]), vld1_f32(ppEntry[3]));
+            } else if (dim == 4) {
+                t0 = vld1q_f32(ppEntries[iFrame/2 + 0]);
+                t1 = vld1q_f32(ppEntries[iFrame/2 + 1]);
+            } else {
+                const float* pEntry = ppEntries[iFrame/framesPerEntry] + (iFrame % framesPerEntry)*2;
+                t0 = vld1q_f32(pEntry + 0);
+                t1 = vld1q_f32(pEntry + 4);
+            }
+
+            lr = vuzpq_f32(t0, t1);
+            vst1q_f32(pOutL + iFrame, vaddq_f32(vld1q_f32(pOutL + iFrame), lr.val[0]));
+            vst1q_f32(pOutR + iFrame, vaddq_f32(vld1q_f32(pOutR + iFrame), lr.val[1]));
+        }
+    }
+
+    ma_libvorbis_residue_add_stereo__tail(pOutL, pOutR, iFrame, frameCount, ppEntries, dim);
+}
+#endif  /* MA_LIBVORBIS_NEON */
+
+static ma_libvorbis_mdct_butterfly_proc       g_ma_libvorbis_mdct_butterfly       = ma_libvorbis_mdct_butterfly__reference;
+static ma_libvorbis_overlap_add_proc          g_ma_libvorbis_overlap_add          = ma_libvorbis_overlap_add__reference;
+static ma_libvorbis_inverse_coupling_proc     g_ma_libvorbis_inverse_coupling     = ma_libvorbis_inverse_coupling__reference;
+static ma_libvorbis_residue_add_proc          g_ma_libvorbis_residue_add          = ma_libvorbis_residue_add__reference;
+static ma_libvorbis_residue_add_stereo_proc   g_ma_libvorbis_residue_add_stereo   = ma_libvorbis_residue_add_stereo__reference;
+static ma_libvorbis_render_floor_line_proc    g_ma_libvorbis_render_floor_line    = ma_libvorbis_render_floor_line__reference;
+
+static void ma_libvorbis_mdct_butterfly(float* pTrig, float* pX, int points, int trigStride)
+{
+    g_ma_libvorbis_mdct_butterfly(pTrig, pX, points, trigStride);
+}
+
+static void ma_libvorbis_overlap_add(float* pPCM, const float* pIn, const float* pWindow, int count)
+{
+    g_ma_libvorbis_overlap_add(pPCM, pIn, pWindow, count);
+}
+
+static void ma_libvorbis_inverse_coupling(float* pMag, float* pAng, int count)
+{
+    g_ma_libvorbis_inverse_coupling(pMag, pAng, count);
+}
+
+static void ma_libvorbis_residue_add(float* pOut, long count, const float** ppEntries, int dim)
+{
+    g_ma_libvorbis_residue_add(pOut, count, ppEntries, dim);
+}
+
+static void ma_libvorbis_residue_add_stereo(float* pOutL, float* pOutR, long frameCount, const float** ppEntries, int dim)
+{
+    g_ma_libvorbis_residue_add_stereo(pOutL, pOutR, frameCount, ppEntries, dim);
+}
+
+static void ma_libvorbis_render_floor_line(int n, int x0, int x1, int y0, int y1, float* pOut, const float* pLookup)
+{
+    g_ma_libvorbis_render_floor_line(n, x0, x1, y0, y1, pOut, pLookup);
+}
+#endif  /* MA_NO_LIBVORBIS */
+
+static ma_libvorbis_interleave_f32_proc g_ma_libvorbis_interleave_f32_2 = ma_libvorbis_interleave_f32_2__reference;
+static ma_libvorbis_interleave_f32_proc g_ma_libvorbis_interleave_f32_6 = ma_libvorbis_interleave_f32_6__reference;
+
+static ma_spinlock g_ma_libvorbis_simd_lock = 0;
+static ma_bool32 g_ma_libvorbis_is_simd_initialized = MA_FALSE;
+
+static void ma_libvorbis_init_simd(void)
+{
+    /* Decoders are opened concurrently by ma_libvorbis_decode_memory() so this needs to be done under a lock. */
+    ma_spinlock_lock(&g_ma_libvorbis_simd_lock);
+    {
+        if (!g_ma_libvorbis_is_simd_initialized) {
+            #if defined(MA_LIBVORBIS_X86)
+            {
+                if (ma_libvorbis_has_avx2()) {
+                    g_ma_libvorbis_interleave_f32_2 = ma_libvorbis_interleave_f32_2__avx2;
+                    g_ma_libvorbis_interleave_f32_6 = ma_libvorbis_interleave_f32_6__avx2;
+                } else if (ma_libvorbis_has_sse2()) {
+                    g_ma_libvorbis_interleave_f32_2 = ma_libvorbis_interleave_f32_2__sse2;
+                    g_ma_libvorbis_interleave_f32_6 = ma_libvorbis_interleave_f32_6__sse2;
+                }
+
+                #if !defined(MA_NO_LIBVORBIS)
+                {
+                    /*
+                    The residue kernels stay on SSE2 with AVX2 since an entry is rarely wider than 4 floats and the
+                    Huffman decode dominates anyway. The SSE2 floor kernel has no gather so it's only a small win.
+                    */
+                    if (ma_libvorbis_has_avx2()) {
+                        g_ma_libvorbis_mdct_butterfly     = ma_libvorbis_mdct_butterfly__avx2;
+                        g_ma_libvorbis_overlap_add        = ma_libvorbis_overlap_add__avx2;
+                        g_ma_libvorbis_inverse_coupling   = ma_libvorbis_inverse_coupling__avx2;
+                        g_ma_libvorbis_residue_add        = ma_libvorbis_residue_add__sse2;
+                        g_ma_libvorbis_residue_add_stereo = ma_libvorbis_residue_add_stereo__sse2;
+                        g_ma_libvorbis_render_floor_line  = ma_libvorbis_render_floor_line__avx2;
+                    } else if (ma_libvorbis_has_sse2()) {
+                        g_ma_libvorbis_mdct_butterfly     = ma_libvorbis_mdct_butterfly__sse2;
+                        g_ma_libvorbis_overlap_add        = ma_libvorbis_overlap_add__sse2;
+                        g_ma_libvorbis_inverse_coupling   = ma_libvorbis_inverse_coupling__sse2;
+                        g_ma_libvorbis_residue_add        = ma_libvorbis_residue_add__sse2;
+                        g_ma_libvorbis_residue_add_stereo = ma_libvorbis_residue_add_stereo__sse2;
+                        g_ma_libvorbis_render_floor_line  = ma_libvorbis_render_floor_line__sse2;
+                    }
+                }
+                #endif
+            }
+            #elif defined(MA_LIBVORBIS_NEON)
+            {
+                g_ma_libvorbis_interleave_f32_2 = ma_libvorbis_interleave_f32_2__neon;
+                g_ma_libvorbis_interleave_f32_6 = ma_libvorbis_interleave_f32_6__neon;
+
+                #if !defined(MA_NO_LIBVORBIS)
+                {
+                    g_ma_libvorbis_mdct_butterfly     = ma_libvorbis_mdct_butterfly__neon;
+                    g_ma_libvorbis_overlap_add        = ma_libvorbis_overlap_add__neon;
+                    g_ma_libvorbis_inverse_coupling   = ma_libvorbis_inverse_coupling__neon;
+                    g_ma_libvorbis_residue_add        = ma_libvorbis_residue_add__neon;
+                    g_ma_libvorbis_residue_add_stereo = ma_libvorbis_residue_add_stereo__neon;
+                }
+                #endif
+            }
+            #endif
+
+            g_ma_libvorbis_is_simd_initialized = MA_TRUE;
+        }
+    }
+    ma_spinlock_unlock(&g_ma_libvorbis_simd_lock);
+}
+
+static void ma_libvorbis_interleave_f32(float* pFramesOut, const float* const* ppFramesIn, ma_uint32 channels, ma_uint64 frameCount)
+{
+    switch (channels)
+    {
+        case 1: memcpy(pFramesOut, ppFramesIn[0], (size_t)frameCount * sizeof(float)); break;
+        case 2: g_ma_libvorbis_interleave_f32_2(pFramesOut, ppFramesIn, frameCount); break;
+        case 6: g_ma_libvorbis_interleave_f32_6(pFramesOut, ppFramesIn, frameCount); break;
+        default: ma_interleave_pcm_frames(ma_format_f32, channels, frameCount, (const void**)ppFramesIn, pFramesOut); break;
+    }
+}
+
+static const ma_allocation_callbacks* ma_libvorbis_get_allocation_callbacks(const ma_libvorbis* pVorbis)
+{
+    /* A zeroed copy means the default allocator was used at init time. */
+    if (pVorbis->allocationCallbacks.onMalloc == NULL && pVorbis->allocationCallbacks.onRealloc == NULL && pVorbis->allocationCallbacks.onFree == NULL) {
+        return NULL;
+    }
+
+    return &pVorbis->allocationCallbacks;
+}
+
+static void ma_libvorbis_free_vf(ma_libvorbis* pVorbis, const ma_allocation_callbacks* pAllocationCallbacks)
+{
+    /* Must only be called once libvorbisfile is done with everything it allocated. */
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        if (pVorbis->pAllocator != NULL) {
+            ma_libvorbis_allocator_uninit((ma_libvorbis_allocator*)pVorbis->pAllocator);
+        }
+    }
+    #endif
+
+    pVorbis->pAllocator = NULL;
+
+    ma_free(pVorbis->vf, pAllocationCallbacks);
+    pVorbis->vf = NULL;
+}
+
+static ma_result ma_libvorbis_init_internal(const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    if (pVorbis == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    memset(pVorbis, 0, sizeof(*pVorbis));
+    pVorbis->format = ma_format_f32;    /* f32 by default. */
+
+    if (pAllocationCallbacks != NULL) {
+        pVorbis->allocationCallbacks = *pAllocationCallbacks;
+    }
+
+    if (pConfig != NULL) {
+        pVorbis->seekPointCountRequested = pConfig->seekPointCount;
+    }
+
+    ma_libvorbis_init_simd();
+
+    if (pConfig != NULL && (pConfig->preferredFormat == ma_format_f32 || pConfig->preferredFormat == ma_format_s16)) {
+        pVorbis->format = pConfig->preferredFormat;
+    } else {
+        /* Getting here means something other than f32 and s16 was specified. Just leave this unset to use the default format. */
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        ma_result result;
+        ma_data_source_config dataSourceConfig;
+
+        dataSourceConfig = ma_data_source_config_init();
+        dataSourceConfig.vtable = &g_ma_libvorbis_ds_vtable;
+
+        result = ma_data_source_init(&dataSourceConfig, &pVorbis->ds);
+        if (result != MA_SUCCESS) {
+            return result;  /* Failed to initialize the base data source. */
+        }
+
+        /* The allocator lives in the same block as the OggVorbis_File so it costs nothing extra. */
+        pVorbis->vf = (OggVorbis_File*)ma_malloc(sizeof(ma_libvorbis_vf_block), pAllocationCallbacks);
+        if (pVorbis->vf == NULL) {
+            ma_data_source_uninit(&pVorbis->ds);
+            return MA_OUT_OF_MEMORY;
+        }
+
+        pVorbis->pAllocator = &((ma_libvorbis_vf_block*)pVorbis->vf)->allocator;
+        ma_libvorbis_allocator_init((ma_libvorbis_allocator*)pVorbis->pAllocator, pAllocationCallbacks);
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. */
+        (void)pAllocationCallbacks;
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+#if !defined(MA_NO_LIBVORBIS)
+/*
+Lazy open
+
+ov_open_callbacks() on a seekable stream scans to the end of the file to find the links and compute the totals before
+a single frame has been decoded. When opening lazily we only parse the headers with ov_test_callbacks() and then
+finish the open as if the stream was unseekable, which lets decoding start straight away. The end of file scan is
+done by ma_libvorbis_complete_deferred_open() the first time something actually needs it, which is a length query, a
+seek or building the seek table.
+*/
+static int ma_libvorbis_open_vf(ma_libvorbis* pVorbis, void* pDataSource, ov_callbacks libvorbisCallbacks, ma_bool32 deferOpen)
+{
+    OggVorbis_File* vf = (OggVorbis_File*)pVorbis->vf;
+    ma_libvorbis_allocator* pAllocator = (ma_libvorbis_allocator*)pVorbis->pAllocator;
+    ma_libvorbis_allocator* pPrevAllocator;
+    int libvorbisResult;
+
+    pPrevAllocator = ma_libvorbis_push_allocator(pAllocator);
+    pAllocator->isArenaActive = (pAllocator->arenaChunkSize > 0);
+
+    libvorbisResult = ov_test_callbacks(pDataSource, vf, NULL, 0, libvorbisCallbacks);
+    if (libvorbisResult == 0) {
+        if (deferOpen && vf->seekable) {
+            vf->seekable = 0;   /* Makes ov_test_open() skip the end of file scan. Restored in ma_libvorbis_complete_deferred_open(). */
+            pVorbis->isOpenDeferred = MA_TRUE;
+        }
+
+        libvorbisResult = ov_test_open(vf);
+    }
+
+    pAllocator->isArenaActive = MA_FALSE;
+    ma_libvorbis_pop_allocator(pPrevAllocator);
+
+    if (libvorbisResult == 0) {
+        vorbis_info* pInfo = ov_info(vf, 0);
+        pVorbis->channels   = (ma_uint32)pInfo->channels;
+        pVorbis->sampleRate = (ma_uint32)pInfo->rate;
+    }
+
+    return libvorbisResult;
+}
+
+static ma_result ma_libvorbis_complete_deferred_open__internal(ma_libvorbis* pVorbis, ma_bool32 restoreCursor)
+{
+    OggVorbis_File* vf = (OggVorbis_File*)pVorbis->vf;
+    void* pDataSource = vf->datasource;
+    ov_callbacks libvorbisCallbacks = vf->callbacks;
+    ogg_int64_t cursor;
+    int libvorbisResult;
+
+    pVorbis->isOpenDeferred = MA_FALSE;
+
+    cursor = ov_pcm_tell(vf);
+
+    if (vf->current_link == 0) {
+        /*
+        Still in the first link so the headers we have are the right ones. Rewind to the first audio page and run the
+        second half of a normal seekable open from there. This is the same state _ov_open2() starts from.
+        */
+        if (vf->ready_state == INITSET) {
+            _decode_clear(vf);
+        }
+
+        vf->ready_state = OPENED;
+        vf->seekable = 1;
+        ogg_stream_reset_serialno(&vf->os, (int)vf->serialnos[0]);
+
+        libvorbisResult = _seek_helper(vf, vf->dataoffsets[0]);
+        if (libvorbisResult == 0) {
+            libvorbisResult = _open_seekable2(vf);
+        }
+    } else {
+        /*
+        Streaming decode has already crossed into a later link of a chained stream and replaced the first link's
+        headers. Simplest is to do a full open from the start of the stream.
+        */
+        vf->datasource = NULL;  /* Stop ov_clear() from closing it. */
+        ov_clear(vf);
+
+        libvorbisResult = libvorbisCallbacks.seek_func(pDataSource, 0, SEEK_SET);
+        if (libvorbisResult == 0) {
+            libvorbisResult = ov_open_callbacks(pDataSource, vf, NULL, 0, libvorbisCallbacks);
+        }
+    }
+
+    if (libvorbisResult != 0) {
+        /*
+        The decoder is unusable at this point. Depending on where it failed libvorbisfile may have already cleared
+        the struct without closing the file so do both here. ov_clear() is safe to call on a cleared struct.
+        */
+        vf->datasource = NULL;
+        ov_clear(vf);
+
+        if (libvorbisCallbacks.close_func != NULL) {
+            libvorbisCallbacks.close_func(pDataSource);
+        }
+
+        return MA_ERROR;
+    }
+
+    if (restoreCursor && cursor > 0) {
+        if (ov_pcm_seek(vf, cursor) != 0) {
+            return MA_ERROR;
+        }
+    }
+
+    return MA_SUCCESS;
+}
+
+static ma_result ma_libvorbis_complete_deferred_open(ma_libvorbis* pVorbis, ma_bool32 restoreCursor)
+{
+    ma_libvorbis_allocator* pPrevAllocator;
+    ma_result result;
+
+    if (!pVorbis->isOpenDeferred) {
+        return MA_SUCCESS;
+    }
+
+    pPrevAllocator = ma_libvorbis_push_allocator((ma_libvorbis_allocator*)pVorbis->pAllocator);
+    result = ma_libvorbis_complete_deferred_open__internal(pVorbis, restoreCursor);
+    ma_libvorbis_pop_allocator(pPrevAllocator);
+
+    return result;
+}
+#endif
+
+static ma_result ma_libvorbis_init_ex(ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, ma_bool32 deferOpen, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    ma_result result;
+
+    if (onRead == NULL || onSeek == NULL) {
+        return MA_INVALID_ARGS; /* onRead and onSeek are mandatory. */
+    }
+    
+    result = ma_libvorbis_init_internal(pConfig, pAllocationCallbacks, pVorbis);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    pVorbis->onRead = onRead;
+    pVorbis->onSeek = onSeek;
+    pVorbis->onTell = onTell;
+    pVorbis->pReadSeekTellUserData = pReadSeekTellUserData;
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        int libvorbisResult;
+        ov_callbacks libvorbisCallbacks;
+
+        /* We can now initialize the vorbis decoder. This must be done after we've set up the callbacks. */
+        libvorbisCallbacks.read_func  = ma_libvorbis_vf_callback__read;
+        libvorbisCallbacks.seek_func  = ma_libvorbis_vf_callback__seek;
+        libvorbisCallbacks.close_func = NULL;
+        libvorbisCallbacks.tell_func  = ma_libvorbis_vf_callback__tell;
+
+        libvorbisResult = ma_libvorbis_open_vf(pVorbis, pVorbis, libvorbisCallbacks, deferOpen);
+        if (libvorbisResult < 0) {
+            ma_data_source_uninit(&pVorbis->ds);
+            ma_libvorbis_free_vf(pVorbis, pAllocationCallbacks);
+            return MA_INVALID_FILE;
+        }
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. */
+        (void)deferOpen;
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+static ma_result ma_libvorbis_init_file_ex(const char* pFilePath, const ma_decoding_backend_config* pConfig, ma_bool32 deferOpen, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    ma_result result;
+
+    result = ma_libvorbis_init_internal(pConfig, pAllocationCallbacks, pVorbis);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        int libvorbisResult;
+        FILE* pFile;
+        ov_callbacks libvorbisCallbacks;
+
+        /* Same as ov_fopen(), but going through ma_libvorbis_open_vf() so the open can be deferred. */
+        pFile = fopen(pFilePath, "rb");
+        if (pFile == NULL) {
+            ma_data_source_uninit(&pVorbis->ds);
+            ma_libvorbis_free_vf(pVorbis, pAllocationCallbacks);
+            return MA_INVALID_FILE;
+        }
+
+        libvorbisCallbacks.read_func  = (size_t (*)(void*, size_t, size_t, void*))fread;
+        libvorbisCallbacks.seek_func  = (int (*)(void*, ogg_int64_t, int))_fseek64_wrap;
+        libvorbisCallbacks.close_func = (int (*)(void*))fclose;
+        libvorbisCallbacks.tell_func  = (ogg_int64_t (*)(void*))_ftell64_wrap;
+
+        libvorbisResult = ma_libvorbis_open_vf(pVorbis, pFile, libvorbisCallbacks, deferOpen);
+        if (libvorbisResult < 0) {
+            fclose(pFile);  /* libvorbisfile doesn't take ownership of the file when opening fails. */
+            ma_data_source_uninit(&pVorbis->ds);
+            ma_libvorbis_free_vf(pVorbis, pAllocationCallbacks);
+            return MA_INVALID_FILE;
+        }
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. */
+        (void)pFilePath;
+        (void)deferOpen;
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+static ma_result ma_libvorbis_init_memory_ex(const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, ma_bool32 deferOpen, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    ma_result result;
+
+    if (pData == NULL || dataSize == 0) {
+        return MA_INVALID_ARGS;
+    }
+
+    result = ma_libvorbis_init_internal(pConfig, pAllocationCallbacks, pVorbis);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    pVorbis->memory.pData          = (const ma_uint8*)pData;
+    pVorbis->memory.dataSize       = dataSize;
+    pVorbis->memory.currentReadPos = 0;
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        int libvorbisResult;
+        ov_callbacks libvorbisCallbacks;
+
+        /* No need to go through onRead/onSeek/onTell. libvorbis reads directly from the buffer. */
+        libvorbisCallbacks.read_func  = ma_libvorbis_vf_callback__read_memory;
+        libvorbisCallbacks.seek_func  = ma_libvorbis_vf_callback__seek_memory;
+        libvorbisCallbacks.close_func = NULL;
+        libvorbisCallbacks.tell_func  = ma_libvorbis_vf_callback__tell_memory;
+
+        libvorbisResult = ma_libvorbis_open_vf(pVorbis, pVorbis, libvorbisCallbacks, deferOpen);
+        if (libvorbisResult < 0) {
+            ma_data_source_uninit(&pVorbis->ds);
+            ma_libvorbis_free_vf(pVorbis, pAllocationCallbacks);
+            return MA_INVALID_FILE;
+        }
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. */
+        (void)deferOpen;
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_init(ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    return ma_libvorbis_init_ex(onRead, onSeek, onTell, pReadSeekTellUserData, pConfig, MA_FALSE, pAllocationCallbacks, pVorbis);
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_init_file(const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    return ma_libvorbis_init_file_ex(pFilePath, pConfig, MA_FALSE, pAllocationCallbacks, pVorbis);
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_init_memory(const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    return ma_libvorbis_init_memory_ex(pData, dataSize, pConfig, MA_FALSE, pAllocationCallbacks, pVorbis);
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_init_lazy(ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    return ma_libvorbis_init_ex(onRead, onSeek, onTell, pReadSeekTellUserData, pConfig, MA_TRUE, pAllocationCallbacks, pVorbis);
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_init_file_lazy(const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    return ma_libvorbis_init_file_ex(pFilePath, pConfig, MA_TRUE, pAllocationCallbacks, pVorbis);
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_init_memory_lazy(const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+{
+    return ma_libvorbis_init_memory_ex(pData, dataSize, pConfig, MA_TRUE, pAllocationCallbacks, pVorbis);
+}
+
+MA_VORBIS_API void ma_libvorbis_uninit(ma_libvorbis* pVorbis, const ma_allocation_callbacks* pAllocationCallbacks)
+{
+    if (pVorbis == NULL) {
+        return;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        ov_clear((OggVorbis_File*)pVorbis->vf);    /* Frees go back to the allocator they came from so no need to make it current. */
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+    }
+    #endif
+
+    ma_data_source_uninit(&pVorbis->ds);
+    ma_free(pVorbis->pSeekPoints, ma_libvorbis_get_allocation_callbacks(pVorbis));
+    ma_libvorbis_free_vf(pVorbis, pAllocationCallbacks);
+}
+
+#if !defined(MA_NO_LIBVORBIS)
+/*
+Batched decoding
+
+ov_read_float() hands back at most one packet per call, so reading a large buffer through it costs one call per packet,
+each of which checks the open state again. The f32 paths instead drain the synthesis buffer directly and pull in packets with
+_fetch_and_process_packet() until the output is full. This is the body of ov_read_float() without the return after each
+packet. Output goes to pFramesOut interleaved or to ppFramesOut planar. Passing neither skips the frames.
+
+The channel count comes from the format cached at open time. The decoder state is checked against it because a chained
+stream can change its channel count in a later link, and writing that link's frames would overrun the output.
+*/
+static ma_result ma_libvorbis_decode_packets_f32(ma_libvorbis* pVorbis, float* pFramesOut, float** ppFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    OggVorbis_File* vf = (OggVorbis_File*)pVorbis->vf;
+    ma_uint32 channels = pVorbis->channels;
+    ma_uint64 totalFramesRead = 0;
+    ma_result result = MA_SUCCESS;
+
+    *pFramesRead = 0;
+
+    if (vf->ready_state < OPENED) {
+        return MA_INVALID_OPERATION;
+    }
+
+    while (totalFramesRead < frameCount) {
+        if (vf->ready_state == INITSET) {
+            float** ppFramesF32;
+            long framesAvailable = vorbis_synthesis_pcmout(&vf->vd, &ppFramesF32);
+
+            if (framesAvailable > 0) {
+                ma_uint64 framesToCopy = (ma_uint64)framesAvailable;
+                if (framesToCopy > frameCount - totalFramesRead) {
+                    framesToCopy = frameCount - totalFramesRead;
+                }
+
+                if ((ma_uint32)vf->vd.vi->channels != channels) {
+                    result = MA_INVALID_DATA;
+                    break;
+                }
+
+                if (pFramesOut != NULL) {
+                    ma_libvorbis_interleave_f32(pFramesOut + totalFramesRead*channels, (const float* const*)ppFramesF32, channels, framesToCopy);
+                } else if (ppFramesOut != NULL) {
+                    ma_uint32 iChannel;
+                    for (iChannel = 0; iChannel < channels; iChannel += 1) {
+                        memcpy(ppFramesOut[iChannel] + totalFramesRead, ppFramesF32[iChannel], (size_t)framesToCopy * sizeof(float));
+                    }
+                }
+
+                vorbis_synthesis_read(&vf->vd, (int)framesToCopy);
+                vf->pcm_offset  += (ogg_int64_t)framesToCopy << vorbis_synthesis_halfrate_p(vf->vi);
+                totalFramesRead += framesToCopy;
+                continue;
+            }
+        }
+
+        {
+            int libvorbisResult = _fetch_and_process_packet(vf, NULL, 1, 1);
+            if (libvorbisResult == OV_EOF || libvorbisResult == 0) {
+                result = MA_AT_END;
+                break;
+            }
+
+            if (libvorbisResult < 0) {
+                result = MA_ERROR;  /* Error while decoding. */
+                break;
+            }
+        }
+    }
+
+    *pFramesRead = totalFramesRead;
+    return result;
+}
+#endif
+
+MA_VORBIS_API ma_result ma_libvorbis_read_pcm_frames(ma_libvorbis* pVorbis, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    if (pFramesRead != NULL) {
+        *pFramesRead = 0;
+    }
+
+    if (frameCount == 0) {
+        return MA_INVALID_ARGS;
+    }
+
+    if (pVorbis == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        ma_result result = MA_SUCCESS;  /* Must be initialized to MA_SUCCESS. */
+        ma_uint64 totalFramesRead;
+        ma_format format = pVorbis->format;
+        ma_uint32 channels = pVorbis->channels;
+
+        ma_libvorbis_allocator* pPrevAllocator;
+
+        pPrevAllocator = ma_libvorbis_push_allocator((ma_libvorbis_allocator*)pVorbis->pAllocator);
+
+        totalFramesRead = 0;
+        if (format == ma_format_f32) {
+            /* Decodes as many packets as fit in one go. See ma_libvorbis_decode_packets_f32(). */
+            result = ma_libvorbis_decode_packets_f32(pVorbis, (float*)pFramesOut, NULL, frameCount, &totalFramesRead);
+        } else {
+            ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(format, channels);
+
+            while (totalFramesRead < frameCount) {
+                long libvorbisResult;
+                ma_uint64 framesToRead;
+
+                framesToRead = (frameCount - totalFramesRead);
+                if (framesToRead > INT_MAX / bytesPerFrame) {
+                    framesToRead = INT_MAX / bytesPerFrame;
+                }
+
+                libvorbisResult = ov_read((OggVorbis_File*)pVorbis->vf, (char*)ma_offset_pcm_frames_ptr(pFramesOut, totalFramesRead, format, channels), (int)(framesToRead * bytesPerFrame), 0, 2, 1, NULL);
+                if (libvorbisResult < 0) {
+                    result = MA_ERROR;  /* Error while decoding. */
+                    break;
+                } else {
+                    /* Conveniently, there's no need to interleaving when using ov_read(). I'm not sure why ov_read_float() is different in that regard... */
+                    totalFramesRead += libvorbisResult / bytesPerFrame;
 
                     if (libvorbisResult == 0) {
                         result = MA_AT_END;
                         break;
                     }
                 }
+            }
+        }
+
+        ma_libvorbis_pop_allocator(pPrevAllocator);
+
+        if (pFramesRead != NULL) {
+            *pFramesRead = totalFramesRead;
+        }
+
+        if (result == MA_SUCCESS && totalFramesRead == 0) {
+            result = MA_AT_END;
+        }
+
+        return result;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+
+        (void)pFramesOut;
+        (void)frameCount;
+        (void)pFramesRead;
+
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_read_pcm_frames_planar(ma_libvorbis* pVorbis, float** ppFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead)
+{
+    if (pFramesRead != NULL) {
+        *pFramesRead = 0;
+    }
+
+    if (frameCount == 0) {
+        return MA_INVALID_ARGS;
+    }
+
+    if (pVorbis == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        /* Planar output is always f32 since that's what libvorbis decodes to natively. */
+        ma_result result;
+        ma_uint64 totalFramesRead;
+
+        ma_libvorbis_allocator* pPrevAllocator;
+
+        pPrevAllocator = ma_libvorbis_push_allocator((ma_libvorbis_allocator*)pVorbis->pAllocator);
+
+        /* No interleaving required. Each channel is a straight copy. A NULL output buffer means we're just skipping. */
+        result = ma_libvorbis_decode_packets_f32(pVorbis, NULL, ppFramesOut, frameCount, &totalFramesRead);
+
+        ma_libvorbis_pop_allocator(pPrevAllocator);
+
+        if (pFramesRead != NULL) {
+            *pFramesRead = totalFramesRead;
+        }
+
+        if (result == MA_SUCCESS && totalFramesRead == 0) {
+            result = MA_AT_END;
+        }
+
+        return result;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+
+        (void)ppFramesOut;
+        (void)frameCount;
+        (void)pFramesRead;
+
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_acquire_pcm_frames_planar(ma_libvorbis* pVorbis, float*** pppFramesOut, ma_uint64 frameCount, ma_uint64* pFramesAcquired)
+{
+    if (pFramesAcquired != NULL) {
+        *pFramesAcquired = 0;
+    }
+
+    if (pppFramesOut == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *pppFramesOut = NULL;
+
+    if (frameCount == 0 || pVorbis == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        long libvorbisResult;
+        ma_libvorbis_allocator* pPrevAllocator;
+
+        if (frameCount > INT_MAX) {
+            frameCount = INT_MAX;
+        }
+
+        /*
+        This hands back libvorbis' own synthesis buffers. The frames are consumed by this call so the caller needs to be
+        done with them before calling back into the decoder.
+        */
+        pPrevAllocator  = ma_libvorbis_push_allocator((ma_libvorbis_allocator*)pVorbis->pAllocator);
+        libvorbisResult = ov_read_float((OggVorbis_File*)pVorbis->vf, pppFramesOut, (int)frameCount, NULL);
+        ma_libvorbis_pop_allocator(pPrevAllocator);
+        if (libvorbisResult < 0) {
+            *pppFramesOut = NULL;
+            return MA_ERROR;    /* Error while decoding. */
+        }
+
+        if (libvorbisResult == 0) {
+            *pppFramesOut = NULL;
+            return MA_AT_END;
+        }
+
+        if (pFramesAcquired != NULL) {
+            *pFramesAcquired = (ma_uint64)libvorbisResult;
+        }
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+
+/*
+Seek table
+
+ov_pcm_seek() bisects over the whole file which is a lot of seek and read calls for a single seek. The seek table is
+a sparse list of (granule position, page offset) pairs collected by scanning the stream once. A seek then jumps
+straight to the last page that ends at or before the target and decodes forward from there with
+ov_pcm_seek_from_page(), which is the tail end of ov_pcm_seek() without the bisection.
+
+Only single link streams are supported. Chained streams, and streams that are not seekable, always use ov_pcm_seek().
+
+The table can be saved to a blob and loaded back in later sessions to skip the scan. All values in the blob are
+little endian:
+
+    magic           4 bytes ("MAVS")
+    version         u32
+    serialNumber    u32     Serial number of the logical stream.
+    seekPointCount  u32
+    rawLength       u64     Length of the file in bytes.
+    pcmLength       u64     Length of the stream in PCM frames.
+    seekPoints      seekPointCount * (u64 pcmFrame, u64 byteOffset)
+*/
+#define MA_LIBVORBIS_SEEK_TABLE_VERSION     1
+#define MA_LIBVORBIS_SEEK_TABLE_HEADER_SIZE 32
+#define MA_LIBVORBIS_SEEK_POINT_SIZE        16
+#define MA_LIBVORBIS_SEEK_TABLE_SCAN_CHUNK  65536
+
+#if !defined(MA_NO_LIBVORBIS)
+static void ma_libvorbis_write_u32_le(ma_uint8* pDst, ma_uint32 value)
+{
+    pDst[0] = (ma_uint8)(value >>  0);
+    pDst[1] = (ma_uint8)(value >>  8);
+    pDst[2] = (ma_uint8)(value >> 16);
+    pDst[3] = (ma_uint8)(value >> 24);
+}
+
+static void ma_libvorbis_write_u64_le(ma_uint8* pDst, ma_uint64 value)
+{
+    ma_libvorbis_write_u32_le(pDst + 0, (ma_uint32)(value >>  0));
+    ma_libvorbis_write_u32_le(pDst + 4, (ma_uint32)(value >> 32));
+}
+
+static ma_uint32 ma_libvorbis_read_u32_le(const ma_uint8* pSrc)
+{
+    return ((ma_uint32)pSrc[0] << 0) | ((ma_uint32)pSrc[1] << 8) | ((ma_uint32)pSrc[2] << 16) | ((ma_uint32)pSrc[3] << 24);
+}
+
+static ma_uint64 ma_libvorbis_read_u64_le(const ma_uint8* pSrc)
+{
+    return ((ma_uint64)ma_libvorbis_read_u32_le(pSrc + 0) << 0) | ((ma_uint64)ma_libvorbis_read_u32_le(pSrc + 4) << 32);
+}
+
+static ma_bool32 ma_libvorbis_supports_seek_table(OggVorbis_File* vf)
+{
+    return vf->ready_state >= OPENED && vf->seekable && vf->links == 1;
+}
+
+static ma_result ma_libvorbis_append_seek_point(ma_libvorbis_seek_point** ppSeekPoints, ma_uint32* pCount, ma_uint32* pCap, ma_uint64 pcmFrame, ma_uint64 byteOffset, const ma_allocation_callbacks* pAllocationCallbacks)
+{
+    if (*pCount == *pCap) {
+        ma_uint32 newCap = (*pCap == 0) ? 64 : (*pCap * 2);
+        ma_libvorbis_seek_point* pNewSeekPoints = (ma_libvorbis_seek_point*)ma_realloc(*ppSeekPoints, sizeof(**ppSeekPoints) * newCap, pAllocationCallbacks);
+        if (pNewSeekPoints == NULL) {
+            return MA_OUT_OF_MEMORY;
+        }
+
+        *ppSeekPoints = pNewSeekPoints;
+        *pCap = newCap;
+    }
+
+    (*ppSeekPoints)[*pCount].pcmFrame   = pcmFrame;
+    (*ppSeekPoints)[*pCount].byteOffset = byteOffset;
+    *pCount += 1;
+
+    return MA_SUCCESS;
+}
+
+static ma_result ma_libvorbis_scan_seek_points(OggVorbis_File* vf, ma_libvorbis_allocator* pOggAllocator, ma_uint64 interval, ma_libvorbis_seek_point** ppSeekPoints, ma_uint32* pSeekPointCount, const ma_allocation_callbacks* pAllocationCallbacks)
+{
+    ma_result result = MA_SUCCESS;
+    ogg_sync_state oy;
+    ogg_page og;
+    ogg_int64_t pageOffset;
+    ogg_int64_t restorePos;
+    ogg_int64_t pcmOrigin;
+    ma_uint64 lastPCMFrame = 0;
+    ma_uint32 seekPointCount = 0;
+    ma_uint32 seekPointCap = 0;
+    ma_libvorbis_seek_point* pSeekPoints = NULL;
+    ma_libvorbis_allocator* pPrevAllocator;
+
+    /*
+    The scan runs on its own sync state straight through the vorbisfile callbacks. The decoder's own state is left
+    alone, but the underlying stream position needs to be put back once we're done.
+    */
+    restorePos = (ogg_int64_t)vf->callbacks.tell_func(vf->datasource);
+    if (restorePos < 0) {
+        return MA_INVALID_OPERATION;
+    }
+
+    pageOffset = vf->dataoffsets[0];
+    pcmOrigin  = vf->pcmlengths[0];
+
+    if (vf->callbacks.seek_func(vf->datasource, pageOffset, SEEK_SET) != 0) {
+        return MA_BAD_SEEK;
+    }
+
+    /* The first audio page always maps to frame 0. */
+    result = ma_libvorbis_append_seek_point(&pSeekPoints, &seekPointCount, &seekPointCap, 0, (ma_uint64)pageOffset, pAllocationCallbacks);
+
+    pPrevAllocator = ma_libvorbis_push_allocator(pOggAllocator);
+    ogg_sync_init(&oy);
+
+    while (result == MA_SUCCESS) {
+        long pageResult;
+        char* pBuffer;
+        size_t bytesRead;
+
+        pageResult = ogg_sync_pageseek(&oy, &og);
+        if (pageResult < 0) {
+            pageOffset += -pageResult;  /* Skipped over garbage. */
+            continue;
+        }
+
+        if (pageResult > 0) {
+            ogg_int64_t granulePos = ogg_page_granulepos(&og);
+
+            if ((ogg_uint32_t)ogg_page_serialno(&og) == (ogg_uint32_t)vf->serialnos[0] && granulePos >= 0) {
+                ma_uint64 pcmFrame = (granulePos > pcmOrigin) ? (ma_uint64)(granulePos - pcmOrigin) : 0;
+                if (pcmFrame - lastPCMFrame >= interval && pcmFrame > lastPCMFrame) {
+                    result = ma_libvorbis_append_seek_point(&pSeekPoints, &seekPointCount, &seekPointCap, pcmFrame, (ma_uint64)pageOffset, pAllocationCallbacks);
+                    lastPCMFrame = pcmFrame;
+                }
+            }
+
+            pageOffset += pageResult;
+            continue;
+        }
+
+        /* Need more data. */
+        pBuffer = ogg_sync_buffer(&oy, MA_LIBVORBIS_SEEK_TABLE_SCAN_CHUNK);
+        if (pBuffer == NULL) {
+            result = MA_OUT_OF_MEMORY;
+            break;
+        }
+
+        bytesRead = vf->callbacks.read_func(pBuffer, 1, MA_LIBVORBIS_SEEK_TABLE_SCAN_CHUNK, vf->datasource);
+        if (bytesRead == 0) {
+            break;  /* End of the stream. */
+        }
+
+        ogg_sync_wrote(&oy, (long)bytesRead);
+    }
+
+    ogg_sync_clear(&oy);
+    ma_libvorbis_pop_allocator(pPrevAllocator);
+
+    if (vf->callbacks.seek_func(vf->datasource, restorePos, SEEK_SET) != 0 && result == MA_SUCCESS) {
+        result = MA_BAD_SEEK;
+    }
+
+    if (result != MA_SUCCESS) {
+        ma_free(pSeekPoints, pAllocationCallbacks);
+        return result;
+    }
+
+    *ppSeekPoints    = pSeekPoints;
+    *pSeekPointCount = seekPointCount;
+
+    return MA_SUCCESS;
+}
+
+static const ma_libvorbis_seek_point* ma_libvorbis_find_seek_point(const ma_libvorbis* pVorbis, ma_uint64 frameIndex)
+{
+    ma_uint32 lo = 0;
+    ma_uint32 hi = pVorbis->seekPointCount;
+
+    /* Last seek point with pcmFrame <= frameIndex. The first point is always frame 0 so this can't miss. */
+    while (hi - lo > 1) {
+        ma_uint32 mid = lo + (hi - lo) / 2;
+        if (pVorbis->pSeekPoints[mid].pcmFrame <= frameIndex) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return &pVorbis->pSeekPoints[lo];
+}
+#endif
+
+MA_VORBIS_API ma_result ma_libvorbis_build_seek_table(ma_libvorbis* pVorbis, ma_uint32 seekPointCount)
+{
+    if (pVorbis == NULL || seekPointCount == 0) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        ma_result result;
+        OggVorbis_File* vf = (OggVorbis_File*)pVorbis->vf;
+        ogg_int64_t pcmLength;
+        ma_uint64 interval;
+        ma_libvorbis_seek_point* pSeekPoints;
+        ma_uint32 actualSeekPointCount;
+
+        result = ma_libvorbis_complete_deferred_open(pVorbis, MA_TRUE);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        if (!ma_libvorbis_supports_seek_table(vf)) {
+            return MA_INVALID_OPERATION;
+        }
+
+        pcmLength = ov_pcm_total(vf, -1);
+        if (pcmLength < 0) {
+            return MA_ERROR;
+        }
+
+        interval = (ma_uint64)pcmLength / seekPointCount;
+
+        result = ma_libvorbis_scan_seek_points(vf, (ma_libvorbis_allocator*)pVorbis->pAllocator, interval, &pSeekPoints, &actualSeekPointCount, ma_libvorbis_get_allocation_callbacks(pVorbis));
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        ma_free(pVorbis->pSeekPoints, ma_libvorbis_get_allocation_callbacks(pVorbis));
+        pVorbis->pSeekPoints    = pSeekPoints;
+        pVorbis->seekPointCount = actualSeekPointCount;
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_save_seek_table(ma_libvorbis* pVorbis, void* pData, size_t dataCap, size_t* pDataSize)
+{
+    if (pDataSize != NULL) {
+        *pDataSize = 0;
+    }
+
+    if (pVorbis == NULL || pDataSize == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        OggVorbis_File* vf = (OggVorbis_File*)pVorbis->vf;
+        ma_uint8* pRunningData = (ma_uint8*)pData;
+        size_t dataSize;
+        ma_uint32 iSeekPoint;
+
+        if (pVorbis->pSeekPoints == NULL) {
+            return MA_INVALID_OPERATION;    /* The seek table hasn't been built. */
+        }
+
+        dataSize = MA_LIBVORBIS_SEEK_TABLE_HEADER_SIZE + (size_t)pVorbis->seekPointCount * MA_LIBVORBIS_SEEK_POINT_SIZE;
+
+        if (pData == NULL) {
+            *pDataSize = dataSize;
+            return MA_SUCCESS;
+        }
+
+        if (dataCap < dataSize) {
+            return MA_NO_SPACE;
+        }
+
+        memcpy(pRunningData, "MAVS", 4);
+        ma_libvorbis_write_u32_le(pRunningData +  4, MA_LIBVORBIS_SEEK_TABLE_VERSION);
+        ma_libvorbis_write_u32_le(pRunningData +  8, (ma_uint32)vf->serialnos[0]);
+        ma_libvorbis_write_u32_le(pRunningData + 12, pVorbis->seekPointCount);
+        ma_libvorbis_write_u64_le(pRunningData + 16, (ma_uint64)ov_raw_total(vf, -1));
+        ma_libvorbis_write_u64_le(pRunningData + 24, (ma_uint64)ov_pcm_total(vf, -1));
+        pRunningData += MA_LIBVORBIS_SEEK_TABLE_HEADER_SIZE;
+
+        for (iSeekPoint = 0; iSeekPoint < pVorbis->seekPointCount; iSeekPoint += 1) {
+            ma_libvorbis_write_u64_le(pRunningData + 0, pVorbis->pSeekPoints[iSeekPoint].pcmFrame);
+            ma_libvorbis_write_u64_le(pRunningData + 8, pVorbis->pSeekPoints[iSeekPoint].byteOffset);
+            pRunningData += MA_LIBVORBIS_SEEK_POINT_SIZE;
+        }
+
+        *pDataSize = dataSize;
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+
+        (void)pData;
+        (void)dataCap;
+
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_load_seek_table(ma_libvorbis* pVorbis, const void* pData, size_t dataSize)
+{
+    if (pVorbis == NULL || pData == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        OggVorbis_File* vf = (OggVorbis_File*)pVorbis->vf;
+        const ma_uint8* pRunningData = (const ma_uint8*)pData;
+        ma_uint32 seekPointCount;
+        ma_uint64 rawLength;
+        ma_uint64 pcmLength;
+        ma_uint64 prevPCMFrame = 0;
+        ma_uint32 iSeekPoint;
+        ma_libvorbis_seek_point* pSeekPoints;
+        ma_result result;
+
+        result = ma_libvorbis_complete_deferred_open(pVorbis, MA_TRUE);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        if (!ma_libvorbis_supports_seek_table(vf)) {
+            return MA_INVALID_OPERATION;
+        }
+
+        if (dataSize < MA_LIBVORBIS_SEEK_TABLE_HEADER_SIZE || memcmp(pRunningData, "MAVS", 4) != 0 || ma_libvorbis_read_u32_le(pRunningData + 4) != MA_LIBVORBIS_SEEK_TABLE_VERSION) {
+            return MA_INVALID_DATA;
+        }
+
+        seekPointCount = ma_libvorbis_read_u32_le(pRunningData + 12);
+        rawLength      = ma_libvorbis_read_u64_le(pRunningData + 16);
+        pcmLength      = ma_libvorbis_read_u64_le(pRunningData + 24);
+
+        /* Make sure the blob belongs to this stream. A stale blob would send seeks to the wrong pages. */
+        if (ma_libvorbis_read_u32_le(pRunningData + 8) != (ma_uint32)vf->serialnos[0] || rawLength != (ma_uint64)ov_raw_total(vf, -1) || pcmLength != (ma_uint64)ov_pcm_total(vf, -1)) {
+            return MA_INVALID_DATA;
+        }
+
+        if (seekPointCount == 0 || (dataSize - MA_LIBVORBIS_SEEK_TABLE_HEADER_SIZE) / MA_LIBVORBIS_SEEK_POINT_SIZE < seekPointCount) {
+            return MA_INVALID_DATA;
+        }
+
+        pSeekPoints = (ma_libvorbis_seek_point*)ma_malloc(sizeof(*pSeekPoints) * seekPointCount, ma_libvorbis_get_allocation_callbacks(pVorbis));
+        if (pSeekPoints == NULL) {
+            return MA_OUT_OF_MEMORY;
+        }
+
+        pRunningData += MA_LIBVORBIS_SEEK_TABLE_HEADER_SIZE;
+
+        for (iSeekPoint = 0; iSeekPoint < seekPointCount; iSeekPoint += 1) {
+            pSeekPoints[iSeekPoint].pcmFrame   = ma_libvorbis_read_u64_le(pRunningData + 0);
+            pSeekPoints[iSeekPoint].byteOffset = ma_libvorbis_read_u64_le(pRunningData + 8);
+            pRunningData += MA_LIBVORBIS_SEEK_POINT_SIZE;
+
+            /*
+            Must start at frame 0, be sorted and point inside the file. ov_raw_total() stops at the start of the last
+            page rather than the end of the file so a point can legitimately sit right on it.
+            */
+            if ((iSeekPoint == 0 && pSeekPoints[iSeekPoint].pcmFrame != 0) ||
+                (iSeekPoint >  0 && pSeekPoints[iSeekPoint].pcmFrame <= prevPCMFrame) ||
+                pSeekPoints[iSeekPoint].byteOffset > rawLength) {
+                ma_free(pSeekPoints, ma_libvorbis_get_allocation_callbacks(pVorbis));
+                return MA_INVALID_DATA;
+            }
+
+            prevPCMFrame = pSeekPoints[iSeekPoint].pcmFrame;
+        }
+
+        ma_free(pVorbis->pSeekPoints, ma_libvorbis_get_allocation_callbacks(pVorbis));
+        pVorbis->pSeekPoints    = pSeekPoints;
+        pVorbis->seekPointCount = seekPointCount;
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+
+        (void)dataSize;
+
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_seek_to_pcm_frame(ma_libvorbis* pVorbis, ma_uint64 frameIndex)
+{
+    if (pVorbis == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        OggVorbis_File* vf = (OggVorbis_File*)pVorbis->vf;
+        int libvorbisResult = -1;
+        ma_result result;
+        ma_libvorbis_allocator* pPrevAllocator;
+
+        /* No need to restore the cursor after a deferred open since we're about to move it anyway. */
+        result = ma_libvorbis_complete_deferred_open(pVorbis, MA_FALSE);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        /* The seek table is built on the first seek if it was requested in the config. A failure here just means we fall back to bisection. */
+        if (pVorbis->pSeekPoints == NULL && pVorbis->seekPointCountRequested > 0 && ma_libvorbis_supports_seek_table(vf)) {
+            if (ma_libvorbis_build_seek_table(pVorbis, pVorbis->seekPointCountRequested) != MA_SUCCESS) {
+                pVorbis->seekPointCountRequested = 0;   /* Don't try again on every seek. */
+            }
+        }
+
+        pPrevAllocator = ma_libvorbis_push_allocator((ma_libvorbis_allocator*)pVorbis->pAllocator);
+        {
+            if (pVorbis->pSeekPoints != NULL) {
+                const ma_libvorbis_seek_point* pSeekPoint = ma_libvorbis_find_seek_point(pVorbis, frameIndex);
+                libvorbisResult = ov_pcm_seek_from_page(vf, (ogg_int64_t)pSeekPoint->byteOffset, (ogg_int64_t)frameIndex);
+            }
+
+            if (libvorbisResult != 0) {
+                libvorbisResult = ov_pcm_seek(vf, (ogg_int64_t)frameIndex);
+            }
+        }
+        ma_libvorbis_pop_allocator(pPrevAllocator);
+
+        if (libvorbisResult != 0) {
+            if (libvorbisResult == OV_ENOSEEK) {
+                return MA_INVALID_OPERATION;    /* Not seekable. */
+            } else if (libvorbisResult == OV_EINVAL) {
+                return MA_INVALID_ARGS;
             } else {
-                libvorbisResult = ov_read((OggVorbis_File*)pVorbis->vf, (char*)ma_offset_pcm_frames_ptr(pFramesOut, totalFramesRead, format, channels), (int)(framesToRead * ma_get_bytes_per_frame(format, channels)), 0, 2, 1, NULL);
-                if (libvorbisResult < 0) {
-                    result = MA_ERROR;  /* Error while decoding. */
-                    break;
-                } else {
-                    /* Conveniently, there's no need to interleaving when using ov_read(). I'm not sure why ov_read_float() is different in that regard... */
-                    totalFramesRead += libvorbisResult / ma_get_bytes_per_frame(format, channels);
+                return MA_ERROR;
+            }
+        }
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+
+        (void)frameIndex;
+
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_get_data_format(ma_libvorbis* pVorbis, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+{
+    /* Defaults for safety. */
+    if (pFormat != NULL) {
+        *pFormat = ma_format_unknown;
+    }
+    if (pChannels != NULL) {
+        *pChannels = 0;
+    }
+    if (pSampleRate != NULL) {
+        *pSampleRate = 0;
+    }
+    if (pChannelMap != NULL) {
+        memset(pChannelMap, 0, sizeof(*pChannelMap) * channelMapCap);
+    }
+
+    if (pVorbis == NULL) {
+        return MA_INVALID_OPERATION;
+    }
+
+    if (pFormat != NULL) {
+        *pFormat = pVorbis->format;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        /* Cached from the first link by ma_libvorbis_open_vf(). */
+        if (pVorbis->channels == 0) {
+            return MA_INVALID_OPERATION;
+        }
+
+        if (pChannels != NULL) {
+            *pChannels = pVorbis->channels;
+        }
+
+        if (pSampleRate != NULL) {
+            *pSampleRate = pVorbis->sampleRate;
+        }
+
+        if (pChannelMap != NULL) {
+            ma_channel_map_init_standard(ma_standard_channel_map_vorbis, pChannelMap, channelMapCap, pVorbis->channels);
+        }
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_get_cursor_in_pcm_frames(ma_libvorbis* pVorbis, ma_uint64* pCursor)
+{
+    if (pCursor == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *pCursor = 0;   /* Safety. */
+
+    if (pVorbis == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        ogg_int64_t offset = ov_pcm_tell((OggVorbis_File*)pVorbis->vf);
+        if (offset < 0) {
+            return MA_INVALID_FILE;
+        }
+
+        *pCursor = (ma_uint64)offset;
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_get_length_in_pcm_frames(ma_libvorbis* pVorbis, ma_uint64* pLength)
+{
+    if (pLength == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    *pLength = 0;   /* Safety. */
+
+    if (pVorbis == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    #if !defined(MA_NO_LIBVORBIS)
+    {
+        /*
+        Will work in the supermajority of cases where a file has a single logical bitstream. Concatenated streams
+        are much harder to determine the length of since they can have sample rate changes, but they should be
+        extremely rare outside of unseekable livestreams anyway.
+        */
+        ma_result result;
+
+        result = ma_libvorbis_complete_deferred_open(pVorbis, MA_TRUE);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+
+        if (ov_streams((OggVorbis_File*)pVorbis->vf) == 1) {
+            ogg_int64_t length = ov_pcm_total((OggVorbis_File*)pVorbis->vf, 0);
+            if(length != OV_EINVAL) {
+                *pLength = (ma_uint64)length;
+            } else {
+                /* Unseekable. */
+            }
+        } else {
+            /* Concatenated stream. */
+        }
+
+        return MA_SUCCESS;
+    }
+    #else
+    {
+        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
+        assert(MA_FALSE);
+        return MA_NOT_IMPLEMENTED;
+    }
+    #endif
+}
+
+
+/*
+Whole file decoding
+
+The file is split into segments that start on the pages recorded in the seek table. Each worker opens its own decoder
+over the same memory, loads the seek table from the first one rather than scanning again, and seeks to the start of
+its segment. ov_pcm_seek_from_page() decodes the packet before the target as pre-roll so the overlap is primed exactly
+as it would be when decoding straight through, which keeps the output bit-exact with a serial decode.
+
+The workers are custom jobs posted to the resource manager. The calling thread claims segments as well so this can't
+deadlock when called from a job thread or when every job thread is busy. A job that only gets to run after all of the
+segments are done just drops its reference to the shared state and returns. Since that can happen after we've returned
+the shared state itself uses the default allocator.
+*/
+#if !defined(MA_NO_LIBVORBIS)
+#define MA_LIBVORBIS_SEGMENTS_PER_THREAD    4
+#define MA_LIBVORBIS_SERIAL_DECODE_CHUNK    4096
+
+typedef struct
+{
+    const void* pData;
+    size_t dataSize;
+    ma_format format;
+    ma_uint32 bytesPerFrame;
+    void* pFramesOut;
+    const void* pSeekTable;
+    size_t seekTableSize;
+    const ma_uint64* pSegmentStarts;    /* segmentCount + 1 entries. The last one is the length of the stream. */
+    ma_uint32 segmentCount;
+    const ma_allocation_callbacks* pAllocationCallbacks;    /* The caller's. Only used while the caller is waiting on completedEvent. */
+    ma_spinlock lock;
+    ma_uint32 refCount;
+    ma_uint32 nextSegment;
+    ma_uint32 completedSegmentCount;
+    ma_uint32 activeWorkerCount;        /* Workers that have claimed at least one segment and haven't released their decoder yet. */
+    ma_uint64 lastSegmentFrameCount;
+    ma_result result;
+    ma_event completedEvent;            /* Signaled once every segment is done and every worker has released its decoder. */
+} ma_libvorbis_decode_job_state;
+
+static void ma_libvorbis_decode_job_state_release(ma_libvorbis_decode_job_state* pState)
+{
+    ma_bool32 isLastReference;
+
+    ma_spinlock_lock(&pState->lock);
+    {
+        pState->refCount -= 1;
+        isLastReference = (pState->refCount == 0);
+    }
+    ma_spinlock_unlock(&pState->lock);
+
+    if (isLastReference) {
+        ma_event_uninit(&pState->completedEvent);
+        ma_free(pState, NULL);
+    }
+}
+
+static ma_result ma_libvorbis_decode_segment(ma_libvorbis_decode_job_state* pState, ma_libvorbis* pVorbis, ma_uint32 iSegment, ma_uint64* pFramesDecoded)
+{
+    ma_result result;
+    ma_uint64 segmentStart = pState->pSegmentStarts[iSegment];
+    ma_uint64 segmentFrameCount = pState->pSegmentStarts[iSegment + 1] - segmentStart;
+    ma_uint64 cursor;
+    ma_uint64 totalFramesRead = 0;
+
+    *pFramesDecoded = 0;
+
+    result = ma_libvorbis_get_cursor_in_pcm_frames(pVorbis, &cursor);
+    if (result != MA_SUCCESS || cursor != segmentStart) {
+        result = ma_libvorbis_seek_to_pcm_frame(pVorbis, segmentStart);
+        if (result != MA_SUCCESS) {
+            return result;
+        }
+    }
+
+    while (totalFramesRead < segmentFrameCount) {
+        ma_uint64 framesRead = 0;
+
+        result = ma_libvorbis_read_pcm_frames(pVorbis, (ma_uint8*)pState->pFramesOut + (segmentStart + totalFramesRead) * pState->bytesPerFrame, segmentFrameCount - totalFramesRead, &framesRead);
+        totalFramesRead += framesRead;
+
+        if (result != MA_SUCCESS || framesRead == 0) {
+            break;
+        }
+    }
+
+    *pFramesDecoded = totalFramesRead;
+
+    /* Only the last segment is allowed to come up short, which happens when the file is truncated. */
+    if (totalFramesRead < segmentFrameCount && iSegment + 1 < pState->segmentCount) {
+        return MA_INVALID_DATA;
+    }
+
+    return MA_SUCCESS;
+}
+
+static void ma_libvorbis_decode_job_run(ma_libvorbis_decode_job_state* pState)
+{
+    ma_libvorbis vorbis;
+    ma_bool32 isActive = MA_FALSE;
+    ma_bool32 isVorbisInitialized = MA_FALSE;
+    ma_bool32 isDone;
+
+    for (;;) {
+        ma_uint32 iSegment;
+        ma_uint64 framesDecoded = 0;
+        ma_result result;
+
+        ma_spinlock_lock(&pState->lock);
+        {
+            iSegment = pState->nextSegment;
+            if (iSegment < pState->segmentCount) {
+                pState->nextSegment += 1;
+
+                if (!isActive) {
+                    pState->activeWorkerCount += 1;
+                    isActive = MA_TRUE;
+                }
+            }
+
+            result = pState->result;
+        }
+        ma_spinlock_unlock(&pState->lock);
+
+        if (iSegment >= pState->segmentCount) {
+            break;
+        }
+
+        /* Once something has failed there's no point decoding the rest, but the segment still needs to be accounted for. */
+        if (result == MA_SUCCESS && !isVorbisInitialized) {
+            ma_decoding_backend_config backendConfig = ma_decoding_backend_config_init(pState->format, 0);
+
+            result = ma_libvorbis_init_memory(pState->pData, pState->dataSize, &backendConfig, pState->pAllocationCallbacks, &vorbis);
+            if (result == MA_SUCCESS) {
+                isVorbisInitialized = MA_TRUE;
+                result = ma_libvorbis_load_seek_table(&vorbis, pState->pSeekTable, pState->seekTableSize);
+            }
+        }
+
+        if (result == MA_SUCCESS) {
+            result = ma_libvorbis_decode_segment(pState, &vorbis, iSegment, &framesDecoded);
+        }
+
+        ma_spinlock_lock(&pState->lock);
+        {
+            if (result != MA_SUCCESS && pState->result == MA_SUCCESS) {
+                pState->result = result;
+            }
+
+            if (iSegment + 1 == pState->segmentCount) {
+                pState->lastSegmentFrameCount = framesDecoded;
+            }
+
+            pState->completedSegmentCount += 1;
+        }
+        ma_spinlock_unlock(&pState->lock);
+    }
+
+    if (!isActive) {
+        return; /* Never claimed anything so we're not holding anything up. */
+    }
+
+    /* The decoder must be gone before the caller is released since it uses the caller's allocation callbacks. */
+    if (isVorbisInitialized) {
+        ma_libvorbis_uninit(&vorbis, pState->pAllocationCallbacks);
+    }
+
+    ma_spinlock_lock(&pState->lock);
+    {
+        pState->activeWorkerCount -= 1;
+        isDone = (pState->activeWorkerCount == 0 && pState->completedSegmentCount == pState->segmentCount);
+    }
+    ma_spinlock_unlock(&pState->lock);
+
+    if (isDone) {
+        ma_event_signal(&pState->completedEvent);
+    }
+}
+
+static ma_result ma_libvorbis_decode_job_proc(ma_job* pJob)
+{
+    ma_libvorbis_decode_job_state* pState = (ma_libvorbis_decode_job_state*)pJob->data.custom.data0;
+
+    ma_libvorbis_decode_job_run(pState);
+    ma_libvorbis_decode_job_state_release(pState);
+
+    return MA_SUCCESS;
+}
+
+static ma_uint32 ma_libvorbis_get_decode_thread_count(const ma_libvorbis_decode_config* pConfig)
+{
+    ma_uint32 jobThreadCount;
+
+    if (pConfig->pResourceManager == NULL || (pConfig->pResourceManager->config.flags & MA_RESOURCE_MANAGER_FLAG_NO_THREADING) != 0) {
+        return 1;   /* Nowhere to post jobs to. */
+    }
+
+    jobThreadCount = pConfig->pResourceManager->config.jobThreadCount;
+
+    if (pConfig->threadCount == 0 || pConfig->threadCount > jobThreadCount + 1) {
+        return jobThreadCount + 1;  /* +1 for the calling thread. */
+    }
+
+    return pConfig->threadCount;
+}
+
+static ma_result ma_libvorbis_decode_serial(ma_libvorbis* pVorbis, ma_uint32 bytesPerFrame, const ma_allocation_callbacks* pAllocationCallbacks, ma_uint64* pFrameCountOut, void** ppPCMFramesOut)
+{
+    ma_result result = MA_SUCCESS;
+    ma_uint64 frameCount = 0;
+    ma_uint64 frameCap;
+    void* pFrames = NULL;
+
+    /* The length is only known for single link streams. Anything else grows the buffer as it goes. */
+    if (ma_libvorbis_get_length_in_pcm_frames(pVorbis, &frameCap) != MA_SUCCESS || frameCap == 0) {
+        frameCap = MA_LIBVORBIS_SERIAL_DECODE_CHUNK;
+    }
+
+    for (;;) {
+        ma_uint64 framesRead = 0;
+
+        if (frameCount == frameCap || pFrames == NULL) {
+            ma_uint64 newFrameCap = (pFrames == NULL) ? frameCap : frameCap * 2;
+            void* pNewFrames;
+
+            if (newFrameCap * bytesPerFrame > MA_SIZE_MAX) {
+                result = MA_TOO_BIG;
+                break;
+            }
 
-                    if (libvorbisResult == 0) {
-                        result = MA_AT_END;
-                        break;
-                    }
-                }
+            pNewFrames = ma_realloc(pFrames, (size_t)(newFrameCap * bytesPerFrame), pAllocationCallbacks);
+            if (pNewFrames == NULL) {
+                result = MA_OUT_OF_MEMORY;
+                break;
             }
-        }
 
-        if (pFramesRead != NULL) {
-            *pFramesRead = totalFramesRead;
+            pFrames  = pNewFrames;
+            frameCap = newFrameCap;
         }
 
-        if (result == MA_SUCCESS && totalFramesRead == 0) {
-            result = MA_AT_END;
+        result = ma_libvorbis_read_pcm_frames(pVorbis, (ma_uint8*)pFrames + frameCount * bytesPerFrame, frameCap - frameCount, &framesRead);
+        frameCount += framesRead;
+
+        if (result != MA_SUCCESS || framesRead == 0) {
+            result = (result == MA_AT_END || result == MA_SUCCESS) ? MA_SUCCESS : result;
+            break;
         }
+    }
 
+    if (result != MA_SUCCESS) {
+        ma_free(pFrames, pAllocationCallbacks);
         return result;
     }
-    #else
-    {
-        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
-        assert(MA_FALSE);
 
-        (void)pFramesOut;
-        (void)frameCount;
-        (void)pFramesRead;
+    *pFrameCountOut = frameCount;
+    *ppPCMFramesOut = pFrames;
 
-        return MA_NOT_IMPLEMENTED;
-    }
-    #endif
+    return MA_SUCCESS;
 }
 
-MA_VORBIS_API ma_result ma_libvorbis_seek_to_pcm_frame(ma_libvorbis* pVorbis, ma_uint64 frameIndex)
+static ma_result ma_libvorbis_decode_parallel(ma_libvorbis* pVorbis, const void* pData, size_t dataSize, ma_uint32 threadCount, ma_uint32 segmentCount, const ma_libvorbis_decode_config* pConfig, ma_uint32 bytesPerFrame, const ma_allocation_callbacks* pAllocationCallbacks, ma_uint64* pFrameCountOut, void** ppPCMFramesOut)
 {
-    if (pVorbis == NULL) {
-        return MA_INVALID_ARGS;
+    ma_result result;
+    ma_uint64 length;
+    size_t seekTableSize;
+    size_t stateSize;
+    ma_libvorbis_decode_job_state* pState;
+    ma_uint64* pSegmentStarts;
+    void* pFrames;
+    ma_uint32 iSeekPoint;
+    ma_uint32 jobCount;
+    ma_uint32 iJob;
+
+    result = ma_libvorbis_get_length_in_pcm_frames(pVorbis, &length);
+    if (result != MA_SUCCESS) {
+        return result;
     }
 
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        int libvorbisResult = ov_pcm_seek((OggVorbis_File*)pVorbis->vf, (ogg_int64_t)frameIndex);
-        if (libvorbisResult != 0) {
-            if (libvorbisResult == OV_ENOSEEK) {
-                return MA_INVALID_OPERATION;    /* Not seekable. */
-            } else if (libvorbisResult == OV_EINVAL) {
-                return MA_INVALID_ARGS;
-            } else {
-                return MA_ERROR;
-            }
-        }
+    /* Without a seek table there's nowhere to split the stream, but it can still be decoded. */
+    result = ma_libvorbis_build_seek_table(pVorbis, segmentCount);
+    if (result != MA_SUCCESS) {
+        return ma_libvorbis_decode_serial(pVorbis, bytesPerFrame, pAllocationCallbacks, pFrameCountOut, ppPCMFramesOut);
+    }
 
-        return MA_SUCCESS;
+    result = ma_libvorbis_save_seek_table(pVorbis, NULL, 0, &seekTableSize);
+    if (result != MA_SUCCESS) {
+        return result;
     }
-    #else
-    {
-        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
-        assert(MA_FALSE);
 
-        (void)frameIndex;
+    if (length * bytesPerFrame > MA_SIZE_MAX) {
+        return MA_TOO_BIG;
+    }
 
-        return MA_NOT_IMPLEMENTED;
+    /* The state, the segment boundaries and the seek table all go in one allocation. */
+    stateSize = sizeof(*pState) + sizeof(ma_uint64) * (pVorbis->seekPointCount + 1) + seekTableSize;
+
+    pState = (ma_libvorbis_decode_job_state*)ma_calloc(stateSize, NULL);
+    if (pState == NULL) {
+        return MA_OUT_OF_MEMORY;
     }
-    #endif
-}
 
-MA_VORBIS_API ma_result ma_libvorbis_get_data_format(ma_libvorbis* pVorbis, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
-{
-    /* Defaults for safety. */
-    if (pFormat != NULL) {
-        *pFormat = ma_format_unknown;
+    pSegmentStarts = (ma_uint64*)(pState + 1);
+
+    result = ma_libvorbis_save_seek_table(pVorbis, pSegmentStarts + pVorbis->seekPointCount + 1, seekTableSize, &seekTableSize);
+    if (result != MA_SUCCESS) {
+        ma_free(pState, NULL);
+        return result;
     }
-    if (pChannels != NULL) {
-        *pChannels = 0;
+
+    /* Every seek point starts a segment, except for the one at the very end which would be empty. */
+    segmentCount = 0;
+    for (iSeekPoint = 0; iSeekPoint < pVorbis->seekPointCount; iSeekPoint += 1) {
+        if (pVorbis->pSeekPoints[iSeekPoint].pcmFrame < length) {
+            pSegmentStarts[segmentCount] = pVorbis->pSeekPoints[iSeekPoint].pcmFrame;
+            segmentCount += 1;
+        }
     }
-    if (pSampleRate != NULL) {
-        *pSampleRate = 0;
+    pSegmentStarts[segmentCount] = length;
+
+    if (segmentCount == 0) {
+        ma_free(pState, NULL);
+        return ma_libvorbis_decode_serial(pVorbis, bytesPerFrame, pAllocationCallbacks, pFrameCountOut, ppPCMFramesOut);
     }
-    if (pChannelMap != NULL) {
-        memset(pChannelMap, 0, sizeof(*pChannelMap) * channelMapCap);
+
+    pFrames = ma_malloc((size_t)(length * bytesPerFrame), pAllocationCallbacks);
+    if (pFrames == NULL) {
+        ma_free(pState, NULL);
+        return MA_OUT_OF_MEMORY;
     }
 
-    if (pVorbis == NULL) {
-        return MA_INVALID_OPERATION;
+    result = ma_event_init(&pState->completedEvent);
+    if (result != MA_SUCCESS) {
+        ma_free(pFrames, pAllocationCallbacks);
+        ma_free(pState, NULL);
+        return result;
     }
 
-    if (pFormat != NULL) {
-        *pFormat = pVorbis->format;
+    pState->pData                = pData;
+    pState->dataSize             = dataSize;
+    pState->format               = pVorbis->format;
+    pState->bytesPerFrame        = bytesPerFrame;
+    pState->pFramesOut           = pFrames;
+    pState->pSeekTable           = pSegmentStarts + pVorbis->seekPointCount + 1;
+    pState->seekTableSize        = seekTableSize;
+    pState->pSegmentStarts       = pSegmentStarts;
+    pState->segmentCount         = segmentCount;
+    pState->pAllocationCallbacks = pAllocationCallbacks;
+    pState->refCount             = 1;
+    pState->result               = MA_SUCCESS;
+
+    /* The calling thread is one of the workers so we only need to post jobs for the rest. */
+    jobCount = threadCount - 1;
+    if (jobCount > segmentCount - 1) {
+        jobCount = segmentCount - 1;
     }
 
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        vorbis_info* pInfo = ov_info((OggVorbis_File*)pVorbis->vf, 0);
-        if (pInfo == NULL) {
-            return MA_INVALID_OPERATION;
-        }
+    for (iJob = 0; iJob < jobCount; iJob += 1) {
+        ma_job job = ma_job_init(MA_JOB_TYPE_CUSTOM);
+        job.data.custom.proc  = ma_libvorbis_decode_job_proc;
+        job.data.custom.data0 = (ma_uintptr)pState;
 
-        if (pChannels != NULL) {
-            *pChannels = pInfo->channels;
+        ma_spinlock_lock(&pState->lock);
+        {
+            pState->refCount += 1;
         }
+        ma_spinlock_unlock(&pState->lock);
 
-        if (pSampleRate != NULL) {
-            *pSampleRate = pInfo->rate;
+        if (ma_resource_manager_post_job(pConfig->pResourceManager, &job) != MA_SUCCESS) {
+            ma_libvorbis_decode_job_state_release(pState);  /* Can't be the last reference since we're holding one. */
+            break;  /* The queue is full. We'll just have fewer workers. */
         }
+    }
 
-        if (pChannelMap != NULL) {
-            ma_channel_map_init_standard(ma_standard_channel_map_vorbis, pChannelMap, channelMapCap, pInfo->channels);
-        }
+    ma_libvorbis_decode_job_run(pState);
+    ma_event_wait(&pState->completedEvent);
 
-        return MA_SUCCESS;
-    }
-    #else
-    {
-        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
-        assert(MA_FALSE);
-        return MA_NOT_IMPLEMENTED;
+    /* Every worker has finished by now so none of these will change from under us. */
+    result = pState->result;
+    if (result == MA_SUCCESS) {
+        *pFrameCountOut = pSegmentStarts[segmentCount - 1] + pState->lastSegmentFrameCount;
+        *ppPCMFramesOut = pFrames;
+    } else {
+        ma_free(pFrames, pAllocationCallbacks);
     }
-    #endif
+
+    ma_libvorbis_decode_job_state_release(pState);
+
+    return result;
 }
+#endif
 
-MA_VORBIS_API ma_result ma_libvorbis_get_cursor_in_pcm_frames(ma_libvorbis* pVorbis, ma_uint64* pCursor)
+MA_VORBIS_API ma_libvorbis_decode_config ma_libvorbis_decode_config_init(ma_format format, ma_resource_manager* pResourceManager)
 {
-    if (pCursor == NULL) {
-        return MA_INVALID_ARGS;
+    ma_libvorbis_decode_config config;
+
+    memset(&config, 0, sizeof(config));
+    config.format           = format;
+    config.pResourceManager = pResourceManager;
+
+    return config;
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_decode_memory(const void* pData, size_t dataSize, ma_libvorbis_decode_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_uint64* pFrameCountOut, void** ppPCMFramesOut)
+{
+    if (pFrameCountOut != NULL) {
+        *pFrameCountOut = 0;
     }
 
-    *pCursor = 0;   /* Safety. */
+    if (ppPCMFramesOut != NULL) {
+        *ppPCMFramesOut = NULL;
+    }
 
-    if (pVorbis == NULL) {
+    if (pData == NULL || dataSize == 0 || pConfig == NULL || pFrameCountOut == NULL || ppPCMFramesOut == NULL) {
         return MA_INVALID_ARGS;
     }
 
     #if !defined(MA_NO_LIBVORBIS)
     {
-        ogg_int64_t offset = ov_pcm_tell((OggVorbis_File*)pVorbis->vf);
-        if (offset < 0) {
-            return MA_INVALID_FILE;
+        ma_result result;
+        ma_libvorbis vorbis;
+        ma_decoding_backend_config backendConfig;
+        ma_uint32 threadCount;
+        ma_uint32 segmentCount;
+        ma_uint32 bytesPerFrame;
+
+        backendConfig = ma_decoding_backend_config_init(pConfig->format, 0);
+
+        result = ma_libvorbis_init_memory(pData, dataSize, &backendConfig, pAllocationCallbacks, &vorbis);
+        if (result != MA_SUCCESS) {
+            return result;
         }
 
-        *pCursor = (ma_uint64)offset;
+        result = ma_libvorbis_get_data_format(&vorbis, &pConfig->format, &pConfig->channels, &pConfig->sampleRate, NULL, 0);
+        if (result != MA_SUCCESS) {
+            ma_libvorbis_uninit(&vorbis, pAllocationCallbacks);
+            return result;
+        }
 
-        return MA_SUCCESS;
+        bytesPerFrame = ma_get_bytes_per_frame(pConfig->format, pConfig->channels);
+        threadCount   = ma_libvorbis_get_decode_thread_count(pConfig);
+        segmentCount  = (pConfig->segmentCount != 0) ? pConfig->segmentCount : threadCount * MA_LIBVORBIS_SEGMENTS_PER_THREAD;
+
+        /* Chained streams can change format between links so they're always decoded serially. */
+        if (threadCount > 1 && segmentCount > 1 && ma_libvorbis_supports_seek_table((OggVorbis_File*)vorbis.vf)) {
+            result = ma_libvorbis_decode_parallel(&vorbis, pData, dataSize, threadCount, segmentCount, pConfig, bytesPerFrame, pAllocationCallbacks, pFrameCountOut, ppPCMFramesOut);
+        } else {
+            result = ma_libvorbis_decode_serial(&vorbis, bytesPerFrame, pAllocationCallbacks, pFrameCountOut, ppPCMFramesOut);
+        }
+
+        ma_libvorbis_uninit(&vorbis, pAllocationCallbacks);
+
+        return result;
     }
     #else
     {
-        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
-        assert(MA_FALSE);
+        /* libvorbis is disabled. */
+        (void)pAllocationCallbacks;
         return MA_NOT_IMPLEMENTED;
     }
     #endif
 }
 
-MA_VORBIS_API ma_result ma_libvorbis_get_length_in_pcm_frames(ma_libvorbis* pVorbis, ma_uint64* pLength)
+MA_VORBIS_API ma_result ma_libvorbis_decode_file(const char* pFilePath, ma_libvorbis_decode_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_uint64* pFrameCountOut, void** ppPCMFramesOut)
 {
-    if (pLength == NULL) {
-        return MA_INVALID_ARGS;
+    ma_result result;
+    void* pData;
+    size_t dataSize;
+
+    if (pFrameCountOut != NULL) {
+        *pFrameCountOut = 0;
     }
 
-    *pLength = 0;   /* Safety. */
+    if (ppPCMFramesOut != NULL) {
+        *ppPCMFramesOut = NULL;
+    }
 
-    if (pVorbis == NULL) {
+    if (pFilePath == NULL || pConfig == NULL) {
         return MA_INVALID_ARGS;
     }
 
-    #if !defined(MA_NO_LIBVORBIS)
-    {
-        /*
-        Will work in the supermajority of cases where a file has a single logical bitstream. Concatenated streams
-        are much harder to determine the length of since they can have sample rate changes, but they should be
-        extremely rare outside of unseekable livestreams anyway.
-        */
-        if (ov_streams((OggVorbis_File*)pVorbis->vf) == 1) {
-            ogg_int64_t length = ov_pcm_total((OggVorbis_File*)pVorbis->vf, 0);
-            if(length != OV_EINVAL) {
-                *pLength = (ma_uint64)length;
-            } else {
-                /* Unseekable. */
-            }
-        } else {
-            /* Concatenated stream. */
-        }
+    /* Workers each need their own view of the file so the whole thing is loaded up front. */
+    result = ma_vfs_open_and_read_file((pConfig->pResourceManager != NULL) ? pConfig->pResourceManager->config.pVFS : NULL, pFilePath, &pData, &dataSize, pAllocationCallbacks);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
 
-        return MA_SUCCESS;
+    result = ma_libvorbis_decode_memory(pData, dataSize, pConfig, pAllocationCallbacks, pFrameCountOut, ppPCMFramesOut);
+    ma_free(pData, pAllocationCallbacks);
+
+    return result;
+}
+
+MA_VORBIS_API ma_result ma_libvorbis_register_decoded_file(const char* pFilePath, ma_libvorbis_decode_config* pConfig, void** ppPCMFramesOut)
+{
+    ma_result result;
+    ma_uint64 frameCount;
+    void* pFrames;
+
+    if (ppPCMFramesOut != NULL) {
+        *ppPCMFramesOut = NULL;
     }
-    #else
-    {
-        /* libvorbis is disabled. Should never hit this since initialization would have failed. */
-        assert(MA_FALSE);
-        return MA_NOT_IMPLEMENTED;
+
+    if (pFilePath == NULL || pConfig == NULL || pConfig->pResourceManager == NULL || ppPCMFramesOut == NULL) {
+        return MA_INVALID_ARGS;
     }
-    #endif
-}
 
+    result = ma_libvorbis_decode_file(pFilePath, pConfig, &pConfig->pResourceManager->config.allocationCallbacks, &frameCount, &pFrames);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    result = ma_resource_manager_register_decoded_data(pConfig->pResourceManager, pFilePath, pFrames, frameCount, pConfig->format, pConfig->channels, pConfig->sampleRate);
+    if (result != MA_SUCCESS) {
+        ma_free(pFrames, &pConfig->pResourceManager->config.allocationCallbacks);
+        return result;
+    }
+
+    *ppPCMFramesOut = pFrames;
+
+    return MA_SUCCESS;
+}
 
 /*
 The code below defines the vtable that you'll plug into your `ma_decoder_config` object.
 */
 #if !defined(MA_NO_LIBVORBIS)
-static ma_result ma_decoding_backend_init__libvorbis(void* pUserData, ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+static ma_result ma_decoding_backend_init_ex__libvorbis(ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, ma_bool32 deferOpen, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
 {
     ma_result result;
     ma_libvorbis* pVorbis;
 
-    (void)pUserData;
-
     pVorbis = (ma_libvorbis*)ma_malloc(sizeof(*pVorbis), pAllocationCallbacks);
     if (pVorbis == NULL) {
         return MA_OUT_OF_MEMORY;
     }
 
-    result = ma_libvorbis_init(onRead, onSeek, onTell, pReadSeekTellUserData, pConfig, pAllocationCallbacks, pVorbis);
+    result = ma_libvorbis_init_ex(onRead, onSeek, onTell, pReadSeekTellUserData, pConfig, deferOpen, pAllocationCallbacks, pVorbis);
     if (result != MA_SUCCESS) {
         ma_free(pVorbis, pAllocationCallbacks);
         return result;
@@ -544,19 +3687,38 @@ static ma_result ma_decoding_backend_init__libvorbis(void* pUserData, ma_read_pr
     return MA_SUCCESS;
 }
 
-static ma_result ma_decoding_backend_init_file__libvorbis(void* pUserData, const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+static ma_result ma_decoding_backend_init_file_ex__libvorbis(const char* pFilePath, const ma_decoding_backend_config* pConfig, ma_bool32 deferOpen, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
 {
     ma_result result;
     ma_libvorbis* pVorbis;
 
-    (void)pUserData;
+    pVorbis = (ma_libvorbis*)ma_malloc(sizeof(*pVorbis), pAllocationCallbacks);
+    if (pVorbis == NULL) {
+        return MA_OUT_OF_MEMORY;
+    }
+
+    result = ma_libvorbis_init_file_ex(pFilePath, pConfig, deferOpen, pAllocationCallbacks, pVorbis);
+    if (result != MA_SUCCESS) {
+        ma_free(pVorbis, pAllocationCallbacks);
+        return result;
+    }
+
+    *ppBackend = pVorbis;
+
+    return MA_SUCCESS;
+}
+
+static ma_result ma_decoding_backend_init_memory_ex__libvorbis(const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, ma_bool32 deferOpen, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+{
+    ma_result result;
+    ma_libvorbis* pVorbis;
 
     pVorbis = (ma_libvorbis*)ma_malloc(sizeof(*pVorbis), pAllocationCallbacks);
     if (pVorbis == NULL) {
         return MA_OUT_OF_MEMORY;
     }
 
-    result = ma_libvorbis_init_file(pFilePath, pConfig, pAllocationCallbacks, pVorbis);
+    result = ma_libvorbis_init_memory_ex(pData, dataSize, pConfig, deferOpen, pAllocationCallbacks, pVorbis);
     if (result != MA_SUCCESS) {
         ma_free(pVorbis, pAllocationCallbacks);
         return result;
@@ -567,6 +3729,42 @@ static ma_result ma_decoding_backend_init_file__libvorbis(void* pUserData, const
     return MA_SUCCESS;
 }
 
+static ma_result ma_decoding_backend_init__libvorbis(void* pUserData, ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+{
+    (void)pUserData;
+    return ma_decoding_backend_init_ex__libvorbis(onRead, onSeek, onTell, pReadSeekTellUserData, pConfig, MA_FALSE, pAllocationCallbacks, ppBackend);
+}
+
+static ma_result ma_decoding_backend_init_file__libvorbis(void* pUserData, const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+{
+    (void)pUserData;
+    return ma_decoding_backend_init_file_ex__libvorbis(pFilePath, pConfig, MA_FALSE, pAllocationCallbacks, ppBackend);
+}
+
+static ma_result ma_decoding_backend_init_memory__libvorbis(void* pUserData, const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+{
+    (void)pUserData;
+    return ma_decoding_backend_init_memory_ex__libvorbis(pData, dataSize, pConfig, MA_FALSE, pAllocationCallbacks, ppBackend);
+}
+
+static ma_result ma_decoding_backend_init_lazy__libvorbis(void* pUserData, ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+{
+    (void)pUserData;
+    return ma_decoding_backend_init_ex__libvorbis(onRead, onSeek, onTell, pReadSeekTellUserData, pConfig, MA_TRUE, pAllocationCallbacks, ppBackend);
+}
+
+static ma_result ma_decoding_backend_init_file_lazy__libvorbis(void* pUserData, const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+{
+    (void)pUserData;
+    return ma_decoding_backend_init_file_ex__libvorbis(pFilePath, pConfig, MA_TRUE, pAllocationCallbacks, ppBackend);
+}
+
+static ma_result ma_decoding_backend_init_memory_lazy__libvorbis(void* pUserData, const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_data_source** ppBackend)
+{
+    (void)pUserData;
+    return ma_decoding_backend_init_memory_ex__libvorbis(pData, dataSize, pConfig, MA_TRUE, pAllocationCallbacks, ppBackend);
+}
+
 static void ma_decoding_backend_uninit__libvorbis(void* pUserData, ma_data_source* pBackend, const ma_allocation_callbacks* pAllocationCallbacks)
 {
     ma_libvorbis* pVorbis = (ma_libvorbis*)pBackend;
@@ -582,7 +3780,16 @@ static ma_decoding_backend_vtable ma_gDecodingBackendVTable_libvorbis =
     ma_decoding_backend_init__libvorbis,
     ma_decoding_backend_init_file__libvorbis,
     NULL, /* onInitFileW() */
-    NULL, /* onInitMemory() */
+    ma_decoding_backend_init_memory__libvorbis,
+    ma_decoding_backend_uninit__libvorbis
+};
+
+static ma_decoding_backend_vtable ma_gDecodingBackendVTable_libvorbis_lazy =
+{
+    ma_decoding_backend_init_lazy__libvorbis,
+    ma_decoding_backend_init_file_lazy__libvorbis,
+    NULL, /* onInitFileW() */
+    ma_decoding_backend_init_memory_lazy__libvorbis,
     ma_decoding_backend_uninit__libvorbis
 };
 
@@ -602,9 +3809,27 @@ MA_VORBIS_API ma_decoding_backend_vtable* ma_decoding_backend_libvorbis_get_vtab
     return ma_decoding_backend_libvorbis;
 }
 
+MA_VORBIS_API ma_result ma_decoder_config_set_libvorbis_backend_lazy(ma_decoder_config* pConfig)
+{
+    if (pConfig == NULL) {
+        return MA_INVALID_ARGS;
+    }
+
+    pConfig->ppCustomBackendVTables = &ma_decoding_backend_libvorbis_lazy;
+    pConfig->customBackendCount = 1;
+
+    return MA_SUCCESS;
+}
+
+MA_VORBIS_API ma_decoding_backend_vtable* ma_decoding_backend_libvorbis_lazy_get_vtable(void) {
+    return ma_decoding_backend_libvorbis_lazy;
+}
+
 ma_decoding_backend_vtable* ma_decoding_backend_libvorbis = &ma_gDecodingBackendVTable_libvorbis;
+ma_decoding_backend_vtable* ma_decoding_backend_libvorbis_lazy = &ma_gDecodingBackendVTable_libvorbis_lazy;
 #else
 ma_decoding_backend_vtable* ma_decoding_backend_libvorbis = NULL;
+ma_decoding_backend_vtable* ma_decoding_backend_libvorbis_lazy = NULL;
 #endif
 
 #endif /* miniaudio_libvorbis_c */
\ No newline at end of file
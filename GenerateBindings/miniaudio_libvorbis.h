@@ -43,6 +43,40 @@ extern "C" {
     #endif
 #endif
 
+typedef enum
+{
+    MA_LIBVORBIS_DATA_SOURCE_FLAG_PLANAR = 0x00010000   /* Set in the data source vtable flags. Planar-aware consumers can use ma_libvorbis_acquire_pcm_frames_planar() instead of reading interleaved. */
+} ma_libvorbis_data_source_flags;
+
+typedef struct
+{
+    ma_uint64 allocationCount;          /* Allocations made by libogg and libvorbis. */
+    ma_uint64 reallocationCount;
+    ma_uint64 freeCount;
+    ma_uint64 heapAllocationCount;      /* Allocations that actually went to the allocation callbacks, including arena chunks. */
+    size_t bytesInUse;
+    size_t peakBytesInUse;
+    ma_uint32 arenaChunkCount;
+    size_t arenaCapacityInBytes;
+    size_t arenaUsedInBytes;
+} ma_libvorbis_allocation_stats;
+
+typedef struct
+{
+    ma_uint64 pcmFrame;         /* PCM frame at which the page ends (its granule position, relative to the start of the stream). */
+    ma_uint64 byteOffset;       /* Offset of the page in the file. */
+} ma_libvorbis_seek_point;
+
+typedef struct
+{
+    ma_format format;                       /* f32 or s16. Anything else decodes to f32. Set to the actual output format on return. */
+    ma_uint32 channels;                     /* Output only. */
+    ma_uint32 sampleRate;                   /* Output only. */
+    ma_resource_manager* pResourceManager;  /* Segments are decoded as custom jobs on this resource manager's job threads. Can be null to decode on the calling thread only. */
+    ma_uint32 threadCount;                  /* Including the calling thread. 0 uses every job thread. */
+    ma_uint32 segmentCount;                 /* 0 uses 4 segments per thread so a slow segment doesn't hold everything up. */
+} ma_libvorbis_decode_config;
+
 typedef struct
 {
     ma_data_source_base ds;     /* The libvorbis decoder can be used independently as a data source. */
@@ -50,23 +84,56 @@ typedef struct
     ma_seek_proc onSeek;
     ma_tell_proc onTell;
     void* pReadSeekTellUserData;
+    struct
+    {
+        const ma_uint8* pData;
+        size_t dataSize;
+        size_t currentReadPos;
+    } memory;                   /* Only used when initialized with ma_libvorbis_init_memory(). */
     ma_format format;           /* Will be either f32 or s16. */
+    ma_uint32 channels;         /* Cached from the first link when the stream is opened so reads don't need to query libvorbis. */
+    ma_uint32 sampleRate;
     /*OggVorbis_File**/ void* vf;   /* Typed as void* so we can avoid a dependency on opusfile in the header section. */
+    ma_allocation_callbacks allocationCallbacks;    /* Copied at init time. Used for the seek table which can be allocated long after init. */
+    ma_uint32 seekPointCountRequested;              /* From ma_decoding_backend_config.seekPointCount. When non-zero the seek table is built on the first seek. */
+    ma_uint32 seekPointCount;
+    ma_libvorbis_seek_point* pSeekPoints;           /* Sorted by pcmFrame. Null until the seek table has been built or loaded. */
+    ma_bool32 isOpenDeferred;                       /* Set by the *_lazy() init functions until the end of file scan has been done. */
+    void* pAllocator;                               /* Private. Routes libogg and libvorbis allocations through the allocation callbacks. */
 } ma_libvorbis;
 
 MA_VORBIS_API ma_result ma_libvorbis_init(ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 MA_VORBIS_API ma_result ma_libvorbis_init_file(const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
+MA_VORBIS_API ma_result ma_libvorbis_init_memory(const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
+MA_VORBIS_API ma_result ma_libvorbis_init_lazy(ma_read_proc onRead, ma_seek_proc onSeek, ma_tell_proc onTell, void* pReadSeekTellUserData, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);  /* Only parses the headers. The end of file scan is deferred until the first length query or seek. */
+MA_VORBIS_API ma_result ma_libvorbis_init_file_lazy(const char* pFilePath, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
+MA_VORBIS_API ma_result ma_libvorbis_init_memory_lazy(const void* pData, size_t dataSize, const ma_decoding_backend_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 MA_VORBIS_API void ma_libvorbis_uninit(ma_libvorbis* pVorbis, const ma_allocation_callbacks* pAllocationCallbacks);
 MA_VORBIS_API ma_result ma_libvorbis_read_pcm_frames(ma_libvorbis* pVorbis, void* pFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);
+MA_VORBIS_API ma_result ma_libvorbis_read_pcm_frames_planar(ma_libvorbis* pVorbis, float** ppFramesOut, ma_uint64 frameCount, ma_uint64* pFramesRead);
+MA_VORBIS_API ma_result ma_libvorbis_acquire_pcm_frames_planar(ma_libvorbis* pVorbis, float*** pppFramesOut, ma_uint64 frameCount, ma_uint64* pFramesAcquired);    /* Zero-copy. The returned channel pointers are owned by libvorbis and are only valid until the next call into pVorbis. */
 MA_VORBIS_API ma_result ma_libvorbis_seek_to_pcm_frame(ma_libvorbis* pVorbis, ma_uint64 frameIndex);
+MA_VORBIS_API ma_result ma_libvorbis_build_seek_table(ma_libvorbis* pVorbis, ma_uint32 seekPointCount);   /* Scans the whole stream once. Subsequent seeks start decoding from the nearest seek point instead of bisecting. */
+MA_VORBIS_API ma_result ma_libvorbis_save_seek_table(ma_libvorbis* pVorbis, void* pData, size_t dataCap, size_t* pDataSize);    /* Pass in NULL for pData to retrieve the required size. */
+MA_VORBIS_API ma_result ma_libvorbis_load_seek_table(ma_libvorbis* pVorbis, const void* pData, size_t dataSize);                /* Returns MA_INVALID_DATA if the blob was saved from a different stream. */
 MA_VORBIS_API ma_result ma_libvorbis_get_data_format(ma_libvorbis* pVorbis, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap);
 MA_VORBIS_API ma_result ma_libvorbis_get_cursor_in_pcm_frames(ma_libvorbis* pVorbis, ma_uint64* pCursor);
 MA_VORBIS_API ma_result ma_libvorbis_get_length_in_pcm_frames(ma_libvorbis* pVorbis, ma_uint64* pLength);
+MA_VORBIS_API ma_result ma_libvorbis_get_allocation_stats(ma_libvorbis* pVorbis, ma_libvorbis_allocation_stats* pStats);
+MA_VORBIS_API void ma_libvorbis_set_default_arena_size(size_t arenaSizeInBytes);    /* Applies to decoders initialized afterwards. 0 (the default) disables the arena. Otherwise allocations made while opening come out of chunks of at least this size. */
+MA_VORBIS_API void ma_libvorbis_set_setup_cache_enabled(ma_bool32 isEnabled);  /* Enabled by default. Decoders opening streams with identical setup headers share their unpacked codebooks. Already open decoders keep what they have. */
+MA_VORBIS_API ma_libvorbis_decode_config ma_libvorbis_decode_config_init(ma_format format, ma_resource_manager* pResourceManager);
+MA_VORBIS_API ma_result ma_libvorbis_decode_memory(const void* pData, size_t dataSize, ma_libvorbis_decode_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_uint64* pFrameCountOut, void** ppPCMFramesOut);   /* Decodes the whole stream, splitting it between threads when it has a single link. Output is identical to a serial decode. Free with ma_free(). */
+MA_VORBIS_API ma_result ma_libvorbis_decode_file(const char* pFilePath, ma_libvorbis_decode_config* pConfig, const ma_allocation_callbacks* pAllocationCallbacks, ma_uint64* pFrameCountOut, void** ppPCMFramesOut);
+MA_VORBIS_API ma_result ma_libvorbis_register_decoded_file(const char* pFilePath, ma_libvorbis_decode_config* pConfig, void** ppPCMFramesOut);   /* Decodes with ma_libvorbis_decode_file() and registers the result with pConfig->pResourceManager under pFilePath so MA_RESOURCE_MANAGER_DATA_SOURCE_FLAG_DECODE loads pick it up. Once unregistered, free *ppPCMFramesOut with ma_free() and the resource manager's allocation callbacks. */
 MA_VORBIS_API ma_result ma_decoder_config_set_libvorbis_backend(ma_decoder_config* pConfig);
 MA_VORBIS_API ma_decoding_backend_vtable* ma_decoding_backend_libvorbis_get_vtable(void);
+MA_VORBIS_API ma_result ma_decoder_config_set_libvorbis_backend_lazy(ma_decoder_config* pConfig);
+MA_VORBIS_API ma_decoding_backend_vtable* ma_decoding_backend_libvorbis_lazy_get_vtable(void);
 
 /* Decoding backend vtable. This is what you'll plug into ma_decoder_config.pBackendVTables. No user data required. */
 extern ma_decoding_backend_vtable* ma_decoding_backend_libvorbis;
+extern ma_decoding_backend_vtable* ma_decoding_backend_libvorbis_lazy;   /* Same as above, but opens with the ma_libvorbis_init_*_lazy() functions. */
 
 #ifdef __cplusplus
 }
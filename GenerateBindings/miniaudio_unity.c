@@ -0,0 +1,10 @@
+/*
+The whole library as a single translation unit, used instead of the separate files when MINIAUDIO_UNITY_BUILD is on (see
+CMakeLists.txt). This lets the compiler inline miniaudio's helpers, such as the data converter and the PCM frame
+utilities, into libvorbis and the ex extensions without needing link time optimization.
+
+miniaudio_avx2.c can't be included here since it's a second copy of miniaudio, so it stays a separate translation unit.
+*/
+#include "./miniaudio.c"
+#include "./miniaudio_libvorbis.c"
+#include "./miniaudio_ex.c"
@@ -41,10 +41,13 @@
 
 /* make it easy on the folks that want to compile the libs with a
    different malloc than stdlib */
+/* miniaudio-cs: can be overridden by defining all four before including. */
+#ifndef _ogg_malloc
 #define _ogg_malloc  malloc
 #define _ogg_calloc  calloc
 #define _ogg_realloc realloc
 #define _ogg_free    free
+#endif
 
 #if defined(_WIN32)
 
@@ -686,7 +689,7 @@ typedef struct {
   size_t (*read_func)  (void *ptr, size_t size, size_t nmemb, void *datasource);
   int    (*seek_func)  (void *datasource, ogg_int64_t offset, int whence);
   int    (*close_func) (void *datasource);
-  long   (*tell_func)  (void *datasource);
+  ogg_int64_t (*tell_func) (void *datasource);  /* long upstream, which is 32 bits on Windows */
 } ov_callbacks;
 
 #ifndef OV_EXCLUDE_STATIC_CALLBACKS
@@ -708,6 +711,18 @@ static int _ov_header_fseek_wrap(FILE *f,ogg_int64_t off,int whence){
 #endif
 }
 
+static ogg_int64_t _ov_header_ftell_wrap(FILE *f){
+  if(f==NULL)return(-1);
+
+#ifdef __MINGW32__
+  return ftello64(f);
+#elif defined (_WIN32)
+  return _ftelli64(f);
+#else
+  return ftell(f);
+#endif
+}
+
 /* These structs below (OV_CALLBACKS_DEFAULT etc) are defined here as
  * static data. That means that every file which includes this header
  * will get its own copy of these structs whether it uses them or
@@ -722,28 +737,28 @@ static ov_callbacks OV_CALLBACKS_DEFAULT = {
   (size_t (*)(void *, size_t, size_t, void *))  fread,
   (int (*)(void *, ogg_int64_t, int))           _ov_header_fseek_wrap,
   (int (*)(void *))                             fclose,
-  (long (*)(void *))                            ftell
+  (ogg_int64_t (*)(void *))                     _ov_header_ftell_wrap
 };
 
 static ov_callbacks OV_CALLBACKS_NOCLOSE = {
   (size_t (*)(void *, size_t, size_t, void *))  fread,
   (int (*)(void *, ogg_int64_t, int))           _ov_header_fseek_wrap,
   (int (*)(void *))                             NULL,
-  (long (*)(void *))                            ftell
+  (ogg_int64_t (*)(void *))                     _ov_header_ftell_wrap
 };
 
 static ov_callbacks OV_CALLBACKS_STREAMONLY = {
   (size_t (*)(void *, size_t, size_t, void *))  fread,
   (int (*)(void *, ogg_int64_t, int))           NULL,
   (int (*)(void *))                             fclose,
-  (long (*)(void *))                            NULL
+  (ogg_int64_t (*)(void *))                     NULL
 };
 
 static ov_callbacks OV_CALLBACKS_STREAMONLY_NOCLOSE = {
   (size_t (*)(void *, size_t, size_t, void *))  fread,
   (int (*)(void *, ogg_int64_t, int))           NULL,
   (int (*)(void *))                             NULL,
-  (long (*)(void *))                            NULL
+  (ogg_int64_t (*)(void *))                     NULL
 };
 
 #endif
@@ -816,6 +831,7 @@ extern double ov_time_total(OggVorbis_File *vf,int i);
 extern int ov_raw_seek(OggVorbis_File *vf,ogg_int64_t pos);
 extern int ov_pcm_seek(OggVorbis_File *vf,ogg_int64_t pos);
 extern int ov_pcm_seek_page(OggVorbis_File *vf,ogg_int64_t pos);
+extern int ov_pcm_seek_from_page(OggVorbis_File *vf,ogg_int64_t pagepos,ogg_int64_t pos);
 extern int ov_time_seek(OggVorbis_File *vf,double pos);
 extern int ov_time_seek_page(OggVorbis_File *vf,double pos);
 
@@ -5421,6 +5437,11 @@ typedef struct codec_setup_info {
                                 highly redundant structure, but
                                 improves clarity of program flow. */
   int         halfrate_flag; /* painless downsample for decode */
+
+  /* miniaudio-cs: when set, the mode, mapping, floor and residue params
+     and the fullbooks are borrowed from a shared setup and are released
+     through VORBIS_SETUP_RELEASE_HOOK instead of being freed here. */
+  void       *shared_setup;
 } codec_setup_info;
 
 extern vorbis_look_psy_global *_vp_global_look(vorbis_info *vi);
@@ -6987,6 +7008,18 @@ STIN void mdct_butterflies(mdct_lookup *init,
   int stages=init->log2n-5;
   int i,j;
 
+#ifdef VORBIS_MDCT_BUTTERFLY_HOOK
+  /* miniaudio-cs: lets the embedding code supply vectorized butterflies.
+     The first stage is the generic one with a trig stride of 4. */
+  if(--stages>0){
+    VORBIS_MDCT_BUTTERFLY_HOOK(T,x,points,4);
+  }
+
+  for(i=1;--stages>0;i++){
+    for(j=0;j<(1<<i);j++)
+      VORBIS_MDCT_BUTTERFLY_HOOK(T,x+(points>>i)*j,points>>i,4<<i);
+  }
+#else
   if(--stages>0){
     mdct_butterfly_first(T,x,points);
   }
@@ -6995,6 +7028,7 @@ STIN void mdct_butterflies(mdct_lookup *init,
     for(j=0;j<(1<<i);j++)
       mdct_butterfly_generic(T,x+(points>>i)*j,points>>i,4<<i);
   }
+#endif
 
   for(j=0;j<points;j+=32)
     mdct_butterfly_32(x+j);
@@ -9248,6 +9282,16 @@ int vorbis_synthesis_blockin(vorbis_dsp_state *v,vorbis_block *vb){
        to have to constantly shift *or* adjust memory usage.  Don't
        accept a new block until the old is shifted out */
 
+#ifdef VORBIS_OVERLAP_ADD_HOOK
+    /* miniaudio-cs: the embedding code can supply a vectorized version of
+       the overlap/add loops below. Each call computes
+       pcm[i]=pcm[i]*w[n-i-1] + p[i]*w[i] for i in [0,n). */
+#define VORBIS_OVERLAP_ADD(pcm,p,w,n) VORBIS_OVERLAP_ADD_HOOK(pcm,p,w,n)
+#else
+#define VORBIS_OVERLAP_ADD(pcm,p,w,n) \
+    for(i=0;i<(n);i++)pcm[i]=pcm[i]*w[(n)-i-1] +p[i]*w[i]
+#endif
+
     for(j=0;j<vi->channels;j++){
       /* the overlap/add section */
       if(v->lW){
@@ -9256,15 +9300,13 @@ int vorbis_synthesis_blockin(vorbis_dsp_state *v,vorbis_block *vb){
           const float *w=_vorbis_window_get(b->window[1]-hs);
           float *pcm=v->pcm[j]+prevCenter;
           float *p=vb->pcm[j];
-          for(i=0;i<n1;i++)
-            pcm[i]=pcm[i]*w[n1-i-1] + p[i]*w[i];
+          VORBIS_OVERLAP_ADD(pcm,p,w,n1);
         }else{
           /* large/small */
           const float *w=_vorbis_window_get(b->window[0]-hs);
           float *pcm=v->pcm[j]+prevCenter+n1/2-n0/2;
           float *p=vb->pcm[j];
-          for(i=0;i<n0;i++)
-            pcm[i]=pcm[i]*w[n0-i-1] +p[i]*w[i];
+          VORBIS_OVERLAP_ADD(pcm,p,w,n0);
         }
       }else{
         if(v->W){
@@ -9272,17 +9314,15 @@ int vorbis_synthesis_blockin(vorbis_dsp_state *v,vorbis_block *vb){
           const float *w=_vorbis_window_get(b->window[0]-hs);
           float *pcm=v->pcm[j]+prevCenter;
           float *p=vb->pcm[j]+n1/2-n0/2;
-          for(i=0;i<n0;i++)
-            pcm[i]=pcm[i]*w[n0-i-1] +p[i]*w[i];
-          for(;i<n1/2+n0/2;i++)
+          VORBIS_OVERLAP_ADD(pcm,p,w,n0);
+          for(i=n0;i<n1/2+n0/2;i++)
             pcm[i]=p[i];
         }else{
           /* small/small */
           const float *w=_vorbis_window_get(b->window[0]-hs);
           float *pcm=v->pcm[j]+prevCenter;
           float *p=vb->pcm[j];
-          for(i=0;i<n0;i++)
-            pcm[i]=pcm[i]*w[n0-i-1] +p[i]*w[i];
+          VORBIS_OVERLAP_ADD(pcm,p,w,n0);
         }
       }
 
@@ -9295,6 +9335,8 @@ int vorbis_synthesis_blockin(vorbis_dsp_state *v,vorbis_block *vb){
       }
     }
 
+#undef VORBIS_OVERLAP_ADD
+
     if(v->centerW)
       v->centerW=0;
     else
@@ -14318,6 +14360,14 @@ void vorbis_info_clear(vorbis_info *vi){
 
   if(ci){
 
+#ifdef VORBIS_SETUP_RELEASE_HOOK
+    if(ci->shared_setup){
+      VORBIS_SETUP_RELEASE_HOOK(ci->shared_setup);
+      ci->modes=ci->maps=ci->floors=ci->residues=ci->books=0;
+      ci->fullbooks=NULL;
+    }
+#endif
+
     for(i=0;i<ci->modes;i++)
       if(ci->mode_param[i])_ogg_free(ci->mode_param[i]);
 
@@ -14591,7 +14641,13 @@ int vorbis_synthesis_headerin(vorbis_info *vi,vorbis_comment *vc,ogg_packet *op)
           return(OV_EBADHEADER);
         }
 
+#ifdef VORBIS_UNPACK_BOOKS_HOOK
+        /* miniaudio-cs: lets the embedding code take over unpacking the
+           setup header, e.g. to share the codebooks between decoders. */
+        return(VORBIS_UNPACK_BOOKS_HOOK(vi,op,&opb));
+#else
         return(_vorbis_unpack_books(vi,&opb));
+#endif
 
       default:
         /* Not a valid vorbis header type */
@@ -15189,6 +15245,10 @@ static const float FLOOR1_fromdB_LOOKUP[256]={
 };
 
 static void render_line(int n, int x0,int x1,int y0,int y1,float *d){
+#ifdef VORBIS_RENDER_LINE_HOOK
+  /* miniaudio-cs: lets the embedding code supply a vectorized version. */
+  VORBIS_RENDER_LINE_HOOK(n,x0,x1,y0,y1,d,FLOOR1_fromdB_LOOKUP);
+#else
   int dy=y1-y0;
   int adx=x1-x0;
   int ady=abs(dy);
@@ -15215,6 +15275,7 @@ static void render_line(int n, int x0,int x1,int y0,int y1,float *d){
     }
     d[x]*=FLOOR1_fromdB_LOOKUP[y];
   }
+#endif
 }
 
 static void render_line0(int n, int x0,int x1,int y0,int y1,int *d){
@@ -17794,6 +17855,10 @@ static int mapping0_inverse(vorbis_block *vb,vorbis_info_mapping *l){
     float *pcmM=vb->pcm[info->coupling_mag[i]];
     float *pcmA=vb->pcm[info->coupling_ang[i]];
 
+#ifdef VORBIS_INVERSE_COUPLING_HOOK
+    /* miniaudio-cs: lets the embedding code supply a vectorized version. */
+    VORBIS_INVERSE_COUPLING_HOOK(pcmM,pcmA,n/2);
+#else
     for(j=0;j<n/2;j++){
       float mag=pcmM[j];
       float ang=pcmA[j];
@@ -17815,6 +17880,7 @@ static int mapping0_inverse(vorbis_block *vb,vorbis_info_mapping *l){
           pcmM[j]=mag-ang;
         }
     }
+#endif
   }
 
   /* compute and apply spectral envelope */
@@ -18285,6 +18351,28 @@ long vorbis_book_decodevs_add(codebook *book,float *a,oggpack_buffer *b,int n){
 
 /* decode vector / dim granularity gaurding is done in the upper layer */
 long vorbis_book_decodev_add(codebook *book,float *a,oggpack_buffer *b,int n){
+#ifdef VORBIS_RESIDUE_ADD_HOOK
+  /* miniaudio-cs: decodes the whole partition up front and lets the
+     embedding code do the adds in one vectorized pass. Entries decoded
+     before a failure are still added so the output matches the loop
+     below exactly. */
+  if(book->used_entries>0){
+    int step=(n+book->dim-1)/book->dim;
+    const float **t=alloca(sizeof(*t)*step);
+    int i;
+
+    for(i=0;i<step;i++){
+      long entry=decode_packed_entry_number(book,b);
+      if(entry==-1){
+        VORBIS_RESIDUE_ADD_HOOK(a,i*book->dim,t,book->dim);
+        return(-1);
+      }
+      t[i]=book->valuelist+entry*book->dim;
+    }
+    VORBIS_RESIDUE_ADD_HOOK(a,n,t,book->dim);
+  }
+  return(0);
+#else
   if(book->used_entries>0){
     int i,j,entry;
     float *t;
@@ -18298,6 +18386,7 @@ long vorbis_book_decodev_add(codebook *book,float *a,oggpack_buffer *b,int n){
     }
   }
   return(0);
+#endif
 }
 
 /* unlike the others, we guard against n not being an integer number
@@ -18331,6 +18420,32 @@ long vorbis_book_decodevv_add(codebook *book,float **a,long offset,int ch,
 
   long i,j,entry;
   int chptr=0;
+#ifdef VORBIS_RESIDUE_ADD_STEREO_HOOK
+  /* miniaudio-cs: same idea as in vorbis_book_decodev_add() for the common
+     stereo case. With an even dimension every entry starts on the left
+     channel, so the adds are a plain deinterleave. */
+  if(ch==2 && (book->dim&1)==0 && book->used_entries>0){
+    long start=offset/2;
+    long frames=(offset+n)/2-start;
+    long step;
+    const float **t;
+
+    if(frames<=0)return(0);
+    step=(frames*2+book->dim-1)/book->dim;
+    t=alloca(sizeof(*t)*step);
+
+    for(i=0;i<step;i++){
+      entry=decode_packed_entry_number(book,b);
+      if(entry==-1){
+        VORBIS_RESIDUE_ADD_STEREO_HOOK(a[0]+start,a[1]+start,i*(book->dim/2),t,book->dim);
+        return(-1);
+      }
+      t[i]=book->valuelist+entry*book->dim;
+    }
+    VORBIS_RESIDUE_ADD_STEREO_HOOK(a[0]+start,a[1]+start,frames,t,book->dim);
+    return(0);
+  }
+#endif
   if(book->used_entries>0){
     int m=(offset+n)/ch;
     for(i=offset/ch;i<m;){
@@ -20175,7 +20290,20 @@ static int _fetch_and_process_packet(OggVorbis_File *vf,
    fseek64 */
 static int _fseek64_wrap(FILE *f,ogg_int64_t off,int whence){
   if(f==NULL)return(-1);
-  return fseek(f,off,whence);
+#if defined(_WIN32)
+  return _fseeki64(f,off,whence);
+#else
+  return fseeko(f,(off_t)off,whence);
+#endif
+}
+
+static ogg_int64_t _ftell64_wrap(FILE *f){
+  if(f==NULL)return(-1);
+#if defined(_WIN32)
+  return _ftelli64(f);
+#else
+  return ftello(f);
+#endif
 }
 
 static int _ov_open1(void *f,OggVorbis_File *vf,const char *initial,
@@ -20305,7 +20433,7 @@ int ov_open(FILE *f,OggVorbis_File *vf,const char *initial,long ibytes){
     (size_t (*)(void *, size_t, size_t, void *))  fread,
     (int (*)(void *, ogg_int64_t, int))              _fseek64_wrap,
     (int (*)(void *))                             fclose,
-    (long (*)(void *))                            ftell
+    (ogg_int64_t (*)(void *))                     _ftell64_wrap
   };
 
   return ov_open_callbacks((void *)f, vf, initial, ibytes, callbacks);
@@ -20375,7 +20503,7 @@ int ov_test(FILE *f,OggVorbis_File *vf,const char *initial,long ibytes){
     (size_t (*)(void *, size_t, size_t, void *))  fread,
     (int (*)(void *, ogg_int64_t, int))              _fseek64_wrap,
     (int (*)(void *))                             fclose,
-    (long (*)(void *))                            ftell
+    (ogg_int64_t (*)(void *))                     _ftell64_wrap
   };
 
   return ov_test_callbacks((void *)f, vf, initial, ibytes, callbacks);
@@ -20975,10 +21103,12 @@ int ov_pcm_seek_page(OggVorbis_File *vf,ogg_int64_t pos){
 /* seek to a sample offset relative to the decompressed pcm stream
    returns zero on success, nonzero on failure */
 
-int ov_pcm_seek(OggVorbis_File *vf,ogg_int64_t pos){
+/* miniaudio-cs: the part of ov_pcm_seek() that runs after the page seek
+   has been split out so that it can also be used after ov_raw_seek() to a
+   page taken from a seek table (see ov_pcm_seek_from_page()). */
+static int _ov_pcm_seek_from_current_page(OggVorbis_File *vf,ogg_int64_t pos){
   int thisblock,lastblock=0;
-  int ret=ov_pcm_seek_page(vf,pos);
-  if(ret<0)return(ret);
+  int ret;
   if((ret=_make_decode_ready(vf)))return ret;
 
   /* discard leading packets we don't need for the lapping of the
@@ -21073,6 +21203,27 @@ int ov_pcm_seek(OggVorbis_File *vf,ogg_int64_t pos){
   return 0;
 }
 
+int ov_pcm_seek(OggVorbis_File *vf,ogg_int64_t pos){
+  int ret=ov_pcm_seek_page(vf,pos);
+  if(ret<0)return(ret);
+  return _ov_pcm_seek_from_current_page(vf,pos);
+}
+
+/* miniaudio-cs: sample accurate seek starting from a known page instead of
+   bisecting. pagepos must be the offset of a page whose granule position is
+   at or before pos. */
+int ov_pcm_seek_from_page(OggVorbis_File *vf,ogg_int64_t pagepos,ogg_int64_t pos){
+  int ret;
+  if(vf->ready_state<OPENED)return(OV_EINVAL);
+  if(!vf->seekable)return(OV_ENOSEEK);
+  if(pos<0 || pos>ov_pcm_total(vf,-1))return(OV_EINVAL);
+
+  ret=ov_raw_seek(vf,pagepos);
+  if(ret<0)return(ret);
+  if(vf->pcm_offset<0 || vf->pcm_offset>pos)return(OV_EFAULT);
+  return _ov_pcm_seek_from_current_page(vf,pos);
+}
+
 /* seek to a playback time relative to the decompressed pcm stream
    returns zero on success, nonzero on failure */
 int ov_time_seek(OggVorbis_File *vf,double seconds){
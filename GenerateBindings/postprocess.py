@@ -0,0 +1,189 @@
+"""
+Rewrites the ClangSharp output into source generated LibraryImport stubs. Run it after ClangSharpPInvokeGenerator:
+
+    python3 postprocess.py
+
+Every [DllImport] becomes [LibraryImport] with [UnmanagedCallConv] for cdecl, and the functions listed in
+suppress_gc_transition.txt also get [SuppressGCTransition]. C variadic functions such as ma_log_postf are removed, since
+the source generator can't call them; format the string in C# and pass it to the non-variadic version. It can be run again
+on its own output, e.g. after editing the list.
+
+It also writes MiniaudioUtf8Overloads.cs, with an overload of every function that takes a const char* where the parameter
+is an ma_utf8_string instead, which a string, UTF-8 bytes or an sbyte* convert to. They convert through ma_utf8_buffer
+(MiniaudioUtf8.cs), which doesn't allocate.
+"""
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+BINDINGS_PATH = os.path.join(ROOT, "..", "Miniaudio-CS", "Miniaudio.cs")
+UTF8_OVERLOADS_PATH = os.path.join(ROOT, "..", "Miniaudio-CS", "MiniaudioUtf8Overloads.cs")
+SUPPRESS_GC_TRANSITION_PATH = os.path.join(ROOT, "suppress_gc_transition.txt")
+
+DLLIMPORT = re.compile(
+    r'^(?P<indent>[ \t]*)\[DllImport\("(?P<library>[^"]+)", CallingConvention = CallingConvention\.Cdecl, '
+    r'EntryPoint = "(?P<entry>[^"]+)", ExactSpelling = true\)\]\r?\n', re.MULTILINE)
+LIBRARYIMPORT = re.compile(
+    r'^(?P<indent>[ \t]*)\[LibraryImport\("(?P<library>[^"]+)", EntryPoint = "(?P<entry>[^"]+)"\)\]\r?\n'
+    r'[ \t]*\[UnmanagedCallConv\(CallConvs = new\[\] \{ typeof\(CallConvCdecl\) \}\)\]\r?\n'
+    r'(?:[ \t]*\[SuppressGCTransition\]\r?\n)?', re.MULTILINE)
+EXTERN = re.compile(r'^([ \t]*)public static extern ', re.MULTILINE)
+VARARGS = re.compile(
+    r'^(?:[ \t]*\[[^\r\n]*\]\r?\n)+[ \t]*public static (?:extern|partial) [^\r\n]* (?P<name>\w+)\([^\r\n]*, __arglist\);\r?\n(?:\r?\n)?',
+    re.MULTILINE)
+ASSEMBLY_ATTRIBUTE = "[assembly: DisableRuntimeMarshalling]"
+PARTIAL = re.compile(r'^[ \t]*public static partial (?P<type>[^\r\n(]+?) (?P<name>\w+)\((?P<params>[^\r\n]*)\);', re.MULTILINE)
+CONST_CHAR_PARAM = re.compile(r'^\[NativeTypeName\("const char \*"\)\] sbyte\* (?P<name>@?\w+)$')
+PARAM_NAME = re.compile(r'(@?\w+)$')
+
+# printf style format strings stay sbyte* only; a managed string would be formatted by C.
+UTF8_EXCLUDED_PARAMS = {"pFormat"}
+
+
+def read_suppress_gc_transition():
+    names = set()
+    with open(SUPPRESS_GC_TRANSITION_PATH, "r", encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if line:
+                names.add(line)
+    return names
+
+
+def split_params(params):
+    """Splits a parameter list on the commas that aren't inside a function pointer type or an attribute."""
+    result = []
+    depth = 0
+    start = 0
+    for i, c in enumerate(params):
+        if c in "<[(":
+            depth += 1
+        elif c in ">])":
+            depth -= 1
+        elif c == "," and depth == 0:
+            result.append(params[start:i].strip())
+            start = i + 1
+    if params.strip():
+        result.append(params[start:].strip())
+    return result
+
+
+def generate_utf8_overload(lines, return_type, name, params, converted):
+    signature = []
+    arguments = []
+    for param in params:
+        match = CONST_CHAR_PARAM.match(param)
+        if match and match.group("name") in converted:
+            signature.append("ma_utf8_string {0}".format(match.group("name")))
+            arguments.append("(sbyte*){0}Bytes".format(match.group("name").lstrip("@")))
+        else:
+            signature.append(param)
+            arguments.append(PARAM_NAME.search(param).group(1))
+
+    lines.append("        [SkipLocalsInit]")
+    lines.append("        public static {0} {1}({2})".format(return_type, name, ", ".join(signature)))
+    lines.append("        {")
+    for param in converted:
+        lines.append("            using ma_utf8_buffer {0}Utf8 = new ma_utf8_buffer({1}, stackalloc byte[ma_utf8_buffer.StackBufferSize]);".format(param.lstrip("@"), param))
+
+    indent = "            "
+    for param in converted:
+        lines.append("{0}fixed (byte* {1}Bytes = {1}Utf8)".format(indent, param.lstrip("@")))
+    lines.append(indent + "{")
+    call = "{0}({1});".format(name, ", ".join(arguments))
+    lines.append("{0}    {1}{2}".format(indent, "" if return_type == "void" else "return ", call))
+    lines.append(indent + "}")
+    lines.append("        }")
+    lines.append("")
+
+
+def generate_utf8_overloads(text, newline):
+    lines = [
+        "// Generated by GenerateBindings/postprocess.py from Miniaudio.cs. Don't edit it by hand.",
+        "using System.Runtime.CompilerServices;",
+        "",
+        "namespace Miniaudio",
+        "{",
+        "    /// <summary>",
+        "    /// Overloads of the functions that take a const char*, with an <see cref=\"ma_utf8_string\" /> that a string or",
+        "    /// UTF-8 bytes convert to. The text is converted into a null terminated UTF-8 <see cref=\"ma_utf8_buffer\" /> on",
+        "    /// the stack, so there's no heap allocation, and unlike Marshal.StringToHGlobalAnsi() nothing is lost on paths",
+        "    /// outside the ANSI code page. A null or default argument still calls the sbyte* overload.",
+        "    /// </summary>",
+        "    public static unsafe partial class ma",
+        "    {",
+    ]
+    count = 0
+    for match in PARTIAL.finditer(text):
+        params = split_params(match.group("params"))
+        converted = []
+        for param in params:
+            param_match = CONST_CHAR_PARAM.match(param)
+            if param_match and param_match.group("name") not in UTF8_EXCLUDED_PARAMS:
+                converted.append(param_match.group("name"))
+        if not converted:
+            continue
+        generate_utf8_overload(lines, match.group("type"), match.group("name"), params, converted)
+        count += 1
+
+    lines.pop()
+    lines.append("    }")
+    lines.append("}")
+    lines.append("")
+
+    with open(UTF8_OVERLOADS_PATH, "w", encoding="utf-8", newline="") as f:
+        f.write(newline.join(lines))
+
+    return count
+
+
+def main():
+    suppressed = read_suppress_gc_transition()
+
+    with open(BINDINGS_PATH, "r", encoding="utf-8", newline="") as f:
+        text = f.read()
+
+    newline = "\r\n" if "\r\n" in text else "\n"
+    found = set()
+
+    def replace(match):
+        indent = match.group("indent")
+        entry = match.group("entry")
+        lines = [
+            '{0}[LibraryImport("{1}", EntryPoint = "{2}")]'.format(indent, match.group("library"), entry),
+            "{0}[UnmanagedCallConv(CallConvs = new[] {{ typeof(CallConvCdecl) }})]".format(indent),
+        ]
+        if entry in suppressed:
+            lines.append("{0}[SuppressGCTransition]".format(indent))
+            found.add(entry)
+        return newline.join(lines) + newline
+
+    varargs = [match.group("name") for match in VARARGS.finditer(text)]
+    text = VARARGS.sub("", text)
+
+    text = DLLIMPORT.sub(replace, text)
+    text = LIBRARYIMPORT.sub(replace, text)
+    text = EXTERN.sub(r"\1public static partial ", text)
+
+    # The structs are all blittable, so this only stops the generator from asking for marshallers for them.
+    if ASSEMBLY_ATTRIBUTE not in text:
+        text = text.replace(newline + "namespace Miniaudio", newline + ASSEMBLY_ATTRIBUTE + newline + newline + "namespace Miniaudio", 1)
+
+    missing = sorted(suppressed - found)
+    if missing:
+        sys.stderr.write("Not in the bindings: {0}\n".format(", ".join(missing)))
+        return 1
+
+    with open(BINDINGS_PATH, "w", encoding="utf-8", newline="") as f:
+        f.write(text)
+
+    print("{0} functions, {1} with SuppressGCTransition".format(text.count("[LibraryImport("), len(found)))
+    print("{0} functions with UTF-8 overloads".format(generate_utf8_overloads(text, newline)))
+    if varargs:
+        print("Removed variadic: {0}".format(", ".join(varargs)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,113 @@
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+
+namespace Miniaudio.AotSample
+{
+    /// <summary>
+    /// Startup and per call cost of miniaudio in a NativeAOT executable, linked statically (MiniaudioStaticLink=true,
+    /// the default for this project) or loading libminiaudio.so at runtime. Results are written to stdout as JSON:
+    ///
+    ///     firstCallUs       - The first call into miniaudio. With the shared library this is where it's loaded and
+    ///                         the symbol is resolved.
+    ///     engineInitUs      - ma_engine_init() without a device.
+    ///     versionNs         - ma_version(), a call with the GC transition.
+    ///     engineGetTimeNs   - ma_engine_get_time_in_pcm_frames(), which skips the GC transition.
+    ///     soundGetVolumeNs  - ma_sound_get_volume() on a sound group, which skips the GC transition.
+    ///
+    /// With --startup it exits after the first call, for timing the whole process from outside, e.g. with hyperfine.
+    /// </summary>
+    public static unsafe class Program
+    {
+        private const int CallCount = 10_000_000;
+
+#if MINIAUDIO_STATIC
+        private const string Linkage = "static";
+#else
+        private const string Linkage = "dynamic";
+#endif
+
+        public static int Main(string[] args)
+        {
+            uint major;
+            uint minor;
+            uint revision;
+
+            long start = Stopwatch.GetTimestamp();
+            ma.version(&major, &minor, &revision);
+            double firstCallUs = Stopwatch.GetElapsedTime(start).TotalMicroseconds;
+
+            if (args.Length > 0 && args[0] == "--startup")
+            {
+                Console.WriteLine($"{{ \"linkage\": \"{Linkage}\", \"firstCallUs\": {firstCallUs:F1} }}");
+                return 0;
+            }
+
+            ma_engine* engine = (ma_engine*)NativeMemory.Alloc((nuint)sizeof(ma_engine));
+            ma_sound* group = (ma_sound*)NativeMemory.Alloc((nuint)sizeof(ma_sound));
+
+            ma_engine_config config = ma.engine_config_init();
+            config.noDevice = 1;
+            config.channels = 2;
+            config.sampleRate = 48000;
+
+            start = Stopwatch.GetTimestamp();
+            ma_result result = ma.engine_init(&config, engine);
+            double engineInitUs = Stopwatch.GetElapsedTime(start).TotalMicroseconds;
+
+            if (result != ma_result.MA_SUCCESS)
+            {
+                Console.Error.WriteLine($"Failed to initialize engine: {result}");
+                return 1;
+            }
+
+            result = ma.sound_group_init(engine, 0, null, group);
+            if (result != ma_result.MA_SUCCESS)
+            {
+                Console.Error.WriteLine($"Failed to initialize sound group: {result}");
+                ma.engine_uninit(engine);
+                return 1;
+            }
+
+            start = Stopwatch.GetTimestamp();
+            for (int i = 0; i < CallCount; i++)
+            {
+                ma.version(&major, &minor, &revision);
+            }
+            double versionNs = Stopwatch.GetElapsedTime(start).TotalNanoseconds / CallCount;
+
+            ulong time = 0;
+            start = Stopwatch.GetTimestamp();
+            for (int i = 0; i < CallCount; i++)
+            {
+                time += ma.engine_get_time_in_pcm_frames(engine);
+            }
+            double engineGetTimeNs = Stopwatch.GetElapsedTime(start).TotalNanoseconds / CallCount;
+
+            float volume = 0;
+            start = Stopwatch.GetTimestamp();
+            for (int i = 0; i < CallCount; i++)
+            {
+                volume += ma.sound_get_volume(group);
+            }
+            double soundGetVolumeNs = Stopwatch.GetElapsedTime(start).TotalNanoseconds / CallCount;
+
+            ma.sound_group_uninit(group);
+            ma.engine_uninit(engine);
+            NativeMemory.Free(group);
+            NativeMemory.Free(engine);
+
+            Console.WriteLine("{");
+            Console.WriteLine($"  \"linkage\": \"{Linkage}\",");
+            Console.WriteLine($"  \"miniaudio\": \"{major}.{minor}.{revision}\",");
+            Console.WriteLine($"  \"firstCallUs\": {firstCallUs:F1},");
+            Console.WriteLine($"  \"engineInitUs\": {engineInitUs:F1},");
+            Console.WriteLine($"  \"versionNs\": {versionNs:F2},");
+            Console.WriteLine($"  \"engineGetTimeNs\": {engineGetTimeNs:F2},");
+            Console.WriteLine($"  \"soundGetVolumeNs\": {soundGetVolumeNs:F2},");
+            Console.WriteLine($"  \"checksum\": {time + (ulong)volume}");
+            Console.WriteLine("}");
+
+            return 0;
+        }
+    }
+}
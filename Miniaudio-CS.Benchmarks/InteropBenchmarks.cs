@@ -0,0 +1,184 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Configs;
+
+namespace Miniaudio.Benchmarks
+{
+    /// <summary>
+    /// Per call cost of the hot getters and setters listed in GenerateBindings/suppress_gc_transition.txt. Each one is
+    /// called three ways: through a classic [DllImport] as the bindings used to be generated, through [LibraryImport]
+    /// with the GC transition, and through <see cref="ma" />, which skips the transition. The engine has no device so
+    /// nothing else is touching it.
+    /// </summary>
+    [MemoryDiagnoser]
+    [CategoriesColumn]
+    [GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory)]
+    public unsafe partial class InteropBenchmarks
+    {
+        private const int CallsPerInvoke = 1000;
+
+        private ma_engine* engine;
+        private ma_sound* group;
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            engine = (ma_engine*)NativeMemory.Alloc((nuint)sizeof(ma_engine));
+            group = (ma_sound*)NativeMemory.Alloc((nuint)sizeof(ma_sound));
+
+            ma_engine_config config = ma.engine_config_init();
+            config.noDevice = 1;
+            config.channels = 2;
+            config.sampleRate = 48000;
+
+            if (ma.engine_init(&config, engine) != ma_result.MA_SUCCESS)
+            {
+                throw new InvalidOperationException("Failed to initialize engine");
+            }
+
+            // A sound group is a sound without a data source, which is all these functions need.
+            if (ma.sound_group_init(engine, 0, null, group) != ma_result.MA_SUCCESS)
+            {
+                throw new InvalidOperationException("Failed to initialize sound group");
+            }
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            ma.sound_group_uninit(group);
+            ma.engine_uninit(engine);
+            NativeMemory.Free(group);
+            NativeMemory.Free(engine);
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke, Baseline = true)]
+        [BenchmarkCategory("engine_get_time_in_pcm_frames")]
+        public ulong GetTime_DllImport()
+        {
+            ulong time = 0;
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                time += Classic.engine_get_time_in_pcm_frames(engine);
+            }
+
+            return time;
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke)]
+        [BenchmarkCategory("engine_get_time_in_pcm_frames")]
+        public ulong GetTime_LibraryImport()
+        {
+            ulong time = 0;
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                time += Transition.engine_get_time_in_pcm_frames(engine);
+            }
+
+            return time;
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke)]
+        [BenchmarkCategory("engine_get_time_in_pcm_frames")]
+        public ulong GetTime_SuppressGCTransition()
+        {
+            ulong time = 0;
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                time += ma.engine_get_time_in_pcm_frames(engine);
+            }
+
+            return time;
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke, Baseline = true)]
+        [BenchmarkCategory("sound_set_volume")]
+        public void SetVolume_DllImport()
+        {
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                Classic.sound_set_volume(group, 0.5f);
+            }
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke)]
+        [BenchmarkCategory("sound_set_volume")]
+        public void SetVolume_LibraryImport()
+        {
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                Transition.sound_set_volume(group, 0.5f);
+            }
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke)]
+        [BenchmarkCategory("sound_set_volume")]
+        public void SetVolume_SuppressGCTransition()
+        {
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                ma.sound_set_volume(group, 0.5f);
+            }
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke, Baseline = true)]
+        [BenchmarkCategory("sound_set_pitch")]
+        public void SetPitch_DllImport()
+        {
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                Classic.sound_set_pitch(group, 1.0f + i * 0.0001f);
+            }
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke)]
+        [BenchmarkCategory("sound_set_pitch")]
+        public void SetPitch_LibraryImport()
+        {
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                Transition.sound_set_pitch(group, 1.0f + i * 0.0001f);
+            }
+        }
+
+        [Benchmark(OperationsPerInvoke = CallsPerInvoke)]
+        [BenchmarkCategory("sound_set_pitch")]
+        public void SetPitch_SuppressGCTransition()
+        {
+            for (int i = 0; i < CallsPerInvoke; i++)
+            {
+                ma.sound_set_pitch(group, 1.0f + i * 0.0001f);
+            }
+        }
+
+        /// <summary>The bindings as ClangSharp generates them, before postprocess.py.</summary>
+        private static class Classic
+        {
+            [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_time_in_pcm_frames", ExactSpelling = true)]
+            public static extern ulong engine_get_time_in_pcm_frames(ma_engine* pEngine);
+
+            [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_volume", ExactSpelling = true)]
+            public static extern void sound_set_volume(ma_sound* pSound, float volume);
+
+            [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_pitch", ExactSpelling = true)]
+            public static extern void sound_set_pitch(ma_sound* pSound, float pitch);
+        }
+
+        /// <summary>The same functions through LibraryImport but without [SuppressGCTransition].</summary>
+        private static partial class Transition
+        {
+            [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_time_in_pcm_frames")]
+            [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+            public static partial ulong engine_get_time_in_pcm_frames(ma_engine* pEngine);
+
+            [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_volume")]
+            [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+            public static partial void sound_set_volume(ma_sound* pSound, float volume);
+
+            [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_pitch")]
+            [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+            public static partial void sound_set_pitch(ma_sound* pSound, float pitch);
+        }
+    }
+}
@@ -0,0 +1,119 @@
+using System.Runtime.InteropServices;
+using System.Text;
+using BenchmarkDotNet.Attributes;
+
+namespace Miniaudio.Benchmarks
+{
+    /// <summary>
+    /// Registers and unregisters a set of keysounds by name, the way a chart's sounds are loaded and released, through
+    /// the ma_utf8_string overloads with a string or UTF-8 bytes and through the byte[] a caller had to make before. The
+    /// data is registered as encoded so nothing is decoded. Miniaudio-CS.Tests checks that the overloads don't allocate.
+    /// </summary>
+    [MemoryDiagnoser]
+    public unsafe class Utf8PathBenchmarks
+    {
+        private const int KeysoundCount = 10000;
+        private const int NativeSyncHeadroom = 4096;
+
+        private ma_resource_manager* resourceManager;
+        private void* data;
+        private string[] names = Array.Empty<string>();
+        private byte[][] utf8Names = Array.Empty<byte[]>();
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            // Miniaudio.cs has the Windows layout, where ma_mutex and ma_semaphore are handles. The pthread ones are bigger.
+            resourceManager = (ma_resource_manager*)NativeMemory.Alloc((nuint)sizeof(ma_resource_manager) + NativeSyncHeadroom);
+            data = NativeMemory.AllocZeroed(64);
+
+            ma_resource_manager_config config = ma.resource_manager_config_init();
+            if (ma.resource_manager_init(&config, resourceManager) != ma_result.MA_SUCCESS)
+            {
+                throw new InvalidOperationException("Failed to initialize resource manager");
+            }
+
+            names = new string[KeysoundCount];
+            utf8Names = new byte[KeysoundCount][];
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                names[i] = $"keysounds/キー{i:D5}.ogg";
+                utf8Names[i] = Encoding.UTF8.GetBytes(names[i]);
+            }
+
+            int failures = Register_String() + Register_Utf8Span();
+            if (failures != 0)
+            {
+                throw new InvalidOperationException($"{failures} registrations failed");
+            }
+        }
+
+        [GlobalCleanup]
+        public void Cleanup()
+        {
+            ma.resource_manager_uninit(resourceManager);
+            NativeMemory.Free(resourceManager);
+            NativeMemory.Free(data);
+        }
+
+        [Benchmark(OperationsPerInvoke = KeysoundCount, Baseline = true)]
+        public int Register_EncodingGetBytes()
+        {
+            int failures = 0;
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                fixed (byte* pName = Encoding.UTF8.GetBytes(names[i] + "\0"))
+                {
+                    failures += ma.resource_manager_register_encoded_data(resourceManager, (sbyte*)pName, data, 64) != ma_result.MA_SUCCESS ? 1 : 0;
+                }
+            }
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                fixed (byte* pName = Encoding.UTF8.GetBytes(names[i] + "\0"))
+                {
+                    failures += ma.resource_manager_unregister_data(resourceManager, (sbyte*)pName) != ma_result.MA_SUCCESS ? 1 : 0;
+                }
+            }
+
+            return failures;
+        }
+
+        [Benchmark(OperationsPerInvoke = KeysoundCount)]
+        public int Register_String()
+        {
+            int failures = 0;
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_register_encoded_data(resourceManager, names[i], data, 64) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_unregister_data(resourceManager, names[i]) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            return failures;
+        }
+
+        [Benchmark(OperationsPerInvoke = KeysoundCount)]
+        public int Register_Utf8Span()
+        {
+            int failures = 0;
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_register_encoded_data(resourceManager, utf8Names[i], data, 64) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_unregister_data(resourceManager, utf8Names[i]) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            return failures;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+namespace Miniaudio.Tests
+{
+    /// <summary>
+    /// Checks on the managed side of the bindings. It's a console app so it doesn't need a test framework package, and
+    /// it exits with a non-zero code if any check fails. It loads the native library from native/ like the benchmarks:
+    ///
+    ///     dotnet run -c Release --project Miniaudio-CS.Tests
+    /// </summary>
+    public static class Program
+    {
+        public static int Main(string[] args)
+        {
+            (string Name, Action Run)[] tests =
+            {
+                ("utf8_null_and_default_pass_null_pointers", Utf8Tests.NullAndDefaultPassNullPointers),
+                ("utf8_string_converts_to_terminated_utf8", Utf8Tests.StringConvertsToTerminatedUtf8),
+                ("utf8_long_string_uses_array_pool", Utf8Tests.LongStringUsesArrayPool),
+                ("utf8_terminated_bytes_are_used_in_place", Utf8Tests.TerminatedBytesAreUsedInPlace),
+                ("utf8_keysound_registration_does_not_allocate", Utf8Tests.KeysoundRegistrationDoesNotAllocate),
+                ("span_data_source_read_round_trips", SpanTests.DataSourceReadRoundTrips),
+                ("span_pcm_rb_scopes_round_trip", SpanTests.PcmRbScopesRoundTrip),
+                ("span_pcm_rb_partial_write_commits_written_frames", SpanTests.PcmRbPartialWriteCommitsWrittenFrames),
+                ("span_audio_buffer_partial_unmap_moves_cursor", SpanTests.AudioBufferPartialUnmapMovesCursor),
+                ("time_stretch_output_length_matches_tempo_at_end", TimeStretchTests.OutputLengthMatchesTempoAtEnd),
+            };
+
+            int failures = 0;
+            int skipped = 0;
+
+            foreach ((string name, Action run) in tests)
+            {
+                try
+                {
+                    run();
+                    Console.WriteLine($"PASS {name}");
+                }
+                catch (EntryPointNotFoundException e)
+                {
+                    // The prebuilt libraries in native/ are upstream miniaudio. CI runs against the one it just built.
+                    skipped++;
+                    Console.WriteLine($"SKIP {name}: {e.Message}");
+                }
+                catch (Exception e)
+                {
+                    failures++;
+                    Console.WriteLine($"FAIL {name}: {e.Message}");
+                }
+            }
+
+            Console.WriteLine($"{tests.Length - failures - skipped}/{tests.Length} passed, {skipped} skipped");
+
+            return failures == 0 ? 0 : 1;
+        }
+
+        internal static void Check(bool condition, string message)
+        {
+            if (!condition)
+            {
+                throw new InvalidOperationException(message);
+            }
+        }
+    }
+}
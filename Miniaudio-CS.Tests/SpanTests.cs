@@ -0,0 +1,209 @@
+using System.Runtime.InteropServices;
+
+namespace Miniaudio.Tests
+{
+    /// <summary>
+    /// The Span overloads and the pcm_rb and audio_buffer scopes from MiniaudioSpan.cs.
+    /// </summary>
+    internal static unsafe class SpanTests
+    {
+        private const uint Channels = 2;
+        private const uint FrameCount = 1000;
+        private const int ChunkFrames = 300;
+
+        private delegate void AudioBufferTest(ma_audio_buffer* audioBuffer);
+
+        private delegate void PcmRbTest(ma_pcm_rb* pcmRb);
+
+        /// <summary>
+        /// Reads an ma_audio_buffer back in chunks that don't divide it, through the float overload, and compares it with
+        /// the source. The short overload has to refuse the f32 buffer.
+        /// </summary>
+        public static void DataSourceReadRoundTrips()
+        {
+            float[] source = MakeFrames(FrameCount);
+            float[] frames = new float[FrameCount * Channels];
+
+            WithAudioBuffer(source, audioBuffer =>
+            {
+                ulong totalFramesRead = 0;
+
+                for (;;)
+                {
+                    Span<float> chunk = frames.AsSpan((int)(totalFramesRead * Channels), (int)Math.Min(ChunkFrames * Channels, (FrameCount - totalFramesRead) * Channels));
+                    ma_result result = ma.data_source_read_pcm_frames(audioBuffer, chunk, out ulong framesRead);
+                    totalFramesRead += framesRead;
+
+                    if (result != ma_result.MA_SUCCESS || framesRead == 0 || totalFramesRead == FrameCount)
+                    {
+                        break;
+                    }
+                }
+
+                Program.Check(totalFramesRead == FrameCount, $"Read {totalFramesRead} of {FrameCount} frames");
+                Program.Check(frames.AsSpan().SequenceEqual(source), "The frames read back don't match the source");
+
+                Program.Check(ma.data_source_read_pcm_frames(audioBuffer, new short[Channels], out ulong shortFramesRead) == ma_result.MA_INVALID_ARGS,
+                    "Reading an f32 buffer into a Span<short> didn't return MA_INVALID_ARGS");
+                Program.Check(shortFramesRead == 0, "A refused read reported frames");
+            });
+        }
+
+        /// <summary>
+        /// Writes frames through a write scope and reads them back through a read scope.
+        /// </summary>
+        public static void PcmRbScopesRoundTrip()
+        {
+            float[] source = MakeFrames(ChunkFrames);
+
+            WithPcmRb(pcmRb =>
+            {
+                using (ma_pcm_rb_write_scope scope = ma.pcm_rb_acquire_write(pcmRb, ChunkFrames))
+                {
+                    Program.Check(scope.Result == ma_result.MA_SUCCESS && scope.FrameCount == ChunkFrames, "Failed to acquire frames for writing");
+                    source.CopyTo(scope.AsSpan<float>());
+                }
+
+                using (ma_pcm_rb_read_scope scope = ma.pcm_rb_acquire_read(pcmRb, ChunkFrames))
+                {
+                    Program.Check(scope.Result == ma_result.MA_SUCCESS && scope.FrameCount == ChunkFrames, "Failed to acquire frames for reading");
+                    Program.Check(scope.AsSpan<float>().SequenceEqual(source), "The frames read back don't match the ones written");
+                }
+
+                Program.Check(ma.pcm_rb_available_read(pcmRb) == 0, "Disposing the read scope didn't commit every frame");
+            });
+        }
+
+        /// <summary>
+        /// A partial write commits only what's passed to Commit(), and disposing the scope afterwards doesn't commit the
+        /// rest. A scope that's disposed without Commit() still commits every frame it acquired.
+        /// </summary>
+        public static void PcmRbPartialWriteCommitsWrittenFrames()
+        {
+            const uint Written = 100;
+
+            WithPcmRb(pcmRb =>
+            {
+                using (ma_pcm_rb_write_scope scope = ma.pcm_rb_acquire_write(pcmRb, ChunkFrames))
+                {
+                    scope.AsSpan<float>().Slice(0, (int)(Written * Channels)).Fill(0.5f);
+                    Program.Check(scope.Commit(Written) == ma_result.MA_SUCCESS, "Commit() failed");
+                    Program.Check(scope.Commit(Written) == ma_result.MA_INVALID_OPERATION, "A second Commit() didn't return MA_INVALID_OPERATION");
+                }
+
+                uint available = ma.pcm_rb_available_read(pcmRb);
+                Program.Check(available == Written, $"A partial write committed {available} frames, expected {Written}");
+
+                using (ma_pcm_rb_read_scope scope = ma.pcm_rb_acquire_read(pcmRb, Written))
+                {
+                    Program.Check(scope.Commit(Written + 1) == ma_result.MA_INVALID_ARGS, "Committing more than was acquired didn't return MA_INVALID_ARGS");
+                    Program.Check(scope.Commit(Written / 2) == ma_result.MA_SUCCESS, "Commit() failed");
+                }
+
+                available = ma.pcm_rb_available_read(pcmRb);
+                Program.Check(available == Written - Written / 2, $"A partial read left {available} frames, expected {Written - Written / 2}");
+
+                using (ma_pcm_rb_write_scope scope = ma.pcm_rb_acquire_write(pcmRb, ChunkFrames))
+                {
+                    scope.AsSpan<float>().Clear();
+                }
+
+                available = ma.pcm_rb_available_read(pcmRb);
+                Program.Check(available == Written - Written / 2 + ChunkFrames, $"Disposing without Commit() left {available} frames to read");
+            });
+        }
+
+        /// <summary>
+        /// Unmap() inside a map scope moves the buffer's cursor by the frames passed to it, not by everything mapped.
+        /// </summary>
+        public static void AudioBufferPartialUnmapMovesCursor()
+        {
+            const ulong Consumed = 120;
+            float[] source = MakeFrames(FrameCount);
+
+            WithAudioBuffer(source, audioBuffer =>
+            {
+                ulong cursor;
+
+                using (ma_audio_buffer_map_scope scope = ma.audio_buffer_map(audioBuffer, ChunkFrames))
+                {
+                    Program.Check(scope.Result == ma_result.MA_SUCCESS && scope.FrameCount == ChunkFrames, "Failed to map frames");
+                    Program.Check(scope.AsSpan<float>().SequenceEqual(source.AsSpan(0, ChunkFrames * (int)Channels)), "The mapped frames don't match the source");
+                    Program.Check(scope.Unmap(Consumed) == ma_result.MA_SUCCESS, "Unmap() failed");
+                }
+
+                ma.audio_buffer_get_cursor_in_pcm_frames(audioBuffer, &cursor);
+                Program.Check(cursor == Consumed, $"A partial unmap moved the cursor to {cursor}, expected {Consumed}");
+
+                using (ma_audio_buffer_map_scope scope = ma.audio_buffer_map(audioBuffer, ChunkFrames))
+                {
+                    Program.Check(scope.AsSpan<float>()[0] == source[Consumed * Channels], "The next map didn't start at the cursor");
+                }
+
+                ma.audio_buffer_get_cursor_in_pcm_frames(audioBuffer, &cursor);
+                Program.Check(cursor == Consumed + ChunkFrames, $"Disposing without Unmap() moved the cursor to {cursor}");
+            });
+        }
+
+        private static float[] MakeFrames(uint frameCount)
+        {
+            float[] frames = new float[frameCount * Channels];
+            for (int i = 0; i < frames.Length; i++)
+            {
+                frames[i] = (i % 101) / 101.0f - 0.5f;
+            }
+
+            return frames;
+        }
+
+        private static void WithAudioBuffer(float[] source, AudioBufferTest run)
+        {
+            ma_audio_buffer* audioBuffer = (ma_audio_buffer*)NativeMemory.Alloc((nuint)sizeof(ma_audio_buffer));
+
+            try
+            {
+                fixed (float* pSource = source)
+                {
+                    ma_audio_buffer_config config = ma.audio_buffer_config_init(ma_format.ma_format_f32, Channels, (ulong)source.Length / Channels, pSource, null);
+                    Program.Check(ma.audio_buffer_init(&config, audioBuffer) == ma_result.MA_SUCCESS, "Failed to initialize audio buffer");
+
+                    try
+                    {
+                        run(audioBuffer);
+                    }
+                    finally
+                    {
+                        ma.audio_buffer_uninit(audioBuffer);
+                    }
+                }
+            }
+            finally
+            {
+                NativeMemory.Free(audioBuffer);
+            }
+        }
+
+        private static void WithPcmRb(PcmRbTest run)
+        {
+            ma_pcm_rb* pcmRb = (ma_pcm_rb*)NativeMemory.Alloc((nuint)sizeof(ma_pcm_rb));
+
+            try
+            {
+                Program.Check(ma.pcm_rb_init(ma_format.ma_format_f32, Channels, FrameCount, null, null, pcmRb) == ma_result.MA_SUCCESS, "Failed to initialize ring buffer");
+
+                try
+                {
+                    run(pcmRb);
+                }
+                finally
+                {
+                    ma.pcm_rb_uninit(pcmRb);
+                }
+            }
+            finally
+            {
+                NativeMemory.Free(pcmRb);
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+using System.Runtime.InteropServices;
+
+namespace Miniaudio.Tests
+{
+    /// <summary>
+    /// ma_ex_time_stretch from miniaudio_ex.c, reading from an ma_audio_buffer.
+    /// </summary>
+    internal static unsafe class TimeStretchTests
+    {
+        private const uint Channels = 2;
+        private const uint SampleRate = 48000;
+        private const int ChunkFrames = 480;
+
+        /// <summary>
+        /// Reads each source to the end and checks the output is as long as the source divided by the tempo. The end of
+        /// the source used to be output at 1x, or dropped when less than an overlap was left. Lengths that aren't a whole
+        /// number of sequences and sources shorter than one sequence are included.
+        /// </summary>
+        public static void OutputLengthMatchesTempoAtEnd()
+        {
+            ulong[] sourceFrameCounts = { SampleRate, SampleRate + 17, 4801, 100 };
+            float[] tempos = { 0.5f, 0.75f, 1.0f, 1.25f, 1.5f, 2.0f, 3.0f };
+
+            foreach (ulong sourceFrameCount in sourceFrameCounts)
+            {
+                foreach (float tempo in tempos)
+                {
+                    ulong outputFrameCount = Stretch(sourceFrameCount, tempo);
+                    double expected = sourceFrameCount / tempo;
+
+                    Program.Check(Math.Abs(outputFrameCount - expected) <= 1,
+                        $"{sourceFrameCount} frames at {tempo}x gave {outputFrameCount} frames, expected {expected:F1}");
+                }
+            }
+        }
+
+        private static ulong Stretch(ulong sourceFrameCount, float tempo)
+        {
+            float* source = (float*)NativeMemory.Alloc((nuint)(sourceFrameCount * Channels * sizeof(float)));
+            ma_audio_buffer* audioBuffer = (ma_audio_buffer*)NativeMemory.Alloc((nuint)sizeof(ma_audio_buffer));
+            ma_ex_time_stretch* timeStretch = (ma_ex_time_stretch*)NativeMemory.Alloc((nuint)sizeof(ma_ex_time_stretch));
+            float* frames = stackalloc float[ChunkFrames * (int)Channels];
+            ulong totalFramesRead = 0;
+
+            try
+            {
+                for (ulong i = 0; i < sourceFrameCount * Channels; i++)
+                {
+                    source[i] = 0.25f * MathF.Sin(2 * MathF.PI * 220 * (i / Channels) / SampleRate);
+                }
+
+                ma_audio_buffer_config audioBufferConfig = ma.audio_buffer_config_init(ma_format.ma_format_f32, Channels, sourceFrameCount, source, null);
+                audioBufferConfig.sampleRate = SampleRate;
+                Program.Check(ma.audio_buffer_init(&audioBufferConfig, audioBuffer) == ma_result.MA_SUCCESS, "Failed to initialize audio buffer");
+
+                ma_ex_time_stretch_config timeStretchConfig = ma.ex_time_stretch_config_init(audioBuffer, tempo);
+                if (ma.ex_time_stretch_init(&timeStretchConfig, null, timeStretch) != ma_result.MA_SUCCESS)
+                {
+                    ma.audio_buffer_uninit(audioBuffer);
+                    throw new InvalidOperationException("Failed to initialize time stretch");
+                }
+
+                for (;;)
+                {
+                    ulong framesRead = 0;
+                    ma_result result = ma.ex_time_stretch_read_pcm_frames(timeStretch, frames, ChunkFrames, &framesRead);
+                    totalFramesRead += framesRead;
+
+                    if (result != ma_result.MA_SUCCESS || framesRead == 0)
+                    {
+                        break;
+                    }
+                }
+
+                ma.ex_time_stretch_uninit(timeStretch, null);
+                ma.audio_buffer_uninit(audioBuffer);
+            }
+            finally
+            {
+                NativeMemory.Free(timeStretch);
+                NativeMemory.Free(audioBuffer);
+                NativeMemory.Free(source);
+            }
+
+            return totalFramesRead;
+        }
+    }
+}
@@ -0,0 +1,147 @@
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Miniaudio.Tests
+{
+    /// <summary>
+    /// The ma_utf8_string overloads from MiniaudioUtf8Overloads.cs and the ma_utf8_buffer they convert through.
+    /// </summary>
+    internal static unsafe class Utf8Tests
+    {
+        private const int KeysoundCount = 10000;
+        private const int NativeSyncHeadroom = 4096;
+
+        /// <summary>
+        /// These calls only compile while a null or default argument binds to the sbyte* overload without ambiguity.
+        /// ma_log_post() returns MA_INVALID_ARGS for a null log before it reads the message.
+        /// </summary>
+        public static void NullAndDefaultPassNullPointers()
+        {
+            Program.Check(ma.log_post(null, 0, null) == ma_result.MA_INVALID_ARGS, "log_post(null, 0, null) didn't return MA_INVALID_ARGS");
+            Program.Check(ma.log_post(null, 0, default) == ma_result.MA_INVALID_ARGS, "log_post(null, 0, default) didn't return MA_INVALID_ARGS");
+
+            string? nullString = null;
+            byte[]? nullArray = null;
+            Program.Check(Pin(nullString) == 0, "A null string didn't pin as a null pointer");
+            Program.Check(Pin(nullArray) == 0, "A null byte[] didn't pin as a null pointer");
+            Program.Check(Pin((sbyte*)null) == 0, "A null sbyte* didn't pin as a null pointer");
+        }
+
+        public static void StringConvertsToTerminatedUtf8()
+        {
+            const string Name = "keysounds/キー00001.ogg";
+
+            Program.Check(ReadBack(Name) == Name, "A string didn't round trip");
+            Program.Check(ReadBack(Encoding.UTF8.GetBytes(Name)) == Name, "A byte[] without a terminator didn't round trip");
+            Program.Check(ReadBack("keysounds/kick.ogg"u8) == "keysounds/kick.ogg", "A u8 literal didn't round trip");
+            Program.Check(ReadBack(string.Empty) == string.Empty, "An empty string didn't pin as an empty string");
+        }
+
+        public static void LongStringUsesArrayPool()
+        {
+            string name = new string('キ', ma_utf8_buffer.StackBufferSize);
+
+            Program.Check(ReadBack(name) == name, "A string longer than the stack buffer didn't round trip");
+            Program.Check(ReadBack(Encoding.UTF8.GetBytes(name)) == name, "UTF-8 longer than the stack buffer didn't round trip");
+        }
+
+        public static void TerminatedBytesAreUsedInPlace()
+        {
+            byte[] terminated = Encoding.UTF8.GetBytes("music.ogg\0");
+
+            fixed (byte* pTerminated = terminated)
+            {
+                Program.Check(Pin(terminated) == (nint)pTerminated, "Terminated bytes were copied");
+                Program.Check(Pin((sbyte*)pTerminated) == (nint)pTerminated, "An sbyte* was copied");
+            }
+        }
+
+        /// <summary>
+        /// Registers and unregisters 10,000 keysounds by name through the string and UTF-8 overloads, as
+        /// Utf8PathBenchmarks does, and fails if a pass allocates on the GC heap. The data is registered as encoded so
+        /// nothing is decoded.
+        /// </summary>
+        public static void KeysoundRegistrationDoesNotAllocate()
+        {
+            // Miniaudio.cs has the Windows layout, where ma_mutex and ma_semaphore are handles. The pthread ones are bigger.
+            ma_resource_manager* resourceManager = (ma_resource_manager*)NativeMemory.Alloc((nuint)sizeof(ma_resource_manager) + NativeSyncHeadroom);
+            void* data = NativeMemory.AllocZeroed(64);
+
+            try
+            {
+                ma_resource_manager_config config = ma.resource_manager_config_init();
+                Program.Check(ma.resource_manager_init(&config, resourceManager) == ma_result.MA_SUCCESS, "Failed to initialize resource manager");
+
+                string[] names = new string[KeysoundCount];
+                byte[][] utf8Names = new byte[KeysoundCount][];
+                for (int i = 0; i < KeysoundCount; i++)
+                {
+                    names[i] = $"keysounds/キー{i:D5}.ogg";
+                    utf8Names[i] = Encoding.UTF8.GetBytes(names[i]);
+                }
+
+                // The first pass warms up the JIT and anything initialized on first use.
+                Register(resourceManager, data, names, utf8Names);
+
+                long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+                int failures = Register(resourceManager, data, names, utf8Names);
+                long allocated = GC.GetAllocatedBytesForCurrentThread() - allocatedBefore;
+
+                ma.resource_manager_uninit(resourceManager);
+
+                Program.Check(failures == 0, $"{failures} registrations failed");
+                Program.Check(allocated == 0, $"Registering {KeysoundCount} keysounds twice allocated {allocated} bytes");
+            }
+            finally
+            {
+                NativeMemory.Free(resourceManager);
+                NativeMemory.Free(data);
+            }
+        }
+
+        private static int Register(ma_resource_manager* resourceManager, void* data, string[] names, byte[][] utf8Names)
+        {
+            int failures = 0;
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_register_encoded_data(resourceManager, names[i], data, 64) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_unregister_data(resourceManager, names[i]) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_register_encoded_data(resourceManager, utf8Names[i], data, 64) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            for (int i = 0; i < KeysoundCount; i++)
+            {
+                failures += ma.resource_manager_unregister_data(resourceManager, utf8Names[i]) != ma_result.MA_SUCCESS ? 1 : 0;
+            }
+
+            return failures;
+        }
+
+        private static nint Pin(ma_utf8_string value)
+        {
+            using ma_utf8_buffer buffer = new ma_utf8_buffer(value, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pBytes = buffer)
+            {
+                return (nint)pBytes;
+            }
+        }
+
+        private static string? ReadBack(ma_utf8_string value)
+        {
+            using ma_utf8_buffer buffer = new ma_utf8_buffer(value, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pBytes = buffer)
+            {
+                return Marshal.PtrToStringUTF8((nint)pBytes);
+            }
+        }
+    }
+}
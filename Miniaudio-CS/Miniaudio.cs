@@ -4,6 +4,8 @@ using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using static Miniaudio.ma_format;
 
+[assembly: DisableRuntimeMarshalling]
+
 namespace Miniaudio
 {
     public enum ma_log_level
@@ -5243,6 +5245,261 @@ namespace Miniaudio
 
         [NativeTypeName("ma_bool32")]
         public uint allowDynamicSampleRate;
+
+        [NativeTypeName("ma_bool32")]
+        public uint preservePassthrough;
+    }
+
+    public unsafe partial struct ma_ex_time_stretch_config
+    {
+        [NativeTypeName("ma_data_source *")]
+        public void* pDataSource;
+
+        public float tempo;
+
+        [NativeTypeName("ma_uint32")]
+        public uint sequenceMs;
+
+        [NativeTypeName("ma_uint32")]
+        public uint seekWindowMs;
+
+        [NativeTypeName("ma_uint32")]
+        public uint overlapMs;
+    }
+
+    public unsafe partial struct ma_ex_time_stretch
+    {
+        public ma_data_source_base ds;
+
+        [NativeTypeName("ma_data_source *")]
+        public void* pDataSource;
+
+        public ma_format formatIn;
+
+        [NativeTypeName("ma_uint32")]
+        public uint channels;
+
+        [NativeTypeName("ma_uint32")]
+        public uint sampleRate;
+
+        [NativeTypeName("ma_spinlock")]
+        public uint @lock;
+
+        public float tempo;
+
+        [NativeTypeName("ma_uint32")]
+        public uint sequenceFrames;
+
+        [NativeTypeName("ma_uint32")]
+        public uint seekWindowFrames;
+
+        [NativeTypeName("ma_uint32")]
+        public uint overlapFrames;
+
+        public double skipFrac;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong skipRemaining;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong inputCursor;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong tailFrameCount;
+
+        public float* pInput;
+
+        [NativeTypeName("ma_uint32")]
+        public uint inputFrameCount;
+
+        [NativeTypeName("ma_uint32")]
+        public uint inputFrameCap;
+
+        [NativeTypeName("ma_uint32")]
+        public uint paddedFrameCount;
+
+        public float* pMid;
+
+        public float* pMidRef;
+
+        public float* pPending;
+
+        [NativeTypeName("ma_uint32")]
+        public uint pendingFrameCount;
+
+        [NativeTypeName("ma_uint32")]
+        public uint pendingFrameOffset;
+
+        [NativeTypeName("ma_bool32")]
+        public uint isPrimed;
+
+        [NativeTypeName("ma_bool32")]
+        public uint isAtEnd;
+
+        public void* _pHeap;
+    }
+
+    public unsafe partial struct ma_ex_probe_config
+    {
+        [NativeTypeName("ma_bool32")]
+        public uint estimateLength;
+
+        public ma_resource_manager* pResourceManager;
+
+        [NativeTypeName("ma_uint32")]
+        public uint threadCount;
+
+        public ma_decoding_backend_vtable** ppCustomBackendVTables;
+
+        [NativeTypeName("ma_uint32")]
+        public uint customBackendCount;
+
+        public void* pCustomBackendUserData;
+
+        public ma_allocation_callbacks allocationCallbacks;
+    }
+
+    public partial struct ma_ex_probe_info
+    {
+        public ma_result result;
+
+        public ma_encoding_format encodingFormat;
+
+        public ma_format format;
+
+        [NativeTypeName("ma_uint32")]
+        public uint channels;
+
+        [NativeTypeName("ma_uint32")]
+        public uint sampleRate;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong lengthInPCMFrames;
+
+        [NativeTypeName("ma_bool32")]
+        public uint isLengthEstimated;
+    }
+
+    public enum ma_ex_pool_object
+    {
+        ma_ex_pool_object_sound = 0,
+        ma_ex_pool_object_decoder,
+        ma_ex_pool_object_resource_manager_data_source,
+        ma_ex_pool_object_audio_buffer,
+        ma_ex_pool_object_count,
+    }
+
+    public partial struct ma_ex_pool_config
+    {
+        [NativeTypeName("ma_uint32")]
+        public uint slabSizeInBytes;
+
+        [NativeTypeName("ma_uint32")]
+        public uint initialSlabCount;
+
+        public ma_allocation_callbacks allocationCallbacks;
+    }
+
+    public unsafe partial struct ma_ex_pool_class
+    {
+        [NativeTypeName("ma_spinlock")]
+        public uint @lock;
+
+        [NativeTypeName("ma_uint32")]
+        public uint slotSize;
+
+        [NativeTypeName("ma_uint32")]
+        public uint slotsPerSlab;
+
+        [NativeTypeName("ma_uint32")]
+        public uint slabCount;
+
+        [NativeTypeName("ma_uint32")]
+        public uint usedSlotCount;
+
+        public void* pFreeSlots;
+
+        public void* pSlabs;
+    }
+
+    public partial struct ma_ex_pool
+    {
+        [NativeTypeName("ma_ex_pool_class[4]")]
+        public _classes_e__FixedBuffer classes;
+
+        [NativeTypeName("ma_uint32")]
+        public uint slabSizeInBytes;
+
+        public ma_allocation_callbacks allocationCallbacks;
+
+        [InlineArray(4)]
+        public partial struct _classes_e__FixedBuffer
+        {
+            public ma_ex_pool_class e0;
+        }
+    }
+
+    public enum ma_libvorbis_data_source_flags
+    {
+        MA_LIBVORBIS_DATA_SOURCE_FLAG_PLANAR = 0x00010000,
+    }
+
+    public partial struct ma_libvorbis_allocation_stats
+    {
+        [NativeTypeName("ma_uint64")]
+        public ulong allocationCount;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong reallocationCount;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong freeCount;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong heapAllocationCount;
+
+        [NativeTypeName("size_t")]
+        public nuint bytesInUse;
+
+        [NativeTypeName("size_t")]
+        public nuint peakBytesInUse;
+
+        [NativeTypeName("ma_uint32")]
+        public uint arenaChunkCount;
+
+        [NativeTypeName("size_t")]
+        public nuint arenaCapacityInBytes;
+
+        [NativeTypeName("size_t")]
+        public nuint arenaUsedInBytes;
+    }
+
+    public partial struct ma_libvorbis_seek_point
+    {
+        [NativeTypeName("ma_uint64")]
+        public ulong pcmFrame;
+
+        [NativeTypeName("ma_uint64")]
+        public ulong byteOffset;
+    }
+
+    public unsafe partial struct ma_libvorbis_decode_config
+    {
+        public ma_format format;
+
+        [NativeTypeName("ma_uint32")]
+        public uint channels;
+
+        [NativeTypeName("ma_uint32")]
+        public uint sampleRate;
+
+        public ma_resource_manager* pResourceManager;
+
+        [NativeTypeName("ma_uint32")]
+        public uint threadCount;
+
+        [NativeTypeName("ma_uint32")]
+        public uint segmentCount;
     }
 
     public unsafe partial struct ma_libvorbis
@@ -5260,1312 +5517,1757 @@ namespace Miniaudio
 
         public void* pReadSeekTellUserData;
 
+        [NativeTypeName("__AnonymousRecord_miniaudio_libvorbis_L87_C5")]
+        public _memory_e__Struct memory;
+
         public ma_format format;
 
+        [NativeTypeName("ma_uint32")]
+        public uint channels;
+
+        [NativeTypeName("ma_uint32")]
+        public uint sampleRate;
+
         public void* vf;
+
+        public ma_allocation_callbacks allocationCallbacks;
+
+        [NativeTypeName("ma_uint32")]
+        public uint seekPointCountRequested;
+
+        [NativeTypeName("ma_uint32")]
+        public uint seekPointCount;
+
+        public ma_libvorbis_seek_point* pSeekPoints;
+
+        [NativeTypeName("ma_bool32")]
+        public uint isOpenDeferred;
+
+        public void* pAllocator;
+
+        public unsafe partial struct _memory_e__Struct
+        {
+            [NativeTypeName("const ma_uint8 *")]
+            public byte* pData;
+
+            [NativeTypeName("size_t")]
+            public nuint dataSize;
+
+            [NativeTypeName("size_t")]
+            public nuint currentReadPos;
+        }
     }
 
     public static unsafe partial class ma
     {
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_version", ExactSpelling = true)]
-        public static extern void version([NativeTypeName("ma_uint32 *")] uint* pMajor, [NativeTypeName("ma_uint32 *")] uint* pMinor, [NativeTypeName("ma_uint32 *")] uint* pRevision);
+        [LibraryImport("miniaudio", EntryPoint = "ma_version")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void version([NativeTypeName("ma_uint32 *")] uint* pMajor, [NativeTypeName("ma_uint32 *")] uint* pMinor, [NativeTypeName("ma_uint32 *")] uint* pRevision);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_version_string", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_version_string")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("const char *")]
-        public static extern sbyte* version_string();
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_callback_init", ExactSpelling = true)]
-        public static extern ma_log_callback log_callback_init([NativeTypeName("ma_log_callback_proc")] delegate* unmanaged[Cdecl]<void*, uint, sbyte*, void> onLog, void* pUserData);
+        public static partial sbyte* version_string();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_init", ExactSpelling = true)]
-        public static extern ma_result log_init([NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_log* pLog);
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_callback_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_log_callback log_callback_init([NativeTypeName("ma_log_callback_proc")] delegate* unmanaged[Cdecl]<void*, uint, sbyte*, void> onLog, void* pUserData);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_uninit", ExactSpelling = true)]
-        public static extern void log_uninit(ma_log* pLog);
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result log_init([NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_log* pLog);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_register_callback", ExactSpelling = true)]
-        public static extern ma_result log_register_callback(ma_log* pLog, ma_log_callback callback);
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void log_uninit(ma_log* pLog);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_unregister_callback", ExactSpelling = true)]
-        public static extern ma_result log_unregister_callback(ma_log* pLog, ma_log_callback callback);
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_register_callback")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result log_register_callback(ma_log* pLog, ma_log_callback callback);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_post", ExactSpelling = true)]
-        public static extern ma_result log_post(ma_log* pLog, [NativeTypeName("ma_uint32")] uint level, [NativeTypeName("const char *")] sbyte* pMessage);
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_unregister_callback")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result log_unregister_callback(ma_log* pLog, ma_log_callback callback);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_postv", ExactSpelling = true)]
-        public static extern ma_result log_postv(ma_log* pLog, [NativeTypeName("ma_uint32")] uint level, [NativeTypeName("const char *")] sbyte* pFormat, [NativeTypeName("va_list")] sbyte* args);
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_post")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result log_post(ma_log* pLog, [NativeTypeName("ma_uint32")] uint level, [NativeTypeName("const char *")] sbyte* pMessage);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_postf", ExactSpelling = true)]
-        public static extern ma_result log_postf(ma_log* pLog, [NativeTypeName("ma_uint32")] uint level, [NativeTypeName("const char *")] sbyte* pFormat, __arglist);
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_postv")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result log_postv(ma_log* pLog, [NativeTypeName("ma_uint32")] uint level, [NativeTypeName("const char *")] sbyte* pFormat, [NativeTypeName("va_list")] sbyte* args);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_config_init", ExactSpelling = true)]
-        public static extern ma_biquad_config biquad_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, double b0, double b1, double b2, double a0, double a1, double a2);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_biquad_config biquad_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, double b0, double b1, double b2, double a0, double a1, double a2);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result biquad_get_heap_size([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_get_heap_size([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result biquad_init_preallocated([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, void* pHeap, ma_biquad* pBQ);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_init_preallocated([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, void* pHeap, ma_biquad* pBQ);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_init", ExactSpelling = true)]
-        public static extern ma_result biquad_init([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_biquad* pBQ);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_init([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_biquad* pBQ);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_uninit", ExactSpelling = true)]
-        public static extern void biquad_uninit(ma_biquad* pBQ, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void biquad_uninit(ma_biquad* pBQ, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_reinit", ExactSpelling = true)]
-        public static extern ma_result biquad_reinit([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, ma_biquad* pBQ);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_reinit([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, ma_biquad* pBQ);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_clear_cache", ExactSpelling = true)]
-        public static extern ma_result biquad_clear_cache(ma_biquad* pBQ);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_clear_cache")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_clear_cache(ma_biquad* pBQ);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result biquad_process_pcm_frames(ma_biquad* pBQ, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_process_pcm_frames(ma_biquad* pBQ, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint biquad_get_latency([NativeTypeName("const ma_biquad *")] ma_biquad* pBQ);
+        public static partial uint biquad_get_latency([NativeTypeName("const ma_biquad *")] ma_biquad* pBQ);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_config_init", ExactSpelling = true)]
-        public static extern ma_lpf1_config lpf1_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_lpf1_config lpf1_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_config_init", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_lpf2_config")]
-        public static extern ma_lpf1_config lpf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, double q);
+        public static partial ma_lpf1_config lpf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, double q);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result lpf1_get_heap_size([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf1_get_heap_size([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result lpf1_init_preallocated([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, void* pHeap, ma_lpf1* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf1_init_preallocated([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, void* pHeap, ma_lpf1* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_init", ExactSpelling = true)]
-        public static extern ma_result lpf1_init([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf1* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf1_init([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf1* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_uninit", ExactSpelling = true)]
-        public static extern void lpf1_uninit(ma_lpf1* pLPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void lpf1_uninit(ma_lpf1* pLPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_reinit", ExactSpelling = true)]
-        public static extern ma_result lpf1_reinit([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, ma_lpf1* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf1_reinit([NativeTypeName("const ma_lpf1_config *")] ma_lpf1_config* pConfig, ma_lpf1* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_clear_cache", ExactSpelling = true)]
-        public static extern ma_result lpf1_clear_cache(ma_lpf1* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_clear_cache")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf1_clear_cache(ma_lpf1* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result lpf1_process_pcm_frames(ma_lpf1* pLPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf1_process_pcm_frames(ma_lpf1* pLPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf1_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf1_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint lpf1_get_latency([NativeTypeName("const ma_lpf1 *")] ma_lpf1* pLPF);
+        public static partial uint lpf1_get_latency([NativeTypeName("const ma_lpf1 *")] ma_lpf1* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result lpf2_get_heap_size([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf2_get_heap_size([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result lpf2_init_preallocated([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, void* pHeap, ma_lpf2* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf2_init_preallocated([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, void* pHeap, ma_lpf2* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_init", ExactSpelling = true)]
-        public static extern ma_result lpf2_init([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf2* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf2_init([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf2* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_uninit", ExactSpelling = true)]
-        public static extern void lpf2_uninit(ma_lpf2* pLPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void lpf2_uninit(ma_lpf2* pLPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_reinit", ExactSpelling = true)]
-        public static extern ma_result lpf2_reinit([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, ma_lpf2* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf2_reinit([NativeTypeName("const ma_lpf2_config *")] ma_lpf1_config* pConfig, ma_lpf2* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_clear_cache", ExactSpelling = true)]
-        public static extern ma_result lpf2_clear_cache(ma_lpf2* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_clear_cache")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf2_clear_cache(ma_lpf2* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result lpf2_process_pcm_frames(ma_lpf2* pLPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf2_process_pcm_frames(ma_lpf2* pLPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf2_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf2_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint lpf2_get_latency([NativeTypeName("const ma_lpf2 *")] ma_lpf2* pLPF);
+        public static partial uint lpf2_get_latency([NativeTypeName("const ma_lpf2 *")] ma_lpf2* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_config_init", ExactSpelling = true)]
-        public static extern ma_lpf_config lpf_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_lpf_config lpf_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result lpf_get_heap_size([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_get_heap_size([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result lpf_init_preallocated([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, void* pHeap, ma_lpf* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_init_preallocated([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, void* pHeap, ma_lpf* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_init", ExactSpelling = true)]
-        public static extern ma_result lpf_init([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_init([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_uninit", ExactSpelling = true)]
-        public static extern void lpf_uninit(ma_lpf* pLPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void lpf_uninit(ma_lpf* pLPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_reinit", ExactSpelling = true)]
-        public static extern ma_result lpf_reinit([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, ma_lpf* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_reinit([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, ma_lpf* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_clear_cache", ExactSpelling = true)]
-        public static extern ma_result lpf_clear_cache(ma_lpf* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_clear_cache")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_clear_cache(ma_lpf* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result lpf_process_pcm_frames(ma_lpf* pLPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_process_pcm_frames(ma_lpf* pLPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint lpf_get_latency([NativeTypeName("const ma_lpf *")] ma_lpf* pLPF);
+        public static partial uint lpf_get_latency([NativeTypeName("const ma_lpf *")] ma_lpf* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_config_init", ExactSpelling = true)]
-        public static extern ma_hpf1_config hpf1_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_hpf1_config hpf1_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_config_init", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_hpf2_config")]
-        public static extern ma_hpf1_config hpf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, double q);
+        public static partial ma_hpf1_config hpf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, double q);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result hpf1_get_heap_size([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf1_get_heap_size([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result hpf1_init_preallocated([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, void* pHeap, ma_hpf1* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf1_init_preallocated([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, void* pHeap, ma_hpf1* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_init", ExactSpelling = true)]
-        public static extern ma_result hpf1_init([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf1* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf1_init([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf1* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_uninit", ExactSpelling = true)]
-        public static extern void hpf1_uninit(ma_hpf1* pHPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void hpf1_uninit(ma_hpf1* pHPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_reinit", ExactSpelling = true)]
-        public static extern ma_result hpf1_reinit([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, ma_hpf1* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf1_reinit([NativeTypeName("const ma_hpf1_config *")] ma_hpf1_config* pConfig, ma_hpf1* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result hpf1_process_pcm_frames(ma_hpf1* pHPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf1_process_pcm_frames(ma_hpf1* pHPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf1_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf1_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint hpf1_get_latency([NativeTypeName("const ma_hpf1 *")] ma_hpf1* pHPF);
+        public static partial uint hpf1_get_latency([NativeTypeName("const ma_hpf1 *")] ma_hpf1* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result hpf2_get_heap_size([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf2_get_heap_size([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result hpf2_init_preallocated([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, void* pHeap, ma_hpf2* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf2_init_preallocated([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, void* pHeap, ma_hpf2* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_init", ExactSpelling = true)]
-        public static extern ma_result hpf2_init([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf2* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf2_init([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf2* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_uninit", ExactSpelling = true)]
-        public static extern void hpf2_uninit(ma_hpf2* pHPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void hpf2_uninit(ma_hpf2* pHPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_reinit", ExactSpelling = true)]
-        public static extern ma_result hpf2_reinit([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, ma_hpf2* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf2_reinit([NativeTypeName("const ma_hpf2_config *")] ma_hpf1_config* pConfig, ma_hpf2* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result hpf2_process_pcm_frames(ma_hpf2* pHPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf2_process_pcm_frames(ma_hpf2* pHPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf2_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf2_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint hpf2_get_latency([NativeTypeName("const ma_hpf2 *")] ma_hpf2* pHPF);
+        public static partial uint hpf2_get_latency([NativeTypeName("const ma_hpf2 *")] ma_hpf2* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_config_init", ExactSpelling = true)]
-        public static extern ma_hpf_config hpf_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_hpf_config hpf_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result hpf_get_heap_size([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf_get_heap_size([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result hpf_init_preallocated([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, void* pHeap, ma_hpf* pLPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf_init_preallocated([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, void* pHeap, ma_hpf* pLPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_init", ExactSpelling = true)]
-        public static extern ma_result hpf_init([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf_init([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_uninit", ExactSpelling = true)]
-        public static extern void hpf_uninit(ma_hpf* pHPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void hpf_uninit(ma_hpf* pHPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_reinit", ExactSpelling = true)]
-        public static extern ma_result hpf_reinit([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, ma_hpf* pHPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf_reinit([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, ma_hpf* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result hpf_process_pcm_frames(ma_hpf* pHPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf_process_pcm_frames(ma_hpf* pHPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint hpf_get_latency([NativeTypeName("const ma_hpf *")] ma_hpf* pHPF);
+        public static partial uint hpf_get_latency([NativeTypeName("const ma_hpf *")] ma_hpf* pHPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_config_init", ExactSpelling = true)]
-        public static extern ma_bpf2_config bpf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, double q);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_bpf2_config bpf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, double q);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result bpf2_get_heap_size([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf2_get_heap_size([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result bpf2_init_preallocated([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, void* pHeap, ma_bpf2* pBPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf2_init_preallocated([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, void* pHeap, ma_bpf2* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_init", ExactSpelling = true)]
-        public static extern ma_result bpf2_init([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_bpf2* pBPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf2_init([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_bpf2* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_uninit", ExactSpelling = true)]
-        public static extern void bpf2_uninit(ma_bpf2* pBPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void bpf2_uninit(ma_bpf2* pBPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_reinit", ExactSpelling = true)]
-        public static extern ma_result bpf2_reinit([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, ma_bpf2* pBPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf2_reinit([NativeTypeName("const ma_bpf2_config *")] ma_bpf2_config* pConfig, ma_bpf2* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result bpf2_process_pcm_frames(ma_bpf2* pBPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf2_process_pcm_frames(ma_bpf2* pBPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf2_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf2_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint bpf2_get_latency([NativeTypeName("const ma_bpf2 *")] ma_bpf2* pBPF);
+        public static partial uint bpf2_get_latency([NativeTypeName("const ma_bpf2 *")] ma_bpf2* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_config_init", ExactSpelling = true)]
-        public static extern ma_bpf_config bpf_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_bpf_config bpf_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result bpf_get_heap_size([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf_get_heap_size([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result bpf_init_preallocated([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, void* pHeap, ma_bpf* pBPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf_init_preallocated([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, void* pHeap, ma_bpf* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_init", ExactSpelling = true)]
-        public static extern ma_result bpf_init([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_bpf* pBPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf_init([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_bpf* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_uninit", ExactSpelling = true)]
-        public static extern void bpf_uninit(ma_bpf* pBPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void bpf_uninit(ma_bpf* pBPF, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_reinit", ExactSpelling = true)]
-        public static extern ma_result bpf_reinit([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, ma_bpf* pBPF);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf_reinit([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, ma_bpf* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result bpf_process_pcm_frames(ma_bpf* pBPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf_process_pcm_frames(ma_bpf* pBPF, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint bpf_get_latency([NativeTypeName("const ma_bpf *")] ma_bpf* pBPF);
+        public static partial uint bpf_get_latency([NativeTypeName("const ma_bpf *")] ma_bpf* pBPF);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_config_init", ExactSpelling = true)]
-        public static extern ma_notch2_config notch2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double q, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_notch2_config notch2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double q, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result notch2_get_heap_size([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result notch2_get_heap_size([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result notch2_init_preallocated([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, void* pHeap, ma_notch2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result notch2_init_preallocated([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, void* pHeap, ma_notch2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_init", ExactSpelling = true)]
-        public static extern ma_result notch2_init([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_notch2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result notch2_init([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_notch2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_uninit", ExactSpelling = true)]
-        public static extern void notch2_uninit(ma_notch2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void notch2_uninit(ma_notch2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_reinit", ExactSpelling = true)]
-        public static extern ma_result notch2_reinit([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, ma_notch2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result notch2_reinit([NativeTypeName("const ma_notch2_config *")] ma_notch2_config* pConfig, ma_notch2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result notch2_process_pcm_frames(ma_notch2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result notch2_process_pcm_frames(ma_notch2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch2_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch2_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint notch2_get_latency([NativeTypeName("const ma_notch2 *")] ma_notch2* pFilter);
+        public static partial uint notch2_get_latency([NativeTypeName("const ma_notch2 *")] ma_notch2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_config_init", ExactSpelling = true)]
-        public static extern ma_peak2_config peak2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_peak2_config peak2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result peak2_get_heap_size([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result peak2_get_heap_size([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result peak2_init_preallocated([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, void* pHeap, ma_peak2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result peak2_init_preallocated([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, void* pHeap, ma_peak2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_init", ExactSpelling = true)]
-        public static extern ma_result peak2_init([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_peak2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result peak2_init([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_peak2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_uninit", ExactSpelling = true)]
-        public static extern void peak2_uninit(ma_peak2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void peak2_uninit(ma_peak2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_reinit", ExactSpelling = true)]
-        public static extern ma_result peak2_reinit([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, ma_peak2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result peak2_reinit([NativeTypeName("const ma_peak2_config *")] ma_peak2_config* pConfig, ma_peak2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result peak2_process_pcm_frames(ma_peak2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result peak2_process_pcm_frames(ma_peak2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak2_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak2_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint peak2_get_latency([NativeTypeName("const ma_peak2 *")] ma_peak2* pFilter);
+        public static partial uint peak2_get_latency([NativeTypeName("const ma_peak2 *")] ma_peak2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_config_init", ExactSpelling = true)]
-        public static extern ma_loshelf2_config loshelf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double shelfSlope, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_loshelf2_config loshelf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double shelfSlope, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result loshelf2_get_heap_size([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result loshelf2_get_heap_size([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result loshelf2_init_preallocated([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, void* pHeap, ma_loshelf2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result loshelf2_init_preallocated([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, void* pHeap, ma_loshelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_init", ExactSpelling = true)]
-        public static extern ma_result loshelf2_init([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_loshelf2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result loshelf2_init([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_loshelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_uninit", ExactSpelling = true)]
-        public static extern void loshelf2_uninit(ma_loshelf2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void loshelf2_uninit(ma_loshelf2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_reinit", ExactSpelling = true)]
-        public static extern ma_result loshelf2_reinit([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, ma_loshelf2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result loshelf2_reinit([NativeTypeName("const ma_loshelf2_config *")] ma_loshelf2_config* pConfig, ma_loshelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result loshelf2_process_pcm_frames(ma_loshelf2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result loshelf2_process_pcm_frames(ma_loshelf2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf2_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf2_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint loshelf2_get_latency([NativeTypeName("const ma_loshelf2 *")] ma_loshelf2* pFilter);
+        public static partial uint loshelf2_get_latency([NativeTypeName("const ma_loshelf2 *")] ma_loshelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_config_init", ExactSpelling = true)]
-        public static extern ma_hishelf2_config hishelf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double shelfSlope, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_hishelf2_config hishelf2_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double shelfSlope, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result hishelf2_get_heap_size([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hishelf2_get_heap_size([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result hishelf2_init_preallocated([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, void* pHeap, ma_hishelf2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hishelf2_init_preallocated([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, void* pHeap, ma_hishelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_init", ExactSpelling = true)]
-        public static extern ma_result hishelf2_init([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hishelf2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hishelf2_init([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hishelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_uninit", ExactSpelling = true)]
-        public static extern void hishelf2_uninit(ma_hishelf2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void hishelf2_uninit(ma_hishelf2* pFilter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_reinit", ExactSpelling = true)]
-        public static extern ma_result hishelf2_reinit([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, ma_hishelf2* pFilter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hishelf2_reinit([NativeTypeName("const ma_hishelf2_config *")] ma_hishelf2_config* pConfig, ma_hishelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result hishelf2_process_pcm_frames(ma_hishelf2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hishelf2_process_pcm_frames(ma_hishelf2* pFilter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf2_get_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf2_get_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint hishelf2_get_latency([NativeTypeName("const ma_hishelf2 *")] ma_hishelf2* pFilter);
+        public static partial uint hishelf2_get_latency([NativeTypeName("const ma_hishelf2 *")] ma_hishelf2* pFilter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_config_init", ExactSpelling = true)]
-        public static extern ma_delay_config delay_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, [NativeTypeName("ma_uint32")] uint delayInFrames, float decay);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_delay_config delay_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, [NativeTypeName("ma_uint32")] uint delayInFrames, float decay);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_init", ExactSpelling = true)]
-        public static extern ma_result delay_init([NativeTypeName("const ma_delay_config *")] ma_delay_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_delay* pDelay);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result delay_init([NativeTypeName("const ma_delay_config *")] ma_delay_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_delay* pDelay);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_uninit", ExactSpelling = true)]
-        public static extern void delay_uninit(ma_delay* pDelay, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_uninit(ma_delay* pDelay, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result delay_process_pcm_frames(ma_delay* pDelay, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint32")] uint frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result delay_process_pcm_frames(ma_delay* pDelay, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint32")] uint frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_set_wet", ExactSpelling = true)]
-        public static extern void delay_set_wet(ma_delay* pDelay, float value);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_set_wet")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_set_wet(ma_delay* pDelay, float value);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_get_wet", ExactSpelling = true)]
-        public static extern float delay_get_wet([NativeTypeName("const ma_delay *")] ma_delay* pDelay);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_get_wet")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float delay_get_wet([NativeTypeName("const ma_delay *")] ma_delay* pDelay);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_set_dry", ExactSpelling = true)]
-        public static extern void delay_set_dry(ma_delay* pDelay, float value);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_set_dry")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_set_dry(ma_delay* pDelay, float value);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_get_dry", ExactSpelling = true)]
-        public static extern float delay_get_dry([NativeTypeName("const ma_delay *")] ma_delay* pDelay);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_get_dry")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float delay_get_dry([NativeTypeName("const ma_delay *")] ma_delay* pDelay);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_set_decay", ExactSpelling = true)]
-        public static extern void delay_set_decay(ma_delay* pDelay, float value);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_set_decay")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_set_decay(ma_delay* pDelay, float value);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_get_decay", ExactSpelling = true)]
-        public static extern float delay_get_decay([NativeTypeName("const ma_delay *")] ma_delay* pDelay);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_get_decay")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float delay_get_decay([NativeTypeName("const ma_delay *")] ma_delay* pDelay);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_config_init", ExactSpelling = true)]
-        public static extern ma_gainer_config gainer_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint smoothTimeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_gainer_config gainer_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint smoothTimeInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result gainer_get_heap_size([NativeTypeName("const ma_gainer_config *")] ma_gainer_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_get_heap_size([NativeTypeName("const ma_gainer_config *")] ma_gainer_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result gainer_init_preallocated([NativeTypeName("const ma_gainer_config *")] ma_gainer_config* pConfig, void* pHeap, ma_gainer* pGainer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_init_preallocated([NativeTypeName("const ma_gainer_config *")] ma_gainer_config* pConfig, void* pHeap, ma_gainer* pGainer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_init", ExactSpelling = true)]
-        public static extern ma_result gainer_init([NativeTypeName("const ma_gainer_config *")] ma_gainer_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_gainer* pGainer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_init([NativeTypeName("const ma_gainer_config *")] ma_gainer_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_gainer* pGainer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_uninit", ExactSpelling = true)]
-        public static extern void gainer_uninit(ma_gainer* pGainer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void gainer_uninit(ma_gainer* pGainer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result gainer_process_pcm_frames(ma_gainer* pGainer, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_process_pcm_frames(ma_gainer* pGainer, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_set_gain", ExactSpelling = true)]
-        public static extern ma_result gainer_set_gain(ma_gainer* pGainer, float newGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_set_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_set_gain(ma_gainer* pGainer, float newGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_set_gains", ExactSpelling = true)]
-        public static extern ma_result gainer_set_gains(ma_gainer* pGainer, float* pNewGains);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_set_gains")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_set_gains(ma_gainer* pGainer, float* pNewGains);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_set_master_volume", ExactSpelling = true)]
-        public static extern ma_result gainer_set_master_volume(ma_gainer* pGainer, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_set_master_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_set_master_volume(ma_gainer* pGainer, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_gainer_get_master_volume", ExactSpelling = true)]
-        public static extern ma_result gainer_get_master_volume([NativeTypeName("const ma_gainer *")] ma_gainer* pGainer, float* pVolume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_gainer_get_master_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result gainer_get_master_volume([NativeTypeName("const ma_gainer *")] ma_gainer* pGainer, float* pVolume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_panner_config_init", ExactSpelling = true)]
-        public static extern ma_panner_config panner_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_panner_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_panner_config panner_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_panner_init", ExactSpelling = true)]
-        public static extern ma_result panner_init([NativeTypeName("const ma_panner_config *")] ma_panner_config* pConfig, ma_panner* pPanner);
+        [LibraryImport("miniaudio", EntryPoint = "ma_panner_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result panner_init([NativeTypeName("const ma_panner_config *")] ma_panner_config* pConfig, ma_panner* pPanner);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_panner_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result panner_process_pcm_frames(ma_panner* pPanner, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_panner_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result panner_process_pcm_frames(ma_panner* pPanner, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_panner_set_mode", ExactSpelling = true)]
-        public static extern void panner_set_mode(ma_panner* pPanner, ma_pan_mode mode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_panner_set_mode")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void panner_set_mode(ma_panner* pPanner, ma_pan_mode mode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_panner_get_mode", ExactSpelling = true)]
-        public static extern ma_pan_mode panner_get_mode([NativeTypeName("const ma_panner *")] ma_panner* pPanner);
+        [LibraryImport("miniaudio", EntryPoint = "ma_panner_get_mode")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_pan_mode panner_get_mode([NativeTypeName("const ma_panner *")] ma_panner* pPanner);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_panner_set_pan", ExactSpelling = true)]
-        public static extern void panner_set_pan(ma_panner* pPanner, float pan);
+        [LibraryImport("miniaudio", EntryPoint = "ma_panner_set_pan")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void panner_set_pan(ma_panner* pPanner, float pan);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_panner_get_pan", ExactSpelling = true)]
-        public static extern float panner_get_pan([NativeTypeName("const ma_panner *")] ma_panner* pPanner);
+        [LibraryImport("miniaudio", EntryPoint = "ma_panner_get_pan")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float panner_get_pan([NativeTypeName("const ma_panner *")] ma_panner* pPanner);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fader_config_init", ExactSpelling = true)]
-        public static extern ma_fader_config fader_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fader_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_fader_config fader_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fader_init", ExactSpelling = true)]
-        public static extern ma_result fader_init([NativeTypeName("const ma_fader_config *")] ma_fader_config* pConfig, ma_fader* pFader);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fader_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result fader_init([NativeTypeName("const ma_fader_config *")] ma_fader_config* pConfig, ma_fader* pFader);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fader_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result fader_process_pcm_frames(ma_fader* pFader, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fader_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result fader_process_pcm_frames(ma_fader* pFader, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fader_get_data_format", ExactSpelling = true)]
-        public static extern void fader_get_data_format([NativeTypeName("const ma_fader *")] ma_fader* pFader, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fader_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void fader_get_data_format([NativeTypeName("const ma_fader *")] ma_fader* pFader, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fader_set_fade", ExactSpelling = true)]
-        public static extern void fader_set_fade(ma_fader* pFader, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong lengthInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fader_set_fade")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void fader_set_fade(ma_fader* pFader, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong lengthInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fader_set_fade_ex", ExactSpelling = true)]
-        public static extern void fader_set_fade_ex(ma_fader* pFader, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong lengthInFrames, [NativeTypeName("ma_int64")] long startOffsetInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fader_set_fade_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void fader_set_fade_ex(ma_fader* pFader, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong lengthInFrames, [NativeTypeName("ma_int64")] long startOffsetInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fader_get_current_volume", ExactSpelling = true)]
-        public static extern float fader_get_current_volume([NativeTypeName("const ma_fader *")] ma_fader* pFader);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fader_get_current_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float fader_get_current_volume([NativeTypeName("const ma_fader *")] ma_fader* pFader);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_config_init", ExactSpelling = true)]
-        public static extern ma_spatializer_listener_config spatializer_listener_config_init([NativeTypeName("ma_uint32")] uint channelsOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_spatializer_listener_config spatializer_listener_config_init([NativeTypeName("ma_uint32")] uint channelsOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result spatializer_listener_get_heap_size([NativeTypeName("const ma_spatializer_listener_config *")] ma_spatializer_listener_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_listener_get_heap_size([NativeTypeName("const ma_spatializer_listener_config *")] ma_spatializer_listener_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result spatializer_listener_init_preallocated([NativeTypeName("const ma_spatializer_listener_config *")] ma_spatializer_listener_config* pConfig, void* pHeap, ma_spatializer_listener* pListener);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_listener_init_preallocated([NativeTypeName("const ma_spatializer_listener_config *")] ma_spatializer_listener_config* pConfig, void* pHeap, ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_init", ExactSpelling = true)]
-        public static extern ma_result spatializer_listener_init([NativeTypeName("const ma_spatializer_listener_config *")] ma_spatializer_listener_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_spatializer_listener* pListener);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_listener_init([NativeTypeName("const ma_spatializer_listener_config *")] ma_spatializer_listener_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_uninit", ExactSpelling = true)]
-        public static extern void spatializer_listener_uninit(ma_spatializer_listener* pListener, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_uninit(ma_spatializer_listener* pListener, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_channel_map", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_channel_map")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_channel *")]
-        public static extern byte* spatializer_listener_get_channel_map(ma_spatializer_listener* pListener);
+        public static partial byte* spatializer_listener_get_channel_map(ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_set_cone", ExactSpelling = true)]
-        public static extern void spatializer_listener_set_cone(ma_spatializer_listener* pListener, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_set_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_set_cone(ma_spatializer_listener* pListener, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_cone", ExactSpelling = true)]
-        public static extern void spatializer_listener_get_cone([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_get_cone([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_set_position", ExactSpelling = true)]
-        public static extern void spatializer_listener_set_position(ma_spatializer_listener* pListener, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_set_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_set_position(ma_spatializer_listener* pListener, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_position", ExactSpelling = true)]
-        public static extern ma_vec3f spatializer_listener_get_position([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f spatializer_listener_get_position([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_set_direction", ExactSpelling = true)]
-        public static extern void spatializer_listener_set_direction(ma_spatializer_listener* pListener, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_set_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_set_direction(ma_spatializer_listener* pListener, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_direction", ExactSpelling = true)]
-        public static extern ma_vec3f spatializer_listener_get_direction([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f spatializer_listener_get_direction([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_set_velocity", ExactSpelling = true)]
-        public static extern void spatializer_listener_set_velocity(ma_spatializer_listener* pListener, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_set_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_set_velocity(ma_spatializer_listener* pListener, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_velocity", ExactSpelling = true)]
-        public static extern ma_vec3f spatializer_listener_get_velocity([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f spatializer_listener_get_velocity([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_set_speed_of_sound", ExactSpelling = true)]
-        public static extern void spatializer_listener_set_speed_of_sound(ma_spatializer_listener* pListener, float speedOfSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_set_speed_of_sound")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_set_speed_of_sound(ma_spatializer_listener* pListener, float speedOfSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_speed_of_sound", ExactSpelling = true)]
-        public static extern float spatializer_listener_get_speed_of_sound([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_speed_of_sound")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_listener_get_speed_of_sound([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_set_world_up", ExactSpelling = true)]
-        public static extern void spatializer_listener_set_world_up(ma_spatializer_listener* pListener, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_set_world_up")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_set_world_up(ma_spatializer_listener* pListener, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_get_world_up", ExactSpelling = true)]
-        public static extern ma_vec3f spatializer_listener_get_world_up([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_get_world_up")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f spatializer_listener_get_world_up([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_set_enabled", ExactSpelling = true)]
-        public static extern void spatializer_listener_set_enabled(ma_spatializer_listener* pListener, [NativeTypeName("ma_bool32")] uint isEnabled);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_set_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_listener_set_enabled(ma_spatializer_listener* pListener, [NativeTypeName("ma_bool32")] uint isEnabled);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_listener_is_enabled", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_listener_is_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint spatializer_listener_is_enabled([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
+        public static partial uint spatializer_listener_is_enabled([NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_config_init", ExactSpelling = true)]
-        public static extern ma_spatializer_config spatializer_config_init([NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("ma_uint32")] uint channelsOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_spatializer_config spatializer_config_init([NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("ma_uint32")] uint channelsOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result spatializer_get_heap_size([NativeTypeName("const ma_spatializer_config *")] ma_spatializer_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_get_heap_size([NativeTypeName("const ma_spatializer_config *")] ma_spatializer_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result spatializer_init_preallocated([NativeTypeName("const ma_spatializer_config *")] ma_spatializer_config* pConfig, void* pHeap, ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_init_preallocated([NativeTypeName("const ma_spatializer_config *")] ma_spatializer_config* pConfig, void* pHeap, ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_init", ExactSpelling = true)]
-        public static extern ma_result spatializer_init([NativeTypeName("const ma_spatializer_config *")] ma_spatializer_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_init([NativeTypeName("const ma_spatializer_config *")] ma_spatializer_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_uninit", ExactSpelling = true)]
-        public static extern void spatializer_uninit(ma_spatializer* pSpatializer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_uninit(ma_spatializer* pSpatializer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result spatializer_process_pcm_frames(ma_spatializer* pSpatializer, ma_spatializer_listener* pListener, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_process_pcm_frames(ma_spatializer* pSpatializer, ma_spatializer_listener* pListener, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_master_volume", ExactSpelling = true)]
-        public static extern ma_result spatializer_set_master_volume(ma_spatializer* pSpatializer, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_master_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_set_master_volume(ma_spatializer* pSpatializer, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_master_volume", ExactSpelling = true)]
-        public static extern ma_result spatializer_get_master_volume([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer, float* pVolume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_master_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spatializer_get_master_volume([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer, float* pVolume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_input_channels", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_input_channels")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint spatializer_get_input_channels([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        public static partial uint spatializer_get_input_channels([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_output_channels", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_output_channels")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint spatializer_get_output_channels([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        public static partial uint spatializer_get_output_channels([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_attenuation_model", ExactSpelling = true)]
-        public static extern void spatializer_set_attenuation_model(ma_spatializer* pSpatializer, ma_attenuation_model attenuationModel);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_attenuation_model")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_attenuation_model(ma_spatializer* pSpatializer, ma_attenuation_model attenuationModel);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_attenuation_model", ExactSpelling = true)]
-        public static extern ma_attenuation_model spatializer_get_attenuation_model([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_attenuation_model")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_attenuation_model spatializer_get_attenuation_model([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_positioning", ExactSpelling = true)]
-        public static extern void spatializer_set_positioning(ma_spatializer* pSpatializer, ma_positioning positioning);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_positioning")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_positioning(ma_spatializer* pSpatializer, ma_positioning positioning);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_positioning", ExactSpelling = true)]
-        public static extern ma_positioning spatializer_get_positioning([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_positioning")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_positioning spatializer_get_positioning([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_rolloff", ExactSpelling = true)]
-        public static extern void spatializer_set_rolloff(ma_spatializer* pSpatializer, float rolloff);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_rolloff")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_rolloff(ma_spatializer* pSpatializer, float rolloff);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_rolloff", ExactSpelling = true)]
-        public static extern float spatializer_get_rolloff([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_rolloff")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_get_rolloff([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_min_gain", ExactSpelling = true)]
-        public static extern void spatializer_set_min_gain(ma_spatializer* pSpatializer, float minGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_min_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_min_gain(ma_spatializer* pSpatializer, float minGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_min_gain", ExactSpelling = true)]
-        public static extern float spatializer_get_min_gain([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_min_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_get_min_gain([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_max_gain", ExactSpelling = true)]
-        public static extern void spatializer_set_max_gain(ma_spatializer* pSpatializer, float maxGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_max_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_max_gain(ma_spatializer* pSpatializer, float maxGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_max_gain", ExactSpelling = true)]
-        public static extern float spatializer_get_max_gain([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_max_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_get_max_gain([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_min_distance", ExactSpelling = true)]
-        public static extern void spatializer_set_min_distance(ma_spatializer* pSpatializer, float minDistance);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_min_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_min_distance(ma_spatializer* pSpatializer, float minDistance);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_min_distance", ExactSpelling = true)]
-        public static extern float spatializer_get_min_distance([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_min_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_get_min_distance([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_max_distance", ExactSpelling = true)]
-        public static extern void spatializer_set_max_distance(ma_spatializer* pSpatializer, float maxDistance);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_max_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_max_distance(ma_spatializer* pSpatializer, float maxDistance);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_max_distance", ExactSpelling = true)]
-        public static extern float spatializer_get_max_distance([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_max_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_get_max_distance([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_cone", ExactSpelling = true)]
-        public static extern void spatializer_set_cone(ma_spatializer* pSpatializer, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_cone(ma_spatializer* pSpatializer, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_cone", ExactSpelling = true)]
-        public static extern void spatializer_get_cone([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_get_cone([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_doppler_factor", ExactSpelling = true)]
-        public static extern void spatializer_set_doppler_factor(ma_spatializer* pSpatializer, float dopplerFactor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_doppler_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_doppler_factor(ma_spatializer* pSpatializer, float dopplerFactor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_doppler_factor", ExactSpelling = true)]
-        public static extern float spatializer_get_doppler_factor([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_doppler_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_get_doppler_factor([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_directional_attenuation_factor", ExactSpelling = true)]
-        public static extern void spatializer_set_directional_attenuation_factor(ma_spatializer* pSpatializer, float directionalAttenuationFactor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_directional_attenuation_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_directional_attenuation_factor(ma_spatializer* pSpatializer, float directionalAttenuationFactor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_directional_attenuation_factor", ExactSpelling = true)]
-        public static extern float spatializer_get_directional_attenuation_factor([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_directional_attenuation_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float spatializer_get_directional_attenuation_factor([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_position", ExactSpelling = true)]
-        public static extern void spatializer_set_position(ma_spatializer* pSpatializer, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_position(ma_spatializer* pSpatializer, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_position", ExactSpelling = true)]
-        public static extern ma_vec3f spatializer_get_position([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f spatializer_get_position([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_direction", ExactSpelling = true)]
-        public static extern void spatializer_set_direction(ma_spatializer* pSpatializer, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_direction(ma_spatializer* pSpatializer, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_direction", ExactSpelling = true)]
-        public static extern ma_vec3f spatializer_get_direction([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f spatializer_get_direction([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_set_velocity", ExactSpelling = true)]
-        public static extern void spatializer_set_velocity(ma_spatializer* pSpatializer, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_set_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_set_velocity(ma_spatializer* pSpatializer, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_velocity", ExactSpelling = true)]
-        public static extern ma_vec3f spatializer_get_velocity([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f spatializer_get_velocity([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spatializer_get_relative_position_and_direction", ExactSpelling = true)]
-        public static extern void spatializer_get_relative_position_and_direction([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer, [NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener, ma_vec3f* pRelativePos, ma_vec3f* pRelativeDir);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spatializer_get_relative_position_and_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void spatializer_get_relative_position_and_direction([NativeTypeName("const ma_spatializer *")] ma_spatializer* pSpatializer, [NativeTypeName("const ma_spatializer_listener *")] ma_spatializer_listener* pListener, ma_vec3f* pRelativePos, ma_vec3f* pRelativeDir);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_config_init", ExactSpelling = true)]
-        public static extern ma_linear_resampler_config linear_resampler_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_linear_resampler_config linear_resampler_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_get_heap_size([NativeTypeName("const ma_linear_resampler_config *")] ma_linear_resampler_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_get_heap_size([NativeTypeName("const ma_linear_resampler_config *")] ma_linear_resampler_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_init_preallocated([NativeTypeName("const ma_linear_resampler_config *")] ma_linear_resampler_config* pConfig, void* pHeap, ma_linear_resampler* pResampler);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_init_preallocated([NativeTypeName("const ma_linear_resampler_config *")] ma_linear_resampler_config* pConfig, void* pHeap, ma_linear_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_init", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_init([NativeTypeName("const ma_linear_resampler_config *")] ma_linear_resampler_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_linear_resampler* pResampler);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_init([NativeTypeName("const ma_linear_resampler_config *")] ma_linear_resampler_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_linear_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_uninit", ExactSpelling = true)]
-        public static extern void linear_resampler_uninit(ma_linear_resampler* pResampler, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void linear_resampler_uninit(ma_linear_resampler* pResampler, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_process_pcm_frames(ma_linear_resampler* pResampler, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountIn, void* pFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_process_pcm_frames(ma_linear_resampler* pResampler, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountIn, void* pFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_set_rate", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_set_rate(ma_linear_resampler* pResampler, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_set_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_set_rate(ma_linear_resampler* pResampler, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_set_rate_ratio", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_set_rate_ratio(ma_linear_resampler* pResampler, float ratioInOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_set_rate_ratio")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_set_rate_ratio(ma_linear_resampler* pResampler, float ratioInOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_get_input_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_get_input_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong linear_resampler_get_input_latency([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler);
+        public static partial ulong linear_resampler_get_input_latency([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_get_output_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_get_output_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong linear_resampler_get_output_latency([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler);
+        public static partial ulong linear_resampler_get_output_latency([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_get_required_input_frame_count", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_get_required_input_frame_count([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong outputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pInputFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_get_required_input_frame_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_get_required_input_frame_count([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong outputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pInputFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_get_expected_output_frame_count", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_get_expected_output_frame_count([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong inputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pOutputFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_get_expected_output_frame_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_get_expected_output_frame_count([NativeTypeName("const ma_linear_resampler *")] ma_linear_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong inputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pOutputFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_linear_resampler_reset", ExactSpelling = true)]
-        public static extern ma_result linear_resampler_reset(ma_linear_resampler* pResampler);
+        [LibraryImport("miniaudio", EntryPoint = "ma_linear_resampler_reset")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result linear_resampler_reset(ma_linear_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_config_init", ExactSpelling = true)]
-        public static extern ma_resampler_config resampler_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut, ma_resample_algorithm algorithm);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_resampler_config resampler_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut, ma_resample_algorithm algorithm);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result resampler_get_heap_size([NativeTypeName("const ma_resampler_config *")] ma_resampler_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_get_heap_size([NativeTypeName("const ma_resampler_config *")] ma_resampler_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result resampler_init_preallocated([NativeTypeName("const ma_resampler_config *")] ma_resampler_config* pConfig, void* pHeap, ma_resampler* pResampler);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_init_preallocated([NativeTypeName("const ma_resampler_config *")] ma_resampler_config* pConfig, void* pHeap, ma_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_init", ExactSpelling = true)]
-        public static extern ma_result resampler_init([NativeTypeName("const ma_resampler_config *")] ma_resampler_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_resampler* pResampler);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_init([NativeTypeName("const ma_resampler_config *")] ma_resampler_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_uninit", ExactSpelling = true)]
-        public static extern void resampler_uninit(ma_resampler* pResampler, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void resampler_uninit(ma_resampler* pResampler, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resampler_process_pcm_frames(ma_resampler* pResampler, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountIn, void* pFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_process_pcm_frames(ma_resampler* pResampler, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountIn, void* pFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_set_rate", ExactSpelling = true)]
-        public static extern ma_result resampler_set_rate(ma_resampler* pResampler, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_set_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_set_rate(ma_resampler* pResampler, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_set_rate_ratio", ExactSpelling = true)]
-        public static extern ma_result resampler_set_rate_ratio(ma_resampler* pResampler, float ratio);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_set_rate_ratio")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_set_rate_ratio(ma_resampler* pResampler, float ratio);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_get_input_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_get_input_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong resampler_get_input_latency([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler);
+        public static partial ulong resampler_get_input_latency([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_get_output_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_get_output_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong resampler_get_output_latency([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler);
+        public static partial ulong resampler_get_output_latency([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_get_required_input_frame_count", ExactSpelling = true)]
-        public static extern ma_result resampler_get_required_input_frame_count([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong outputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pInputFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_get_required_input_frame_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_get_required_input_frame_count([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong outputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pInputFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_get_expected_output_frame_count", ExactSpelling = true)]
-        public static extern ma_result resampler_get_expected_output_frame_count([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong inputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pOutputFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_get_expected_output_frame_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_get_expected_output_frame_count([NativeTypeName("const ma_resampler *")] ma_resampler* pResampler, [NativeTypeName("ma_uint64")] ulong inputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pOutputFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resampler_reset", ExactSpelling = true)]
-        public static extern ma_result resampler_reset(ma_resampler* pResampler);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resampler_reset")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resampler_reset(ma_resampler* pResampler);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_config_init", ExactSpelling = true)]
-        public static extern ma_channel_converter_config channel_converter_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("const ma_channel *")] byte* pChannelMapIn, [NativeTypeName("ma_uint32")] uint channelsOut, [NativeTypeName("const ma_channel *")] byte* pChannelMapOut, ma_channel_mix_mode mixingMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_channel_converter_config channel_converter_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("const ma_channel *")] byte* pChannelMapIn, [NativeTypeName("ma_uint32")] uint channelsOut, [NativeTypeName("const ma_channel *")] byte* pChannelMapOut, ma_channel_mix_mode mixingMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result channel_converter_get_heap_size([NativeTypeName("const ma_channel_converter_config *")] ma_channel_converter_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result channel_converter_get_heap_size([NativeTypeName("const ma_channel_converter_config *")] ma_channel_converter_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result channel_converter_init_preallocated([NativeTypeName("const ma_channel_converter_config *")] ma_channel_converter_config* pConfig, void* pHeap, ma_channel_converter* pConverter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result channel_converter_init_preallocated([NativeTypeName("const ma_channel_converter_config *")] ma_channel_converter_config* pConfig, void* pHeap, ma_channel_converter* pConverter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_init", ExactSpelling = true)]
-        public static extern ma_result channel_converter_init([NativeTypeName("const ma_channel_converter_config *")] ma_channel_converter_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_channel_converter* pConverter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result channel_converter_init([NativeTypeName("const ma_channel_converter_config *")] ma_channel_converter_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_channel_converter* pConverter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_uninit", ExactSpelling = true)]
-        public static extern void channel_converter_uninit(ma_channel_converter* pConverter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void channel_converter_uninit(ma_channel_converter* pConverter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result channel_converter_process_pcm_frames(ma_channel_converter* pConverter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result channel_converter_process_pcm_frames(ma_channel_converter* pConverter, void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_get_input_channel_map", ExactSpelling = true)]
-        public static extern ma_result channel_converter_get_input_channel_map([NativeTypeName("const ma_channel_converter *")] ma_channel_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_get_input_channel_map")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result channel_converter_get_input_channel_map([NativeTypeName("const ma_channel_converter *")] ma_channel_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_converter_get_output_channel_map", ExactSpelling = true)]
-        public static extern ma_result channel_converter_get_output_channel_map([NativeTypeName("const ma_channel_converter *")] ma_channel_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_converter_get_output_channel_map")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result channel_converter_get_output_channel_map([NativeTypeName("const ma_channel_converter *")] ma_channel_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_config_init_default", ExactSpelling = true)]
-        public static extern ma_data_converter_config data_converter_config_init_default();
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_config_init_default")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_data_converter_config data_converter_config_init_default();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_config_init", ExactSpelling = true)]
-        public static extern ma_data_converter_config data_converter_config_init(ma_format formatIn, ma_format formatOut, [NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("ma_uint32")] uint channelsOut, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_data_converter_config data_converter_config_init(ma_format formatIn, ma_format formatOut, [NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("ma_uint32")] uint channelsOut, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result data_converter_get_heap_size([NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_get_heap_size([NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result data_converter_init_preallocated([NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig, void* pHeap, ma_data_converter* pConverter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_init_preallocated([NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig, void* pHeap, ma_data_converter* pConverter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_init", ExactSpelling = true)]
-        public static extern ma_result data_converter_init([NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_data_converter* pConverter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_init([NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_data_converter* pConverter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_uninit", ExactSpelling = true)]
-        public static extern void data_converter_uninit(ma_data_converter* pConverter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void data_converter_uninit(ma_data_converter* pConverter, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_process_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result data_converter_process_pcm_frames(ma_data_converter* pConverter, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountIn, void* pFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_process_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_process_pcm_frames(ma_data_converter* pConverter, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountIn, void* pFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_set_rate", ExactSpelling = true)]
-        public static extern ma_result data_converter_set_rate(ma_data_converter* pConverter, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_set_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_set_rate(ma_data_converter* pConverter, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_set_rate_ratio", ExactSpelling = true)]
-        public static extern ma_result data_converter_set_rate_ratio(ma_data_converter* pConverter, float ratioInOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_set_rate_ratio")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_set_rate_ratio(ma_data_converter* pConverter, float ratioInOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_get_input_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_get_input_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong data_converter_get_input_latency([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter);
+        public static partial ulong data_converter_get_input_latency([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_get_output_latency", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_get_output_latency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong data_converter_get_output_latency([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter);
+        public static partial ulong data_converter_get_output_latency([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_get_required_input_frame_count", ExactSpelling = true)]
-        public static extern ma_result data_converter_get_required_input_frame_count([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_uint64")] ulong outputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pInputFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_get_required_input_frame_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_get_required_input_frame_count([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_uint64")] ulong outputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pInputFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_get_expected_output_frame_count", ExactSpelling = true)]
-        public static extern ma_result data_converter_get_expected_output_frame_count([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_uint64")] ulong inputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pOutputFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_get_expected_output_frame_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_get_expected_output_frame_count([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_uint64")] ulong inputFrameCount, [NativeTypeName("ma_uint64 *")] ulong* pOutputFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_get_input_channel_map", ExactSpelling = true)]
-        public static extern ma_result data_converter_get_input_channel_map([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_get_input_channel_map")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_get_input_channel_map([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_get_output_channel_map", ExactSpelling = true)]
-        public static extern ma_result data_converter_get_output_channel_map([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_get_output_channel_map")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_get_output_channel_map([NativeTypeName("const ma_data_converter *")] ma_data_converter* pConverter, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_converter_reset", ExactSpelling = true)]
-        public static extern ma_result data_converter_reset(ma_data_converter* pConverter);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_converter_reset")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_converter_reset(ma_data_converter* pConverter);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_u8_to_s16", ExactSpelling = true)]
-        public static extern void pcm_u8_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_u8_to_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_u8_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_u8_to_s24", ExactSpelling = true)]
-        public static extern void pcm_u8_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_u8_to_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_u8_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_u8_to_s32", ExactSpelling = true)]
-        public static extern void pcm_u8_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_u8_to_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_u8_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_u8_to_f32", ExactSpelling = true)]
-        public static extern void pcm_u8_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_u8_to_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_u8_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s16_to_u8", ExactSpelling = true)]
-        public static extern void pcm_s16_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s16_to_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s16_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s16_to_s24", ExactSpelling = true)]
-        public static extern void pcm_s16_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s16_to_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s16_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s16_to_s32", ExactSpelling = true)]
-        public static extern void pcm_s16_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s16_to_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s16_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s16_to_f32", ExactSpelling = true)]
-        public static extern void pcm_s16_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s16_to_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s16_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s24_to_u8", ExactSpelling = true)]
-        public static extern void pcm_s24_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s24_to_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s24_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s24_to_s16", ExactSpelling = true)]
-        public static extern void pcm_s24_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s24_to_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s24_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s24_to_s32", ExactSpelling = true)]
-        public static extern void pcm_s24_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s24_to_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s24_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s24_to_f32", ExactSpelling = true)]
-        public static extern void pcm_s24_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s24_to_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s24_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s32_to_u8", ExactSpelling = true)]
-        public static extern void pcm_s32_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s32_to_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s32_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s32_to_s16", ExactSpelling = true)]
-        public static extern void pcm_s32_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s32_to_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s32_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s32_to_s24", ExactSpelling = true)]
-        public static extern void pcm_s32_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s32_to_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s32_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_s32_to_f32", ExactSpelling = true)]
-        public static extern void pcm_s32_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_s32_to_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_s32_to_f32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_f32_to_u8", ExactSpelling = true)]
-        public static extern void pcm_f32_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_f32_to_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_f32_to_u8(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_f32_to_s16", ExactSpelling = true)]
-        public static extern void pcm_f32_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_f32_to_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_f32_to_s16(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_f32_to_s24", ExactSpelling = true)]
-        public static extern void pcm_f32_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_f32_to_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_f32_to_s24(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_f32_to_s32", ExactSpelling = true)]
-        public static extern void pcm_f32_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_f32_to_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_f32_to_s32(void* pOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong count, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_convert", ExactSpelling = true)]
-        public static extern void pcm_convert(void* pOut, ma_format formatOut, [NativeTypeName("const void *")] void* pIn, ma_format formatIn, [NativeTypeName("ma_uint64")] ulong sampleCount, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_convert")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_convert(void* pOut, ma_format formatOut, [NativeTypeName("const void *")] void* pIn, ma_format formatIn, [NativeTypeName("ma_uint64")] ulong sampleCount, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_convert_pcm_frames_format", ExactSpelling = true)]
-        public static extern void convert_pcm_frames_format(void* pOut, ma_format formatOut, [NativeTypeName("const void *")] void* pIn, ma_format formatIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, ma_dither_mode ditherMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_convert_pcm_frames_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void convert_pcm_frames_format(void* pOut, ma_format formatOut, [NativeTypeName("const void *")] void* pIn, ma_format formatIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, ma_dither_mode ditherMode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_deinterleave_pcm_frames", ExactSpelling = true)]
-        public static extern void deinterleave_pcm_frames(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("const void *")] void* pInterleavedPCMFrames, void** ppDeinterleavedPCMFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_deinterleave_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void deinterleave_pcm_frames(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("const void *")] void* pInterleavedPCMFrames, void** ppDeinterleavedPCMFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_interleave_pcm_frames", ExactSpelling = true)]
-        public static extern void interleave_pcm_frames(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("const void **")] void** ppDeinterleavedPCMFrames, void* pInterleavedPCMFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_interleave_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void interleave_pcm_frames(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("const void **")] void** ppDeinterleavedPCMFrames, void* pInterleavedPCMFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_get_channel", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_get_channel")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_channel")]
-        public static extern byte channel_map_get_channel([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channelCount, [NativeTypeName("ma_uint32")] uint channelIndex);
+        public static partial byte channel_map_get_channel([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channelCount, [NativeTypeName("ma_uint32")] uint channelIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_init_blank", ExactSpelling = true)]
-        public static extern void channel_map_init_blank([NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_init_blank")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void channel_map_init_blank([NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_init_standard", ExactSpelling = true)]
-        public static extern void channel_map_init_standard(ma_standard_channel_map standardChannelMap, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_init_standard")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void channel_map_init_standard(ma_standard_channel_map standardChannelMap, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_copy", ExactSpelling = true)]
-        public static extern void channel_map_copy([NativeTypeName("ma_channel *")] byte* pOut, [NativeTypeName("const ma_channel *")] byte* pIn, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_copy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void channel_map_copy([NativeTypeName("ma_channel *")] byte* pOut, [NativeTypeName("const ma_channel *")] byte* pIn, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_copy_or_default", ExactSpelling = true)]
-        public static extern void channel_map_copy_or_default([NativeTypeName("ma_channel *")] byte* pOut, [NativeTypeName("size_t")] nuint channelMapCapOut, [NativeTypeName("const ma_channel *")] byte* pIn, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_copy_or_default")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void channel_map_copy_or_default([NativeTypeName("ma_channel *")] byte* pOut, [NativeTypeName("size_t")] nuint channelMapCapOut, [NativeTypeName("const ma_channel *")] byte* pIn, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_is_valid", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_is_valid")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint channel_map_is_valid([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels);
+        public static partial uint channel_map_is_valid([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_is_equal", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_is_equal")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint channel_map_is_equal([NativeTypeName("const ma_channel *")] byte* pChannelMapA, [NativeTypeName("const ma_channel *")] byte* pChannelMapB, [NativeTypeName("ma_uint32")] uint channels);
+        public static partial uint channel_map_is_equal([NativeTypeName("const ma_channel *")] byte* pChannelMapA, [NativeTypeName("const ma_channel *")] byte* pChannelMapB, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_is_blank", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_is_blank")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint channel_map_is_blank([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels);
+        public static partial uint channel_map_is_blank([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_contains_channel_position", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_contains_channel_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint channel_map_contains_channel_position([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_channel")] byte channelPosition);
+        public static partial uint channel_map_contains_channel_position([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_channel")] byte channelPosition);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_find_channel_position", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_find_channel_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint channel_map_find_channel_position([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_channel")] byte channelPosition, [NativeTypeName("ma_uint32 *")] uint* pChannelIndex);
+        public static partial uint channel_map_find_channel_position([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_channel")] byte channelPosition, [NativeTypeName("ma_uint32 *")] uint* pChannelIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_map_to_string", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_map_to_string")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("size_t")]
-        public static extern nuint channel_map_to_string([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("char *")] sbyte* pBufferOut, [NativeTypeName("size_t")] nuint bufferCap);
+        public static partial nuint channel_map_to_string([NativeTypeName("const ma_channel *")] byte* pChannelMap, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("char *")] sbyte* pBufferOut, [NativeTypeName("size_t")] nuint bufferCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_channel_position_to_string", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_channel_position_to_string")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("const char *")]
-        public static extern sbyte* channel_position_to_string([NativeTypeName("ma_channel")] byte channel);
+        public static partial sbyte* channel_position_to_string([NativeTypeName("ma_channel")] byte channel);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_convert_frames", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_convert_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong convert_frames(void* pOut, [NativeTypeName("ma_uint64")] ulong frameCountOut, ma_format formatOut, [NativeTypeName("ma_uint32")] uint channelsOut, [NativeTypeName("ma_uint32")] uint sampleRateOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong frameCountIn, ma_format formatIn, [NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("ma_uint32")] uint sampleRateIn);
+        public static partial ulong convert_frames(void* pOut, [NativeTypeName("ma_uint64")] ulong frameCountOut, ma_format formatOut, [NativeTypeName("ma_uint32")] uint channelsOut, [NativeTypeName("ma_uint32")] uint sampleRateOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong frameCountIn, ma_format formatIn, [NativeTypeName("ma_uint32")] uint channelsIn, [NativeTypeName("ma_uint32")] uint sampleRateIn);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_convert_frames_ex", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_convert_frames_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong convert_frames_ex(void* pOut, [NativeTypeName("ma_uint64")] ulong frameCountOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong frameCountIn, [NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig);
+        public static partial ulong convert_frames_ex(void* pOut, [NativeTypeName("ma_uint64")] ulong frameCountOut, [NativeTypeName("const void *")] void* pIn, [NativeTypeName("ma_uint64")] ulong frameCountIn, [NativeTypeName("const ma_data_converter_config *")] ma_data_converter_config* pConfig);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_config_init", ExactSpelling = true)]
-        public static extern ma_data_source_config data_source_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_data_source_config data_source_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_init", ExactSpelling = true)]
-        public static extern ma_result data_source_init([NativeTypeName("const ma_data_source_config *")] ma_data_source_config* pConfig, [NativeTypeName("ma_data_source *")] void* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_init([NativeTypeName("const ma_data_source_config *")] ma_data_source_config* pConfig, [NativeTypeName("ma_data_source *")] void* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_uninit", ExactSpelling = true)]
-        public static extern void data_source_uninit([NativeTypeName("ma_data_source *")] void* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void data_source_uninit([NativeTypeName("ma_data_source *")] void* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result data_source_read_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_read_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_seek_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result data_source_seek_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesSeeked);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_seek_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_seek_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesSeeked);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result data_source_seek_to_pcm_frame([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_seek_to_pcm_frame([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_seek_seconds", ExactSpelling = true)]
-        public static extern ma_result data_source_seek_seconds([NativeTypeName("ma_data_source *")] void* pDataSource, float secondCount, float* pSecondsSeeked);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_seek_seconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_seek_seconds([NativeTypeName("ma_data_source *")] void* pDataSource, float secondCount, float* pSecondsSeeked);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_seek_to_second", ExactSpelling = true)]
-        public static extern ma_result data_source_seek_to_second([NativeTypeName("ma_data_source *")] void* pDataSource, float seekPointInSeconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_seek_to_second")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_seek_to_second([NativeTypeName("ma_data_source *")] void* pDataSource, float seekPointInSeconds);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_data_format", ExactSpelling = true)]
-        public static extern ma_result data_source_get_data_format([NativeTypeName("ma_data_source *")] void* pDataSource, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_get_data_format([NativeTypeName("ma_data_source *")] void* pDataSource, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result data_source_get_cursor_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_get_cursor_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result data_source_get_length_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_get_length_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_cursor_in_seconds", ExactSpelling = true)]
-        public static extern ma_result data_source_get_cursor_in_seconds([NativeTypeName("ma_data_source *")] void* pDataSource, float* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_cursor_in_seconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_get_cursor_in_seconds([NativeTypeName("ma_data_source *")] void* pDataSource, float* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_length_in_seconds", ExactSpelling = true)]
-        public static extern ma_result data_source_get_length_in_seconds([NativeTypeName("ma_data_source *")] void* pDataSource, float* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_length_in_seconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_get_length_in_seconds([NativeTypeName("ma_data_source *")] void* pDataSource, float* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_set_looping", ExactSpelling = true)]
-        public static extern ma_result data_source_set_looping([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_bool32")] uint isLooping);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_set_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_set_looping([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_bool32")] uint isLooping);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_is_looping", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_is_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint data_source_is_looping([NativeTypeName("const ma_data_source *")] void* pDataSource);
+        public static partial uint data_source_is_looping([NativeTypeName("const ma_data_source *")] void* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_set_range_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result data_source_set_range_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong rangeBegInFrames, [NativeTypeName("ma_uint64")] ulong rangeEndInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_set_range_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_set_range_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong rangeBegInFrames, [NativeTypeName("ma_uint64")] ulong rangeEndInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_range_in_pcm_frames", ExactSpelling = true)]
-        public static extern void data_source_get_range_in_pcm_frames([NativeTypeName("const ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pRangeBegInFrames, [NativeTypeName("ma_uint64 *")] ulong* pRangeEndInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_range_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void data_source_get_range_in_pcm_frames([NativeTypeName("const ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pRangeBegInFrames, [NativeTypeName("ma_uint64 *")] ulong* pRangeEndInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_set_loop_point_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result data_source_set_loop_point_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong loopBegInFrames, [NativeTypeName("ma_uint64")] ulong loopEndInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_set_loop_point_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_set_loop_point_in_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64")] ulong loopBegInFrames, [NativeTypeName("ma_uint64")] ulong loopEndInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_loop_point_in_pcm_frames", ExactSpelling = true)]
-        public static extern void data_source_get_loop_point_in_pcm_frames([NativeTypeName("const ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pLoopBegInFrames, [NativeTypeName("ma_uint64 *")] ulong* pLoopEndInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_loop_point_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void data_source_get_loop_point_in_pcm_frames([NativeTypeName("const ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pLoopBegInFrames, [NativeTypeName("ma_uint64 *")] ulong* pLoopEndInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_set_current", ExactSpelling = true)]
-        public static extern ma_result data_source_set_current([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_data_source *")] void* pCurrentDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_set_current")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_set_current([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_data_source *")] void* pCurrentDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_current", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_current")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_data_source *")]
-        public static extern void* data_source_get_current([NativeTypeName("const ma_data_source *")] void* pDataSource);
+        public static partial void* data_source_get_current([NativeTypeName("const ma_data_source *")] void* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_set_next", ExactSpelling = true)]
-        public static extern ma_result data_source_set_next([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_data_source *")] void* pNextDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_set_next")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_set_next([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_data_source *")] void* pNextDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_next", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_next")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_data_source *")]
-        public static extern void* data_source_get_next([NativeTypeName("const ma_data_source *")] void* pDataSource);
+        public static partial void* data_source_get_next([NativeTypeName("const ma_data_source *")] void* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_set_next_callback", ExactSpelling = true)]
-        public static extern ma_result data_source_set_next_callback([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_data_source_get_next_proc")] delegate* unmanaged[Cdecl]<void*, void*> onGetNext);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_set_next_callback")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_set_next_callback([NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_data_source_get_next_proc")] delegate* unmanaged[Cdecl]<void*, void*> onGetNext);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_get_next_callback", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_get_next_callback")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_data_source_get_next_proc")]
-        public static extern delegate* unmanaged[Cdecl]<void*, void*> data_source_get_next_callback([NativeTypeName("const ma_data_source *")] void* pDataSource);
+        public static partial delegate* unmanaged[Cdecl]<void*, void*> data_source_get_next_callback([NativeTypeName("const ma_data_source *")] void* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_init", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong sizeInFrames, ma_audio_buffer_ref* pAudioBufferRef);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong sizeInFrames, ma_audio_buffer_ref* pAudioBufferRef);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_uninit", ExactSpelling = true)]
-        public static extern void audio_buffer_ref_uninit(ma_audio_buffer_ref* pAudioBufferRef);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void audio_buffer_ref_uninit(ma_audio_buffer_ref* pAudioBufferRef);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_set_data", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_set_data(ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong sizeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_set_data")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_set_data(ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong sizeInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_read_pcm_frames", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong audio_buffer_ref_read_pcm_frames(ma_audio_buffer_ref* pAudioBufferRef, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_bool32")] uint loop);
+        public static partial ulong audio_buffer_ref_read_pcm_frames(ma_audio_buffer_ref* pAudioBufferRef, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_bool32")] uint loop);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_seek_to_pcm_frame(ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_seek_to_pcm_frame(ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_map", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_map(ma_audio_buffer_ref* pAudioBufferRef, void** ppFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_map")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_map(ma_audio_buffer_ref* pAudioBufferRef, void** ppFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_unmap", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_unmap(ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_unmap")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_unmap(ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_at_end", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_at_end")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint audio_buffer_ref_at_end([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef);
+        public static partial uint audio_buffer_ref_at_end([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_get_cursor_in_pcm_frames([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_get_cursor_in_pcm_frames([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_get_length_in_pcm_frames([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_get_length_in_pcm_frames([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_ref_get_available_frames", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_ref_get_available_frames([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_ref_get_available_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_ref_get_available_frames([NativeTypeName("const ma_audio_buffer_ref *")] ma_audio_buffer_ref* pAudioBufferRef, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_config_init", ExactSpelling = true)]
-        public static extern ma_audio_buffer_config audio_buffer_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint64")] ulong sizeInFrames, [NativeTypeName("const void *")] void* pData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_audio_buffer_config audio_buffer_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint64")] ulong sizeInFrames, [NativeTypeName("const void *")] void* pData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_init", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_init([NativeTypeName("const ma_audio_buffer_config *")] ma_audio_buffer_config* pConfig, ma_audio_buffer* pAudioBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_init([NativeTypeName("const ma_audio_buffer_config *")] ma_audio_buffer_config* pConfig, ma_audio_buffer* pAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_init_copy", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_init_copy([NativeTypeName("const ma_audio_buffer_config *")] ma_audio_buffer_config* pConfig, ma_audio_buffer* pAudioBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_init_copy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_init_copy([NativeTypeName("const ma_audio_buffer_config *")] ma_audio_buffer_config* pConfig, ma_audio_buffer* pAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_alloc_and_init", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_alloc_and_init([NativeTypeName("const ma_audio_buffer_config *")] ma_audio_buffer_config* pConfig, ma_audio_buffer** ppAudioBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_alloc_and_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_alloc_and_init([NativeTypeName("const ma_audio_buffer_config *")] ma_audio_buffer_config* pConfig, ma_audio_buffer** ppAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_uninit", ExactSpelling = true)]
-        public static extern void audio_buffer_uninit(ma_audio_buffer* pAudioBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void audio_buffer_uninit(ma_audio_buffer* pAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_uninit_and_free", ExactSpelling = true)]
-        public static extern void audio_buffer_uninit_and_free(ma_audio_buffer* pAudioBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_uninit_and_free")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void audio_buffer_uninit_and_free(ma_audio_buffer* pAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_read_pcm_frames", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong audio_buffer_read_pcm_frames(ma_audio_buffer* pAudioBuffer, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_bool32")] uint loop);
+        public static partial ulong audio_buffer_read_pcm_frames(ma_audio_buffer* pAudioBuffer, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_bool32")] uint loop);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_seek_to_pcm_frame(ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_seek_to_pcm_frame(ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_map", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_map(ma_audio_buffer* pAudioBuffer, void** ppFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_map")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_map(ma_audio_buffer* pAudioBuffer, void** ppFramesOut, [NativeTypeName("ma_uint64 *")] ulong* pFrameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_unmap", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_unmap(ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64")] ulong frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_unmap")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_unmap(ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64")] ulong frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_at_end", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_at_end")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint audio_buffer_at_end([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer);
+        public static partial uint audio_buffer_at_end([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_get_cursor_in_pcm_frames([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_get_cursor_in_pcm_frames([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_get_length_in_pcm_frames([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_get_length_in_pcm_frames([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_audio_buffer_get_available_frames", ExactSpelling = true)]
-        public static extern ma_result audio_buffer_get_available_frames([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_audio_buffer_get_available_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result audio_buffer_get_available_frames([NativeTypeName("const ma_audio_buffer *")] ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_init", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_data_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, ma_paged_audio_buffer_data* pData);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_data_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, ma_paged_audio_buffer_data* pData);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_uninit", ExactSpelling = true)]
-        public static extern void paged_audio_buffer_data_uninit(ma_paged_audio_buffer_data* pData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void paged_audio_buffer_data_uninit(ma_paged_audio_buffer_data* pData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_get_head", ExactSpelling = true)]
-        public static extern ma_paged_audio_buffer_page* paged_audio_buffer_data_get_head(ma_paged_audio_buffer_data* pData);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_get_head")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_paged_audio_buffer_page* paged_audio_buffer_data_get_head(ma_paged_audio_buffer_data* pData);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_get_tail", ExactSpelling = true)]
-        public static extern ma_paged_audio_buffer_page* paged_audio_buffer_data_get_tail(ma_paged_audio_buffer_data* pData);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_get_tail")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_paged_audio_buffer_page* paged_audio_buffer_data_get_tail(ma_paged_audio_buffer_data* pData);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_data_get_length_in_pcm_frames(ma_paged_audio_buffer_data* pData, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_data_get_length_in_pcm_frames(ma_paged_audio_buffer_data* pData, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_allocate_page", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_data_allocate_page(ma_paged_audio_buffer_data* pData, [NativeTypeName("ma_uint64")] ulong pageSizeInFrames, [NativeTypeName("const void *")] void* pInitialData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_paged_audio_buffer_page** ppPage);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_allocate_page")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_data_allocate_page(ma_paged_audio_buffer_data* pData, [NativeTypeName("ma_uint64")] ulong pageSizeInFrames, [NativeTypeName("const void *")] void* pInitialData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_paged_audio_buffer_page** ppPage);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_free_page", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_data_free_page(ma_paged_audio_buffer_data* pData, ma_paged_audio_buffer_page* pPage, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_free_page")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_data_free_page(ma_paged_audio_buffer_data* pData, ma_paged_audio_buffer_page* pPage, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_append_page", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_data_append_page(ma_paged_audio_buffer_data* pData, ma_paged_audio_buffer_page* pPage);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_append_page")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_data_append_page(ma_paged_audio_buffer_data* pData, ma_paged_audio_buffer_page* pPage);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_data_allocate_and_append_page", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_data_allocate_and_append_page(ma_paged_audio_buffer_data* pData, [NativeTypeName("ma_uint32")] uint pageSizeInFrames, [NativeTypeName("const void *")] void* pInitialData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_data_allocate_and_append_page")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_data_allocate_and_append_page(ma_paged_audio_buffer_data* pData, [NativeTypeName("ma_uint32")] uint pageSizeInFrames, [NativeTypeName("const void *")] void* pInitialData, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_config_init", ExactSpelling = true)]
-        public static extern ma_paged_audio_buffer_config paged_audio_buffer_config_init(ma_paged_audio_buffer_data* pData);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_paged_audio_buffer_config paged_audio_buffer_config_init(ma_paged_audio_buffer_data* pData);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_init", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_init([NativeTypeName("const ma_paged_audio_buffer_config *")] ma_paged_audio_buffer_config* pConfig, ma_paged_audio_buffer* pPagedAudioBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_init([NativeTypeName("const ma_paged_audio_buffer_config *")] ma_paged_audio_buffer_config* pConfig, ma_paged_audio_buffer* pPagedAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_uninit", ExactSpelling = true)]
-        public static extern void paged_audio_buffer_uninit(ma_paged_audio_buffer* pPagedAudioBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void paged_audio_buffer_uninit(ma_paged_audio_buffer* pPagedAudioBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_read_pcm_frames(ma_paged_audio_buffer* pPagedAudioBuffer, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_read_pcm_frames(ma_paged_audio_buffer* pPagedAudioBuffer, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_seek_to_pcm_frame(ma_paged_audio_buffer* pPagedAudioBuffer, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_seek_to_pcm_frame(ma_paged_audio_buffer* pPagedAudioBuffer, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_get_cursor_in_pcm_frames(ma_paged_audio_buffer* pPagedAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_get_cursor_in_pcm_frames(ma_paged_audio_buffer* pPagedAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_paged_audio_buffer_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result paged_audio_buffer_get_length_in_pcm_frames(ma_paged_audio_buffer* pPagedAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_paged_audio_buffer_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result paged_audio_buffer_get_length_in_pcm_frames(ma_paged_audio_buffer* pPagedAudioBuffer, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_init_ex", ExactSpelling = true)]
-        public static extern ma_result rb_init_ex([NativeTypeName("size_t")] nuint subbufferSizeInBytes, [NativeTypeName("size_t")] nuint subbufferCount, [NativeTypeName("size_t")] nuint subbufferStrideInBytes, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_init_ex([NativeTypeName("size_t")] nuint subbufferSizeInBytes, [NativeTypeName("size_t")] nuint subbufferCount, [NativeTypeName("size_t")] nuint subbufferStrideInBytes, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_init", ExactSpelling = true)]
-        public static extern ma_result rb_init([NativeTypeName("size_t")] nuint bufferSizeInBytes, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_init([NativeTypeName("size_t")] nuint bufferSizeInBytes, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_uninit", ExactSpelling = true)]
-        public static extern void rb_uninit(ma_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void rb_uninit(ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_reset", ExactSpelling = true)]
-        public static extern void rb_reset(ma_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_reset")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void rb_reset(ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_acquire_read", ExactSpelling = true)]
-        public static extern ma_result rb_acquire_read(ma_rb* pRB, [NativeTypeName("size_t *")] nuint* pSizeInBytes, void** ppBufferOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_acquire_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_acquire_read(ma_rb* pRB, [NativeTypeName("size_t *")] nuint* pSizeInBytes, void** ppBufferOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_commit_read", ExactSpelling = true)]
-        public static extern ma_result rb_commit_read(ma_rb* pRB, [NativeTypeName("size_t")] nuint sizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_commit_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_commit_read(ma_rb* pRB, [NativeTypeName("size_t")] nuint sizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_acquire_write", ExactSpelling = true)]
-        public static extern ma_result rb_acquire_write(ma_rb* pRB, [NativeTypeName("size_t *")] nuint* pSizeInBytes, void** ppBufferOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_acquire_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_acquire_write(ma_rb* pRB, [NativeTypeName("size_t *")] nuint* pSizeInBytes, void** ppBufferOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_commit_write", ExactSpelling = true)]
-        public static extern ma_result rb_commit_write(ma_rb* pRB, [NativeTypeName("size_t")] nuint sizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_commit_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_commit_write(ma_rb* pRB, [NativeTypeName("size_t")] nuint sizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_seek_read", ExactSpelling = true)]
-        public static extern ma_result rb_seek_read(ma_rb* pRB, [NativeTypeName("size_t")] nuint offsetInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_seek_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_seek_read(ma_rb* pRB, [NativeTypeName("size_t")] nuint offsetInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_seek_write", ExactSpelling = true)]
-        public static extern ma_result rb_seek_write(ma_rb* pRB, [NativeTypeName("size_t")] nuint offsetInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_seek_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result rb_seek_write(ma_rb* pRB, [NativeTypeName("size_t")] nuint offsetInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_pointer_distance", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_pointer_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_int32")]
-        public static extern int rb_pointer_distance(ma_rb* pRB);
+        public static partial int rb_pointer_distance(ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_available_read", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_available_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint rb_available_read(ma_rb* pRB);
+        public static partial uint rb_available_read(ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_available_write", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_available_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint rb_available_write(ma_rb* pRB);
+        public static partial uint rb_available_write(ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_get_subbuffer_size", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_get_subbuffer_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("size_t")]
-        public static extern nuint rb_get_subbuffer_size(ma_rb* pRB);
+        public static partial nuint rb_get_subbuffer_size(ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_get_subbuffer_stride", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_get_subbuffer_stride")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("size_t")]
-        public static extern nuint rb_get_subbuffer_stride(ma_rb* pRB);
+        public static partial nuint rb_get_subbuffer_stride(ma_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_get_subbuffer_offset", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_get_subbuffer_offset")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("size_t")]
-        public static extern nuint rb_get_subbuffer_offset(ma_rb* pRB, [NativeTypeName("size_t")] nuint subbufferIndex);
+        public static partial nuint rb_get_subbuffer_offset(ma_rb* pRB, [NativeTypeName("size_t")] nuint subbufferIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_rb_get_subbuffer_ptr", ExactSpelling = true)]
-        public static extern void* rb_get_subbuffer_ptr(ma_rb* pRB, [NativeTypeName("size_t")] nuint subbufferIndex, void* pBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_rb_get_subbuffer_ptr")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* rb_get_subbuffer_ptr(ma_rb* pRB, [NativeTypeName("size_t")] nuint subbufferIndex, void* pBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_init_ex", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_init_ex(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint subbufferSizeInFrames, [NativeTypeName("ma_uint32")] uint subbufferCount, [NativeTypeName("ma_uint32")] uint subbufferStrideInFrames, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_pcm_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_init_ex(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint subbufferSizeInFrames, [NativeTypeName("ma_uint32")] uint subbufferCount, [NativeTypeName("ma_uint32")] uint subbufferStrideInFrames, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_init", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint bufferSizeInFrames, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_pcm_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint bufferSizeInFrames, void* pOptionalPreallocatedBuffer, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_uninit", ExactSpelling = true)]
-        public static extern void pcm_rb_uninit(ma_pcm_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_rb_uninit(ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_reset", ExactSpelling = true)]
-        public static extern void pcm_rb_reset(ma_pcm_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_reset")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_rb_reset(ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_acquire_read", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_acquire_read(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32 *")] uint* pSizeInFrames, void** ppBufferOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_acquire_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_acquire_read(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32 *")] uint* pSizeInFrames, void** ppBufferOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_commit_read", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_commit_read(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint sizeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_commit_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_commit_read(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint sizeInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_acquire_write", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_acquire_write(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32 *")] uint* pSizeInFrames, void** ppBufferOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_acquire_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_acquire_write(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32 *")] uint* pSizeInFrames, void** ppBufferOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_commit_write", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_commit_write(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint sizeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_commit_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_commit_write(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint sizeInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_seek_read", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_seek_read(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint offsetInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_seek_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_seek_read(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint offsetInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_seek_write", ExactSpelling = true)]
-        public static extern ma_result pcm_rb_seek_write(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint offsetInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_seek_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pcm_rb_seek_write(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint offsetInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_pointer_distance", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_pointer_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_int32")]
-        public static extern int pcm_rb_pointer_distance(ma_pcm_rb* pRB);
+        public static partial int pcm_rb_pointer_distance(ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_available_read", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_available_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint pcm_rb_available_read(ma_pcm_rb* pRB);
+        public static partial uint pcm_rb_available_read(ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_available_write", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_available_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint pcm_rb_available_write(ma_pcm_rb* pRB);
+        public static partial uint pcm_rb_available_write(ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_get_subbuffer_size", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_get_subbuffer_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint pcm_rb_get_subbuffer_size(ma_pcm_rb* pRB);
+        public static partial uint pcm_rb_get_subbuffer_size(ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_get_subbuffer_stride", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_get_subbuffer_stride")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint pcm_rb_get_subbuffer_stride(ma_pcm_rb* pRB);
+        public static partial uint pcm_rb_get_subbuffer_stride(ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_get_subbuffer_offset", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_get_subbuffer_offset")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint pcm_rb_get_subbuffer_offset(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint subbufferIndex);
+        public static partial uint pcm_rb_get_subbuffer_offset(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint subbufferIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_get_subbuffer_ptr", ExactSpelling = true)]
-        public static extern void* pcm_rb_get_subbuffer_ptr(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint subbufferIndex, void* pBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_get_subbuffer_ptr")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* pcm_rb_get_subbuffer_ptr(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint subbufferIndex, void* pBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_get_format", ExactSpelling = true)]
-        public static extern ma_format pcm_rb_get_format([NativeTypeName("const ma_pcm_rb *")] ma_pcm_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_get_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_format pcm_rb_get_format([NativeTypeName("const ma_pcm_rb *")] ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_get_channels", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_get_channels")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint pcm_rb_get_channels([NativeTypeName("const ma_pcm_rb *")] ma_pcm_rb* pRB);
+        public static partial uint pcm_rb_get_channels([NativeTypeName("const ma_pcm_rb *")] ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_get_sample_rate", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_get_sample_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint pcm_rb_get_sample_rate([NativeTypeName("const ma_pcm_rb *")] ma_pcm_rb* pRB);
+        public static partial uint pcm_rb_get_sample_rate([NativeTypeName("const ma_pcm_rb *")] ma_pcm_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pcm_rb_set_sample_rate", ExactSpelling = true)]
-        public static extern void pcm_rb_set_sample_rate(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pcm_rb_set_sample_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pcm_rb_set_sample_rate(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_duplex_rb_init", ExactSpelling = true)]
-        public static extern ma_result duplex_rb_init(ma_format captureFormat, [NativeTypeName("ma_uint32")] uint captureChannels, [NativeTypeName("ma_uint32")] uint sampleRate, [NativeTypeName("ma_uint32")] uint captureInternalSampleRate, [NativeTypeName("ma_uint32")] uint captureInternalPeriodSizeInFrames, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_duplex_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_duplex_rb_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result duplex_rb_init(ma_format captureFormat, [NativeTypeName("ma_uint32")] uint captureChannels, [NativeTypeName("ma_uint32")] uint sampleRate, [NativeTypeName("ma_uint32")] uint captureInternalSampleRate, [NativeTypeName("ma_uint32")] uint captureInternalPeriodSizeInFrames, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_duplex_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_duplex_rb_uninit", ExactSpelling = true)]
-        public static extern ma_result duplex_rb_uninit(ma_duplex_rb* pRB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_duplex_rb_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result duplex_rb_uninit(ma_duplex_rb* pRB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_result_description", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_result_description")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("const char *")]
-        public static extern sbyte* result_description(ma_result result);
+        public static partial sbyte* result_description(ma_result result);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_malloc", ExactSpelling = true)]
-        public static extern void* malloc([NativeTypeName("size_t")] nuint sz, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_malloc")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* malloc([NativeTypeName("size_t")] nuint sz, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_calloc", ExactSpelling = true)]
-        public static extern void* calloc([NativeTypeName("size_t")] nuint sz, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_calloc")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* calloc([NativeTypeName("size_t")] nuint sz, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_realloc", ExactSpelling = true)]
-        public static extern void* realloc(void* p, [NativeTypeName("size_t")] nuint sz, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_realloc")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* realloc(void* p, [NativeTypeName("size_t")] nuint sz, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_free", ExactSpelling = true)]
-        public static extern void free(void* p, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_free")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void free(void* p, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_aligned_malloc", ExactSpelling = true)]
-        public static extern void* aligned_malloc([NativeTypeName("size_t")] nuint sz, [NativeTypeName("size_t")] nuint alignment, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_aligned_malloc")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* aligned_malloc([NativeTypeName("size_t")] nuint sz, [NativeTypeName("size_t")] nuint alignment, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_aligned_free", ExactSpelling = true)]
-        public static extern void aligned_free(void* p, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_aligned_free")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void aligned_free(void* p, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_get_format_name", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_get_format_name")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("const char *")]
-        public static extern sbyte* get_format_name(ma_format format);
+        public static partial sbyte* get_format_name(ma_format format);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_blend_f32", ExactSpelling = true)]
-        public static extern void blend_f32(float* pOut, float* pInA, float* pInB, float factor, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_blend_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void blend_f32(float* pOut, float* pInA, float* pInB, float factor, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_get_bytes_per_sample", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_get_bytes_per_sample")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint get_bytes_per_sample(ma_format format);
+        public static partial uint get_bytes_per_sample(ma_format format);
 
         [return: NativeTypeName("ma_uint32")]
         public static uint get_bytes_per_frame(ma_format format, [NativeTypeName("ma_uint32")] uint channels)
@@ -6573,285 +7275,374 @@ namespace Miniaudio
             return get_bytes_per_sample(format) * channels;
         }
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_log_level_to_string", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_log_level_to_string")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("const char *")]
-        public static extern sbyte* log_level_to_string([NativeTypeName("ma_uint32")] uint logLevel);
+        public static partial sbyte* log_level_to_string([NativeTypeName("ma_uint32")] uint logLevel);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spinlock_lock", ExactSpelling = true)]
-        public static extern ma_result spinlock_lock([NativeTypeName("ma_spinlock *")] uint* pSpinlock);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spinlock_lock")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spinlock_lock([NativeTypeName("ma_spinlock *")] uint* pSpinlock);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spinlock_lock_noyield", ExactSpelling = true)]
-        public static extern ma_result spinlock_lock_noyield([NativeTypeName("ma_spinlock *")] uint* pSpinlock);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spinlock_lock_noyield")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spinlock_lock_noyield([NativeTypeName("ma_spinlock *")] uint* pSpinlock);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_spinlock_unlock", ExactSpelling = true)]
-        public static extern ma_result spinlock_unlock([NativeTypeName("ma_spinlock *")] uint* pSpinlock);
+        [LibraryImport("miniaudio", EntryPoint = "ma_spinlock_unlock")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result spinlock_unlock([NativeTypeName("ma_spinlock *")] uint* pSpinlock);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_mutex_init", ExactSpelling = true)]
-        public static extern ma_result mutex_init([NativeTypeName("ma_mutex *")] void** pMutex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_mutex_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result mutex_init([NativeTypeName("ma_mutex *")] void** pMutex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_mutex_uninit", ExactSpelling = true)]
-        public static extern void mutex_uninit([NativeTypeName("ma_mutex *")] void** pMutex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_mutex_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void mutex_uninit([NativeTypeName("ma_mutex *")] void** pMutex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_mutex_lock", ExactSpelling = true)]
-        public static extern void mutex_lock([NativeTypeName("ma_mutex *")] void** pMutex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_mutex_lock")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void mutex_lock([NativeTypeName("ma_mutex *")] void** pMutex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_mutex_unlock", ExactSpelling = true)]
-        public static extern void mutex_unlock([NativeTypeName("ma_mutex *")] void** pMutex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_mutex_unlock")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void mutex_unlock([NativeTypeName("ma_mutex *")] void** pMutex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_event_init", ExactSpelling = true)]
-        public static extern ma_result event_init([NativeTypeName("ma_event *")] void** pEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_event_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result event_init([NativeTypeName("ma_event *")] void** pEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_event_uninit", ExactSpelling = true)]
-        public static extern void event_uninit([NativeTypeName("ma_event *")] void** pEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_event_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void event_uninit([NativeTypeName("ma_event *")] void** pEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_event_wait", ExactSpelling = true)]
-        public static extern ma_result event_wait([NativeTypeName("ma_event *")] void** pEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_event_wait")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result event_wait([NativeTypeName("ma_event *")] void** pEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_event_signal", ExactSpelling = true)]
-        public static extern ma_result event_signal([NativeTypeName("ma_event *")] void** pEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_event_signal")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result event_signal([NativeTypeName("ma_event *")] void** pEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_semaphore_init", ExactSpelling = true)]
-        public static extern ma_result semaphore_init(int initialValue, [NativeTypeName("ma_semaphore *")] void** pSemaphore);
+        [LibraryImport("miniaudio", EntryPoint = "ma_semaphore_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result semaphore_init(int initialValue, [NativeTypeName("ma_semaphore *")] void** pSemaphore);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_semaphore_uninit", ExactSpelling = true)]
-        public static extern void semaphore_uninit([NativeTypeName("ma_semaphore *")] void** pSemaphore);
+        [LibraryImport("miniaudio", EntryPoint = "ma_semaphore_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void semaphore_uninit([NativeTypeName("ma_semaphore *")] void** pSemaphore);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_semaphore_wait", ExactSpelling = true)]
-        public static extern ma_result semaphore_wait([NativeTypeName("ma_semaphore *")] void** pSemaphore);
+        [LibraryImport("miniaudio", EntryPoint = "ma_semaphore_wait")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result semaphore_wait([NativeTypeName("ma_semaphore *")] void** pSemaphore);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_semaphore_release", ExactSpelling = true)]
-        public static extern ma_result semaphore_release([NativeTypeName("ma_semaphore *")] void** pSemaphore);
+        [LibraryImport("miniaudio", EntryPoint = "ma_semaphore_release")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result semaphore_release([NativeTypeName("ma_semaphore *")] void** pSemaphore);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fence_init", ExactSpelling = true)]
-        public static extern ma_result fence_init(ma_fence* pFence);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fence_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result fence_init(ma_fence* pFence);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fence_uninit", ExactSpelling = true)]
-        public static extern void fence_uninit(ma_fence* pFence);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fence_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void fence_uninit(ma_fence* pFence);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fence_acquire", ExactSpelling = true)]
-        public static extern ma_result fence_acquire(ma_fence* pFence);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fence_acquire")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result fence_acquire(ma_fence* pFence);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fence_release", ExactSpelling = true)]
-        public static extern ma_result fence_release(ma_fence* pFence);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fence_release")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result fence_release(ma_fence* pFence);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_fence_wait", ExactSpelling = true)]
-        public static extern ma_result fence_wait(ma_fence* pFence);
+        [LibraryImport("miniaudio", EntryPoint = "ma_fence_wait")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result fence_wait(ma_fence* pFence);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_async_notification_signal", ExactSpelling = true)]
-        public static extern ma_result async_notification_signal([NativeTypeName("ma_async_notification *")] void* pNotification);
+        [LibraryImport("miniaudio", EntryPoint = "ma_async_notification_signal")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result async_notification_signal([NativeTypeName("ma_async_notification *")] void* pNotification);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_async_notification_poll_init", ExactSpelling = true)]
-        public static extern ma_result async_notification_poll_init(ma_async_notification_poll* pNotificationPoll);
+        [LibraryImport("miniaudio", EntryPoint = "ma_async_notification_poll_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result async_notification_poll_init(ma_async_notification_poll* pNotificationPoll);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_async_notification_poll_is_signalled", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_async_notification_poll_is_signalled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint async_notification_poll_is_signalled([NativeTypeName("const ma_async_notification_poll *")] ma_async_notification_poll* pNotificationPoll);
+        public static partial uint async_notification_poll_is_signalled([NativeTypeName("const ma_async_notification_poll *")] ma_async_notification_poll* pNotificationPoll);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_async_notification_event_init", ExactSpelling = true)]
-        public static extern ma_result async_notification_event_init(ma_async_notification_event* pNotificationEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_async_notification_event_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result async_notification_event_init(ma_async_notification_event* pNotificationEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_async_notification_event_uninit", ExactSpelling = true)]
-        public static extern ma_result async_notification_event_uninit(ma_async_notification_event* pNotificationEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_async_notification_event_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result async_notification_event_uninit(ma_async_notification_event* pNotificationEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_async_notification_event_wait", ExactSpelling = true)]
-        public static extern ma_result async_notification_event_wait(ma_async_notification_event* pNotificationEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_async_notification_event_wait")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result async_notification_event_wait(ma_async_notification_event* pNotificationEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_async_notification_event_signal", ExactSpelling = true)]
-        public static extern ma_result async_notification_event_signal(ma_async_notification_event* pNotificationEvent);
+        [LibraryImport("miniaudio", EntryPoint = "ma_async_notification_event_signal")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result async_notification_event_signal(ma_async_notification_event* pNotificationEvent);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_slot_allocator_config_init", ExactSpelling = true)]
-        public static extern ma_slot_allocator_config slot_allocator_config_init([NativeTypeName("ma_uint32")] uint capacity);
+        [LibraryImport("miniaudio", EntryPoint = "ma_slot_allocator_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_slot_allocator_config slot_allocator_config_init([NativeTypeName("ma_uint32")] uint capacity);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_slot_allocator_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result slot_allocator_get_heap_size([NativeTypeName("const ma_slot_allocator_config *")] ma_slot_allocator_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_slot_allocator_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result slot_allocator_get_heap_size([NativeTypeName("const ma_slot_allocator_config *")] ma_slot_allocator_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_slot_allocator_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result slot_allocator_init_preallocated([NativeTypeName("const ma_slot_allocator_config *")] ma_slot_allocator_config* pConfig, void* pHeap, ma_slot_allocator* pAllocator);
+        [LibraryImport("miniaudio", EntryPoint = "ma_slot_allocator_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result slot_allocator_init_preallocated([NativeTypeName("const ma_slot_allocator_config *")] ma_slot_allocator_config* pConfig, void* pHeap, ma_slot_allocator* pAllocator);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_slot_allocator_init", ExactSpelling = true)]
-        public static extern ma_result slot_allocator_init([NativeTypeName("const ma_slot_allocator_config *")] ma_slot_allocator_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_slot_allocator* pAllocator);
+        [LibraryImport("miniaudio", EntryPoint = "ma_slot_allocator_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result slot_allocator_init([NativeTypeName("const ma_slot_allocator_config *")] ma_slot_allocator_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_slot_allocator* pAllocator);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_slot_allocator_uninit", ExactSpelling = true)]
-        public static extern void slot_allocator_uninit(ma_slot_allocator* pAllocator, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_slot_allocator_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void slot_allocator_uninit(ma_slot_allocator* pAllocator, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_slot_allocator_alloc", ExactSpelling = true)]
-        public static extern ma_result slot_allocator_alloc(ma_slot_allocator* pAllocator, [NativeTypeName("ma_uint64 *")] ulong* pSlot);
+        [LibraryImport("miniaudio", EntryPoint = "ma_slot_allocator_alloc")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result slot_allocator_alloc(ma_slot_allocator* pAllocator, [NativeTypeName("ma_uint64 *")] ulong* pSlot);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_slot_allocator_free", ExactSpelling = true)]
-        public static extern ma_result slot_allocator_free(ma_slot_allocator* pAllocator, [NativeTypeName("ma_uint64")] ulong slot);
+        [LibraryImport("miniaudio", EntryPoint = "ma_slot_allocator_free")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result slot_allocator_free(ma_slot_allocator* pAllocator, [NativeTypeName("ma_uint64")] ulong slot);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_init", ExactSpelling = true)]
-        public static extern ma_job job_init([NativeTypeName("ma_uint16")] ushort code);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_job job_init([NativeTypeName("ma_uint16")] ushort code);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_process", ExactSpelling = true)]
-        public static extern ma_result job_process(ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_process")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result job_process(ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_queue_config_init", ExactSpelling = true)]
-        public static extern ma_job_queue_config job_queue_config_init([NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_uint32")] uint capacity);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_queue_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_job_queue_config job_queue_config_init([NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_uint32")] uint capacity);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_queue_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result job_queue_get_heap_size([NativeTypeName("const ma_job_queue_config *")] ma_job_queue_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_queue_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result job_queue_get_heap_size([NativeTypeName("const ma_job_queue_config *")] ma_job_queue_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_queue_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result job_queue_init_preallocated([NativeTypeName("const ma_job_queue_config *")] ma_job_queue_config* pConfig, void* pHeap, ma_job_queue* pQueue);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_queue_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result job_queue_init_preallocated([NativeTypeName("const ma_job_queue_config *")] ma_job_queue_config* pConfig, void* pHeap, ma_job_queue* pQueue);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_queue_init", ExactSpelling = true)]
-        public static extern ma_result job_queue_init([NativeTypeName("const ma_job_queue_config *")] ma_job_queue_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_job_queue* pQueue);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_queue_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result job_queue_init([NativeTypeName("const ma_job_queue_config *")] ma_job_queue_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_job_queue* pQueue);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_queue_uninit", ExactSpelling = true)]
-        public static extern void job_queue_uninit(ma_job_queue* pQueue, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_queue_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void job_queue_uninit(ma_job_queue* pQueue, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_queue_post", ExactSpelling = true)]
-        public static extern ma_result job_queue_post(ma_job_queue* pQueue, [NativeTypeName("const ma_job *")] ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_queue_post")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result job_queue_post(ma_job_queue* pQueue, [NativeTypeName("const ma_job *")] ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_job_queue_next", ExactSpelling = true)]
-        public static extern ma_result job_queue_next(ma_job_queue* pQueue, ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_job_queue_next")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result job_queue_next(ma_job_queue* pQueue, ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_job_thread_config_init", ExactSpelling = true)]
-        public static extern ma_device_job_thread_config device_job_thread_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_job_thread_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_device_job_thread_config device_job_thread_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_job_thread_init", ExactSpelling = true)]
-        public static extern ma_result device_job_thread_init([NativeTypeName("const ma_device_job_thread_config *")] ma_device_job_thread_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_device_job_thread* pJobThread);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_job_thread_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_job_thread_init([NativeTypeName("const ma_device_job_thread_config *")] ma_device_job_thread_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_device_job_thread* pJobThread);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_job_thread_uninit", ExactSpelling = true)]
-        public static extern void device_job_thread_uninit(ma_device_job_thread* pJobThread, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_job_thread_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void device_job_thread_uninit(ma_device_job_thread* pJobThread, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_job_thread_post", ExactSpelling = true)]
-        public static extern ma_result device_job_thread_post(ma_device_job_thread* pJobThread, [NativeTypeName("const ma_job *")] ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_job_thread_post")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_job_thread_post(ma_device_job_thread* pJobThread, [NativeTypeName("const ma_job *")] ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_job_thread_next", ExactSpelling = true)]
-        public static extern ma_result device_job_thread_next(ma_device_job_thread* pJobThread, ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_job_thread_next")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_job_thread_next(ma_device_job_thread* pJobThread, ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_id_equal", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_id_equal")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint device_id_equal([NativeTypeName("const ma_device_id *")] ma_device_id* pA, [NativeTypeName("const ma_device_id *")] ma_device_id* pB);
+        public static partial uint device_id_equal([NativeTypeName("const ma_device_id *")] ma_device_id* pA, [NativeTypeName("const ma_device_id *")] ma_device_id* pB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_config_init", ExactSpelling = true)]
-        public static extern ma_context_config context_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_context_config context_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_init", ExactSpelling = true)]
-        public static extern ma_result context_init([NativeTypeName("const ma_backend[]")] ma_backend* backends, [NativeTypeName("ma_uint32")] uint backendCount, [NativeTypeName("const ma_context_config *")] ma_context_config* pConfig, ma_context* pContext);
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result context_init([NativeTypeName("const ma_backend[]")] ma_backend* backends, [NativeTypeName("ma_uint32")] uint backendCount, [NativeTypeName("const ma_context_config *")] ma_context_config* pConfig, ma_context* pContext);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_uninit", ExactSpelling = true)]
-        public static extern ma_result context_uninit(ma_context* pContext);
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result context_uninit(ma_context* pContext);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_sizeof", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_sizeof")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("size_t")]
-        public static extern nuint context_sizeof();
+        public static partial nuint context_sizeof();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_get_log", ExactSpelling = true)]
-        public static extern ma_log* context_get_log(ma_context* pContext);
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_get_log")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_log* context_get_log(ma_context* pContext);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_enumerate_devices", ExactSpelling = true)]
-        public static extern ma_result context_enumerate_devices(ma_context* pContext, [NativeTypeName("ma_enum_devices_callback_proc")] delegate* unmanaged[Cdecl]<ma_context*, ma_device_type, ma_device_info*, void*, uint> callback, void* pUserData);
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_enumerate_devices")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result context_enumerate_devices(ma_context* pContext, [NativeTypeName("ma_enum_devices_callback_proc")] delegate* unmanaged[Cdecl]<ma_context*, ma_device_type, ma_device_info*, void*, uint> callback, void* pUserData);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_get_devices", ExactSpelling = true)]
-        public static extern ma_result context_get_devices(ma_context* pContext, ma_device_info** ppPlaybackDeviceInfos, [NativeTypeName("ma_uint32 *")] uint* pPlaybackDeviceCount, ma_device_info** ppCaptureDeviceInfos, [NativeTypeName("ma_uint32 *")] uint* pCaptureDeviceCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_get_devices")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result context_get_devices(ma_context* pContext, ma_device_info** ppPlaybackDeviceInfos, [NativeTypeName("ma_uint32 *")] uint* pPlaybackDeviceCount, ma_device_info** ppCaptureDeviceInfos, [NativeTypeName("ma_uint32 *")] uint* pCaptureDeviceCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_get_device_info", ExactSpelling = true)]
-        public static extern ma_result context_get_device_info(ma_context* pContext, ma_device_type deviceType, [NativeTypeName("const ma_device_id *")] ma_device_id* pDeviceID, ma_device_info* pDeviceInfo);
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_get_device_info")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result context_get_device_info(ma_context* pContext, ma_device_type deviceType, [NativeTypeName("const ma_device_id *")] ma_device_id* pDeviceID, ma_device_info* pDeviceInfo);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_context_is_loopback_supported", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_context_is_loopback_supported")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint context_is_loopback_supported(ma_context* pContext);
+        public static partial uint context_is_loopback_supported(ma_context* pContext);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_config_init", ExactSpelling = true)]
-        public static extern ma_device_config device_config_init(ma_device_type deviceType);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_device_config device_config_init(ma_device_type deviceType);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_init", ExactSpelling = true)]
-        public static extern ma_result device_init(ma_context* pContext, [NativeTypeName("const ma_device_config *")] ma_device_config* pConfig, ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_init(ma_context* pContext, [NativeTypeName("const ma_device_config *")] ma_device_config* pConfig, ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_init_ex", ExactSpelling = true)]
-        public static extern ma_result device_init_ex([NativeTypeName("const ma_backend[]")] ma_backend* backends, [NativeTypeName("ma_uint32")] uint backendCount, [NativeTypeName("const ma_context_config *")] ma_context_config* pContextConfig, [NativeTypeName("const ma_device_config *")] ma_device_config* pConfig, ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_init_ex([NativeTypeName("const ma_backend[]")] ma_backend* backends, [NativeTypeName("ma_uint32")] uint backendCount, [NativeTypeName("const ma_context_config *")] ma_context_config* pContextConfig, [NativeTypeName("const ma_device_config *")] ma_device_config* pConfig, ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_uninit", ExactSpelling = true)]
-        public static extern void device_uninit(ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void device_uninit(ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_get_context", ExactSpelling = true)]
-        public static extern ma_context* device_get_context(ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_get_context")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_context* device_get_context(ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_get_log", ExactSpelling = true)]
-        public static extern ma_log* device_get_log(ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_get_log")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_log* device_get_log(ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_get_info", ExactSpelling = true)]
-        public static extern ma_result device_get_info(ma_device* pDevice, ma_device_type type, ma_device_info* pDeviceInfo);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_get_info")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_get_info(ma_device* pDevice, ma_device_type type, ma_device_info* pDeviceInfo);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_get_name", ExactSpelling = true)]
-        public static extern ma_result device_get_name(ma_device* pDevice, ma_device_type type, [NativeTypeName("char *")] sbyte* pName, [NativeTypeName("size_t")] nuint nameCap, [NativeTypeName("size_t *")] nuint* pLengthNotIncludingNullTerminator);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_get_name")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_get_name(ma_device* pDevice, ma_device_type type, [NativeTypeName("char *")] sbyte* pName, [NativeTypeName("size_t")] nuint nameCap, [NativeTypeName("size_t *")] nuint* pLengthNotIncludingNullTerminator);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_start", ExactSpelling = true)]
-        public static extern ma_result device_start(ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_start")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_start(ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_stop", ExactSpelling = true)]
-        public static extern ma_result device_stop(ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_stop")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_stop(ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_is_started", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_is_started")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint device_is_started([NativeTypeName("const ma_device *")] ma_device* pDevice);
+        public static partial uint device_is_started([NativeTypeName("const ma_device *")] ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_get_state", ExactSpelling = true)]
-        public static extern ma_device_state device_get_state([NativeTypeName("const ma_device *")] ma_device* pDevice);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_get_state")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_device_state device_get_state([NativeTypeName("const ma_device *")] ma_device* pDevice);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_post_init", ExactSpelling = true)]
-        public static extern ma_result device_post_init(ma_device* pDevice, ma_device_type deviceType, [NativeTypeName("const ma_device_descriptor *")] ma_device_descriptor* pPlaybackDescriptor, [NativeTypeName("const ma_device_descriptor *")] ma_device_descriptor* pCaptureDescriptor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_post_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_post_init(ma_device* pDevice, ma_device_type deviceType, [NativeTypeName("const ma_device_descriptor *")] ma_device_descriptor* pPlaybackDescriptor, [NativeTypeName("const ma_device_descriptor *")] ma_device_descriptor* pCaptureDescriptor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_set_master_volume", ExactSpelling = true)]
-        public static extern ma_result device_set_master_volume(ma_device* pDevice, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_set_master_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_set_master_volume(ma_device* pDevice, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_get_master_volume", ExactSpelling = true)]
-        public static extern ma_result device_get_master_volume(ma_device* pDevice, float* pVolume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_get_master_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_get_master_volume(ma_device* pDevice, float* pVolume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_set_master_volume_db", ExactSpelling = true)]
-        public static extern ma_result device_set_master_volume_db(ma_device* pDevice, float gainDB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_set_master_volume_db")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_set_master_volume_db(ma_device* pDevice, float gainDB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_get_master_volume_db", ExactSpelling = true)]
-        public static extern ma_result device_get_master_volume_db(ma_device* pDevice, float* pGainDB);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_get_master_volume_db")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_get_master_volume_db(ma_device* pDevice, float* pGainDB);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_device_handle_backend_data_callback", ExactSpelling = true)]
-        public static extern ma_result device_handle_backend_data_callback(ma_device* pDevice, void* pOutput, [NativeTypeName("const void *")] void* pInput, [NativeTypeName("ma_uint32")] uint frameCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_device_handle_backend_data_callback")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result device_handle_backend_data_callback(ma_device* pDevice, void* pOutput, [NativeTypeName("const void *")] void* pInput, [NativeTypeName("ma_uint32")] uint frameCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_calculate_buffer_size_in_frames_from_descriptor", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_calculate_buffer_size_in_frames_from_descriptor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint calculate_buffer_size_in_frames_from_descriptor([NativeTypeName("const ma_device_descriptor *")] ma_device_descriptor* pDescriptor, [NativeTypeName("ma_uint32")] uint nativeSampleRate, ma_performance_profile performanceProfile);
+        public static partial uint calculate_buffer_size_in_frames_from_descriptor([NativeTypeName("const ma_device_descriptor *")] ma_device_descriptor* pDescriptor, [NativeTypeName("ma_uint32")] uint nativeSampleRate, ma_performance_profile performanceProfile);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_get_backend_name", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_get_backend_name")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("const char *")]
-        public static extern sbyte* get_backend_name(ma_backend backend);
+        public static partial sbyte* get_backend_name(ma_backend backend);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_get_backend_from_name", ExactSpelling = true)]
-        public static extern ma_result get_backend_from_name([NativeTypeName("const char *")] sbyte* pBackendName, ma_backend* pBackend);
+        [LibraryImport("miniaudio", EntryPoint = "ma_get_backend_from_name")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result get_backend_from_name([NativeTypeName("const char *")] sbyte* pBackendName, ma_backend* pBackend);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_is_backend_enabled", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_is_backend_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint is_backend_enabled(ma_backend backend);
+        public static partial uint is_backend_enabled(ma_backend backend);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_get_enabled_backends", ExactSpelling = true)]
-        public static extern ma_result get_enabled_backends(ma_backend* pBackends, [NativeTypeName("size_t")] nuint backendCap, [NativeTypeName("size_t *")] nuint* pBackendCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_get_enabled_backends")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result get_enabled_backends(ma_backend* pBackends, [NativeTypeName("size_t")] nuint backendCap, [NativeTypeName("size_t *")] nuint* pBackendCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_is_loopback_supported", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_is_loopback_supported")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint is_loopback_supported(ma_backend backend);
+        public static partial uint is_loopback_supported(ma_backend backend);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_calculate_buffer_size_in_milliseconds_from_frames", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_calculate_buffer_size_in_milliseconds_from_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint calculate_buffer_size_in_milliseconds_from_frames([NativeTypeName("ma_uint32")] uint bufferSizeInFrames, [NativeTypeName("ma_uint32")] uint sampleRate);
+        public static partial uint calculate_buffer_size_in_milliseconds_from_frames([NativeTypeName("ma_uint32")] uint bufferSizeInFrames, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_calculate_buffer_size_in_frames_from_milliseconds", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_calculate_buffer_size_in_frames_from_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint calculate_buffer_size_in_frames_from_milliseconds([NativeTypeName("ma_uint32")] uint bufferSizeInMilliseconds, [NativeTypeName("ma_uint32")] uint sampleRate);
+        public static partial uint calculate_buffer_size_in_frames_from_milliseconds([NativeTypeName("ma_uint32")] uint bufferSizeInMilliseconds, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_pcm_frames", ExactSpelling = true)]
-        public static extern void copy_pcm_frames(void* dst, [NativeTypeName("const void *")] void* src, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_pcm_frames(void* dst, [NativeTypeName("const void *")] void* src, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_silence_pcm_frames", ExactSpelling = true)]
-        public static extern void silence_pcm_frames(void* p, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_silence_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void silence_pcm_frames(void* p, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_offset_pcm_frames_ptr", ExactSpelling = true)]
-        public static extern void* offset_pcm_frames_ptr(void* p, [NativeTypeName("ma_uint64")] ulong offsetInFrames, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_offset_pcm_frames_ptr")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* offset_pcm_frames_ptr(void* p, [NativeTypeName("ma_uint64")] ulong offsetInFrames, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_offset_pcm_frames_const_ptr", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_offset_pcm_frames_const_ptr")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("const void *")]
-        public static extern void* offset_pcm_frames_const_ptr([NativeTypeName("const void *")] void* p, [NativeTypeName("ma_uint64")] ulong offsetInFrames, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
+        public static partial void* offset_pcm_frames_const_ptr([NativeTypeName("const void *")] void* p, [NativeTypeName("ma_uint64")] ulong offsetInFrames, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
 
         public static float* offset_pcm_frames_ptr_f32(float* p, [NativeTypeName("ma_uint64")] ulong offsetInFrames, [NativeTypeName("ma_uint32")] uint channels)
         {
@@ -6864,1356 +7655,2006 @@ namespace Miniaudio
             return (float*)(offset_pcm_frames_const_ptr((void*)(p), offsetInFrames, ma_format_f32, channels));
         }
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_clip_samples_u8", ExactSpelling = true)]
-        public static extern void clip_samples_u8([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int16 *")] short* pSrc, [NativeTypeName("ma_uint64")] ulong count);
+        [LibraryImport("miniaudio", EntryPoint = "ma_clip_samples_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void clip_samples_u8([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int16 *")] short* pSrc, [NativeTypeName("ma_uint64")] ulong count);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_clip_samples_s16", ExactSpelling = true)]
-        public static extern void clip_samples_s16([NativeTypeName("ma_int16 *")] short* pDst, [NativeTypeName("const ma_int32 *")] int* pSrc, [NativeTypeName("ma_uint64")] ulong count);
+        [LibraryImport("miniaudio", EntryPoint = "ma_clip_samples_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void clip_samples_s16([NativeTypeName("ma_int16 *")] short* pDst, [NativeTypeName("const ma_int32 *")] int* pSrc, [NativeTypeName("ma_uint64")] ulong count);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_clip_samples_s24", ExactSpelling = true)]
-        public static extern void clip_samples_s24([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count);
+        [LibraryImport("miniaudio", EntryPoint = "ma_clip_samples_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void clip_samples_s24([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_clip_samples_s32", ExactSpelling = true)]
-        public static extern void clip_samples_s32([NativeTypeName("ma_int32 *")] int* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count);
+        [LibraryImport("miniaudio", EntryPoint = "ma_clip_samples_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void clip_samples_s32([NativeTypeName("ma_int32 *")] int* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_clip_samples_f32", ExactSpelling = true)]
-        public static extern void clip_samples_f32(float* pDst, [NativeTypeName("const float *")] float* pSrc, [NativeTypeName("ma_uint64")] ulong count);
+        [LibraryImport("miniaudio", EntryPoint = "ma_clip_samples_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void clip_samples_f32(float* pDst, [NativeTypeName("const float *")] float* pSrc, [NativeTypeName("ma_uint64")] ulong count);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_clip_pcm_frames", ExactSpelling = true)]
-        public static extern void clip_pcm_frames(void* pDst, [NativeTypeName("const void *")] void* pSrc, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_clip_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void clip_pcm_frames(void* pDst, [NativeTypeName("const void *")] void* pSrc, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_u8", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_u8([NativeTypeName("ma_uint8 *")] byte* pSamplesOut, [NativeTypeName("const ma_uint8 *")] byte* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_u8([NativeTypeName("ma_uint8 *")] byte* pSamplesOut, [NativeTypeName("const ma_uint8 *")] byte* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_s16", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_s16([NativeTypeName("ma_int16 *")] short* pSamplesOut, [NativeTypeName("const ma_int16 *")] short* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_s16([NativeTypeName("ma_int16 *")] short* pSamplesOut, [NativeTypeName("const ma_int16 *")] short* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_s24", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_s24(void* pSamplesOut, [NativeTypeName("const void *")] void* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_s24(void* pSamplesOut, [NativeTypeName("const void *")] void* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_s32", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_s32([NativeTypeName("ma_int32 *")] int* pSamplesOut, [NativeTypeName("const ma_int32 *")] int* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_s32([NativeTypeName("ma_int32 *")] int* pSamplesOut, [NativeTypeName("const ma_int32 *")] int* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_f32", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_f32(float* pSamplesOut, [NativeTypeName("const float *")] float* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_f32(float* pSamplesOut, [NativeTypeName("const float *")] float* pSamplesIn, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_u8", ExactSpelling = true)]
-        public static extern void apply_volume_factor_u8([NativeTypeName("ma_uint8 *")] byte* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_u8([NativeTypeName("ma_uint8 *")] byte* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_s16", ExactSpelling = true)]
-        public static extern void apply_volume_factor_s16([NativeTypeName("ma_int16 *")] short* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_s16([NativeTypeName("ma_int16 *")] short* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_s24", ExactSpelling = true)]
-        public static extern void apply_volume_factor_s24(void* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_s24(void* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_s32", ExactSpelling = true)]
-        public static extern void apply_volume_factor_s32([NativeTypeName("ma_int32 *")] int* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_s32([NativeTypeName("ma_int32 *")] int* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_f32", ExactSpelling = true)]
-        public static extern void apply_volume_factor_f32(float* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_f32(float* pSamples, [NativeTypeName("ma_uint64")] ulong sampleCount, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_u8", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_pcm_frames_u8([NativeTypeName("ma_uint8 *")] byte* pFramesOut, [NativeTypeName("const ma_uint8 *")] byte* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_pcm_frames_u8([NativeTypeName("ma_uint8 *")] byte* pFramesOut, [NativeTypeName("const ma_uint8 *")] byte* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_s16", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_pcm_frames_s16([NativeTypeName("ma_int16 *")] short* pFramesOut, [NativeTypeName("const ma_int16 *")] short* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_pcm_frames_s16([NativeTypeName("ma_int16 *")] short* pFramesOut, [NativeTypeName("const ma_int16 *")] short* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_s24", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_pcm_frames_s24(void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_pcm_frames_s24(void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_s32", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_pcm_frames_s32([NativeTypeName("ma_int32 *")] int* pFramesOut, [NativeTypeName("const ma_int32 *")] int* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_pcm_frames_s32([NativeTypeName("ma_int32 *")] int* pFramesOut, [NativeTypeName("const ma_int32 *")] int* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_f32", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_pcm_frames_f32(float* pFramesOut, [NativeTypeName("const float *")] float* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_pcm_frames_f32(float* pFramesOut, [NativeTypeName("const float *")] float* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_pcm_frames(void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_pcm_frames(void* pFramesOut, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_pcm_frames_u8", ExactSpelling = true)]
-        public static extern void apply_volume_factor_pcm_frames_u8([NativeTypeName("ma_uint8 *")] byte* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_pcm_frames_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_pcm_frames_u8([NativeTypeName("ma_uint8 *")] byte* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_pcm_frames_s16", ExactSpelling = true)]
-        public static extern void apply_volume_factor_pcm_frames_s16([NativeTypeName("ma_int16 *")] short* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_pcm_frames_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_pcm_frames_s16([NativeTypeName("ma_int16 *")] short* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_pcm_frames_s24", ExactSpelling = true)]
-        public static extern void apply_volume_factor_pcm_frames_s24(void* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_pcm_frames_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_pcm_frames_s24(void* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_pcm_frames_s32", ExactSpelling = true)]
-        public static extern void apply_volume_factor_pcm_frames_s32([NativeTypeName("ma_int32 *")] int* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_pcm_frames_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_pcm_frames_s32([NativeTypeName("ma_int32 *")] int* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_pcm_frames_f32", ExactSpelling = true)]
-        public static extern void apply_volume_factor_pcm_frames_f32(float* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_pcm_frames_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_pcm_frames_f32(float* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_apply_volume_factor_pcm_frames", ExactSpelling = true)]
-        public static extern void apply_volume_factor_pcm_frames(void* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_apply_volume_factor_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void apply_volume_factor_pcm_frames(void* pFrames, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_factor_per_channel_f32", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_factor_per_channel_f32(float* pFramesOut, [NativeTypeName("const float *")] float* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float* pChannelGains);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_factor_per_channel_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_factor_per_channel_f32(float* pFramesOut, [NativeTypeName("const float *")] float* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float* pChannelGains);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_u8", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_and_clip_samples_u8([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int16 *")] short* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_u8")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_and_clip_samples_u8([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int16 *")] short* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_s16", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_and_clip_samples_s16([NativeTypeName("ma_int16 *")] short* pDst, [NativeTypeName("const ma_int32 *")] int* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_s16")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_and_clip_samples_s16([NativeTypeName("ma_int16 *")] short* pDst, [NativeTypeName("const ma_int32 *")] int* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_s24", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_and_clip_samples_s24([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_s24")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_and_clip_samples_s24([NativeTypeName("ma_uint8 *")] byte* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_s32", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_and_clip_samples_s32([NativeTypeName("ma_int32 *")] int* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_s32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_and_clip_samples_s32([NativeTypeName("ma_int32 *")] int* pDst, [NativeTypeName("const ma_int64 *")] long* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_f32", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_and_clip_samples_f32(float* pDst, [NativeTypeName("const float *")] float* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_and_clip_samples_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_and_clip_samples_f32(float* pDst, [NativeTypeName("const float *")] float* pSrc, [NativeTypeName("ma_uint64")] ulong count, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_copy_and_apply_volume_and_clip_pcm_frames", ExactSpelling = true)]
-        public static extern void copy_and_apply_volume_and_clip_pcm_frames(void* pDst, [NativeTypeName("const void *")] void* pSrc, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_copy_and_apply_volume_and_clip_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void copy_and_apply_volume_and_clip_pcm_frames(void* pDst, [NativeTypeName("const void *")] void* pSrc, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_volume_linear_to_db", ExactSpelling = true)]
-        public static extern float volume_linear_to_db(float factor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_volume_linear_to_db")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float volume_linear_to_db(float factor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_volume_db_to_linear", ExactSpelling = true)]
-        public static extern float volume_db_to_linear(float gain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_volume_db_to_linear")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float volume_db_to_linear(float gain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_mix_pcm_frames_f32", ExactSpelling = true)]
-        public static extern ma_result mix_pcm_frames_f32(float* pDst, [NativeTypeName("const float *")] float* pSrc, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_mix_pcm_frames_f32")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result mix_pcm_frames_f32(float* pDst, [NativeTypeName("const float *")] float* pSrc, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint32")] uint channels, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_open", ExactSpelling = true)]
-        public static extern ma_result vfs_open([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint openMode, [NativeTypeName("ma_vfs_file *")] void** pFile);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_open")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_open([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint openMode, [NativeTypeName("ma_vfs_file *")] void** pFile);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_open_w", ExactSpelling = true)]
-        public static extern ma_result vfs_open_w([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint openMode, [NativeTypeName("ma_vfs_file *")] void** pFile);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_open_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_open_w([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint openMode, [NativeTypeName("ma_vfs_file *")] void** pFile);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_close", ExactSpelling = true)]
-        public static extern ma_result vfs_close([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_close")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_close([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_read", ExactSpelling = true)]
-        public static extern ma_result vfs_read([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, void* pDst, [NativeTypeName("size_t")] nuint sizeInBytes, [NativeTypeName("size_t *")] nuint* pBytesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_read")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_read([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, void* pDst, [NativeTypeName("size_t")] nuint sizeInBytes, [NativeTypeName("size_t *")] nuint* pBytesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_write", ExactSpelling = true)]
-        public static extern ma_result vfs_write([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, [NativeTypeName("const void *")] void* pSrc, [NativeTypeName("size_t")] nuint sizeInBytes, [NativeTypeName("size_t *")] nuint* pBytesWritten);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_write")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_write([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, [NativeTypeName("const void *")] void* pSrc, [NativeTypeName("size_t")] nuint sizeInBytes, [NativeTypeName("size_t *")] nuint* pBytesWritten);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_seek", ExactSpelling = true)]
-        public static extern ma_result vfs_seek([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, [NativeTypeName("ma_int64")] long offset, ma_seek_origin origin);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_seek")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_seek([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, [NativeTypeName("ma_int64")] long offset, ma_seek_origin origin);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_tell", ExactSpelling = true)]
-        public static extern ma_result vfs_tell([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, [NativeTypeName("ma_int64 *")] long* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_tell")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_tell([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, [NativeTypeName("ma_int64 *")] long* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_info", ExactSpelling = true)]
-        public static extern ma_result vfs_info([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, ma_file_info* pInfo);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_info")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_info([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("ma_vfs_file")] void* file, ma_file_info* pInfo);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_vfs_open_and_read_file", ExactSpelling = true)]
-        public static extern ma_result vfs_open_and_read_file([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, void** ppData, [NativeTypeName("size_t *")] nuint* pSize, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_vfs_open_and_read_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result vfs_open_and_read_file([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, void** ppData, [NativeTypeName("size_t *")] nuint* pSize, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_default_vfs_init", ExactSpelling = true)]
-        public static extern ma_result default_vfs_init(ma_default_vfs* pVFS, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_default_vfs_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result default_vfs_init(ma_default_vfs* pVFS, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoding_backend_config_init", ExactSpelling = true)]
-        public static extern ma_decoding_backend_config decoding_backend_config_init(ma_format preferredFormat, [NativeTypeName("ma_uint32")] uint seekPointCount);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoding_backend_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_decoding_backend_config decoding_backend_config_init(ma_format preferredFormat, [NativeTypeName("ma_uint32")] uint seekPointCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_config_init", ExactSpelling = true)]
-        public static extern ma_decoder_config decoder_config_init(ma_format outputFormat, [NativeTypeName("ma_uint32")] uint outputChannels, [NativeTypeName("ma_uint32")] uint outputSampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_decoder_config decoder_config_init(ma_format outputFormat, [NativeTypeName("ma_uint32")] uint outputChannels, [NativeTypeName("ma_uint32")] uint outputSampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_config_init_default", ExactSpelling = true)]
-        public static extern ma_decoder_config decoder_config_init_default();
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_config_init_default")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_decoder_config decoder_config_init_default();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_init", ExactSpelling = true)]
-        public static extern ma_result decoder_init([NativeTypeName("ma_decoder_read_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, void*, nuint, nuint*, ma_result> onRead, [NativeTypeName("ma_decoder_seek_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, long, ma_seek_origin, ma_result> onSeek, void* pUserData, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_init([NativeTypeName("ma_decoder_read_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, void*, nuint, nuint*, ma_result> onRead, [NativeTypeName("ma_decoder_seek_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, long, ma_seek_origin, ma_result> onSeek, void* pUserData, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_init_memory", ExactSpelling = true)]
-        public static extern ma_result decoder_init_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_init_memory")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_init_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_init_vfs", ExactSpelling = true)]
-        public static extern ma_result decoder_init_vfs([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_init_vfs")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_init_vfs([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_init_vfs_w", ExactSpelling = true)]
-        public static extern ma_result decoder_init_vfs_w([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_init_vfs_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_init_vfs_w([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_init_file", ExactSpelling = true)]
-        public static extern ma_result decoder_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_init_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_init_file_w", ExactSpelling = true)]
-        public static extern ma_result decoder_init_file_w([NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_init_file_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_init_file_w([NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_uninit", ExactSpelling = true)]
-        public static extern ma_result decoder_uninit(ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_uninit(ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result decoder_read_pcm_frames(ma_decoder* pDecoder, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_read_pcm_frames(ma_decoder* pDecoder, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result decoder_seek_to_pcm_frame(ma_decoder* pDecoder, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_seek_to_pcm_frame(ma_decoder* pDecoder, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_get_data_format", ExactSpelling = true)]
-        public static extern ma_result decoder_get_data_format(ma_decoder* pDecoder, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_get_data_format(ma_decoder* pDecoder, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result decoder_get_cursor_in_pcm_frames(ma_decoder* pDecoder, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_get_cursor_in_pcm_frames(ma_decoder* pDecoder, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result decoder_get_length_in_pcm_frames(ma_decoder* pDecoder, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_get_length_in_pcm_frames(ma_decoder* pDecoder, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_get_available_frames", ExactSpelling = true)]
-        public static extern ma_result decoder_get_available_frames(ma_decoder* pDecoder, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_get_available_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_get_available_frames(ma_decoder* pDecoder, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decode_from_vfs", ExactSpelling = true)]
-        public static extern ma_result decode_from_vfs([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decode_from_vfs")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decode_from_vfs([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decode_file", ExactSpelling = true)]
-        public static extern ma_result decode_file([NativeTypeName("const char *")] sbyte* pFilePath, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decode_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decode_file([NativeTypeName("const char *")] sbyte* pFilePath, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decode_memory", ExactSpelling = true)]
-        public static extern ma_result decode_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decode_memory")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decode_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_config_init", ExactSpelling = true)]
-        public static extern ma_encoder_config encoder_config_init(ma_encoding_format encodingFormat, ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_encoder_config encoder_config_init(ma_encoding_format encodingFormat, ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_init", ExactSpelling = true)]
-        public static extern ma_result encoder_init([NativeTypeName("ma_encoder_write_proc")] delegate* unmanaged[Cdecl]<ma_encoder*, void*, nuint, nuint*, ma_result> onWrite, [NativeTypeName("ma_encoder_seek_proc")] delegate* unmanaged[Cdecl]<ma_encoder*, long, ma_seek_origin, ma_result> onSeek, void* pUserData, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result encoder_init([NativeTypeName("ma_encoder_write_proc")] delegate* unmanaged[Cdecl]<ma_encoder*, void*, nuint, nuint*, ma_result> onWrite, [NativeTypeName("ma_encoder_seek_proc")] delegate* unmanaged[Cdecl]<ma_encoder*, long, ma_seek_origin, ma_result> onSeek, void* pUserData, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_init_vfs", ExactSpelling = true)]
-        public static extern ma_result encoder_init_vfs([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_init_vfs")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result encoder_init_vfs([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_init_vfs_w", ExactSpelling = true)]
-        public static extern ma_result encoder_init_vfs_w([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_init_vfs_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result encoder_init_vfs_w([NativeTypeName("ma_vfs *")] void* pVFS, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_init_file", ExactSpelling = true)]
-        public static extern ma_result encoder_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_init_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result encoder_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_init_file_w", ExactSpelling = true)]
-        public static extern ma_result encoder_init_file_w([NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_init_file_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result encoder_init_file_w([NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_uninit", ExactSpelling = true)]
-        public static extern void encoder_uninit(ma_encoder* pEncoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void encoder_uninit(ma_encoder* pEncoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_encoder_write_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result encoder_write_pcm_frames(ma_encoder* pEncoder, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesWritten);
+        [LibraryImport("miniaudio", EntryPoint = "ma_encoder_write_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result encoder_write_pcm_frames(ma_encoder* pEncoder, [NativeTypeName("const void *")] void* pFramesIn, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesWritten);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_config_init", ExactSpelling = true)]
-        public static extern ma_waveform_config waveform_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, ma_waveform_type type, double amplitude, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_waveform_config waveform_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, ma_waveform_type type, double amplitude, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_init", ExactSpelling = true)]
-        public static extern ma_result waveform_init([NativeTypeName("const ma_waveform_config *")] ma_waveform_config* pConfig, ma_waveform* pWaveform);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result waveform_init([NativeTypeName("const ma_waveform_config *")] ma_waveform_config* pConfig, ma_waveform* pWaveform);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_uninit", ExactSpelling = true)]
-        public static extern void waveform_uninit(ma_waveform* pWaveform);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void waveform_uninit(ma_waveform* pWaveform);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result waveform_read_pcm_frames(ma_waveform* pWaveform, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result waveform_read_pcm_frames(ma_waveform* pWaveform, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result waveform_seek_to_pcm_frame(ma_waveform* pWaveform, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result waveform_seek_to_pcm_frame(ma_waveform* pWaveform, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_set_amplitude", ExactSpelling = true)]
-        public static extern ma_result waveform_set_amplitude(ma_waveform* pWaveform, double amplitude);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_set_amplitude")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result waveform_set_amplitude(ma_waveform* pWaveform, double amplitude);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_set_frequency", ExactSpelling = true)]
-        public static extern ma_result waveform_set_frequency(ma_waveform* pWaveform, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_set_frequency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result waveform_set_frequency(ma_waveform* pWaveform, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_set_type", ExactSpelling = true)]
-        public static extern ma_result waveform_set_type(ma_waveform* pWaveform, ma_waveform_type type);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_set_type")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result waveform_set_type(ma_waveform* pWaveform, ma_waveform_type type);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_waveform_set_sample_rate", ExactSpelling = true)]
-        public static extern ma_result waveform_set_sample_rate(ma_waveform* pWaveform, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_waveform_set_sample_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result waveform_set_sample_rate(ma_waveform* pWaveform, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_config_init", ExactSpelling = true)]
-        public static extern ma_pulsewave_config pulsewave_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double dutyCycle, double amplitude, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_pulsewave_config pulsewave_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double dutyCycle, double amplitude, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_init", ExactSpelling = true)]
-        public static extern ma_result pulsewave_init([NativeTypeName("const ma_pulsewave_config *")] ma_pulsewave_config* pConfig, ma_pulsewave* pWaveform);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pulsewave_init([NativeTypeName("const ma_pulsewave_config *")] ma_pulsewave_config* pConfig, ma_pulsewave* pWaveform);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_uninit", ExactSpelling = true)]
-        public static extern void pulsewave_uninit(ma_pulsewave* pWaveform);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void pulsewave_uninit(ma_pulsewave* pWaveform);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result pulsewave_read_pcm_frames(ma_pulsewave* pWaveform, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pulsewave_read_pcm_frames(ma_pulsewave* pWaveform, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result pulsewave_seek_to_pcm_frame(ma_pulsewave* pWaveform, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pulsewave_seek_to_pcm_frame(ma_pulsewave* pWaveform, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_set_amplitude", ExactSpelling = true)]
-        public static extern ma_result pulsewave_set_amplitude(ma_pulsewave* pWaveform, double amplitude);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_set_amplitude")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pulsewave_set_amplitude(ma_pulsewave* pWaveform, double amplitude);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_set_frequency", ExactSpelling = true)]
-        public static extern ma_result pulsewave_set_frequency(ma_pulsewave* pWaveform, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_set_frequency")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pulsewave_set_frequency(ma_pulsewave* pWaveform, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_set_sample_rate", ExactSpelling = true)]
-        public static extern ma_result pulsewave_set_sample_rate(ma_pulsewave* pWaveform, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_set_sample_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pulsewave_set_sample_rate(ma_pulsewave* pWaveform, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_pulsewave_set_duty_cycle", ExactSpelling = true)]
-        public static extern ma_result pulsewave_set_duty_cycle(ma_pulsewave* pWaveform, double dutyCycle);
+        [LibraryImport("miniaudio", EntryPoint = "ma_pulsewave_set_duty_cycle")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result pulsewave_set_duty_cycle(ma_pulsewave* pWaveform, double dutyCycle);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_config_init", ExactSpelling = true)]
-        public static extern ma_noise_config noise_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, ma_noise_type type, [NativeTypeName("ma_int32")] int seed, double amplitude);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_noise_config noise_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, ma_noise_type type, [NativeTypeName("ma_int32")] int seed, double amplitude);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result noise_get_heap_size([NativeTypeName("const ma_noise_config *")] ma_noise_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result noise_get_heap_size([NativeTypeName("const ma_noise_config *")] ma_noise_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result noise_init_preallocated([NativeTypeName("const ma_noise_config *")] ma_noise_config* pConfig, void* pHeap, ma_noise* pNoise);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result noise_init_preallocated([NativeTypeName("const ma_noise_config *")] ma_noise_config* pConfig, void* pHeap, ma_noise* pNoise);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_init", ExactSpelling = true)]
-        public static extern ma_result noise_init([NativeTypeName("const ma_noise_config *")] ma_noise_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_noise* pNoise);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result noise_init([NativeTypeName("const ma_noise_config *")] ma_noise_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_noise* pNoise);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_uninit", ExactSpelling = true)]
-        public static extern void noise_uninit(ma_noise* pNoise, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void noise_uninit(ma_noise* pNoise, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result noise_read_pcm_frames(ma_noise* pNoise, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result noise_read_pcm_frames(ma_noise* pNoise, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_set_amplitude", ExactSpelling = true)]
-        public static extern ma_result noise_set_amplitude(ma_noise* pNoise, double amplitude);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_set_amplitude")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result noise_set_amplitude(ma_noise* pNoise, double amplitude);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_set_seed", ExactSpelling = true)]
-        public static extern ma_result noise_set_seed(ma_noise* pNoise, [NativeTypeName("ma_int32")] int seed);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_set_seed")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result noise_set_seed(ma_noise* pNoise, [NativeTypeName("ma_int32")] int seed);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_noise_set_type", ExactSpelling = true)]
-        public static extern ma_result noise_set_type(ma_noise* pNoise, ma_noise_type type);
+        [LibraryImport("miniaudio", EntryPoint = "ma_noise_set_type")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result noise_set_type(ma_noise* pNoise, ma_noise_type type);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_pipeline_notifications_init", ExactSpelling = true)]
-        public static extern ma_resource_manager_pipeline_notifications resource_manager_pipeline_notifications_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_pipeline_notifications_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_resource_manager_pipeline_notifications resource_manager_pipeline_notifications_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_config_init", ExactSpelling = true)]
-        public static extern ma_resource_manager_data_source_config resource_manager_data_source_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_resource_manager_data_source_config resource_manager_data_source_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_config_init", ExactSpelling = true)]
-        public static extern ma_resource_manager_config resource_manager_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_resource_manager_config resource_manager_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_init", ExactSpelling = true)]
-        public static extern ma_result resource_manager_init([NativeTypeName("const ma_resource_manager_config *")] ma_resource_manager_config* pConfig, ma_resource_manager* pResourceManager);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_init([NativeTypeName("const ma_resource_manager_config *")] ma_resource_manager_config* pConfig, ma_resource_manager* pResourceManager);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_uninit", ExactSpelling = true)]
-        public static extern void resource_manager_uninit(ma_resource_manager* pResourceManager);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void resource_manager_uninit(ma_resource_manager* pResourceManager);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_get_log", ExactSpelling = true)]
-        public static extern ma_log* resource_manager_get_log(ma_resource_manager* pResourceManager);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_get_log")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_log* resource_manager_get_log(ma_resource_manager* pResourceManager);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_register_file", ExactSpelling = true)]
-        public static extern ma_result resource_manager_register_file(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_register_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_register_file(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_register_file_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_register_file_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_register_file_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_register_file_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_register_decoded_data", ExactSpelling = true)]
-        public static extern ma_result resource_manager_register_decoded_data(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_register_decoded_data")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_register_decoded_data(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_register_decoded_data_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_register_decoded_data_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_register_decoded_data_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_register_decoded_data_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_register_encoded_data", ExactSpelling = true)]
-        public static extern ma_result resource_manager_register_encoded_data(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint sizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_register_encoded_data")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_register_encoded_data(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint sizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_register_encoded_data_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_register_encoded_data_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint sizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_register_encoded_data_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_register_encoded_data_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint sizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_unregister_file", ExactSpelling = true)]
-        public static extern ma_result resource_manager_unregister_file(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_unregister_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_unregister_file(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_unregister_file_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_unregister_file_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_unregister_file_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_unregister_file_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_unregister_data", ExactSpelling = true)]
-        public static extern ma_result resource_manager_unregister_data(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_unregister_data")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_unregister_data(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_unregister_data_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_unregister_data_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_unregister_data_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_unregister_data_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_init_ex", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_init_ex(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source_config *")] ma_resource_manager_data_source_config* pConfig, ma_resource_manager_data_buffer* pDataBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_init_ex(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source_config *")] ma_resource_manager_data_source_config* pConfig, ma_resource_manager_data_buffer* pDataBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_init", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_init(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_buffer* pDataBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_init(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_buffer* pDataBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_init_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_init_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_buffer* pDataBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_init_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_init_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_buffer* pDataBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_init_copy", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_init_copy(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_buffer *")] ma_resource_manager_data_buffer* pExistingDataBuffer, ma_resource_manager_data_buffer* pDataBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_init_copy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_init_copy(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_buffer *")] ma_resource_manager_data_buffer* pExistingDataBuffer, ma_resource_manager_data_buffer* pDataBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_uninit", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_uninit(ma_resource_manager_data_buffer* pDataBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_uninit(ma_resource_manager_data_buffer* pDataBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_read_pcm_frames(ma_resource_manager_data_buffer* pDataBuffer, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_read_pcm_frames(ma_resource_manager_data_buffer* pDataBuffer, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_seek_to_pcm_frame(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_seek_to_pcm_frame(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_get_data_format", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_get_data_format(ma_resource_manager_data_buffer* pDataBuffer, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_get_data_format(ma_resource_manager_data_buffer* pDataBuffer, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_get_cursor_in_pcm_frames(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_get_cursor_in_pcm_frames(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_get_length_in_pcm_frames(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_get_length_in_pcm_frames(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_result", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_result([NativeTypeName("const ma_resource_manager_data_buffer *")] ma_resource_manager_data_buffer* pDataBuffer);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_result")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_result([NativeTypeName("const ma_resource_manager_data_buffer *")] ma_resource_manager_data_buffer* pDataBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_set_looping", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_set_looping(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_bool32")] uint isLooping);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_set_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_set_looping(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_bool32")] uint isLooping);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_is_looping", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_is_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint resource_manager_data_buffer_is_looping([NativeTypeName("const ma_resource_manager_data_buffer *")] ma_resource_manager_data_buffer* pDataBuffer);
+        public static partial uint resource_manager_data_buffer_is_looping([NativeTypeName("const ma_resource_manager_data_buffer *")] ma_resource_manager_data_buffer* pDataBuffer);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_buffer_get_available_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_buffer_get_available_frames(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_buffer_get_available_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_buffer_get_available_frames(ma_resource_manager_data_buffer* pDataBuffer, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_init_ex", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_init_ex(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source_config *")] ma_resource_manager_data_source_config* pConfig, ma_resource_manager_data_stream* pDataStream);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_init_ex(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source_config *")] ma_resource_manager_data_source_config* pConfig, ma_resource_manager_data_stream* pDataStream);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_init", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_init(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_stream* pDataStream);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_init(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_stream* pDataStream);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_init_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_init_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_stream* pDataStream);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_init_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_init_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_stream* pDataStream);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_uninit", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_uninit(ma_resource_manager_data_stream* pDataStream);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_uninit(ma_resource_manager_data_stream* pDataStream);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_read_pcm_frames(ma_resource_manager_data_stream* pDataStream, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_read_pcm_frames(ma_resource_manager_data_stream* pDataStream, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_seek_to_pcm_frame(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_seek_to_pcm_frame(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_get_data_format", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_get_data_format(ma_resource_manager_data_stream* pDataStream, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_get_data_format(ma_resource_manager_data_stream* pDataStream, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_get_cursor_in_pcm_frames(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_get_cursor_in_pcm_frames(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_get_length_in_pcm_frames(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_get_length_in_pcm_frames(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_result", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_result([NativeTypeName("const ma_resource_manager_data_stream *")] ma_resource_manager_data_stream* pDataStream);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_result")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_result([NativeTypeName("const ma_resource_manager_data_stream *")] ma_resource_manager_data_stream* pDataStream);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_set_looping", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_set_looping(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_bool32")] uint isLooping);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_set_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_set_looping(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_bool32")] uint isLooping);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_is_looping", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_is_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint resource_manager_data_stream_is_looping([NativeTypeName("const ma_resource_manager_data_stream *")] ma_resource_manager_data_stream* pDataStream);
+        public static partial uint resource_manager_data_stream_is_looping([NativeTypeName("const ma_resource_manager_data_stream *")] ma_resource_manager_data_stream* pDataStream);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_stream_get_available_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_stream_get_available_frames(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_stream_get_available_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_stream_get_available_frames(ma_resource_manager_data_stream* pDataStream, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_init_ex", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_init_ex(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source_config *")] ma_resource_manager_data_source_config* pConfig, ma_resource_manager_data_source* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_init_ex(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source_config *")] ma_resource_manager_data_source_config* pConfig, ma_resource_manager_data_source* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_init", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_init(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_source* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_init(ma_resource_manager* pResourceManager, [NativeTypeName("const char *")] sbyte* pName, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_source* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_init_w", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_init_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_source* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_init_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_init_w(ma_resource_manager* pResourceManager, [NativeTypeName("const wchar_t *")] ushort* pName, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_source* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_init_copy", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_init_copy(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source *")] ma_resource_manager_data_source* pExistingDataSource, ma_resource_manager_data_source* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_init_copy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_init_copy(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_resource_manager_data_source *")] ma_resource_manager_data_source* pExistingDataSource, ma_resource_manager_data_source* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_uninit", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_uninit(ma_resource_manager_data_source* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_uninit(ma_resource_manager_data_source* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_read_pcm_frames(ma_resource_manager_data_source* pDataSource, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_read_pcm_frames(ma_resource_manager_data_source* pDataSource, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_seek_to_pcm_frame(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_seek_to_pcm_frame(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_get_data_format", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_get_data_format(ma_resource_manager_data_source* pDataSource, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_get_data_format(ma_resource_manager_data_source* pDataSource, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_get_cursor_in_pcm_frames(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_get_cursor_in_pcm_frames(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_get_length_in_pcm_frames(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_get_length_in_pcm_frames(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_result", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_result([NativeTypeName("const ma_resource_manager_data_source *")] ma_resource_manager_data_source* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_result")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_result([NativeTypeName("const ma_resource_manager_data_source *")] ma_resource_manager_data_source* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_set_looping", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_set_looping(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_bool32")] uint isLooping);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_set_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_set_looping(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_bool32")] uint isLooping);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_is_looping", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_is_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint resource_manager_data_source_is_looping([NativeTypeName("const ma_resource_manager_data_source *")] ma_resource_manager_data_source* pDataSource);
+        public static partial uint resource_manager_data_source_is_looping([NativeTypeName("const ma_resource_manager_data_source *")] ma_resource_manager_data_source* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_data_source_get_available_frames", ExactSpelling = true)]
-        public static extern ma_result resource_manager_data_source_get_available_frames(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_data_source_get_available_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_data_source_get_available_frames(ma_resource_manager_data_source* pDataSource, [NativeTypeName("ma_uint64 *")] ulong* pAvailableFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_post_job", ExactSpelling = true)]
-        public static extern ma_result resource_manager_post_job(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_job *")] ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_post_job")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_post_job(ma_resource_manager* pResourceManager, [NativeTypeName("const ma_job *")] ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_post_job_quit", ExactSpelling = true)]
-        public static extern ma_result resource_manager_post_job_quit(ma_resource_manager* pResourceManager);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_post_job_quit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_post_job_quit(ma_resource_manager* pResourceManager);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_next_job", ExactSpelling = true)]
-        public static extern ma_result resource_manager_next_job(ma_resource_manager* pResourceManager, ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_next_job")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_next_job(ma_resource_manager* pResourceManager, ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_process_job", ExactSpelling = true)]
-        public static extern ma_result resource_manager_process_job(ma_resource_manager* pResourceManager, ma_job* pJob);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_process_job")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_process_job(ma_resource_manager* pResourceManager, ma_job* pJob);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_resource_manager_process_next_job", ExactSpelling = true)]
-        public static extern ma_result resource_manager_process_next_job(ma_resource_manager* pResourceManager);
+        [LibraryImport("miniaudio", EntryPoint = "ma_resource_manager_process_next_job")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result resource_manager_process_next_job(ma_resource_manager* pResourceManager);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_config_init", ExactSpelling = true)]
-        public static extern ma_node_config node_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_node_config node_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result node_get_heap_size(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_node_config *")] ma_node_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_get_heap_size(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_node_config *")] ma_node_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result node_init_preallocated(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_node_config *")] ma_node_config* pConfig, void* pHeap, [NativeTypeName("ma_node *")] void* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_init_preallocated(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_node_config *")] ma_node_config* pConfig, void* pHeap, [NativeTypeName("ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_init", ExactSpelling = true)]
-        public static extern ma_result node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_node_config *")] ma_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, [NativeTypeName("ma_node *")] void* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_node_config *")] ma_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, [NativeTypeName("ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_uninit", ExactSpelling = true)]
-        public static extern void node_uninit([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void node_uninit([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_node_graph", ExactSpelling = true)]
-        public static extern ma_node_graph* node_get_node_graph([NativeTypeName("const ma_node *")] void* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_node_graph")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_node_graph* node_get_node_graph([NativeTypeName("const ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_input_bus_count", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_input_bus_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint node_get_input_bus_count([NativeTypeName("const ma_node *")] void* pNode);
+        public static partial uint node_get_input_bus_count([NativeTypeName("const ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_output_bus_count", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_output_bus_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint node_get_output_bus_count([NativeTypeName("const ma_node *")] void* pNode);
+        public static partial uint node_get_output_bus_count([NativeTypeName("const ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_input_channels", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_input_channels")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint node_get_input_channels([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint inputBusIndex);
+        public static partial uint node_get_input_channels([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint inputBusIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_output_channels", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_output_channels")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint node_get_output_channels([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex);
+        public static partial uint node_get_output_channels([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_attach_output_bus", ExactSpelling = true)]
-        public static extern ma_result node_attach_output_bus([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex, [NativeTypeName("ma_node *")] void* pOtherNode, [NativeTypeName("ma_uint32")] uint otherNodeInputBusIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_attach_output_bus")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_attach_output_bus([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex, [NativeTypeName("ma_node *")] void* pOtherNode, [NativeTypeName("ma_uint32")] uint otherNodeInputBusIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_detach_output_bus", ExactSpelling = true)]
-        public static extern ma_result node_detach_output_bus([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_detach_output_bus")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_detach_output_bus([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_detach_all_output_buses", ExactSpelling = true)]
-        public static extern ma_result node_detach_all_output_buses([NativeTypeName("ma_node *")] void* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_detach_all_output_buses")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_detach_all_output_buses([NativeTypeName("ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_set_output_bus_volume", ExactSpelling = true)]
-        public static extern ma_result node_set_output_bus_volume([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_set_output_bus_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial ma_result node_set_output_bus_volume([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex, float volume);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_output_bus_volume", ExactSpelling = true)]
-        public static extern float node_get_output_bus_volume([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_output_bus_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float node_get_output_bus_volume([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint outputBusIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_set_state", ExactSpelling = true)]
-        public static extern ma_result node_set_state([NativeTypeName("ma_node *")] void* pNode, ma_node_state state);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_set_state")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_set_state([NativeTypeName("ma_node *")] void* pNode, ma_node_state state);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_state", ExactSpelling = true)]
-        public static extern ma_node_state node_get_state([NativeTypeName("const ma_node *")] void* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_state")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial ma_node_state node_get_state([NativeTypeName("const ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_set_state_time", ExactSpelling = true)]
-        public static extern ma_result node_set_state_time([NativeTypeName("ma_node *")] void* pNode, ma_node_state state, [NativeTypeName("ma_uint64")] ulong globalTime);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_set_state_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_set_state_time([NativeTypeName("ma_node *")] void* pNode, ma_node_state state, [NativeTypeName("ma_uint64")] ulong globalTime);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_state_time", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_state_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong node_get_state_time([NativeTypeName("const ma_node *")] void* pNode, ma_node_state state);
+        public static partial ulong node_get_state_time([NativeTypeName("const ma_node *")] void* pNode, ma_node_state state);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_state_by_time", ExactSpelling = true)]
-        public static extern ma_node_state node_get_state_by_time([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint64")] ulong globalTime);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_state_by_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_node_state node_get_state_by_time([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint64")] ulong globalTime);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_state_by_time_range", ExactSpelling = true)]
-        public static extern ma_node_state node_get_state_by_time_range([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint64")] ulong globalTimeBeg, [NativeTypeName("ma_uint64")] ulong globalTimeEnd);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_state_by_time_range")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_node_state node_get_state_by_time_range([NativeTypeName("const ma_node *")] void* pNode, [NativeTypeName("ma_uint64")] ulong globalTimeBeg, [NativeTypeName("ma_uint64")] ulong globalTimeEnd);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_get_time", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_get_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong node_get_time([NativeTypeName("const ma_node *")] void* pNode);
+        public static partial ulong node_get_time([NativeTypeName("const ma_node *")] void* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_set_time", ExactSpelling = true)]
-        public static extern ma_result node_set_time([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint64")] ulong localTime);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_set_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_set_time([NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint64")] ulong localTime);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_config_init", ExactSpelling = true)]
-        public static extern ma_node_graph_config node_graph_config_init([NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_node_graph_config node_graph_config_init([NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_init", ExactSpelling = true)]
-        public static extern ma_result node_graph_init([NativeTypeName("const ma_node_graph_config *")] ma_node_graph_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_node_graph* pNodeGraph);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_graph_init([NativeTypeName("const ma_node_graph_config *")] ma_node_graph_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_node_graph* pNodeGraph);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_uninit", ExactSpelling = true)]
-        public static extern void node_graph_uninit(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void node_graph_uninit(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_get_endpoint", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_get_endpoint")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_node *")]
-        public static extern void* node_graph_get_endpoint(ma_node_graph* pNodeGraph);
+        public static partial void* node_graph_get_endpoint(ma_node_graph* pNodeGraph);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result node_graph_read_pcm_frames(ma_node_graph* pNodeGraph, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_graph_read_pcm_frames(ma_node_graph* pNodeGraph, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_get_channels", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_get_channels")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint node_graph_get_channels([NativeTypeName("const ma_node_graph *")] ma_node_graph* pNodeGraph);
+        public static partial uint node_graph_get_channels([NativeTypeName("const ma_node_graph *")] ma_node_graph* pNodeGraph);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_get_time", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_get_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong node_graph_get_time([NativeTypeName("const ma_node_graph *")] ma_node_graph* pNodeGraph);
+        public static partial ulong node_graph_get_time([NativeTypeName("const ma_node_graph *")] ma_node_graph* pNodeGraph);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_node_graph_set_time", ExactSpelling = true)]
-        public static extern ma_result node_graph_set_time(ma_node_graph* pNodeGraph, [NativeTypeName("ma_uint64")] ulong globalTime);
+        [LibraryImport("miniaudio", EntryPoint = "ma_node_graph_set_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result node_graph_set_time(ma_node_graph* pNodeGraph, [NativeTypeName("ma_uint64")] ulong globalTime);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_node_config_init", ExactSpelling = true)]
-        public static extern ma_data_source_node_config data_source_node_config_init([NativeTypeName("ma_data_source *")] void* pDataSource);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_data_source_node_config data_source_node_config_init([NativeTypeName("ma_data_source *")] void* pDataSource);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_node_init", ExactSpelling = true)]
-        public static extern ma_result data_source_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_data_source_node_config *")] ma_data_source_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_data_source_node* pDataSourceNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_data_source_node_config *")] ma_data_source_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_data_source_node* pDataSourceNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_node_uninit", ExactSpelling = true)]
-        public static extern void data_source_node_uninit(ma_data_source_node* pDataSourceNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void data_source_node_uninit(ma_data_source_node* pDataSourceNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_node_set_looping", ExactSpelling = true)]
-        public static extern ma_result data_source_node_set_looping(ma_data_source_node* pDataSourceNode, [NativeTypeName("ma_bool32")] uint isLooping);
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_node_set_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result data_source_node_set_looping(ma_data_source_node* pDataSourceNode, [NativeTypeName("ma_bool32")] uint isLooping);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_data_source_node_is_looping", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_data_source_node_is_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint data_source_node_is_looping(ma_data_source_node* pDataSourceNode);
+        public static partial uint data_source_node_is_looping(ma_data_source_node* pDataSourceNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_splitter_node_config_init", ExactSpelling = true)]
-        public static extern ma_splitter_node_config splitter_node_config_init([NativeTypeName("ma_uint32")] uint channels);
+        [LibraryImport("miniaudio", EntryPoint = "ma_splitter_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_splitter_node_config splitter_node_config_init([NativeTypeName("ma_uint32")] uint channels);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_splitter_node_init", ExactSpelling = true)]
-        public static extern ma_result splitter_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_splitter_node_config *")] ma_splitter_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_splitter_node* pSplitterNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_splitter_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result splitter_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_splitter_node_config *")] ma_splitter_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_splitter_node* pSplitterNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_splitter_node_uninit", ExactSpelling = true)]
-        public static extern void splitter_node_uninit(ma_splitter_node* pSplitterNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_splitter_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void splitter_node_uninit(ma_splitter_node* pSplitterNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_node_config_init", ExactSpelling = true)]
-        public static extern ma_biquad_node_config biquad_node_config_init([NativeTypeName("ma_uint32")] uint channels, float b0, float b1, float b2, float a0, float a1, float a2);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_biquad_node_config biquad_node_config_init([NativeTypeName("ma_uint32")] uint channels, float b0, float b1, float b2, float a0, float a1, float a2);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_node_init", ExactSpelling = true)]
-        public static extern ma_result biquad_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_biquad_node_config *")] ma_biquad_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_biquad_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_biquad_node_config *")] ma_biquad_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_biquad_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_node_reinit", ExactSpelling = true)]
-        public static extern ma_result biquad_node_reinit([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, ma_biquad_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result biquad_node_reinit([NativeTypeName("const ma_biquad_config *")] ma_biquad_config* pConfig, ma_biquad_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_biquad_node_uninit", ExactSpelling = true)]
-        public static extern void biquad_node_uninit(ma_biquad_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_biquad_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void biquad_node_uninit(ma_biquad_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_node_config_init", ExactSpelling = true)]
-        public static extern ma_lpf_node_config lpf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_lpf_node_config lpf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_node_init", ExactSpelling = true)]
-        public static extern ma_result lpf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_lpf_node_config *")] ma_lpf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_lpf_node_config *")] ma_lpf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_lpf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_node_reinit", ExactSpelling = true)]
-        public static extern ma_result lpf_node_reinit([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, ma_lpf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result lpf_node_reinit([NativeTypeName("const ma_lpf_config *")] ma_lpf_config* pConfig, ma_lpf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_lpf_node_uninit", ExactSpelling = true)]
-        public static extern void lpf_node_uninit(ma_lpf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_lpf_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void lpf_node_uninit(ma_lpf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_node_config_init", ExactSpelling = true)]
-        public static extern ma_hpf_node_config hpf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_hpf_node_config hpf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_node_init", ExactSpelling = true)]
-        public static extern ma_result hpf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_hpf_node_config *")] ma_hpf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_hpf_node_config *")] ma_hpf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hpf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_node_reinit", ExactSpelling = true)]
-        public static extern ma_result hpf_node_reinit([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, ma_hpf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hpf_node_reinit([NativeTypeName("const ma_hpf_config *")] ma_hpf_config* pConfig, ma_hpf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hpf_node_uninit", ExactSpelling = true)]
-        public static extern void hpf_node_uninit(ma_hpf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hpf_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void hpf_node_uninit(ma_hpf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_node_config_init", ExactSpelling = true)]
-        public static extern ma_bpf_node_config bpf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_bpf_node_config bpf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double cutoffFrequency, [NativeTypeName("ma_uint32")] uint order);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_node_init", ExactSpelling = true)]
-        public static extern ma_result bpf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_bpf_node_config *")] ma_bpf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_bpf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_bpf_node_config *")] ma_bpf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_bpf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_node_reinit", ExactSpelling = true)]
-        public static extern ma_result bpf_node_reinit([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, ma_bpf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result bpf_node_reinit([NativeTypeName("const ma_bpf_config *")] ma_bpf_config* pConfig, ma_bpf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_bpf_node_uninit", ExactSpelling = true)]
-        public static extern void bpf_node_uninit(ma_bpf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_bpf_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void bpf_node_uninit(ma_bpf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch_node_config_init", ExactSpelling = true)]
-        public static extern ma_notch_node_config notch_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double q, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_notch_node_config notch_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double q, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch_node_init", ExactSpelling = true)]
-        public static extern ma_result notch_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_notch_node_config *")] ma_notch_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_notch_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result notch_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_notch_node_config *")] ma_notch_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_notch_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch_node_reinit", ExactSpelling = true)]
-        public static extern ma_result notch_node_reinit([NativeTypeName("const ma_notch_config *")] ma_notch2_config* pConfig, ma_notch_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result notch_node_reinit([NativeTypeName("const ma_notch_config *")] ma_notch2_config* pConfig, ma_notch_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_notch_node_uninit", ExactSpelling = true)]
-        public static extern void notch_node_uninit(ma_notch_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_notch_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void notch_node_uninit(ma_notch_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak_node_config_init", ExactSpelling = true)]
-        public static extern ma_peak_node_config peak_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_peak_node_config peak_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak_node_init", ExactSpelling = true)]
-        public static extern ma_result peak_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_peak_node_config *")] ma_peak_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_peak_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result peak_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_peak_node_config *")] ma_peak_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_peak_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak_node_reinit", ExactSpelling = true)]
-        public static extern ma_result peak_node_reinit([NativeTypeName("const ma_peak_config *")] ma_peak2_config* pConfig, ma_peak_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result peak_node_reinit([NativeTypeName("const ma_peak_config *")] ma_peak2_config* pConfig, ma_peak_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_peak_node_uninit", ExactSpelling = true)]
-        public static extern void peak_node_uninit(ma_peak_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_peak_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void peak_node_uninit(ma_peak_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf_node_config_init", ExactSpelling = true)]
-        public static extern ma_loshelf_node_config loshelf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_loshelf_node_config loshelf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf_node_init", ExactSpelling = true)]
-        public static extern ma_result loshelf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_loshelf_node_config *")] ma_loshelf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_loshelf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result loshelf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_loshelf_node_config *")] ma_loshelf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_loshelf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf_node_reinit", ExactSpelling = true)]
-        public static extern ma_result loshelf_node_reinit([NativeTypeName("const ma_loshelf_config *")] ma_loshelf2_config* pConfig, ma_loshelf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result loshelf_node_reinit([NativeTypeName("const ma_loshelf_config *")] ma_loshelf2_config* pConfig, ma_loshelf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_loshelf_node_uninit", ExactSpelling = true)]
-        public static extern void loshelf_node_uninit(ma_loshelf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_loshelf_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void loshelf_node_uninit(ma_loshelf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf_node_config_init", ExactSpelling = true)]
-        public static extern ma_hishelf_node_config hishelf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_hishelf_node_config hishelf_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, double gainDB, double q, double frequency);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf_node_init", ExactSpelling = true)]
-        public static extern ma_result hishelf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_hishelf_node_config *")] ma_hishelf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hishelf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hishelf_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_hishelf_node_config *")] ma_hishelf_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_hishelf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf_node_reinit", ExactSpelling = true)]
-        public static extern ma_result hishelf_node_reinit([NativeTypeName("const ma_hishelf_config *")] ma_hishelf2_config* pConfig, ma_hishelf_node* pNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf_node_reinit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result hishelf_node_reinit([NativeTypeName("const ma_hishelf_config *")] ma_hishelf2_config* pConfig, ma_hishelf_node* pNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_hishelf_node_uninit", ExactSpelling = true)]
-        public static extern void hishelf_node_uninit(ma_hishelf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_hishelf_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void hishelf_node_uninit(ma_hishelf_node* pNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_config_init", ExactSpelling = true)]
-        public static extern ma_delay_node_config delay_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, [NativeTypeName("ma_uint32")] uint delayInFrames, float decay);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_delay_node_config delay_node_config_init([NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate, [NativeTypeName("ma_uint32")] uint delayInFrames, float decay);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_init", ExactSpelling = true)]
-        public static extern ma_result delay_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_delay_node_config *")] ma_delay_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_delay_node* pDelayNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result delay_node_init(ma_node_graph* pNodeGraph, [NativeTypeName("const ma_delay_node_config *")] ma_delay_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_delay_node* pDelayNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_uninit", ExactSpelling = true)]
-        public static extern void delay_node_uninit(ma_delay_node* pDelayNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_node_uninit(ma_delay_node* pDelayNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_set_wet", ExactSpelling = true)]
-        public static extern void delay_node_set_wet(ma_delay_node* pDelayNode, float value);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_set_wet")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_node_set_wet(ma_delay_node* pDelayNode, float value);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_get_wet", ExactSpelling = true)]
-        public static extern float delay_node_get_wet([NativeTypeName("const ma_delay_node *")] ma_delay_node* pDelayNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_get_wet")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float delay_node_get_wet([NativeTypeName("const ma_delay_node *")] ma_delay_node* pDelayNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_set_dry", ExactSpelling = true)]
-        public static extern void delay_node_set_dry(ma_delay_node* pDelayNode, float value);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_set_dry")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_node_set_dry(ma_delay_node* pDelayNode, float value);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_get_dry", ExactSpelling = true)]
-        public static extern float delay_node_get_dry([NativeTypeName("const ma_delay_node *")] ma_delay_node* pDelayNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_get_dry")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float delay_node_get_dry([NativeTypeName("const ma_delay_node *")] ma_delay_node* pDelayNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_set_decay", ExactSpelling = true)]
-        public static extern void delay_node_set_decay(ma_delay_node* pDelayNode, float value);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_set_decay")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void delay_node_set_decay(ma_delay_node* pDelayNode, float value);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_delay_node_get_decay", ExactSpelling = true)]
-        public static extern float delay_node_get_decay([NativeTypeName("const ma_delay_node *")] ma_delay_node* pDelayNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_delay_node_get_decay")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float delay_node_get_decay([NativeTypeName("const ma_delay_node *")] ma_delay_node* pDelayNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_node_config_init", ExactSpelling = true)]
-        public static extern ma_engine_node_config engine_node_config_init(ma_engine* pEngine, ma_engine_node_type type, [NativeTypeName("ma_uint32")] uint flags);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_node_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_engine_node_config engine_node_config_init(ma_engine* pEngine, ma_engine_node_type type, [NativeTypeName("ma_uint32")] uint flags);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_node_get_heap_size", ExactSpelling = true)]
-        public static extern ma_result engine_node_get_heap_size([NativeTypeName("const ma_engine_node_config *")] ma_engine_node_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_node_get_heap_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_node_get_heap_size([NativeTypeName("const ma_engine_node_config *")] ma_engine_node_config* pConfig, [NativeTypeName("size_t *")] nuint* pHeapSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_node_init_preallocated", ExactSpelling = true)]
-        public static extern ma_result engine_node_init_preallocated([NativeTypeName("const ma_engine_node_config *")] ma_engine_node_config* pConfig, void* pHeap, ma_engine_node* pEngineNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_node_init_preallocated")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_node_init_preallocated([NativeTypeName("const ma_engine_node_config *")] ma_engine_node_config* pConfig, void* pHeap, ma_engine_node* pEngineNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_node_init", ExactSpelling = true)]
-        public static extern ma_result engine_node_init([NativeTypeName("const ma_engine_node_config *")] ma_engine_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_engine_node* pEngineNode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_node_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_node_init([NativeTypeName("const ma_engine_node_config *")] ma_engine_node_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_engine_node* pEngineNode);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_node_uninit", ExactSpelling = true)]
-        public static extern void engine_node_uninit(ma_engine_node* pEngineNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_node_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_node_uninit(ma_engine_node* pEngineNode, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_config_init", ExactSpelling = true)]
-        public static extern ma_sound_config sound_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_sound_config sound_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_config_init_2", ExactSpelling = true)]
-        public static extern ma_sound_config sound_config_init_2(ma_engine* pEngine);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_config_init_2")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_sound_config sound_config_init_2(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_config_init", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_sound_group_config")]
-        public static extern ma_sound_config sound_group_config_init();
+        public static partial ma_sound_config sound_group_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_config_init_2", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_config_init_2")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_sound_group_config")]
-        public static extern ma_sound_config sound_group_config_init_2(ma_engine* pEngine);
+        public static partial ma_sound_config sound_group_config_init_2(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_config_init", ExactSpelling = true)]
-        public static extern ma_engine_config engine_config_init();
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_engine_config engine_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_init", ExactSpelling = true)]
-        public static extern ma_result engine_init([NativeTypeName("const ma_engine_config *")] ma_engine_config* pConfig, ma_engine* pEngine);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_init([NativeTypeName("const ma_engine_config *")] ma_engine_config* pConfig, ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_uninit", ExactSpelling = true)]
-        public static extern void engine_uninit(ma_engine* pEngine);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_uninit(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result engine_read_pcm_frames(ma_engine* pEngine, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_read_pcm_frames(ma_engine* pEngine, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_node_graph", ExactSpelling = true)]
-        public static extern ma_node_graph* engine_get_node_graph(ma_engine* pEngine);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_node_graph")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_node_graph* engine_get_node_graph(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_resource_manager", ExactSpelling = true)]
-        public static extern ma_resource_manager* engine_get_resource_manager(ma_engine* pEngine);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_resource_manager")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_resource_manager* engine_get_resource_manager(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_device", ExactSpelling = true)]
-        public static extern ma_device* engine_get_device(ma_engine* pEngine);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_device")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_device* engine_get_device(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_log", ExactSpelling = true)]
-        public static extern ma_log* engine_get_log(ma_engine* pEngine);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_log")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_log* engine_get_log(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_endpoint", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_endpoint")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_node *")]
-        public static extern void* engine_get_endpoint(ma_engine* pEngine);
+        public static partial void* engine_get_endpoint(ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_time_in_pcm_frames", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong engine_get_time_in_pcm_frames([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
+        public static partial ulong engine_get_time_in_pcm_frames([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_time_in_milliseconds", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_time_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong engine_get_time_in_milliseconds([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
+        public static partial ulong engine_get_time_in_milliseconds([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_set_time_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result engine_set_time_in_pcm_frames(ma_engine* pEngine, [NativeTypeName("ma_uint64")] ulong globalTime);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_set_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial ma_result engine_set_time_in_pcm_frames(ma_engine* pEngine, [NativeTypeName("ma_uint64")] ulong globalTime);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_set_time_in_milliseconds", ExactSpelling = true)]
-        public static extern ma_result engine_set_time_in_milliseconds(ma_engine* pEngine, [NativeTypeName("ma_uint64")] ulong globalTime);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_set_time_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial ma_result engine_set_time_in_milliseconds(ma_engine* pEngine, [NativeTypeName("ma_uint64")] ulong globalTime);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_time", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint64")]
-        public static extern ulong engine_get_time([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
+        public static partial ulong engine_get_time([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_set_time", ExactSpelling = true)]
-        public static extern ma_result engine_set_time(ma_engine* pEngine, [NativeTypeName("ma_uint64")] ulong globalTime);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_set_time")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_set_time(ma_engine* pEngine, [NativeTypeName("ma_uint64")] ulong globalTime);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_channels", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_channels")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint engine_get_channels([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
+        public static partial uint engine_get_channels([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_sample_rate", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_sample_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint engine_get_sample_rate([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_start", ExactSpelling = true)]
-        public static extern ma_result engine_start(ma_engine* pEngine);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_stop", ExactSpelling = true)]
-        public static extern ma_result engine_stop(ma_engine* pEngine);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_set_volume", ExactSpelling = true)]
-        public static extern ma_result engine_set_volume(ma_engine* pEngine, float volume);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_volume", ExactSpelling = true)]
-        public static extern float engine_get_volume(ma_engine* pEngine);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_set_gain_db", ExactSpelling = true)]
-        public static extern ma_result engine_set_gain_db(ma_engine* pEngine, float gainDB);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_gain_db", ExactSpelling = true)]
-        public static extern float engine_get_gain_db(ma_engine* pEngine);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_get_listener_count", ExactSpelling = true)]
+        public static partial uint engine_get_sample_rate([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_start")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_start(ma_engine* pEngine);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_stop")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_stop(ma_engine* pEngine);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_set_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial ma_result engine_set_volume(ma_engine* pEngine, float volume);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float engine_get_volume(ma_engine* pEngine);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_set_gain_db")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial ma_result engine_set_gain_db(ma_engine* pEngine, float gainDB);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_gain_db")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float engine_get_gain_db(ma_engine* pEngine);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_get_listener_count")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint engine_get_listener_count([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
+        public static partial uint engine_get_listener_count([NativeTypeName("const ma_engine *")] ma_engine* pEngine);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_find_closest_listener", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_find_closest_listener")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_uint32")]
-        public static extern uint engine_find_closest_listener([NativeTypeName("const ma_engine *")] ma_engine* pEngine, float absolutePosX, float absolutePosY, float absolutePosZ);
+        public static partial uint engine_find_closest_listener([NativeTypeName("const ma_engine *")] ma_engine* pEngine, float absolutePosX, float absolutePosY, float absolutePosZ);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_set_position", ExactSpelling = true)]
-        public static extern void engine_listener_set_position(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_set_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_listener_set_position(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_get_position", ExactSpelling = true)]
-        public static extern ma_vec3f engine_listener_get_position([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_get_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f engine_listener_get_position([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_set_direction", ExactSpelling = true)]
-        public static extern void engine_listener_set_direction(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_set_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_listener_set_direction(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_get_direction", ExactSpelling = true)]
-        public static extern ma_vec3f engine_listener_get_direction([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_get_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f engine_listener_get_direction([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_set_velocity", ExactSpelling = true)]
-        public static extern void engine_listener_set_velocity(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_set_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_listener_set_velocity(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_get_velocity", ExactSpelling = true)]
-        public static extern ma_vec3f engine_listener_get_velocity([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_get_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f engine_listener_get_velocity([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_set_cone", ExactSpelling = true)]
-        public static extern void engine_listener_set_cone(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_set_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_listener_set_cone(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_get_cone", ExactSpelling = true)]
-        public static extern void engine_listener_get_cone([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_get_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_listener_get_cone([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_set_world_up", ExactSpelling = true)]
-        public static extern void engine_listener_set_world_up(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_set_world_up")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_listener_set_world_up(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_get_world_up", ExactSpelling = true)]
-        public static extern ma_vec3f engine_listener_get_world_up([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_get_world_up")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f engine_listener_get_world_up([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_set_enabled", ExactSpelling = true)]
-        public static extern void engine_listener_set_enabled(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, [NativeTypeName("ma_bool32")] uint isEnabled);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_set_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void engine_listener_set_enabled(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex, [NativeTypeName("ma_bool32")] uint isEnabled);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_listener_is_enabled", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_listener_is_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_bool32")]
-        public static extern uint engine_listener_is_enabled([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
+        public static partial uint engine_listener_is_enabled([NativeTypeName("const ma_engine *")] ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint listenerIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_play_sound_ex", ExactSpelling = true)]
-        public static extern ma_result engine_play_sound_ex(ma_engine* pEngine, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint nodeInputBusIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_play_sound_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_play_sound_ex(ma_engine* pEngine, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint nodeInputBusIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_engine_play_sound", ExactSpelling = true)]
-        public static extern ma_result engine_play_sound(ma_engine* pEngine, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_engine_play_sound")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_play_sound(ma_engine* pEngine, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_init_from_file", ExactSpelling = true)]
-        public static extern ma_result sound_init_from_file(ma_engine* pEngine, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_fence* pDoneFence, ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_init_from_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_init_from_file(ma_engine* pEngine, [NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_fence* pDoneFence, ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_init_from_file_w", ExactSpelling = true)]
-        public static extern ma_result sound_init_from_file_w(ma_engine* pEngine, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_fence* pDoneFence, ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_init_from_file_w")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_init_from_file_w(ma_engine* pEngine, [NativeTypeName("const wchar_t *")] ushort* pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_fence* pDoneFence, ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_init_copy", ExactSpelling = true)]
-        public static extern ma_result sound_init_copy(ma_engine* pEngine, [NativeTypeName("const ma_sound *")] ma_sound* pExistingSound, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_init_copy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_init_copy(ma_engine* pEngine, [NativeTypeName("const ma_sound *")] ma_sound* pExistingSound, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_init_from_data_source", ExactSpelling = true)]
-        public static extern ma_result sound_init_from_data_source(ma_engine* pEngine, [NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_init_from_data_source")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_init_from_data_source(ma_engine* pEngine, [NativeTypeName("ma_data_source *")] void* pDataSource, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_init_ex", ExactSpelling = true)]
-        public static extern ma_result sound_init_ex(ma_engine* pEngine, [NativeTypeName("const ma_sound_config *")] ma_sound_config* pConfig, ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_init_ex(ma_engine* pEngine, [NativeTypeName("const ma_sound_config *")] ma_sound_config* pConfig, ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_uninit", ExactSpelling = true)]
-        public static extern void sound_uninit(ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_uninit(ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_engine", ExactSpelling = true)]
-        public static extern ma_engine* sound_get_engine([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_engine")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_engine* sound_get_engine([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_data_source", ExactSpelling = true)]
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_data_source")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
         [return: NativeTypeName("ma_data_source *")]
-        public static extern void* sound_get_data_source([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        public static partial void* sound_get_data_source([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_start")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_start(ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_stop")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_stop(ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_stop_with_fade_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_stop_with_fade_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_stop_with_fade_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_stop_with_fade_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_set_volume(ma_sound* pSound, float volume);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float sound_get_volume([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_pan")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_set_pan(ma_sound* pSound, float pan);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_pan")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float sound_get_pan([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_pan_mode")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_pan_mode(ma_sound* pSound, ma_pan_mode panMode);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_pan_mode")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_pan_mode sound_get_pan_mode([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_pitch")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_set_pitch(ma_sound* pSound, float pitch);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_pitch")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float sound_get_pitch([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_spatialization_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_set_spatialization_enabled(ma_sound* pSound, [NativeTypeName("ma_bool32")] uint enabled);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_is_spatialization_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_bool32")]
+        public static partial uint sound_is_spatialization_enabled([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_start", ExactSpelling = true)]
-        public static extern ma_result sound_start(ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_pinned_listener_index")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_pinned_listener_index(ma_sound* pSound, [NativeTypeName("ma_uint32")] uint listenerIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_stop", ExactSpelling = true)]
-        public static extern ma_result sound_stop(ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_pinned_listener_index")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [return: NativeTypeName("ma_uint32")]
+        public static partial uint sound_get_pinned_listener_index([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_stop_with_fade_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result sound_stop_with_fade_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_listener_index")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [return: NativeTypeName("ma_uint32")]
+        public static partial uint sound_get_listener_index([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_stop_with_fade_in_milliseconds", ExactSpelling = true)]
-        public static extern ma_result sound_stop_with_fade_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_direction_to_listener")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_get_direction_to_listener([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_volume", ExactSpelling = true)]
-        public static extern void sound_set_volume(ma_sound* pSound, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_position(ma_sound* pSound, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_volume", ExactSpelling = true)]
-        public static extern float sound_get_volume([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_get_position([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_pan", ExactSpelling = true)]
-        public static extern void sound_set_pan(ma_sound* pSound, float pan);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_direction(ma_sound* pSound, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_pan", ExactSpelling = true)]
-        public static extern float sound_get_pan([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_get_direction([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_pan_mode", ExactSpelling = true)]
-        public static extern void sound_set_pan_mode(ma_sound* pSound, ma_pan_mode panMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_velocity(ma_sound* pSound, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_pan_mode", ExactSpelling = true)]
-        public static extern ma_pan_mode sound_get_pan_mode([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_get_velocity([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_pitch", ExactSpelling = true)]
-        public static extern void sound_set_pitch(ma_sound* pSound, float pitch);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_attenuation_model")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_attenuation_model(ma_sound* pSound, ma_attenuation_model attenuationModel);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_pitch", ExactSpelling = true)]
-        public static extern float sound_get_pitch([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_attenuation_model")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_attenuation_model sound_get_attenuation_model([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_spatialization_enabled", ExactSpelling = true)]
-        public static extern void sound_set_spatialization_enabled(ma_sound* pSound, [NativeTypeName("ma_bool32")] uint enabled);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_positioning")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_positioning(ma_sound* pSound, ma_positioning positioning);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_is_spatialization_enabled", ExactSpelling = true)]
-        [return: NativeTypeName("ma_bool32")]
-        public static extern uint sound_is_spatialization_enabled([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_positioning")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_positioning sound_get_positioning([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_pinned_listener_index", ExactSpelling = true)]
-        public static extern void sound_set_pinned_listener_index(ma_sound* pSound, [NativeTypeName("ma_uint32")] uint listenerIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_rolloff")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_rolloff(ma_sound* pSound, float rolloff);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_pinned_listener_index", ExactSpelling = true)]
-        [return: NativeTypeName("ma_uint32")]
-        public static extern uint sound_get_pinned_listener_index([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_rolloff")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_rolloff([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_listener_index", ExactSpelling = true)]
-        [return: NativeTypeName("ma_uint32")]
-        public static extern uint sound_get_listener_index([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_min_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_min_gain(ma_sound* pSound, float minGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_direction_to_listener", ExactSpelling = true)]
-        public static extern ma_vec3f sound_get_direction_to_listener([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_min_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_min_gain([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_position", ExactSpelling = true)]
-        public static extern void sound_set_position(ma_sound* pSound, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_max_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_max_gain(ma_sound* pSound, float maxGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_position", ExactSpelling = true)]
-        public static extern ma_vec3f sound_get_position([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_max_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_max_gain([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_direction", ExactSpelling = true)]
-        public static extern void sound_set_direction(ma_sound* pSound, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_min_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_min_distance(ma_sound* pSound, float minDistance);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_direction", ExactSpelling = true)]
-        public static extern ma_vec3f sound_get_direction([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_min_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_min_distance([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_velocity", ExactSpelling = true)]
-        public static extern void sound_set_velocity(ma_sound* pSound, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_max_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_max_distance(ma_sound* pSound, float maxDistance);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_velocity", ExactSpelling = true)]
-        public static extern ma_vec3f sound_get_velocity([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_max_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_max_distance([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_attenuation_model", ExactSpelling = true)]
-        public static extern void sound_set_attenuation_model(ma_sound* pSound, ma_attenuation_model attenuationModel);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_cone(ma_sound* pSound, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_attenuation_model", ExactSpelling = true)]
-        public static extern ma_attenuation_model sound_get_attenuation_model([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_get_cone([NativeTypeName("const ma_sound *")] ma_sound* pSound, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_positioning", ExactSpelling = true)]
-        public static extern void sound_set_positioning(ma_sound* pSound, ma_positioning positioning);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_doppler_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_doppler_factor(ma_sound* pSound, float dopplerFactor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_positioning", ExactSpelling = true)]
-        public static extern ma_positioning sound_get_positioning([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_doppler_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_doppler_factor([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_rolloff", ExactSpelling = true)]
-        public static extern void sound_set_rolloff(ma_sound* pSound, float rolloff);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_directional_attenuation_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_directional_attenuation_factor(ma_sound* pSound, float directionalAttenuationFactor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_rolloff", ExactSpelling = true)]
-        public static extern float sound_get_rolloff([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_directional_attenuation_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_directional_attenuation_factor([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_min_gain", ExactSpelling = true)]
-        public static extern void sound_set_min_gain(ma_sound* pSound, float minGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_fade_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_fade_in_pcm_frames(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_min_gain", ExactSpelling = true)]
-        public static extern float sound_get_min_gain([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_fade_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_fade_in_milliseconds(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_max_gain", ExactSpelling = true)]
-        public static extern void sound_set_max_gain(ma_sound* pSound, float maxGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_fade_start_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_fade_start_in_pcm_frames(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_max_gain", ExactSpelling = true)]
-        public static extern float sound_get_max_gain([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_fade_start_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_fade_start_in_milliseconds(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_min_distance", ExactSpelling = true)]
-        public static extern void sound_set_min_distance(ma_sound* pSound, float minDistance);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_current_fade_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_get_current_fade_volume([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_min_distance", ExactSpelling = true)]
-        public static extern float sound_get_min_distance([NativeTypeName("const ma_sound *")] ma_sound* pSound);
-
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_max_distance", ExactSpelling = true)]
-        public static extern void sound_set_max_distance(ma_sound* pSound, float maxDistance);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_start_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_set_start_time_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_start_time_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_start_time_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_stop_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_set_stop_time_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_stop_time_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_stop_time_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_stop_time_with_fade_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_stop_time_with_fade_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong stopAbsoluteGlobalTimeInFrames, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_stop_time_with_fade_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_stop_time_with_fade_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong stopAbsoluteGlobalTimeInMilliseconds, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_is_playing")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_bool32")]
+        public static partial uint sound_is_playing([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_max_distance", ExactSpelling = true)]
-        public static extern float sound_get_max_distance([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_uint64")]
+        public static partial ulong sound_get_time_in_pcm_frames([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_cone", ExactSpelling = true)]
-        public static extern void sound_set_cone(ma_sound* pSound, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_time_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_uint64")]
+        public static partial ulong sound_get_time_in_milliseconds([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_cone", ExactSpelling = true)]
-        public static extern void sound_get_cone([NativeTypeName("const ma_sound *")] ma_sound* pSound, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_set_looping(ma_sound* pSound, [NativeTypeName("ma_bool32")] uint isLooping);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_doppler_factor", ExactSpelling = true)]
-        public static extern void sound_set_doppler_factor(ma_sound* pSound, float dopplerFactor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_is_looping")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_bool32")]
+        public static partial uint sound_is_looping([NativeTypeName("const ma_sound *")] ma_sound* pSound);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_doppler_factor", ExactSpelling = true)]
-        public static extern float sound_get_doppler_factor([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_at_end")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_bool32")]
+        public static partial uint sound_at_end([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial ma_result sound_seek_to_pcm_frame(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong frameIndex);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_seek_to_second")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_seek_to_second(ma_sound* pSound, float seekPointInSeconds);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_get_data_format([NativeTypeName("const ma_sound *")] ma_sound* pSound, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_get_cursor_in_pcm_frames([NativeTypeName("const ma_sound *")] ma_sound* pSound, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_get_length_in_pcm_frames([NativeTypeName("const ma_sound *")] ma_sound* pSound, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_cursor_in_seconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_get_cursor_in_seconds([NativeTypeName("const ma_sound *")] ma_sound* pSound, float* pCursor);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_get_length_in_seconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_get_length_in_seconds([NativeTypeName("const ma_sound *")] ma_sound* pSound, float* pLength);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_set_end_callback")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_set_end_callback(ma_sound* pSound, [NativeTypeName("ma_sound_end_proc")] delegate* unmanaged[Cdecl]<void*, ma_sound*, void> callback, void* pUserData);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_group_init(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pParentGroup, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_init_ex")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_group_init_ex(ma_engine* pEngine, [NativeTypeName("const ma_sound_group_config *")] ma_sound_config* pConfig, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_uninit([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_engine")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_engine* sound_group_get_engine([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_start")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_group_start([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_stop")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result sound_group_stop([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_group_set_volume([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float volume);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float sound_group_get_volume([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_pan")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_group_set_pan([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float pan);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_pan")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float sound_group_get_pan([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_pan_mode")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_pan_mode([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_pan_mode panMode);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_pan_mode")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_pan_mode sound_group_get_pan_mode([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_pitch")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial void sound_group_set_pitch([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float pitch);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_pitch")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        public static partial float sound_group_get_pitch([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_spatialization_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_spatialization_enabled([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_bool32")] uint enabled);
+
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_is_spatialization_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [return: NativeTypeName("ma_bool32")]
+        public static partial uint sound_group_is_spatialization_enabled([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_directional_attenuation_factor", ExactSpelling = true)]
-        public static extern void sound_set_directional_attenuation_factor(ma_sound* pSound, float directionalAttenuationFactor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_pinned_listener_index")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_pinned_listener_index([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint32")] uint listenerIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_directional_attenuation_factor", ExactSpelling = true)]
-        public static extern float sound_get_directional_attenuation_factor([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_pinned_listener_index")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [return: NativeTypeName("ma_uint32")]
+        public static partial uint sound_group_get_pinned_listener_index([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_fade_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_set_fade_in_pcm_frames(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_listener_index")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [return: NativeTypeName("ma_uint32")]
+        public static partial uint sound_group_get_listener_index([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_fade_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_set_fade_in_milliseconds(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_direction_to_listener")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_group_get_direction_to_listener([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_fade_start_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_set_fade_start_in_pcm_frames(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_position([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_fade_start_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_set_fade_start_in_milliseconds(ma_sound* pSound, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_position")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_group_get_position([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_current_fade_volume", ExactSpelling = true)]
-        public static extern float sound_get_current_fade_volume([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_direction([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_start_time_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_set_start_time_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_direction")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_group_get_direction([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_start_time_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_set_start_time_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_velocity([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float x, float y, float z);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_stop_time_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_set_stop_time_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_velocity")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_vec3f sound_group_get_velocity([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_stop_time_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_set_stop_time_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_attenuation_model")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_attenuation_model([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_attenuation_model attenuationModel);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_stop_time_with_fade_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_set_stop_time_with_fade_in_pcm_frames(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong stopAbsoluteGlobalTimeInFrames, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_attenuation_model")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_attenuation_model sound_group_get_attenuation_model([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_stop_time_with_fade_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_set_stop_time_with_fade_in_milliseconds(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong stopAbsoluteGlobalTimeInMilliseconds, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_positioning")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_positioning([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_positioning positioning);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_is_playing", ExactSpelling = true)]
-        [return: NativeTypeName("ma_bool32")]
-        public static extern uint sound_is_playing([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_positioning")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_positioning sound_group_get_positioning([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_time_in_pcm_frames", ExactSpelling = true)]
-        [return: NativeTypeName("ma_uint64")]
-        public static extern ulong sound_get_time_in_pcm_frames([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_rolloff")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_rolloff([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float rolloff);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_time_in_milliseconds", ExactSpelling = true)]
-        [return: NativeTypeName("ma_uint64")]
-        public static extern ulong sound_get_time_in_milliseconds([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_rolloff")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_rolloff([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_looping", ExactSpelling = true)]
-        public static extern void sound_set_looping(ma_sound* pSound, [NativeTypeName("ma_bool32")] uint isLooping);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_min_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_min_gain([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float minGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_is_looping", ExactSpelling = true)]
-        [return: NativeTypeName("ma_bool32")]
-        public static extern uint sound_is_looping([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_min_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_min_gain([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_at_end", ExactSpelling = true)]
-        [return: NativeTypeName("ma_bool32")]
-        public static extern uint sound_at_end([NativeTypeName("const ma_sound *")] ma_sound* pSound);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_max_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_max_gain([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float maxGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result sound_seek_to_pcm_frame(ma_sound* pSound, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_max_gain")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_max_gain([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_seek_to_second", ExactSpelling = true)]
-        public static extern ma_result sound_seek_to_second(ma_sound* pSound, float seekPointInSeconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_min_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_min_distance([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float minDistance);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_data_format", ExactSpelling = true)]
-        public static extern ma_result sound_get_data_format([NativeTypeName("const ma_sound *")] ma_sound* pSound, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_min_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_min_distance([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result sound_get_cursor_in_pcm_frames([NativeTypeName("const ma_sound *")] ma_sound* pSound, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_max_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_max_distance([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float maxDistance);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result sound_get_length_in_pcm_frames([NativeTypeName("const ma_sound *")] ma_sound* pSound, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_max_distance")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_max_distance([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_cursor_in_seconds", ExactSpelling = true)]
-        public static extern ma_result sound_get_cursor_in_seconds([NativeTypeName("const ma_sound *")] ma_sound* pSound, float* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_cone([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_get_length_in_seconds", ExactSpelling = true)]
-        public static extern ma_result sound_get_length_in_seconds([NativeTypeName("const ma_sound *")] ma_sound* pSound, float* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_cone")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_get_cone([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_set_end_callback", ExactSpelling = true)]
-        public static extern ma_result sound_set_end_callback(ma_sound* pSound, [NativeTypeName("ma_sound_end_proc")] delegate* unmanaged[Cdecl]<void*, ma_sound*, void> callback, void* pUserData);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_doppler_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_doppler_factor([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float dopplerFactor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_init", ExactSpelling = true)]
-        public static extern ma_result sound_group_init(ma_engine* pEngine, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pParentGroup, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_doppler_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_doppler_factor([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_init_ex", ExactSpelling = true)]
-        public static extern ma_result sound_group_init_ex(ma_engine* pEngine, [NativeTypeName("const ma_sound_group_config *")] ma_sound_config* pConfig, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_directional_attenuation_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_directional_attenuation_factor([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float directionalAttenuationFactor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_uninit", ExactSpelling = true)]
-        public static extern void sound_group_uninit([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_directional_attenuation_factor")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_directional_attenuation_factor([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_engine", ExactSpelling = true)]
-        public static extern ma_engine* sound_group_get_engine([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_fade_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_fade_in_pcm_frames([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_start", ExactSpelling = true)]
-        public static extern ma_result sound_group_start([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_fade_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_fade_in_milliseconds([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_stop", ExactSpelling = true)]
-        public static extern ma_result sound_group_stop([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_current_fade_volume")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float sound_group_get_current_fade_volume([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_volume", ExactSpelling = true)]
-        public static extern void sound_group_set_volume([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float volume);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_start_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_start_time_in_pcm_frames([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_volume", ExactSpelling = true)]
-        public static extern float sound_group_get_volume([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_start_time_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_start_time_in_milliseconds([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_pan", ExactSpelling = true)]
-        public static extern void sound_group_set_pan([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float pan);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_stop_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_stop_time_in_pcm_frames([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_pan", ExactSpelling = true)]
-        public static extern float sound_group_get_pan([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_set_stop_time_in_milliseconds")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void sound_group_set_stop_time_in_milliseconds([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_pan_mode", ExactSpelling = true)]
-        public static extern void sound_group_set_pan_mode([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_pan_mode panMode);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_is_playing")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_bool32")]
+        public static partial uint sound_group_is_playing([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_pan_mode", ExactSpelling = true)]
-        public static extern ma_pan_mode sound_group_get_pan_mode([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_sound_group_get_time_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [SuppressGCTransition]
+        [return: NativeTypeName("ma_uint64")]
+        public static partial ulong sound_group_get_time_in_pcm_frames([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_pitch", ExactSpelling = true)]
-        public static extern void sound_group_set_pitch([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float pitch);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_decoder_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_ex_decoder_config ex_decoder_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_pitch", ExactSpelling = true)]
-        public static extern float sound_group_get_pitch([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_decoder_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_decoder_init([NativeTypeName("ma_decoder_read_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, void*, nuint, nuint*, ma_result> onRead, [NativeTypeName("ma_decoder_seek_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, long, ma_seek_origin, ma_result> onSeek, void* pUserData, [NativeTypeName("const ma_ex_decoder_config *")] ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_spatialization_enabled", ExactSpelling = true)]
-        public static extern void sound_group_set_spatialization_enabled([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_bool32")] uint enabled);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_decoder_init_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_decoder_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_ex_decoder_config *")] ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_is_spatialization_enabled", ExactSpelling = true)]
-        [return: NativeTypeName("ma_bool32")]
-        public static extern uint sound_group_is_spatialization_enabled([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_decoder_init_memory")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_decoder_init_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, [NativeTypeName("const ma_ex_decoder_config *")] ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_pinned_listener_index", ExactSpelling = true)]
-        public static extern void sound_group_set_pinned_listener_index([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint32")] uint listenerIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_decoder_set_rate")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_decoder_set_rate(ma_decoder* pDecoder, [NativeTypeName("ma_uint32")] uint sampleRateIn, [NativeTypeName("ma_uint32")] uint sampleRateOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_pinned_listener_index", ExactSpelling = true)]
-        [return: NativeTypeName("ma_uint32")]
-        public static extern uint sound_group_get_pinned_listener_index([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_decoder_set_rate_ratio")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_decoder_set_rate_ratio(ma_decoder* pDecoder, float ratioInOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_listener_index", ExactSpelling = true)]
-        [return: NativeTypeName("ma_uint32")]
-        public static extern uint sound_group_get_listener_index([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_decoder_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_decoder_read_pcm_frames(ma_decoder* pDecoder, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_direction_to_listener", ExactSpelling = true)]
-        public static extern ma_vec3f sound_group_get_direction_to_listener([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_get_encoding_format_from_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_encoding_format ex_get_encoding_format_from_file([NativeTypeName("const char *")] sbyte* pFilePath);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_position", ExactSpelling = true)]
-        public static extern void sound_group_set_position([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_get_encoding_format_from_memory")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_encoding_format ex_get_encoding_format_from_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_position", ExactSpelling = true)]
-        public static extern ma_vec3f sound_group_get_position([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_ex_time_stretch_config ex_time_stretch_config_init([NativeTypeName("ma_data_source *")] void* pDataSource, float tempo);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_direction", ExactSpelling = true)]
-        public static extern void sound_group_set_direction([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_time_stretch_init([NativeTypeName("const ma_ex_time_stretch_config *")] ma_ex_time_stretch_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_ex_time_stretch* pTimeStretch);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_direction", ExactSpelling = true)]
-        public static extern ma_vec3f sound_group_get_direction([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void ex_time_stretch_uninit(ma_ex_time_stretch* pTimeStretch, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_velocity", ExactSpelling = true)]
-        public static extern void sound_group_set_velocity([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float x, float y, float z);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_time_stretch_read_pcm_frames(ma_ex_time_stretch* pTimeStretch, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_velocity", ExactSpelling = true)]
-        public static extern ma_vec3f sound_group_get_velocity([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_time_stretch_seek_to_pcm_frame(ma_ex_time_stretch* pTimeStretch, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_attenuation_model", ExactSpelling = true)]
-        public static extern void sound_group_set_attenuation_model([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_attenuation_model attenuationModel);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_time_stretch_get_data_format(ma_ex_time_stretch* pTimeStretch, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_attenuation_model", ExactSpelling = true)]
-        public static extern ma_attenuation_model sound_group_get_attenuation_model([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_time_stretch_get_cursor_in_pcm_frames(ma_ex_time_stretch* pTimeStretch, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_positioning", ExactSpelling = true)]
-        public static extern void sound_group_set_positioning([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_positioning positioning);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_time_stretch_get_length_in_pcm_frames(ma_ex_time_stretch* pTimeStretch, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_positioning", ExactSpelling = true)]
-        public static extern ma_positioning sound_group_get_positioning([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_set_tempo")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_time_stretch_set_tempo(ma_ex_time_stretch* pTimeStretch, float tempo);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_rolloff", ExactSpelling = true)]
-        public static extern void sound_group_set_rolloff([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float rolloff);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_time_stretch_get_tempo")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial float ex_time_stretch_get_tempo(ma_ex_time_stretch* pTimeStretch);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_rolloff", ExactSpelling = true)]
-        public static extern float sound_group_get_rolloff([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_probe_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_ex_probe_config ex_probe_config_init(ma_resource_manager* pResourceManager);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_min_gain", ExactSpelling = true)]
-        public static extern void sound_group_set_min_gain([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float minGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_probe_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_probe_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_ex_probe_config *")] ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_min_gain", ExactSpelling = true)]
-        public static extern float sound_group_get_min_gain([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_probe_files")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_probe_files([NativeTypeName("const char **")] sbyte** ppFilePaths, [NativeTypeName("ma_uint32")] uint fileCount, [NativeTypeName("const ma_ex_probe_config *")] ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfos);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_max_gain", ExactSpelling = true)]
-        public static extern void sound_group_set_max_gain([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float maxGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_pool_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_ex_pool_config ex_pool_config_init();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_max_gain", ExactSpelling = true)]
-        public static extern float sound_group_get_max_gain([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_pool_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_pool_init([NativeTypeName("const ma_ex_pool_config *")] ma_ex_pool_config* pConfig, ma_ex_pool* pPool);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_min_distance", ExactSpelling = true)]
-        public static extern void sound_group_set_min_distance([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float minDistance);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_pool_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void ex_pool_uninit(ma_ex_pool* pPool);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_min_distance", ExactSpelling = true)]
-        public static extern float sound_group_get_min_distance([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_pool_alloc")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void* ex_pool_alloc(ma_ex_pool* pPool, ma_ex_pool_object @object);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_max_distance", ExactSpelling = true)]
-        public static extern void sound_group_set_max_distance([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float maxDistance);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_pool_free")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void ex_pool_free(ma_ex_pool* pPool, ma_ex_pool_object @object, void* p);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_max_distance", ExactSpelling = true)]
-        public static extern float sound_group_get_max_distance([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_pool_get_slot_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        [return: NativeTypeName("size_t")]
+        public static partial nuint ex_pool_get_slot_size(ma_ex_pool_object @object);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_cone", ExactSpelling = true)]
-        public static extern void sound_group_set_cone([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float innerAngleInRadians, float outerAngleInRadians, float outerGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_ex_pool_get_stats")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result ex_pool_get_stats(ma_ex_pool* pPool, ma_ex_pool_object @object, [NativeTypeName("ma_uint32 *")] uint* pUsedSlotCount, [NativeTypeName("ma_uint32 *")] uint* pSlotCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_cone", ExactSpelling = true)]
-        public static extern void sound_group_get_cone([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup, float* pInnerAngleInRadians, float* pOuterAngleInRadians, float* pOuterGain);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_init([NativeTypeName("ma_read_proc")] delegate* unmanaged[Cdecl]<void*, void*, nuint, nuint*, ma_result> onRead, [NativeTypeName("ma_seek_proc")] delegate* unmanaged[Cdecl]<void*, long, ma_seek_origin, ma_result> onSeek, [NativeTypeName("ma_tell_proc")] delegate* unmanaged[Cdecl]<void*, long*, ma_result> onTell, void* pReadSeekTellUserData, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_doppler_factor", ExactSpelling = true)]
-        public static extern void sound_group_set_doppler_factor([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float dopplerFactor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_init_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_doppler_factor", ExactSpelling = true)]
-        public static extern float sound_group_get_doppler_factor([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_init_memory")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_init_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_directional_attenuation_factor", ExactSpelling = true)]
-        public static extern void sound_group_set_directional_attenuation_factor([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float directionalAttenuationFactor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_init_lazy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_init_lazy([NativeTypeName("ma_read_proc")] delegate* unmanaged[Cdecl]<void*, void*, nuint, nuint*, ma_result> onRead, [NativeTypeName("ma_seek_proc")] delegate* unmanaged[Cdecl]<void*, long, ma_seek_origin, ma_result> onSeek, [NativeTypeName("ma_tell_proc")] delegate* unmanaged[Cdecl]<void*, long*, ma_result> onTell, void* pReadSeekTellUserData, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_directional_attenuation_factor", ExactSpelling = true)]
-        public static extern float sound_group_get_directional_attenuation_factor([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_init_file_lazy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_init_file_lazy([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_fade_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_group_set_fade_in_pcm_frames([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_init_memory_lazy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_init_memory_lazy([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_fade_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_group_set_fade_in_milliseconds([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, float volumeBeg, float volumeEnd, [NativeTypeName("ma_uint64")] ulong fadeLengthInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_uninit")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void libvorbis_uninit(ma_libvorbis* pVorbis, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_current_fade_volume", ExactSpelling = true)]
-        public static extern float sound_group_get_current_fade_volume([NativeTypeName("ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_read_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_read_pcm_frames(ma_libvorbis* pVorbis, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_start_time_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_group_set_start_time_in_pcm_frames([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_read_pcm_frames_planar")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_read_pcm_frames_planar(ma_libvorbis* pVorbis, float** ppFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_start_time_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_group_set_start_time_in_milliseconds([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_acquire_pcm_frames_planar")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_acquire_pcm_frames_planar(ma_libvorbis* pVorbis, float*** pppFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesAcquired);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_stop_time_in_pcm_frames", ExactSpelling = true)]
-        public static extern void sound_group_set_stop_time_in_pcm_frames([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInFrames);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_seek_to_pcm_frame")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_seek_to_pcm_frame(ma_libvorbis* pVorbis, [NativeTypeName("ma_uint64")] ulong frameIndex);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_set_stop_time_in_milliseconds", ExactSpelling = true)]
-        public static extern void sound_group_set_stop_time_in_milliseconds([NativeTypeName("ma_sound_group *")] ma_sound* pGroup, [NativeTypeName("ma_uint64")] ulong absoluteGlobalTimeInMilliseconds);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_build_seek_table")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_build_seek_table(ma_libvorbis* pVorbis, [NativeTypeName("ma_uint32")] uint seekPointCount);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_is_playing", ExactSpelling = true)]
-        [return: NativeTypeName("ma_bool32")]
-        public static extern uint sound_group_is_playing([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_save_seek_table")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_save_seek_table(ma_libvorbis* pVorbis, void* pData, [NativeTypeName("size_t")] nuint dataCap, [NativeTypeName("size_t *")] nuint* pDataSize);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_sound_group_get_time_in_pcm_frames", ExactSpelling = true)]
-        [return: NativeTypeName("ma_uint64")]
-        public static extern ulong sound_group_get_time_in_pcm_frames([NativeTypeName("const ma_sound_group *")] ma_sound* pGroup);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_load_seek_table")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_load_seek_table(ma_libvorbis* pVorbis, [NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_ex_decoder_config_init", ExactSpelling = true)]
-        public static extern ma_ex_decoder_config ex_decoder_config_init(ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_get_data_format")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_get_data_format(ma_libvorbis* pVorbis, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_ex_decoder_init", ExactSpelling = true)]
-        public static extern ma_result ex_decoder_init([NativeTypeName("ma_decoder_read_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, void*, nuint, nuint*, ma_result> onRead, [NativeTypeName("ma_decoder_seek_proc")] delegate* unmanaged[Cdecl]<ma_decoder*, long, ma_seek_origin, ma_result> onSeek, void* pUserData, [NativeTypeName("const ma_ex_decoder_config *")] ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_get_cursor_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_get_cursor_in_pcm_frames(ma_libvorbis* pVorbis, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_ex_decoder_init_file", ExactSpelling = true)]
-        public static extern ma_result ex_decoder_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_ex_decoder_config *")] ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_get_length_in_pcm_frames")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_get_length_in_pcm_frames(ma_libvorbis* pVorbis, [NativeTypeName("ma_uint64 *")] ulong* pLength);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_ex_decoder_init_memory", ExactSpelling = true)]
-        public static extern ma_result ex_decoder_init_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, [NativeTypeName("const ma_ex_decoder_config *")] ma_ex_decoder_config* pConfig, ma_decoder* pDecoder);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_get_allocation_stats")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_get_allocation_stats(ma_libvorbis* pVorbis, ma_libvorbis_allocation_stats* pStats);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_init", ExactSpelling = true)]
-        public static extern ma_result libvorbis_init([NativeTypeName("ma_read_proc")] delegate* unmanaged[Cdecl]<void*, void*, nuint, nuint*, ma_result> onRead, [NativeTypeName("ma_seek_proc")] delegate* unmanaged[Cdecl]<void*, long, ma_seek_origin, ma_result> onSeek, [NativeTypeName("ma_tell_proc")] delegate* unmanaged[Cdecl]<void*, long*, ma_result> onTell, void* pReadSeekTellUserData, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_set_default_arena_size")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void libvorbis_set_default_arena_size([NativeTypeName("size_t")] nuint arenaSizeInBytes);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_init_file", ExactSpelling = true)]
-        public static extern ma_result libvorbis_init_file([NativeTypeName("const char *")] sbyte* pFilePath, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_set_setup_cache_enabled")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial void libvorbis_set_setup_cache_enabled([NativeTypeName("ma_bool32")] uint isEnabled);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_uninit", ExactSpelling = true)]
-        public static extern void libvorbis_uninit(ma_libvorbis* pVorbis, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_decode_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_libvorbis_decode_config libvorbis_decode_config_init(ma_format format, ma_resource_manager* pResourceManager);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_read_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result libvorbis_read_pcm_frames(ma_libvorbis* pVorbis, void* pFramesOut, [NativeTypeName("ma_uint64")] ulong frameCount, [NativeTypeName("ma_uint64 *")] ulong* pFramesRead);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_decode_memory")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_decode_memory([NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint dataSize, ma_libvorbis_decode_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_seek_to_pcm_frame", ExactSpelling = true)]
-        public static extern ma_result libvorbis_seek_to_pcm_frame(ma_libvorbis* pVorbis, [NativeTypeName("ma_uint64")] ulong frameIndex);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_decode_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_decode_file([NativeTypeName("const char *")] sbyte* pFilePath, ma_libvorbis_decode_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_get_data_format", ExactSpelling = true)]
-        public static extern ma_result libvorbis_get_data_format(ma_libvorbis* pVorbis, ma_format* pFormat, [NativeTypeName("ma_uint32 *")] uint* pChannels, [NativeTypeName("ma_uint32 *")] uint* pSampleRate, [NativeTypeName("ma_channel *")] byte* pChannelMap, [NativeTypeName("size_t")] nuint channelMapCap);
+        [LibraryImport("miniaudio", EntryPoint = "ma_libvorbis_register_decoded_file")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result libvorbis_register_decoded_file([NativeTypeName("const char *")] sbyte* pFilePath, ma_libvorbis_decode_config* pConfig, void** ppPCMFramesOut);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_get_cursor_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result libvorbis_get_cursor_in_pcm_frames(ma_libvorbis* pVorbis, [NativeTypeName("ma_uint64 *")] ulong* pCursor);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_config_set_libvorbis_backend")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_config_set_libvorbis_backend(ma_decoder_config* pConfig);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_libvorbis_get_length_in_pcm_frames", ExactSpelling = true)]
-        public static extern ma_result libvorbis_get_length_in_pcm_frames(ma_libvorbis* pVorbis, [NativeTypeName("ma_uint64 *")] ulong* pLength);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoding_backend_libvorbis_get_vtable")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_decoding_backend_vtable* decoding_backend_libvorbis_get_vtable();
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoder_config_set_libvorbis_backend", ExactSpelling = true)]
-        public static extern ma_result decoder_config_set_libvorbis_backend(ma_decoder_config* pConfig);
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoder_config_set_libvorbis_backend_lazy")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result decoder_config_set_libvorbis_backend_lazy(ma_decoder_config* pConfig);
 
-        [DllImport("miniaudio", CallingConvention = CallingConvention.Cdecl, EntryPoint = "ma_decoding_backend_libvorbis_get_vtable", ExactSpelling = true)]
-        public static extern ma_decoding_backend_vtable* decoding_backend_libvorbis_get_vtable();
+        [LibraryImport("miniaudio", EntryPoint = "ma_decoding_backend_libvorbis_lazy_get_vtable")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_decoding_backend_vtable* decoding_backend_libvorbis_lazy_get_vtable();
     }
 }
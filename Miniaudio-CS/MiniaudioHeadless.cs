@@ -0,0 +1,113 @@
+using System;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace Miniaudio
+{
+    /// <summary>
+    /// <see cref="ma_engine_config" /> as laid out by miniaudio_headless. It's built with MA_NO_DEVICE_IO, which removes
+    /// the device fields. Always use this one with <see cref="ma_headless.engine_init" />.
+    /// </summary>
+    public unsafe partial struct ma_headless_engine_config
+    {
+        public ma_resource_manager* pResourceManager;
+
+        public ma_log* pLog;
+
+        [NativeTypeName("ma_uint32")]
+        public uint listenerCount;
+
+        [NativeTypeName("ma_uint32")]
+        public uint channels;
+
+        [NativeTypeName("ma_uint32")]
+        public uint sampleRate;
+
+        [NativeTypeName("ma_uint32")]
+        public uint periodSizeInFrames;
+
+        [NativeTypeName("ma_uint32")]
+        public uint periodSizeInMilliseconds;
+
+        [NativeTypeName("ma_uint32")]
+        public uint gainSmoothTimeInFrames;
+
+        [NativeTypeName("ma_uint32")]
+        public uint gainSmoothTimeInMilliseconds;
+
+        [NativeTypeName("ma_uint32")]
+        public uint defaultVolumeSmoothTimeInPCMFrames;
+
+        [NativeTypeName("ma_uint32")]
+        public uint preMixStackSizeInBytes;
+
+        public ma_allocation_callbacks allocationCallbacks;
+
+        [NativeTypeName("ma_bool32")]
+        public uint noAutoStart;
+
+        [NativeTypeName("ma_bool32")]
+        public uint noDevice;
+
+        public ma_mono_expansion_mode monoExpansionMode;
+
+        [NativeTypeName("ma_vfs *")]
+        public void* pResourceManagerVFS;
+
+        [NativeTypeName("ma_engine_process_proc")]
+        public delegate* unmanaged[Cdecl]<void*, float*, ulong, void> onProcess;
+
+        public void* pProcessUserData;
+    }
+
+    /// <summary>
+    /// Support for miniaudio_headless, a build of the native library without device IO, encoders or generators, for
+    /// decoding and offline rendering with <see cref="ma.engine_read_pcm_frames" />.
+    /// <para>
+    /// Call <see cref="Use" /> before anything else calls into miniaudio. Everything in <see cref="ma" /> then goes to
+    /// miniaudio_headless, apart from the device functions, which aren't in it. The engine has to be initialized
+    /// through <see cref="engine_config_init" /> and <see cref="engine_init" /> with channels and sampleRate set, since
+    /// there's no device to take them from. <see cref="ma_engine" /> is also missing its pDevice field, so use the
+    /// engine functions rather than its fields. Allocating it with sizeof(ma_engine) is fine.
+    /// </para>
+    /// </summary>
+    public static unsafe partial class ma_headless
+    {
+        public const string LibraryName = "miniaudio_headless";
+
+        private static readonly object s_lock = new object();
+        private static bool s_isUsed;
+
+        /// <summary>Loads miniaudio_headless in place of miniaudio for every binding in this assembly.</summary>
+        public static void Use()
+        {
+            lock (s_lock)
+            {
+                if (!s_isUsed)
+                {
+                    NativeLibrary.SetDllImportResolver(typeof(ma).Assembly, Resolve);
+                    s_isUsed = true;
+                }
+            }
+        }
+
+        private static IntPtr Resolve(string libraryName, Assembly assembly, DllImportSearchPath? searchPath)
+        {
+            if (libraryName == "miniaudio")
+            {
+                return NativeLibrary.Load(LibraryName, assembly, searchPath);
+            }
+
+            return IntPtr.Zero;
+        }
+
+        [LibraryImport(LibraryName, EntryPoint = "ma_engine_config_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_headless_engine_config engine_config_init();
+
+        [LibraryImport(LibraryName, EntryPoint = "ma_engine_init")]
+        [UnmanagedCallConv(CallConvs = new[] { typeof(CallConvCdecl) })]
+        public static partial ma_result engine_init([NativeTypeName("const ma_engine_config *")] ma_headless_engine_config* pConfig, ma_engine* pEngine);
+    }
+}
@@ -0,0 +1,57 @@
+using System;
+using static Miniaudio.ma_ex_pool_object;
+
+namespace Miniaudio
+{
+    /// <summary>
+    /// Typed wrappers around <see cref="ma.ex_pool_alloc(ma_ex_pool*, ma_ex_pool_object)" /> and
+    /// <see cref="ma.ex_pool_free(ma_ex_pool*, ma_ex_pool_object, void*)" /> for the objects the pool has a size class
+    /// for: <see cref="ma_sound" />, <see cref="ma_decoder" />, <see cref="ma_resource_manager_data_source" /> and
+    /// <see cref="ma_audio_buffer" />. Pass null for the pool to use the process-wide one. Use these in place of
+    /// NativeMemory.Alloc() for objects that are created and destroyed often, e.g. one sound per shot.
+    /// </summary>
+    public static unsafe partial class ma
+    {
+        /// <summary>Allocates an uninitialized T from the pool. Returns null if out of memory.</summary>
+        public static T* ex_pool_alloc<T>(ma_ex_pool* pPool) where T : unmanaged
+        {
+            return (T*)ex_pool_alloc(pPool, ex_pool_object_of<T>.Value);
+        }
+
+        /// <summary>Returns a T from <see cref="ex_pool_alloc{T}(ma_ex_pool*)" /> to the same pool. Uninitialize it first.</summary>
+        public static void ex_pool_free<T>(ma_ex_pool* pPool, T* p) where T : unmanaged
+        {
+            ex_pool_free(pPool, ex_pool_object_of<T>.Value, p);
+        }
+
+        private static class ex_pool_object_of<T> where T : unmanaged
+        {
+            public static readonly ma_ex_pool_object Value = Get();
+
+            private static ma_ex_pool_object Get()
+            {
+                if (typeof(T) == typeof(ma_sound))
+                {
+                    return ma_ex_pool_object_sound;
+                }
+
+                if (typeof(T) == typeof(ma_decoder))
+                {
+                    return ma_ex_pool_object_decoder;
+                }
+
+                if (typeof(T) == typeof(ma_resource_manager_data_source))
+                {
+                    return ma_ex_pool_object_resource_manager_data_source;
+                }
+
+                if (typeof(T) == typeof(ma_audio_buffer))
+                {
+                    return ma_ex_pool_object_audio_buffer;
+                }
+
+                throw new NotSupportedException($"The pool has no size class for {typeof(T).Name}.");
+            }
+        }
+    }
+}
@@ -0,0 +1,349 @@
+using System;
+using System.Runtime.CompilerServices;
+using static Miniaudio.ma_format;
+
+namespace Miniaudio
+{
+    /// <summary>
+    /// Span overloads for the PCM read and write functions. The frame count is the span's length divided by the channel
+    /// count, and the span is pinned for the length of the call only, so there's no copy and no allocation. The element
+    /// type has to match the format of the decoder, data source or encoder: float for ma_format_f32 and short for
+    /// ma_format_s16. MA_INVALID_ARGS is returned otherwise.
+    ///
+    /// These are written by hand rather than emitted by postprocess.py like the ma_utf8_string overloads. The UTF-8
+    /// overloads are a mechanical rewrite of every const char* parameter, but here the frame count comes from a
+    /// different place for each object (the decoder's output format, the encoder's config, or
+    /// ma_data_source_get_data_format()) and only these few functions take interleaved frames in a fixed format.
+    /// </summary>
+    public static unsafe partial class ma
+    {
+        public static ma_result decoder_read_pcm_frames(ma_decoder* pDecoder, Span<float> framesOut, out ulong framesRead)
+        {
+            return decoder_read_pcm_frames_span(pDecoder, framesOut, ma_format_f32, out framesRead);
+        }
+
+        public static ma_result decoder_read_pcm_frames(ma_decoder* pDecoder, Span<short> framesOut, out ulong framesRead)
+        {
+            return decoder_read_pcm_frames_span(pDecoder, framesOut, ma_format_s16, out framesRead);
+        }
+
+        public static ma_result data_source_read_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, Span<float> framesOut, out ulong framesRead)
+        {
+            return data_source_read_pcm_frames_span(pDataSource, framesOut, ma_format_f32, out framesRead);
+        }
+
+        public static ma_result data_source_read_pcm_frames([NativeTypeName("ma_data_source *")] void* pDataSource, Span<short> framesOut, out ulong framesRead)
+        {
+            return data_source_read_pcm_frames_span(pDataSource, framesOut, ma_format_s16, out framesRead);
+        }
+
+        public static ma_result encoder_write_pcm_frames(ma_encoder* pEncoder, ReadOnlySpan<float> framesIn, out ulong framesWritten)
+        {
+            return encoder_write_pcm_frames_span(pEncoder, framesIn, ma_format_f32, out framesWritten);
+        }
+
+        public static ma_result encoder_write_pcm_frames(ma_encoder* pEncoder, ReadOnlySpan<short> framesIn, out ulong framesWritten)
+        {
+            return encoder_write_pcm_frames_span(pEncoder, framesIn, ma_format_s16, out framesWritten);
+        }
+
+        /// <summary>
+        /// Acquires up to <paramref name="frameCount" /> frames for reading. Read them through
+        /// <see cref="ma_pcm_rb_read_scope.AsSpan{T}" />; the scope commits them when it's disposed.
+        /// </summary>
+        public static ma_pcm_rb_read_scope pcm_rb_acquire_read(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint frameCount)
+        {
+            void* pBuffer = null;
+            ma_result result = pRB == null ? ma_result.MA_INVALID_ARGS : pcm_rb_acquire_read(pRB, &frameCount, &pBuffer);
+
+            return new ma_pcm_rb_read_scope(pRB, result, pBuffer, result == ma_result.MA_SUCCESS ? frameCount : 0);
+        }
+
+        /// <summary>
+        /// Acquires up to <paramref name="frameCount" /> frames for writing. Write them through
+        /// <see cref="ma_pcm_rb_write_scope.AsSpan{T}" />; the scope commits them when it's disposed.
+        /// </summary>
+        public static ma_pcm_rb_write_scope pcm_rb_acquire_write(ma_pcm_rb* pRB, [NativeTypeName("ma_uint32")] uint frameCount)
+        {
+            void* pBuffer = null;
+            ma_result result = pRB == null ? ma_result.MA_INVALID_ARGS : pcm_rb_acquire_write(pRB, &frameCount, &pBuffer);
+
+            return new ma_pcm_rb_write_scope(pRB, result, pBuffer, result == ma_result.MA_SUCCESS ? frameCount : 0);
+        }
+
+        /// <summary>
+        /// Maps up to <paramref name="frameCount" /> frames from the buffer's cursor. The scope unmaps them, which moves
+        /// the cursor, when it's disposed.
+        /// </summary>
+        public static ma_audio_buffer_map_scope audio_buffer_map(ma_audio_buffer* pAudioBuffer, [NativeTypeName("ma_uint64")] ulong frameCount)
+        {
+            void* pFrames = null;
+            ma_result result = pAudioBuffer == null ? ma_result.MA_INVALID_ARGS : audio_buffer_map(pAudioBuffer, &pFrames, &frameCount);
+
+            return new ma_audio_buffer_map_scope(pAudioBuffer, result, pFrames, result == ma_result.MA_SUCCESS ? frameCount : 0);
+        }
+
+        private static ma_result decoder_read_pcm_frames_span<T>(ma_decoder* pDecoder, Span<T> framesOut, ma_format format, out ulong framesRead)
+            where T : unmanaged
+        {
+            framesRead = 0;
+
+            if (pDecoder == null || pDecoder->outputFormat != format || pDecoder->outputChannels == 0)
+            {
+                return ma_result.MA_INVALID_ARGS;
+            }
+
+            fixed (T* pFramesOut = framesOut)
+            fixed (ulong* pFramesRead = &framesRead)
+            {
+                return decoder_read_pcm_frames(pDecoder, pFramesOut, (ulong)framesOut.Length / pDecoder->outputChannels, pFramesRead);
+            }
+        }
+
+        private static ma_result data_source_read_pcm_frames_span<T>(void* pDataSource, Span<T> framesOut, ma_format format, out ulong framesRead)
+            where T : unmanaged
+        {
+            ma_format dataSourceFormat;
+            uint channels;
+            ma_result result;
+
+            framesRead = 0;
+
+            result = data_source_get_data_format(pDataSource, &dataSourceFormat, &channels, null, null, 0);
+            if (result != ma_result.MA_SUCCESS)
+            {
+                return result;
+            }
+
+            if (dataSourceFormat != format || channels == 0)
+            {
+                return ma_result.MA_INVALID_ARGS;
+            }
+
+            fixed (T* pFramesOut = framesOut)
+            fixed (ulong* pFramesRead = &framesRead)
+            {
+                return data_source_read_pcm_frames(pDataSource, pFramesOut, (ulong)framesOut.Length / channels, pFramesRead);
+            }
+        }
+
+        private static ma_result encoder_write_pcm_frames_span<T>(ma_encoder* pEncoder, ReadOnlySpan<T> framesIn, ma_format format, out ulong framesWritten)
+            where T : unmanaged
+        {
+            framesWritten = 0;
+
+            if (pEncoder == null || pEncoder->config.format != format || pEncoder->config.channels == 0)
+            {
+                return ma_result.MA_INVALID_ARGS;
+            }
+
+            fixed (T* pFramesIn = framesIn)
+            fixed (ulong* pFramesWritten = &framesWritten)
+            {
+                return encoder_write_pcm_frames(pEncoder, pFramesIn, (ulong)framesIn.Length / pEncoder->config.channels, pFramesWritten);
+            }
+        }
+
+        internal static int get_span_length<T>(ma_format format, uint channels, ulong frameCount)
+            where T : unmanaged
+        {
+            uint bytesPerSample = format switch
+            {
+                ma_format_u8 => 1,
+                ma_format_s16 => 2,
+                ma_format_s24 => 3,
+                ma_format_s32 => 4,
+                ma_format_f32 => 4,
+                _ => 0,
+            };
+
+            if (bytesPerSample == 0 || (bytesPerSample != sizeof(T) && sizeof(T) != 1))
+            {
+                throw new ArgumentException($"{typeof(T).Name} doesn't match {format}.");
+            }
+
+            return checked((int)(frameCount * channels * bytesPerSample / (uint)sizeof(T)));
+        }
+    }
+
+    /// <summary>
+    /// Frames acquired with <see cref="ma.pcm_rb_acquire_read(ma_pcm_rb*, uint)" />. Disposing it commits all of them
+    /// unless <see cref="Commit(uint)" /> was called first. Check <see cref="Result" /> first; FrameCount is 0 when
+    /// nothing could be acquired.
+    /// </summary>
+    public readonly unsafe ref struct ma_pcm_rb_read_scope
+    {
+        private readonly ma_pcm_rb* _pRB;
+        private readonly void* _pBuffer;
+        private readonly bool _isReleased;
+
+        public readonly ma_result Result;
+
+        public readonly uint FrameCount;
+
+        internal ma_pcm_rb_read_scope(ma_pcm_rb* pRB, ma_result result, void* pBuffer, uint frameCount)
+        {
+            _pRB = pRB;
+            _pBuffer = pBuffer;
+            Result = result;
+            FrameCount = frameCount;
+        }
+
+        /// <summary>The acquired frames, interleaved. T is float for ma_format_f32, short for ma_format_s16 and so on, or byte.</summary>
+        public ReadOnlySpan<T> AsSpan<T>() where T : unmanaged
+        {
+            return new ReadOnlySpan<T>(_pBuffer, ma.get_span_length<T>(_pRB->format, _pRB->channels, FrameCount));
+        }
+
+        /// <summary>
+        /// Commits the first <paramref name="frameCount" /> frames now, and nothing when the scope is disposed.
+        /// Returns MA_INVALID_ARGS if that's more than FrameCount, and MA_INVALID_OPERATION if nothing was acquired or
+        /// it's already been called.
+        /// </summary>
+        public ma_result Commit(uint frameCount)
+        {
+            if (Result != ma_result.MA_SUCCESS || _isReleased)
+            {
+                return ma_result.MA_INVALID_OPERATION;
+            }
+
+            if (frameCount > FrameCount)
+            {
+                return ma_result.MA_INVALID_ARGS;
+            }
+
+            // The struct is readonly so a using variable is passed by reference rather than copied, which makes this
+            // visible to Dispose().
+            Unsafe.AsRef(in _isReleased) = true;
+
+            return ma.pcm_rb_commit_read(_pRB, frameCount);
+        }
+
+        public void Dispose()
+        {
+            if (Result == ma_result.MA_SUCCESS && !_isReleased)
+            {
+                ma.pcm_rb_commit_read(_pRB, FrameCount);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Frames acquired with <see cref="ma.pcm_rb_acquire_write(ma_pcm_rb*, uint)" />. Disposing it commits all of them
+    /// unless <see cref="Commit(uint)" /> was called first, so call that after a partial write. Check
+    /// <see cref="Result" /> first; FrameCount is 0 when nothing could be acquired.
+    /// </summary>
+    public readonly unsafe ref struct ma_pcm_rb_write_scope
+    {
+        private readonly ma_pcm_rb* _pRB;
+        private readonly void* _pBuffer;
+        private readonly bool _isReleased;
+
+        public readonly ma_result Result;
+
+        public readonly uint FrameCount;
+
+        internal ma_pcm_rb_write_scope(ma_pcm_rb* pRB, ma_result result, void* pBuffer, uint frameCount)
+        {
+            _pRB = pRB;
+            _pBuffer = pBuffer;
+            Result = result;
+            FrameCount = frameCount;
+        }
+
+        /// <summary>The acquired frames, interleaved. T is float for ma_format_f32, short for ma_format_s16 and so on, or byte.</summary>
+        public Span<T> AsSpan<T>() where T : unmanaged
+        {
+            return new Span<T>(_pBuffer, ma.get_span_length<T>(_pRB->format, _pRB->channels, FrameCount));
+        }
+
+        /// <summary>
+        /// Commits the first <paramref name="frameCount" /> frames now, and nothing when the scope is disposed.
+        /// Returns MA_INVALID_ARGS if that's more than FrameCount, and MA_INVALID_OPERATION if nothing was acquired or
+        /// it's already been called.
+        /// </summary>
+        public ma_result Commit(uint frameCount)
+        {
+            if (Result != ma_result.MA_SUCCESS || _isReleased)
+            {
+                return ma_result.MA_INVALID_OPERATION;
+            }
+
+            if (frameCount > FrameCount)
+            {
+                return ma_result.MA_INVALID_ARGS;
+            }
+
+            Unsafe.AsRef(in _isReleased) = true;
+
+            return ma.pcm_rb_commit_write(_pRB, frameCount);
+        }
+
+        public void Dispose()
+        {
+            if (Result == ma_result.MA_SUCCESS && !_isReleased)
+            {
+                ma.pcm_rb_commit_write(_pRB, FrameCount);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Frames mapped with <see cref="ma.audio_buffer_map(ma_audio_buffer*, ulong)" />. Disposing it unmaps all of them,
+    /// which moves the buffer's cursor past them, unless <see cref="Unmap(ulong)" /> was called first.
+    /// </summary>
+    public readonly unsafe ref struct ma_audio_buffer_map_scope
+    {
+        private readonly ma_audio_buffer* _pAudioBuffer;
+        private readonly void* _pFrames;
+        private readonly bool _isReleased;
+
+        public readonly ma_result Result;
+
+        public readonly ulong FrameCount;
+
+        internal ma_audio_buffer_map_scope(ma_audio_buffer* pAudioBuffer, ma_result result, void* pFrames, ulong frameCount)
+        {
+            _pAudioBuffer = pAudioBuffer;
+            _pFrames = pFrames;
+            Result = result;
+            FrameCount = frameCount;
+        }
+
+        /// <summary>The mapped frames, interleaved. T is float for ma_format_f32, short for ma_format_s16 and so on, or byte.</summary>
+        public ReadOnlySpan<T> AsSpan<T>() where T : unmanaged
+        {
+            return new ReadOnlySpan<T>(_pFrames, ma.get_span_length<T>(_pAudioBuffer->@ref.format, _pAudioBuffer->@ref.channels, FrameCount));
+        }
+
+        /// <summary>
+        /// Unmaps the first <paramref name="frameCount" /> frames now, and nothing when the scope is disposed.
+        /// Returns MA_INVALID_ARGS if that's more than FrameCount, and MA_INVALID_OPERATION if nothing was acquired or
+        /// it's already been called.
+        /// </summary>
+        public ma_result Unmap(ulong frameCount)
+        {
+            if (Result != ma_result.MA_SUCCESS || _isReleased)
+            {
+                return ma_result.MA_INVALID_OPERATION;
+            }
+
+            if (frameCount > FrameCount)
+            {
+                return ma_result.MA_INVALID_ARGS;
+            }
+
+            Unsafe.AsRef(in _isReleased) = true;
+
+            return ma.audio_buffer_unmap(_pAudioBuffer, frameCount);
+        }
+
+        public void Dispose()
+        {
+            if (Result == ma_result.MA_SUCCESS && !_isReleased)
+            {
+                ma.audio_buffer_unmap(_pAudioBuffer, FrameCount);
+            }
+        }
+    }
+}
@@ -0,0 +1,143 @@
+using System;
+using System.Buffers;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Miniaudio
+{
+    /// <summary>
+    /// The text argument of the overloads in MiniaudioUtf8Overloads.cs: a string, UTF-8 bytes such as a "music.ogg"u8
+    /// literal, or a pointer to a null terminated string. Taking this one type instead of an overload per kind of text
+    /// keeps a null or default argument calling the sbyte* overload, since sbyte* converts to ma_utf8_string and not
+    /// the other way around.
+    /// </summary>
+    public readonly unsafe ref struct ma_utf8_string
+    {
+        internal readonly string? String;
+        internal readonly ReadOnlySpan<byte> Utf8;
+        internal readonly bool IsUtf8;
+
+        private ma_utf8_string(string? value)
+        {
+            String = value;
+            Utf8 = default;
+            IsUtf8 = false;
+        }
+
+        private ma_utf8_string(ReadOnlySpan<byte> value)
+        {
+            String = null;
+            Utf8 = value;
+            IsUtf8 = true;
+        }
+
+        public static implicit operator ma_utf8_string(string? value) => new ma_utf8_string(value);
+
+        public static implicit operator ma_utf8_string(ReadOnlySpan<byte> value) => new ma_utf8_string(value);
+
+        public static implicit operator ma_utf8_string(Span<byte> value) => new ma_utf8_string((ReadOnlySpan<byte>)value);
+
+        /// <summary>A null array passes a null pointer, like a null string.</summary>
+        public static implicit operator ma_utf8_string(byte[]? value) => (value == null) ? new ma_utf8_string((string?)null) : new ma_utf8_string(value.AsSpan());
+
+        /// <summary>The bytes up to and including the terminator are used as is. A null pointer stays null.</summary>
+        public static implicit operator ma_utf8_string(sbyte* value)
+        {
+            if (value == null)
+            {
+                return new ma_utf8_string((string?)null);
+            }
+
+            ReadOnlySpan<byte> bytes = MemoryMarshal.CreateReadOnlySpanFromNullTerminated((byte*)value);
+            return new ma_utf8_string(new ReadOnlySpan<byte>(value, bytes.Length + 1));
+        }
+    }
+
+    /// <summary>
+    /// A null terminated UTF-8 copy of a string for the functions that take a const char*. It's written to a buffer on
+    /// the caller's stack, or to one rented from ArrayPool&lt;byte&gt;.Shared when it doesn't fit, so converting doesn't
+    /// allocate. Pin it with fixed and dispose it after the call. The <see cref="ma_utf8_string" /> overloads that
+    /// postprocess.py generates into MiniaudioUtf8Overloads.cs are built on it.
+    /// </summary>
+    public readonly ref struct ma_utf8_buffer
+    {
+        /// <summary>Bytes to stackalloc for each string. Anything longer goes to the array pool.</summary>
+        public const int StackBufferSize = 512;
+
+        private readonly ReadOnlySpan<byte> _bytes;
+        private readonly byte[]? _rented;
+
+        /// <summary>Converts <paramref name="value" />. A null string pins as a null pointer.</summary>
+        public ma_utf8_buffer(string? value, Span<byte> stackBuffer)
+        {
+            _rented = null;
+
+            if (value == null)
+            {
+                _bytes = default;
+                return;
+            }
+
+            // The exact count costs a second pass, so only take it when the worst case doesn't fit.
+            Span<byte> buffer = stackBuffer;
+            if (Encoding.UTF8.GetMaxByteCount(value.Length) + 1 > buffer.Length)
+            {
+                int byteCount = Encoding.UTF8.GetByteCount(value) + 1;
+                if (byteCount > buffer.Length)
+                {
+                    _rented = ArrayPool<byte>.Shared.Rent(byteCount);
+                    buffer = _rented;
+                }
+            }
+
+            int written = Encoding.UTF8.GetBytes(value, buffer);
+            buffer[written] = 0;
+            _bytes = buffer.Slice(0, written + 1);
+        }
+
+        /// <summary>
+        /// Terminates <paramref name="value" />, which is already UTF-8, e.g. a "music.ogg"u8 literal. It's used as is
+        /// when its last byte is already 0.
+        /// </summary>
+        public ma_utf8_buffer(ReadOnlySpan<byte> value, Span<byte> stackBuffer)
+        {
+            _rented = null;
+
+            if (!value.IsEmpty && value[value.Length - 1] == 0)
+            {
+                _bytes = value;
+                return;
+            }
+
+            Span<byte> buffer = stackBuffer;
+            if (value.Length + 1 > buffer.Length)
+            {
+                _rented = ArrayPool<byte>.Shared.Rent(value.Length + 1);
+                buffer = _rented;
+            }
+
+            value.CopyTo(buffer);
+            buffer[value.Length] = 0;
+            _bytes = buffer.Slice(0, value.Length + 1);
+        }
+
+        /// <summary>Converts or terminates <paramref name="value" /> with the constructor for its kind of text.</summary>
+        public ma_utf8_buffer(ma_utf8_string value, Span<byte> stackBuffer)
+        {
+            this = value.IsUtf8 ? new ma_utf8_buffer(value.Utf8, stackBuffer) : new ma_utf8_buffer(value.String, stackBuffer);
+        }
+
+        public ref readonly byte GetPinnableReference()
+        {
+            return ref MemoryMarshal.GetReference(_bytes);
+        }
+
+        public void Dispose()
+        {
+            if (_rented != null)
+            {
+                ArrayPool<byte>.Shared.Return(_rented);
+            }
+        }
+    }
+}
@@ -0,0 +1,294 @@
+// Generated by GenerateBindings/postprocess.py from Miniaudio.cs. Don't edit it by hand.
+using System.Runtime.CompilerServices;
+
+namespace Miniaudio
+{
+    /// <summary>
+    /// Overloads of the functions that take a const char*, with an <see cref="ma_utf8_string" /> that a string or
+    /// UTF-8 bytes convert to. The text is converted into a null terminated UTF-8 <see cref="ma_utf8_buffer" /> on
+    /// the stack, so there's no heap allocation, and unlike Marshal.StringToHGlobalAnsi() nothing is lost on paths
+    /// outside the ANSI code page. A null or default argument still calls the sbyte* overload.
+    /// </summary>
+    public static unsafe partial class ma
+    {
+        [SkipLocalsInit]
+        public static ma_result log_post(ma_log* pLog, [NativeTypeName("ma_uint32")] uint level, ma_utf8_string pMessage)
+        {
+            using ma_utf8_buffer pMessageUtf8 = new ma_utf8_buffer(pMessage, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pMessageBytes = pMessageUtf8)
+            {
+                return log_post(pLog, level, (sbyte*)pMessageBytes);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result get_backend_from_name(ma_utf8_string pBackendName, ma_backend* pBackend)
+        {
+            using ma_utf8_buffer pBackendNameUtf8 = new ma_utf8_buffer(pBackendName, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pBackendNameBytes = pBackendNameUtf8)
+            {
+                return get_backend_from_name((sbyte*)pBackendNameBytes, pBackend);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result vfs_open([NativeTypeName("ma_vfs *")] void* pVFS, ma_utf8_string pFilePath, [NativeTypeName("ma_uint32")] uint openMode, [NativeTypeName("ma_vfs_file *")] void** pFile)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return vfs_open(pVFS, (sbyte*)pFilePathBytes, openMode, pFile);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result vfs_open_and_read_file([NativeTypeName("ma_vfs *")] void* pVFS, ma_utf8_string pFilePath, void** ppData, [NativeTypeName("size_t *")] nuint* pSize, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return vfs_open_and_read_file(pVFS, (sbyte*)pFilePathBytes, ppData, pSize, pAllocationCallbacks);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result decoder_init_vfs([NativeTypeName("ma_vfs *")] void* pVFS, ma_utf8_string pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return decoder_init_vfs(pVFS, (sbyte*)pFilePathBytes, pConfig, pDecoder);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result decoder_init_file(ma_utf8_string pFilePath, [NativeTypeName("const ma_decoder_config *")] ma_decoder_config* pConfig, ma_decoder* pDecoder)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return decoder_init_file((sbyte*)pFilePathBytes, pConfig, pDecoder);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result decode_from_vfs([NativeTypeName("ma_vfs *")] void* pVFS, ma_utf8_string pFilePath, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return decode_from_vfs(pVFS, (sbyte*)pFilePathBytes, pConfig, pFrameCountOut, ppPCMFramesOut);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result decode_file(ma_utf8_string pFilePath, ma_decoder_config* pConfig, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return decode_file((sbyte*)pFilePathBytes, pConfig, pFrameCountOut, ppPCMFramesOut);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result encoder_init_vfs([NativeTypeName("ma_vfs *")] void* pVFS, ma_utf8_string pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return encoder_init_vfs(pVFS, (sbyte*)pFilePathBytes, pConfig, pEncoder);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result encoder_init_file(ma_utf8_string pFilePath, [NativeTypeName("const ma_encoder_config *")] ma_encoder_config* pConfig, ma_encoder* pEncoder)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return encoder_init_file((sbyte*)pFilePathBytes, pConfig, pEncoder);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_register_file(ma_resource_manager* pResourceManager, ma_utf8_string pFilePath, [NativeTypeName("ma_uint32")] uint flags)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return resource_manager_register_file(pResourceManager, (sbyte*)pFilePathBytes, flags);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_register_decoded_data(ma_resource_manager* pResourceManager, ma_utf8_string pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("ma_uint64")] ulong frameCount, ma_format format, [NativeTypeName("ma_uint32")] uint channels, [NativeTypeName("ma_uint32")] uint sampleRate)
+        {
+            using ma_utf8_buffer pNameUtf8 = new ma_utf8_buffer(pName, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pNameBytes = pNameUtf8)
+            {
+                return resource_manager_register_decoded_data(pResourceManager, (sbyte*)pNameBytes, pData, frameCount, format, channels, sampleRate);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_register_encoded_data(ma_resource_manager* pResourceManager, ma_utf8_string pName, [NativeTypeName("const void *")] void* pData, [NativeTypeName("size_t")] nuint sizeInBytes)
+        {
+            using ma_utf8_buffer pNameUtf8 = new ma_utf8_buffer(pName, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pNameBytes = pNameUtf8)
+            {
+                return resource_manager_register_encoded_data(pResourceManager, (sbyte*)pNameBytes, pData, sizeInBytes);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_unregister_file(ma_resource_manager* pResourceManager, ma_utf8_string pFilePath)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return resource_manager_unregister_file(pResourceManager, (sbyte*)pFilePathBytes);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_unregister_data(ma_resource_manager* pResourceManager, ma_utf8_string pName)
+        {
+            using ma_utf8_buffer pNameUtf8 = new ma_utf8_buffer(pName, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pNameBytes = pNameUtf8)
+            {
+                return resource_manager_unregister_data(pResourceManager, (sbyte*)pNameBytes);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_data_buffer_init(ma_resource_manager* pResourceManager, ma_utf8_string pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_buffer* pDataBuffer)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return resource_manager_data_buffer_init(pResourceManager, (sbyte*)pFilePathBytes, flags, pNotifications, pDataBuffer);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_data_stream_init(ma_resource_manager* pResourceManager, ma_utf8_string pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_stream* pDataStream)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return resource_manager_data_stream_init(pResourceManager, (sbyte*)pFilePathBytes, flags, pNotifications, pDataStream);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result resource_manager_data_source_init(ma_resource_manager* pResourceManager, ma_utf8_string pName, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("const ma_resource_manager_pipeline_notifications *")] ma_resource_manager_pipeline_notifications* pNotifications, ma_resource_manager_data_source* pDataSource)
+        {
+            using ma_utf8_buffer pNameUtf8 = new ma_utf8_buffer(pName, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pNameBytes = pNameUtf8)
+            {
+                return resource_manager_data_source_init(pResourceManager, (sbyte*)pNameBytes, flags, pNotifications, pDataSource);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result engine_play_sound_ex(ma_engine* pEngine, ma_utf8_string pFilePath, [NativeTypeName("ma_node *")] void* pNode, [NativeTypeName("ma_uint32")] uint nodeInputBusIndex)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return engine_play_sound_ex(pEngine, (sbyte*)pFilePathBytes, pNode, nodeInputBusIndex);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result engine_play_sound(ma_engine* pEngine, ma_utf8_string pFilePath, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return engine_play_sound(pEngine, (sbyte*)pFilePathBytes, pGroup);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result sound_init_from_file(ma_engine* pEngine, ma_utf8_string pFilePath, [NativeTypeName("ma_uint32")] uint flags, [NativeTypeName("ma_sound_group *")] ma_sound* pGroup, ma_fence* pDoneFence, ma_sound* pSound)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return sound_init_from_file(pEngine, (sbyte*)pFilePathBytes, flags, pGroup, pDoneFence, pSound);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result ex_decoder_init_file(ma_utf8_string pFilePath, [NativeTypeName("const ma_ex_decoder_config *")] ma_ex_decoder_config* pConfig, ma_decoder* pDecoder)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return ex_decoder_init_file((sbyte*)pFilePathBytes, pConfig, pDecoder);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_encoding_format ex_get_encoding_format_from_file(ma_utf8_string pFilePath)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return ex_get_encoding_format_from_file((sbyte*)pFilePathBytes);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result ex_probe_file(ma_utf8_string pFilePath, [NativeTypeName("const ma_ex_probe_config *")] ma_ex_probe_config* pConfig, ma_ex_probe_info* pInfo)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return ex_probe_file((sbyte*)pFilePathBytes, pConfig, pInfo);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result libvorbis_init_file(ma_utf8_string pFilePath, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return libvorbis_init_file((sbyte*)pFilePathBytes, pConfig, pAllocationCallbacks, pVorbis);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result libvorbis_init_file_lazy(ma_utf8_string pFilePath, [NativeTypeName("const ma_decoding_backend_config *")] ma_decoding_backend_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, ma_libvorbis* pVorbis)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return libvorbis_init_file_lazy((sbyte*)pFilePathBytes, pConfig, pAllocationCallbacks, pVorbis);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result libvorbis_decode_file(ma_utf8_string pFilePath, ma_libvorbis_decode_config* pConfig, [NativeTypeName("const ma_allocation_callbacks *")] ma_allocation_callbacks* pAllocationCallbacks, [NativeTypeName("ma_uint64 *")] ulong* pFrameCountOut, void** ppPCMFramesOut)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return libvorbis_decode_file((sbyte*)pFilePathBytes, pConfig, pAllocationCallbacks, pFrameCountOut, ppPCMFramesOut);
+            }
+        }
+
+        [SkipLocalsInit]
+        public static ma_result libvorbis_register_decoded_file(ma_utf8_string pFilePath, ma_libvorbis_decode_config* pConfig, void** ppPCMFramesOut)
+        {
+            using ma_utf8_buffer pFilePathUtf8 = new ma_utf8_buffer(pFilePath, stackalloc byte[ma_utf8_buffer.StackBufferSize]);
+            fixed (byte* pFilePathBytes = pFilePathUtf8)
+            {
+                return libvorbis_register_decoded_file((sbyte*)pFilePathBytes, pConfig, ppPCMFramesOut);
+            }
+        }
+    }
+}
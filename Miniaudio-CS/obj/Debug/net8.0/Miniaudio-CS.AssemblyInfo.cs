@@ -0,0 +1,24 @@
+//------------------------------------------------------------------------------
+// <auto-generated>
+//     This code was generated by a tool.
+//
+//     Changes to this file may cause incorrect behavior and will be lost if
+//     the code is regenerated.
+// </auto-generated>
+//------------------------------------------------------------------------------
+
+using System;
+using System.Reflection;
+
+[assembly: System.Reflection.AssemblyCompanyAttribute("Estrol & NyaCube")]
+[assembly: System.Reflection.AssemblyConfigurationAttribute("Debug")]
+[assembly: System.Reflection.AssemblyDescriptionAttribute("Fork of C# bindings for miniaudio")]
+[assembly: System.Reflection.AssemblyFileVersionAttribute("1.1.0.0")]
+[assembly: System.Reflection.AssemblyInformationalVersionAttribute("1.1.0+8e2fb2c9b3d6b2a607c04ea6e2682bb78a9e56e7")]
+[assembly: System.Reflection.AssemblyProductAttribute("Miniaudio-CS")]
+[assembly: System.Reflection.AssemblyTitleAttribute("Miniaudio-CS")]
+[assembly: System.Reflection.AssemblyVersionAttribute("1.1.0.0")]
+[assembly: System.Reflection.AssemblyMetadataAttribute("RepositoryUrl", "https://github.com/estrol/Miniaudio-CS.git")]
+
+// Generated by the MSBuild WriteCodeFragment class.
+